@@ -0,0 +1,80 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/generic_cutting/batched_cutting.h"
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/moments/volume.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+struct CuboidProblem {
+  std::vector<RectangularCuboid> cuboids;
+  std::vector<PlanarSeparator> separators;
+  std::vector<Volume> volumes;
+};
+
+CuboidProblem generateCuboidProblem(const UnsignedIndex_t a_size) {
+  std::mt19937_64 eng(12345);
+  std::uniform_real_distribution<double> random_normal(-1.0, 1.0);
+  std::uniform_real_distribution<double> random_offset(-0.5, 0.5);
+  CuboidProblem problem;
+  problem.cuboids.resize(a_size);
+  problem.separators.resize(a_size);
+  problem.volumes.resize(a_size);
+  for (UnsignedIndex_t n = 0; n < a_size; ++n) {
+    const Pt lower(static_cast<double>(n), 0.0, 0.0);
+    problem.cuboids[n] =
+        RectangularCuboid::fromBoundingPts(lower, lower + Pt(1.0, 1.0, 1.0));
+    const Normal normal = Normal::normalized(
+        random_normal(eng), random_normal(eng), random_normal(eng));
+    problem.separators[n] = PlanarSeparator::fromOnePlane(
+        Plane(normal, normal * problem.cuboids[n].calculateCentroid() +
+                          random_offset(eng)));
+  }
+  return problem;
+}
+
+void BM_CuboidVolumeScalarLoop(benchmark::State& state) {
+  auto problem = generateCuboidProblem(state.range(0));
+  for (auto _ : state) {
+    for (std::size_t n = 0; n < problem.cuboids.size(); ++n) {
+      problem.volumes[n] = getNormalizedVolumeMoments<Volume>(
+          problem.cuboids[n], problem.separators[n]);
+    }
+    benchmark::DoNotOptimize(problem.volumes.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CuboidVolumeScalarLoop)->Arg(1 << 10)->Arg(1 << 16);
+
+void BM_CuboidVolumeBatched(benchmark::State& state) {
+  auto problem = generateCuboidProblem(state.range(0));
+  for (auto _ : state) {
+    getNormalizedVolumeMoments<Volume>(
+        problem.cuboids.data(), problem.separators.data(),
+        static_cast<UnsignedIndex_t>(problem.cuboids.size()),
+        problem.volumes.data());
+    benchmark::DoNotOptimize(problem.volumes.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CuboidVolumeBatched)->Arg(1 << 10)->Arg(1 << 16);
+
+}  // namespace
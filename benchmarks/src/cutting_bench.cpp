@@ -0,0 +1,68 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Cost of getVolumeMoments for every polyhedron type in
+// irl/geometry/polyhedrons, with each cutting method from
+// default_cutting_method.h, cut by one- and two-plane PlanarSeparators.
+// Benchmark names are BM_CutPolyhedron<Polyhedron, CuttingMethod>/planes:N.
+
+#include "benchmark/benchmark.h"
+
+#include "irl/generic_cutting/default_cutting_method.h"
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/helpers/cutting_samples.h"
+#include "irl/moments/volume_moments.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+// Number of separators cycled through so that branch prediction does not
+// learn a single cut configuration.
+constexpr UnsignedIndex_t number_of_separators = 256;
+
+template <class PolyhedronType, class CuttingMethod>
+void BM_CutPolyhedron(benchmark::State& state) {
+  const auto polyhedron = makeSamplePolyhedron<PolyhedronType>();
+  const auto separators = generateSampleSeparators(
+      polyhedron.calculateCentroid(), number_of_separators,
+      static_cast<UnsignedIndex_t>(state.range(0)));
+  UnsignedIndex_t n = 0;
+  for (auto _ : state) {
+    auto moments = getVolumeMoments<VolumeMoments, CuttingMethod>(
+        polyhedron, separators[n]);
+    benchmark::DoNotOptimize(moments);
+    n = (n + 1) % number_of_separators;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+#define IRL_CUTTING_BENCHMARK(PolyhedronType, CuttingMethod)           \
+  BENCHMARK_TEMPLATE(BM_CutPolyhedron, PolyhedronType, CuttingMethod) \
+      ->ArgName("planes")                                             \
+      ->Arg(1)                                                        \
+      ->Arg(2)
+
+#define IRL_CUTTING_BENCHMARKS(PolyhedronType)                    \
+  IRL_CUTTING_BENCHMARK(PolyhedronType, HalfEdgeCutting);         \
+  IRL_CUTTING_BENCHMARK(PolyhedronType, SimplexCutting);          \
+  IRL_CUTTING_BENCHMARK(PolyhedronType, RecursiveSimplexCutting)
+
+IRL_CUTTING_BENCHMARKS(RectangularCuboid);
+IRL_CUTTING_BENCHMARKS(Hexahedron);
+IRL_CUTTING_BENCHMARKS(Tet);
+IRL_CUTTING_BENCHMARKS(TriangularPrism);
+IRL_CUTTING_BENCHMARKS(Pyramid);
+IRL_CUTTING_BENCHMARKS(Octahedron);
+IRL_CUTTING_BENCHMARKS(Dodecahedron);
+IRL_CUTTING_BENCHMARKS(CappedDodecahedron);
+IRL_CUTTING_BENCHMARKS(Polyhedron24);
+
+}  // namespace
@@ -0,0 +1,182 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Per-cell cost of the ELVIRA, LVIRA, R2P and MOF reconstructions on
+// 3x3x3 stencils of unit cubes filled by random planes through the center
+// cell. Each benchmark iteration reconstructs one cell.
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/interface_reconstruction_methods/elvira_neighborhood.h"
+#include "irl/interface_reconstruction_methods/lvira_neighborhood.h"
+#include "irl/interface_reconstruction_methods/r2p_neighborhood.h"
+#include "irl/interface_reconstruction_methods/reconstruction_interface.h"
+#include "irl/moments/separated_volume_moments.h"
+#include "irl/moments/volume_moments.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+constexpr UnsignedIndex_t number_of_stencils = 64;
+
+// 3x3x3 stencil of unit cubes cut by one plane, with the center cell at
+// index 13 (i = j = k = 0) so it can be shared by every neighborhood type.
+struct Stencil {
+  explicit Stencil(const Plane& a_plane) {
+    const auto separator = PlanarSeparator::fromOnePlane(a_plane);
+    for (int k = -1; k <= 1; ++k) {
+      for (int j = -1; j <= 1; ++j) {
+        for (int i = -1; i <= 1; ++i) {
+          const UnsignedIndex_t n = static_cast<UnsignedIndex_t>(
+              (i + 1) + (j + 1) * 3 + (k + 1) * 9);
+          cells[n] = RectangularCuboid::fromBoundingPts(
+              Pt(i - 0.5, j - 0.5, k - 0.5), Pt(i + 0.5, j + 0.5, k + 0.5));
+          moments[n] =
+              getNormalizedVolumeMoments<SeparatedMoments<VolumeMoments>>(
+                  cells[n], separator);
+          volume_fractions[n] = moments[n][0].volume();
+        }
+      }
+    }
+  }
+
+  RectangularCuboid cells[27];
+  SeparatedMoments<VolumeMoments> moments[27];
+  double volume_fractions[27];
+};
+
+constexpr UnsignedIndex_t center = 13;
+
+// Stencils for planes with random orientation passing through the center
+// cell. The seed is fixed so runs are comparable.
+std::vector<Stencil> generateStencils(void) {
+  std::mt19937_64 eng(12345);
+  std::uniform_real_distribution<double> random_normal(-1.0, 1.0);
+  std::uniform_real_distribution<double> random_offset(-0.25, 0.25);
+  std::vector<Stencil> stencils;
+  stencils.reserve(number_of_stencils);
+  for (UnsignedIndex_t n = 0; n < number_of_stencils; ++n) {
+    const Normal normal = Normal::normalized(
+        random_normal(eng), random_normal(eng), random_normal(eng));
+    stencils.emplace_back(Plane(normal, random_offset(eng)));
+  }
+  return stencils;
+}
+
+// Initial guess for the optimization based methods, as a code would supply
+// it: normal from the phase centroids, distance matching the volume
+// fraction.
+PlanarSeparator initialGuess(const Stencil& a_stencil) {
+  const auto& center_moments = a_stencil.moments[center];
+  const Normal normal = Normal::fromPtNormalized(
+      center_moments[1].centroid() - center_moments[0].centroid());
+  PlanarSeparator guess = PlanarSeparator::fromOnePlane(Plane(normal, 0.0));
+  setDistanceToMatchVolumeFraction(a_stencil.cells[center],
+                                   a_stencil.volume_fractions[center], &guess);
+  return guess;
+}
+
+void BM_ELVIRA3D(benchmark::State& state) {
+  const auto stencils = generateStencils();
+  std::vector<ELVIRANeighborhood> neighborhoods(number_of_stencils);
+  for (UnsignedIndex_t s = 0; s < number_of_stencils; ++s) {
+    neighborhoods[s].resize(27);
+    for (int k = -1; k <= 1; ++k) {
+      for (int j = -1; j <= 1; ++j) {
+        for (int i = -1; i <= 1; ++i) {
+          const int n = (i + 1) + (j + 1) * 3 + (k + 1) * 9;
+          neighborhoods[s].setMember(&stencils[s].cells[n],
+                                     &stencils[s].volume_fractions[n], i, j,
+                                     k);
+        }
+      }
+    }
+  }
+  UnsignedIndex_t s = 0;
+  for (auto _ : state) {
+    auto reconstruction = reconstructionWithELVIRA3D(neighborhoods[s]);
+    benchmark::DoNotOptimize(reconstruction);
+    s = (s + 1) % number_of_stencils;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ELVIRA3D);
+
+void BM_LVIRA3D(benchmark::State& state) {
+  const auto stencils = generateStencils();
+  std::vector<LVIRANeighborhood<RectangularCuboid>> neighborhoods(
+      number_of_stencils);
+  std::vector<PlanarSeparator> guesses(number_of_stencils);
+  for (UnsignedIndex_t s = 0; s < number_of_stencils; ++s) {
+    neighborhoods[s].resize(27);
+    for (UnsignedIndex_t n = 0; n < 27; ++n) {
+      neighborhoods[s].setMember(n, &stencils[s].cells[n],
+                                 &stencils[s].volume_fractions[n]);
+    }
+    neighborhoods[s].setCenterOfStencil(center);
+    guesses[s] = initialGuess(stencils[s]);
+  }
+  UnsignedIndex_t s = 0;
+  for (auto _ : state) {
+    auto reconstruction =
+        reconstructionWithLVIRA3D(neighborhoods[s], guesses[s]);
+    benchmark::DoNotOptimize(reconstruction);
+    s = (s + 1) % number_of_stencils;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LVIRA3D);
+
+void BM_R2P3D(benchmark::State& state) {
+  const auto stencils = generateStencils();
+  std::vector<R2PNeighborhood<RectangularCuboid>> neighborhoods(
+      number_of_stencils);
+  std::vector<PlanarSeparator> guesses(number_of_stencils);
+  for (UnsignedIndex_t s = 0; s < number_of_stencils; ++s) {
+    neighborhoods[s].resize(27);
+    for (UnsignedIndex_t n = 0; n < 27; ++n) {
+      neighborhoods[s].setMember(n, &stencils[s].cells[n],
+                                 &stencils[s].moments[n]);
+    }
+    neighborhoods[s].setCenterOfStencil(center);
+    guesses[s] = initialGuess(stencils[s]);
+    neighborhoods[s].setSurfaceArea(
+        getReconstructionSurfaceArea(stencils[s].cells[center], guesses[s]));
+  }
+  UnsignedIndex_t s = 0;
+  for (auto _ : state) {
+    auto reconstruction = reconstructionWithR2P3D(neighborhoods[s], guesses[s]);
+    benchmark::DoNotOptimize(reconstruction);
+    s = (s + 1) % number_of_stencils;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_R2P3D);
+
+void BM_MOF3D(benchmark::State& state) {
+  const auto stencils = generateStencils();
+  UnsignedIndex_t s = 0;
+  for (auto _ : state) {
+    auto reconstruction = reconstructionWithMOF3D(
+        stencils[s].cells[center], stencils[s].moments[center]);
+    benchmark::DoNotOptimize(reconstruction);
+    s = (s + 1) % number_of_stencils;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MOF3D);
+
+}  // namespace
@@ -7,10 +7,14 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include "examples/advector/vof_advection.h"
 
+#include "irl/generic_cutting/flux_volume_computer.h"
 #include "irl/generic_cutting/generic_cutting.h"
 #include "irl/geometry/polyhedrons/rectangular_cuboid.h"
 
@@ -358,56 +362,52 @@ void SemiLagrangianCorrected::advectVOF(
       Data<IRL::SeparatedMoments<IRL::VolumeMoments>>(&mesh),
       Data<IRL::SeparatedMoments<IRL::VolumeMoments>>(&mesh),
       Data<IRL::SeparatedMoments<IRL::VolumeMoments>>(&mesh)};
-
-  // For now, naively advect everywhere in domain
+  // Gather the lower x, y, and z face of every cell, ordered so that the
+  // face normal points into the cell, with the volume the face velocity
+  // fluxes through it. Cutting starts from the cell's own link.
+  std::vector<IRL::Pt> face_vertices;
+  std::vector<double> flux_volumes;
+  std::vector<const IRL::LocalizedSeparatorLink*> starting_links;
   for (int i = mesh.imin(); i <= mesh.imax(); ++i) {
     for (int j = mesh.jmin(); j <= mesh.jmax(); ++j) {
       for (int k = mesh.kmin(); k <= mesh.kmax(); ++k) {
         auto cell = IRL::RectangularCuboid::fromBoundingPts(
             IRL::Pt(mesh.x(i), mesh.y(j), mesh.z(k)),
             IRL::Pt(mesh.x(i + 1), mesh.y(j + 1), mesh.z(k + 1)));
-        // Get the back projected Dodecahedron.
-        IRL::Dodecahedron transported_cell;
-        for (IRL::UnsignedIndex_t n = 0; n < 8; ++n) {
-          transported_cell[n] =
-              back_project_vertex(cell[n], -a_dt, a_U, a_V, a_W);
-        }
-        // Initialize face flux hexahedra
-        IRL::CappedDodecahedron face_cell[3];
-        IRL::Pt face_center_pt = 0.25 * (cell[7] + cell[4] + cell[5] + cell[6]);
-        IRL::Pt correction_pt =
-            back_project_vertex(face_center_pt, -a_dt, a_U, a_V, a_W);
-        face_cell[0] = IRL::CappedDodecahedron(
-            {cell[7], cell[4], cell[5], cell[6], transported_cell[7],
-             transported_cell[4], transported_cell[5], transported_cell[6],
-             correction_pt});
-        face_center_pt = 0.25 * (cell[0] + cell[4] + cell[7] + cell[3]);
-        correction_pt =
-            back_project_vertex(face_center_pt, -a_dt, a_U, a_V, a_W);
-        face_cell[1] = IRL::CappedDodecahedron(
-            {cell[0], cell[4], cell[7], cell[3], transported_cell[0],
-             transported_cell[4], transported_cell[7], transported_cell[3],
-             correction_pt});
-        face_center_pt = 0.25 * (cell[5] + cell[4] + cell[0] + cell[1]);
-        correction_pt =
-            back_project_vertex(face_center_pt, -a_dt, a_U, a_V, a_W);
-        face_cell[2] = IRL::CappedDodecahedron(
-            {cell[5], cell[4], cell[0], cell[1], transported_cell[5],
-             transported_cell[4], transported_cell[0], transported_cell[1],
-             correction_pt});
-        // Tack on the corrective 9th vertex for each face hexahedra
-        face_cell[0].adjustCapToMatchVolume(a_dt * U_face(i, j, k) * mesh.dy() *
-                                            mesh.dz());
-        face_cell[1].adjustCapToMatchVolume(a_dt * V_face(i, j, k) * mesh.dx() *
-                                            mesh.dz());
-        face_cell[2].adjustCapToMatchVolume(a_dt * W_face(i, j, k) * mesh.dx() *
-                                            mesh.dy());
+        face_vertices.insert(face_vertices.end(),
+                             {cell[7], cell[4], cell[5], cell[6], cell[0],
+                              cell[4], cell[7], cell[3], cell[5], cell[4],
+                              cell[0], cell[1]});
+        flux_volumes.insert(
+            flux_volumes.end(),
+            {a_dt * U_face(i, j, k) * mesh.dy() * mesh.dz(),
+             a_dt * V_face(i, j, k) * mesh.dx() * mesh.dz(),
+             a_dt * W_face(i, j, k) * mesh.dx() * mesh.dy()});
+        starting_links.insert(starting_links.end(),
+                              3, &(*a_link_localized_separator)(i, j, k));
+      }
+    }
+  }
 
+  // Build the flux volumes, with the corrective cap that matches the face
+  // velocity, and cut them by the reconstructions in bulk.
+  static IRL::FluxVolumeComputer flux_volume_computer(
+      std::max(1u, std::thread::hardware_concurrency()));
+  flux_volume_computer.computeFluxes(
+      static_cast<IRL::UnsignedIndex_t>(starting_links.size()),
+      face_vertices.data(),
+      [&](const IRL::Pt& a_pt) {
+        return back_project_vertex(a_pt, -a_dt, a_U, a_V, a_W);
+      },
+      flux_volumes.data(), starting_links.data());
+
+  const auto& fluxes = flux_volume_computer.getFaceFluxes();
+  std::size_t face = 0;
+  for (int i = mesh.imin(); i <= mesh.imax(); ++i) {
+    for (int j = mesh.jmin(); j <= mesh.jmax(); ++j) {
+      for (int k = mesh.kmin(); k <= mesh.kmax(); ++k) {
         for (int dim = 0; dim < 3; ++dim) {
-          // Store face flux
-          (face_flux[dim])(i, j, k) =
-              IRL::getVolumeMoments<IRL::SeparatedMoments<IRL::VolumeMoments>>(
-                  face_cell[dim], (*a_link_localized_separator)(i, j, k));
+          (face_flux[dim])(i, j, k) = fluxes[face++];
         }
       }
     }
@@ -603,9 +603,14 @@ class StaticVector {
       const auto old_size = m_size;
       m_size = count;
       for (auto i = old_size; i < m_size; ++i) {
-        (*this)[i] = Element{};
+        new (m_storage.data() + i) Element{};
       }
     } else {
+      if constexpr (!std::is_trivially_destructible_v<Element>) {
+        for (size_type i = count; i < m_size; ++i) {
+          std::destroy_at(m_storage.data() + i);
+        }
+      }
       m_size = count;
     }
   }
@@ -617,9 +622,14 @@ class StaticVector {
       const auto old_size = m_size;
       m_size = count;
       for (auto i = old_size; i < m_size; ++i) {
-        (*this)[i] = value;
+        new (m_storage.data() + i) Element(value);
       }
     } else {
+      if constexpr (!std::is_trivially_destructible_v<Element>) {
+        for (size_type i = count; i < m_size; ++i) {
+          std::destroy_at(m_storage.data() + i);
+        }
+      }
       m_size = count;
     }
   }
@@ -9,7 +9,9 @@
 
 #include "irl/c_interface/data_structures/c_object_allocation_server_localized_separator.h"
 
+#include <algorithm>
 #include <cassert>
+#include <thread>
 
 extern "C" {
 
@@ -17,12 +19,22 @@ void c_ObjServer_LocSep_new(
     c_ObjServer_LocSep* a_self,
     const IRL::LargeOffsetIndex_t* a_number_to_allocate) {
   assert(a_self->obj_ptr == nullptr);
-  a_self->obj_ptr = new IRL::ObjectAllocationServer<IRL::LocalizedSeparator>(
-      *a_number_to_allocate);
+  using ServerType =
+      IRL::ConcurrentObjectAllocationServer<IRL::LocalizedSeparator>;
+  // Leave room for a partially used slab on every hardware thread.
+  const IRL::LargeOffsetIndex_t number_of_threads =
+      std::max(1u, std::thread::hardware_concurrency());
+  a_self->obj_ptr = new ServerType(
+      ServerType::capacityWithSlack(*a_number_to_allocate, number_of_threads));
 }
 
 void c_ObjServer_LocSep_delete(c_ObjServer_LocSep* a_self) {
   delete a_self->obj_ptr;
   a_self->obj_ptr = nullptr;
 }
+
+void c_ObjServer_LocSep_reset(c_ObjServer_LocSep* a_self) {
+  assert(a_self->obj_ptr != nullptr);
+  a_self->obj_ptr->reset();
+}
 }
@@ -10,19 +10,25 @@
 #ifndef IRL_C_INTERFACE_DATA_STRUCTURES_C_OBJECT_ALLOCATION_SERVER_LOCALIZED_SEPARATOR_LINK_H_
 #define IRL_C_INTERFACE_DATA_STRUCTURES_C_OBJECT_ALLOCATION_SERVER_LOCALIZED_SEPARATOR_LINK_H_
 
-#include "irl/data_structures/object_allocation_server.h"
+#include "irl/data_structures/concurrent_object_allocation_server.h"
 #include "irl/planar_reconstruction/localized_separator_link.h"
 
 extern "C" {
 
 struct c_ObjServer_LocSepLink {
-  IRL::ObjectAllocationServer<IRL::LocalizedSeparatorLink>* obj_ptr = nullptr;
+  IRL::ConcurrentObjectAllocationServer<IRL::LocalizedSeparatorLink>* obj_ptr =
+      nullptr;
 };
 
+// Storage for a partially used slab per hardware thread is added to
+// a_number_to_allocate, so that a_number_to_allocate objects can be
+// served when allocating from several threads.
 void c_ObjServer_LocSepLink_new(c_ObjServer_LocSepLink* a_self,
                                 const std::size_t* a_number_to_allocate);
 
 void c_ObjServer_LocSepLink_delete(c_ObjServer_LocSepLink* a_self);
+
+void c_ObjServer_LocSepLink_reset(c_ObjServer_LocSepLink* a_self);
 }
 
 #endif // IRL_C_INTERFACE_DATA_STRUCTURES_C_OBJECT_ALLOCATION_SERVER_LOCALIZED_SEPARATOR_LINK_H_
@@ -10,19 +10,24 @@
 #ifndef IRL_C_INTERFACE_DATA_STRUCTURES_C_OBJECT_ALLOCATION_SERVER_LOCALIZER_LINK_H_
 #define IRL_C_INTERFACE_DATA_STRUCTURES_C_OBJECT_ALLOCATION_SERVER_LOCALIZER_LINK_H_
 
-#include "irl/data_structures/object_allocation_server.h"
+#include "irl/data_structures/concurrent_object_allocation_server.h"
 #include "irl/planar_reconstruction/localizer_link.h"
 
 extern "C" {
 
 struct c_ObjServer_LocLink {
-  IRL::ObjectAllocationServer<IRL::LocalizerLink>* obj_ptr = nullptr;
+  IRL::ConcurrentObjectAllocationServer<IRL::LocalizerLink>* obj_ptr = nullptr;
 };
 
+// Storage for a partially used slab per hardware thread is added to
+// a_number_to_allocate, so that a_number_to_allocate objects can be
+// served when allocating from several threads.
 void c_ObjServer_LocLink_new(c_ObjServer_LocLink* a_self,
                              const std::size_t* a_number_to_allocate);
 
 void c_ObjServer_LocLink_delete(c_ObjServer_LocLink* a_self);
+
+void c_ObjServer_LocLink_reset(c_ObjServer_LocLink* a_self);
 }
 
 #endif // IRL_C_INTERFACE_DATA_STRUCTURES_C_OBJECT_ALLOCATION_SERVER_LOCALIZER_LINK_H_
@@ -10,19 +10,25 @@
 #ifndef IRL_C_INTERFACE_DATA_STRUCTURES_C_OBJECT_ALLOCATION_SERVER_PLANAR_LOCALIZER_H_
 #define IRL_C_INTERFACE_DATA_STRUCTURES_C_OBJECT_ALLOCATION_SERVER_PLANAR_LOCALIZER_H_
 
-#include "irl/data_structures/object_allocation_server.h"
+#include "irl/data_structures/concurrent_object_allocation_server.h"
 #include "irl/planar_reconstruction/planar_localizer.h"
 
 extern "C" {
 
 struct c_ObjServer_PlanarLoc {
-  IRL::ObjectAllocationServer<IRL::PlanarLocalizer>* obj_ptr = nullptr;
+  IRL::ConcurrentObjectAllocationServer<IRL::PlanarLocalizer>* obj_ptr =
+      nullptr;
 };
 
+// Storage for a partially used slab per hardware thread is added to
+// a_number_to_allocate, so that a_number_to_allocate objects can be
+// served when allocating from several threads.
 void c_ObjServer_PlanarLoc_new(c_ObjServer_PlanarLoc* a_self,
                                const std::size_t* a_number_to_allocate);
 
 void c_ObjServer_PlanarLoc_delete(c_ObjServer_PlanarLoc* a_self);
+
+void c_ObjServer_PlanarLoc_reset(c_ObjServer_PlanarLoc* a_self);
 }
 
 #endif // IRL_C_INTERFACE_DATA_STRUCTURES_C_OBJECT_ALLOCATION_SERVER_PLANAR_LOCALIZER_H_
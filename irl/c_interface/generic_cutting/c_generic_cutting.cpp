@@ -9,7 +9,15 @@
 
 #include "irl/c_interface/generic_cutting/c_generic_cutting.h"
 
+#include <algorithm>
 #include <cassert>
+#include <memory>
+#include <vector>
+
+#include "irl/generic_cutting/batched_cutting.h"
+#include "irl/generic_cutting/cutting_method_table.h"
+#include "irl/generic_cutting/cutting_method_tuner.h"
+#include "irl/helpers/work_stealing_thread_pool.h"
 
 namespace IRL {
 
@@ -17,6 +25,7 @@ enum class c_RuntimeCuttingMethod {
   RecursiveSimplexCutting = 0,
   HalfEdgeCutting = 1,
   SimplexCutting = 2,
+  AutoTunedCutting = 3,
 };
 
 #ifdef C_STATIC_CUTTING
@@ -38,6 +47,17 @@ static ReturnType c_RuntimegetMoments(
       a_encompassing_polytope, a_reconstruction);
 }
 
+template <class ReturnType, class EncompassingType, class ReconstructionType>
+static void c_RuntimegetNormMomentsBatch(
+    const EncompassingType* a_encompassing_polytopes,
+    const ReconstructionType* a_reconstructions,
+    const UnsignedIndex_t a_number_of_cells, ReturnType* a_moments,
+    const c_RuntimeCuttingMethod& a_cutting_method) {
+  IRL::getNormalizedVolumeMoments<ReturnType, DefaultCuttingMethod>(
+      a_encompassing_polytopes, a_reconstructions, a_number_of_cells,
+      a_moments);
+}
+
 #else   // C_STATIC_CUTTING not defined
 template <class ReturnType, class EncompassingType, class ReconstructionType>
 static ReturnType c_RuntimegetNormMoments(
@@ -57,6 +77,10 @@ static ReturnType c_RuntimegetNormMoments(
     case c_RuntimeCuttingMethod::SimplexCutting:
       return IRL::getNormalizedVolumeMoments<ReturnType, SimplexCutting>(
           a_encompassing_polytope, a_reconstruction);
+
+    case c_RuntimeCuttingMethod::AutoTunedCutting:
+      return IRL::getNormalizedVolumeMoments<ReturnType, AutoTunedCutting>(
+          a_encompassing_polytope, a_reconstruction);
     default:
       std::cout << "During call to cutting: Unkown cutting method required for "
                    "getNormalizedVolumeMoments in "
@@ -83,6 +107,49 @@ static ReturnType c_RuntimegetMoments(
     case c_RuntimeCuttingMethod::SimplexCutting:
       return IRL::getVolumeMoments<ReturnType, SimplexCutting>(
           a_encompassing_polytope, a_reconstruction);
+
+    case c_RuntimeCuttingMethod::AutoTunedCutting:
+      return IRL::getVolumeMoments<ReturnType, AutoTunedCutting>(
+          a_encompassing_polytope, a_reconstruction);
+    default:
+      std::cout << "During call to cutting: Unkown cutting method required for "
+                   "getNormalizedVolumeMoments in "
+                   "the C/Fortran interface."
+                << std::endl;
+      std::exit(-1);
+  }
+}
+
+template <class ReturnType, class EncompassingType, class ReconstructionType>
+static void c_RuntimegetNormMomentsBatch(
+    const EncompassingType* a_encompassing_polytopes,
+    const ReconstructionType* a_reconstructions,
+    const UnsignedIndex_t a_number_of_cells, ReturnType* a_moments,
+    const c_RuntimeCuttingMethod& a_cutting_method) {
+  switch (a_cutting_method) {
+    case c_RuntimeCuttingMethod::RecursiveSimplexCutting:
+      IRL::getNormalizedVolumeMoments<ReturnType, RecursiveSimplexCutting>(
+          a_encompassing_polytopes, a_reconstructions, a_number_of_cells,
+          a_moments);
+      break;
+
+    case c_RuntimeCuttingMethod::HalfEdgeCutting:
+      IRL::getNormalizedVolumeMoments<ReturnType, HalfEdgeCutting>(
+          a_encompassing_polytopes, a_reconstructions, a_number_of_cells,
+          a_moments);
+      break;
+
+    case c_RuntimeCuttingMethod::SimplexCutting:
+      IRL::getNormalizedVolumeMoments<ReturnType, SimplexCutting>(
+          a_encompassing_polytopes, a_reconstructions, a_number_of_cells,
+          a_moments);
+      break;
+
+    case c_RuntimeCuttingMethod::AutoTunedCutting:
+      IRL::getNormalizedVolumeMoments<ReturnType, AutoTunedCutting>(
+          a_encompassing_polytopes, a_reconstructions, a_number_of_cells,
+          a_moments);
+      break;
     default:
       std::cout << "During call to cutting: Unkown cutting method required for "
                    "getNormalizedVolumeMoments in "
@@ -114,11 +181,169 @@ c_getCompiledDefaultCuttingMethod<SimplexCutting>(void) {
   return c_RuntimeCuttingMethod::SimplexCutting;
 }
 
+template <>
+constexpr c_RuntimeCuttingMethod
+c_getCompiledDefaultCuttingMethod<AutoTunedCutting>(void) {
+  return c_RuntimeCuttingMethod::AutoTunedCutting;
+}
+
 // Initialize C_CUTTING_METHOD with the default cutting method in
 // src/generic_cutting/default_cutting_method.h
 static IRL::c_RuntimeCuttingMethod C_CUTTING_METHOD =
     c_getCompiledDefaultCuttingMethod<DefaultCuttingMethod>();
 
+// Pool the c_getNormMomentsBatch functions run on, created on first use.
+static std::unique_ptr<WorkStealingThreadPool> C_BATCH_THREAD_POOL;
+
+// Cells a thread takes from a batch at a time. A multiple of
+// kBatchedCuttingLaneWidth, so that blocks fill the vectorized kernels.
+static constexpr UnsignedIndex_t C_BATCH_BLOCK_SIZE =
+    8 * kBatchedCuttingLaneWidth;
+
+static WorkStealingThreadPool& c_getBatchThreadPool(void) {
+  if (C_BATCH_THREAD_POOL == nullptr) {
+    C_BATCH_THREAD_POOL.reset(new WorkStealingThreadPool(1));
+  }
+  return *C_BATCH_THREAD_POOL;
+}
+
+// Layout of the moments returned by the batch functions.
+template <class ReturnType>
+struct c_FlatMoments;
+
+template <>
+struct c_FlatMoments<Volume> {
+  static constexpr UnsignedIndex_t size = 1;
+  static void store(const Volume& a_moments, double* a_flat_moments) {
+    a_flat_moments[0] = static_cast<double>(a_moments);
+  }
+};
+
+template <>
+struct c_FlatMoments<SeparatedMoments<VolumeMoments>> {
+  static constexpr UnsignedIndex_t size = 8;
+  static void store(const SeparatedMoments<VolumeMoments>& a_moments,
+                    double* a_flat_moments) {
+    for (UnsignedIndex_t phase = 0; phase < 2; ++phase) {
+      double* phase_moments = a_flat_moments + 4 * phase;
+      phase_moments[0] = a_moments[phase].volume();
+      for (UnsignedIndex_t d = 0; d < 3; ++d) {
+        phase_moments[d + 1] = a_moments[phase].centroid()[d];
+      }
+    }
+  }
+};
+
+static void c_loadPlanarSeparator(const int a_number_of_planes,
+                                  const double* a_planes,
+                                  PlanarSeparator* a_separator) {
+  assert(a_number_of_planes >= 0);
+  assert(a_number_of_planes <=
+         static_cast<int>(global_constants::MAX_PLANAR_SEPARATOR_PLANES));
+  const auto number_of_planes =
+      static_cast<UnsignedIndex_t>(a_number_of_planes);
+  a_separator->setNumberOfPlanes(number_of_planes);
+  for (UnsignedIndex_t p = 0; p < number_of_planes; ++p) {
+    (*a_separator)[p] = Plane(Normal::fromRawDoublePointer(a_planes + 4 * p),
+                              a_planes[4 * p + 3]);
+  }
+  a_separator->doNotFlipCutting();
+}
+
+// Cut each cell of a batch by its PlanarSeparator, one block of cells per
+// task. The polytopes and separators of a block are built in storage kept
+// per thread, and cut together by the batched getNormalizedVolumeMoments.
+template <class ReturnType, class EncompassingType>
+static void c_getNormMomentsBatchByPlanarSep(const int* a_number_of_cells,
+                                             const double* a_vertices,
+                                             const int* a_max_planes,
+                                             const int* a_number_of_planes,
+                                             const double* a_planes,
+                                             double* a_moments_to_return) {
+  assert(a_number_of_cells != nullptr);
+  assert(*a_number_of_cells >= 0);
+  assert(a_max_planes != nullptr);
+  assert(*a_max_planes >= 0);
+  const auto number_of_cells = static_cast<UnsignedIndex_t>(*a_number_of_cells);
+  const auto max_planes = static_cast<UnsignedIndex_t>(*a_max_planes);
+  constexpr UnsignedIndex_t number_of_vertices =
+      EncompassingType::getNumberOfVerticesInObject();
+  constexpr UnsignedIndex_t moments_size = c_FlatMoments<ReturnType>::size;
+  const UnsignedIndex_t number_of_blocks =
+      (number_of_cells + C_BATCH_BLOCK_SIZE - 1) / C_BATCH_BLOCK_SIZE;
+  // Checked here, before any thread writes past the end of a separator.
+  const int supported_planes = static_cast<int>(
+      std::min(max_planes, global_constants::MAX_PLANAR_SEPARATOR_PLANES));
+  for (UnsignedIndex_t cell = 0; cell < number_of_cells; ++cell) {
+    if (a_number_of_planes[cell] < 0 ||
+        a_number_of_planes[cell] > supported_planes) {
+      std::cout << "During batched call to cutting: cell " << cell
+                << " has " << a_number_of_planes[cell]
+                << " planes, but between 0 and " << supported_planes
+                << " are supported in the C/Fortran interface." << std::endl;
+      std::exit(-1);
+    }
+  }
+  const c_RuntimeCuttingMethod cutting_method = C_CUTTING_METHOD;
+  c_getBatchThreadPool().parallelFor(
+      number_of_blocks, 1,
+      [&](const UnsignedIndex_t a_block, const UnsignedIndex_t) {
+        thread_local static std::vector<EncompassingType> polytopes;
+        thread_local static std::vector<PlanarSeparator> separators;
+        thread_local static std::vector<ReturnType> moments;
+        const UnsignedIndex_t first_cell = a_block * C_BATCH_BLOCK_SIZE;
+        const UnsignedIndex_t block_size =
+            std::min(C_BATCH_BLOCK_SIZE, number_of_cells - first_cell);
+        polytopes.resize(block_size);
+        separators.resize(block_size);
+        moments.resize(block_size);
+        for (UnsignedIndex_t n = 0; n < block_size; ++n) {
+          const UnsignedIndex_t cell = first_cell + n;
+          polytopes[n] = EncompassingType::fromRawDoublePointer(
+              number_of_vertices, a_vertices + 3 * number_of_vertices * cell);
+          c_loadPlanarSeparator(a_number_of_planes[cell],
+                                a_planes + 4 * max_planes * cell,
+                                &separators[n]);
+        }
+        c_RuntimegetNormMomentsBatch(polytopes.data(), separators.data(),
+                                     block_size, moments.data(),
+                                     cutting_method);
+        for (UnsignedIndex_t n = 0; n < block_size; ++n) {
+          c_FlatMoments<ReturnType>::store(
+              moments[n],
+              a_moments_to_return + moments_size * (first_cell + n));
+        }
+      });
+}
+
+// Cut each cell of a batch by its LocalizedSeparatorLink. The links form a
+// graph and cannot be copied into a block, so each cell is cut on its own.
+template <class ReturnType, class EncompassingType>
+static void c_getNormMomentsBatchByLocSepLink(
+    const int* a_number_of_cells, const double* a_vertices,
+    const c_LocSepLink* a_localized_separator_links,
+    double* a_moments_to_return) {
+  assert(a_number_of_cells != nullptr);
+  assert(*a_number_of_cells >= 0);
+  const auto number_of_cells = static_cast<UnsignedIndex_t>(*a_number_of_cells);
+  constexpr UnsignedIndex_t number_of_vertices =
+      EncompassingType::getNumberOfVerticesInObject();
+  constexpr UnsignedIndex_t moments_size = c_FlatMoments<ReturnType>::size;
+  const c_RuntimeCuttingMethod cutting_method = C_CUTTING_METHOD;
+  c_getBatchThreadPool().parallelFor(
+      number_of_cells, C_BATCH_BLOCK_SIZE,
+      [&](const UnsignedIndex_t a_cell, const UnsignedIndex_t) {
+        assert(a_localized_separator_links[a_cell].obj_ptr != nullptr);
+        const auto polytope = EncompassingType::fromRawDoublePointer(
+            number_of_vertices, a_vertices + 3 * number_of_vertices * a_cell);
+        c_FlatMoments<ReturnType>::store(
+            c_RuntimegetNormMoments<ReturnType>(
+                polytope, *a_localized_separator_links[a_cell].obj_ptr,
+                cutting_method),
+            a_moments_to_return + moments_size * a_cell);
+      });
+}
+
 }  // namespace IRL
 
 extern "C" {
@@ -145,6 +370,9 @@ void c_getMoments_setMethod(const int* a_cutting_method) {
     case 2:
       IRL::C_CUTTING_METHOD = IRL::c_RuntimeCuttingMethod::SimplexCutting;
       break;
+    case 3:
+      IRL::C_CUTTING_METHOD = IRL::c_RuntimeCuttingMethod::AutoTunedCutting;
+      break;
     default:
       std::cout
           << "Unkown cutting method required for getNormalizedVolumeMoments in "
@@ -155,6 +383,30 @@ void c_getMoments_setMethod(const int* a_cutting_method) {
 }
 #endif  // C_STATIC_CUTTING
 
+void c_getMoments_calibrateMethods(void) { IRL::calibrateCuttingMethods(); }
+
+bool c_getMoments_saveMethodTable(const char* a_file_name) {
+  return IRL::CuttingMethodTable::getTable().save(a_file_name);
+}
+
+bool c_getMoments_loadMethodTable(const char* a_file_name) {
+  return IRL::CuttingMethodTable::getTable().load(a_file_name);
+}
+
+void c_getMoments_setNumberOfThreads(const int* a_number_of_threads) {
+  assert(a_number_of_threads != nullptr);
+  const auto number_of_threads = static_cast<IRL::UnsignedIndex_t>(
+      std::max(*a_number_of_threads, 1));
+  if (IRL::c_getBatchThreadPool().getNumberOfThreads() != number_of_threads) {
+    IRL::C_BATCH_THREAD_POOL.reset(
+        new IRL::WorkStealingThreadPool(number_of_threads));
+  }
+}
+
+int c_getMoments_getNumberOfThreads(void) {
+  return static_cast<int>(IRL::c_getBatchThreadPool().getNumberOfThreads());
+}
+
 void c_getNormMoments_Dod_LocSepLink_SepVM(
     const c_Dod* a_dodecahedron, const c_LocSepLink* a_localized_separator_link,
     c_SepVM* a_moments_to_return) {
@@ -1793,4 +2045,70 @@ void c_getNormMoments_CapDod_TTTT_LocSep_SepVol(
           IRL::C_CUTTING_METHOD);
 }
 
+void c_getNormMomentsBatch_RectCub_PlanarSep_Vol(
+    const int* a_number_of_cells, const double* a_vertices,
+    const int* a_max_planes, const int* a_number_of_planes,
+    const double* a_planes, double* a_moments_to_return) {
+  IRL::c_getNormMomentsBatchByPlanarSep<IRL::Volume, IRL::RectangularCuboid>(
+      a_number_of_cells, a_vertices, a_max_planes, a_number_of_planes,
+      a_planes, a_moments_to_return);
+}
+
+void c_getNormMomentsBatch_Tet_PlanarSep_Vol(
+    const int* a_number_of_cells, const double* a_vertices,
+    const int* a_max_planes, const int* a_number_of_planes,
+    const double* a_planes, double* a_moments_to_return) {
+  IRL::c_getNormMomentsBatchByPlanarSep<IRL::Volume, IRL::Tet>(
+      a_number_of_cells, a_vertices, a_max_planes, a_number_of_planes,
+      a_planes, a_moments_to_return);
+}
+
+void c_getNormMomentsBatch_Hex_PlanarSep_Vol(
+    const int* a_number_of_cells, const double* a_vertices,
+    const int* a_max_planes, const int* a_number_of_planes,
+    const double* a_planes, double* a_moments_to_return) {
+  IRL::c_getNormMomentsBatchByPlanarSep<IRL::Volume, IRL::Hexahedron>(
+      a_number_of_cells, a_vertices, a_max_planes, a_number_of_planes,
+      a_planes, a_moments_to_return);
+}
+
+void c_getNormMomentsBatch_Hex_PlanarSep_SepVM(
+    const int* a_number_of_cells, const double* a_vertices,
+    const int* a_max_planes, const int* a_number_of_planes,
+    const double* a_planes, double* a_moments_to_return) {
+  IRL::c_getNormMomentsBatchByPlanarSep<
+      IRL::SeparatedMoments<IRL::VolumeMoments>, IRL::Hexahedron>(
+      a_number_of_cells, a_vertices, a_max_planes, a_number_of_planes,
+      a_planes, a_moments_to_return);
+}
+
+void c_getNormMomentsBatch_Dod_PlanarSep_SepVM(
+    const int* a_number_of_cells, const double* a_vertices,
+    const int* a_max_planes, const int* a_number_of_planes,
+    const double* a_planes, double* a_moments_to_return) {
+  IRL::c_getNormMomentsBatchByPlanarSep<
+      IRL::SeparatedMoments<IRL::VolumeMoments>, IRL::Dodecahedron>(
+      a_number_of_cells, a_vertices, a_max_planes, a_number_of_planes,
+      a_planes, a_moments_to_return);
+}
+
+void c_getNormMomentsBatch_Dod_LocSepLink_Vol(
+    const int* a_number_of_cells, const double* a_vertices,
+    const c_LocSepLink* a_localized_separator_links,
+    double* a_moments_to_return) {
+  IRL::c_getNormMomentsBatchByLocSepLink<IRL::Volume, IRL::Dodecahedron>(
+      a_number_of_cells, a_vertices, a_localized_separator_links,
+      a_moments_to_return);
+}
+
+void c_getNormMomentsBatch_Dod_LocSepLink_SepVM(
+    const int* a_number_of_cells, const double* a_vertices,
+    const c_LocSepLink* a_localized_separator_links,
+    double* a_moments_to_return) {
+  IRL::c_getNormMomentsBatchByLocSepLink<
+      IRL::SeparatedMoments<IRL::VolumeMoments>, IRL::Dodecahedron>(
+      a_number_of_cells, a_vertices, a_localized_separator_links,
+      a_moments_to_return);
+}
+
 }  // end extern C
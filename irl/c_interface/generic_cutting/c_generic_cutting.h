@@ -81,8 +81,32 @@ extern "C" {
 /// - 0 : RecursiveSimplexCutting
 /// - 1 : HalfEdgeCutting
 /// - 2 : SimplexCutting
+/// - 3 : AutoTunedCutting
 void c_getMoments_setMethod(const int* a_cutting_method);
 
+/// \brief Time the cutting methods on each polyhedron type cut by a
+/// PlanarSeparator and store the fastest for use by AutoTunedCutting
+/// (cutting method 3). Other combinations, such as cutting by a
+/// LocalizedSeparatorLink, keep using HalfEdgeCutting.
+void c_getMoments_calibrateMethods(void);
+
+/// \brief Write the methods selected by calibration to the file
+/// `a_file_name`, returning whether it succeeded.
+bool c_getMoments_saveMethodTable(const char* a_file_name);
+
+/// \brief Read methods written by c_getMoments_saveMethodTable from the
+/// file `a_file_name`, returning whether it succeeded.
+bool c_getMoments_loadMethodTable(const char* a_file_name);
+
+/// \brief Set the number of threads (at least one) that the
+/// c_getNormMomentsBatch functions share their cells between. Batches run
+/// on the calling thread alone until this is called.
+void c_getMoments_setNumberOfThreads(const int* a_number_of_threads);
+
+/// \brief Return the number of threads used by the c_getNormMomentsBatch
+/// functions.
+int c_getMoments_getNumberOfThreads(void);
+
 void c_getNormMoments_Dod_LocSepLink_SepVM(
     const c_Dod* a_Dod, const c_LocSepLink* a_localized_separator_link,
     c_SepVM* a_moments_to_return);
@@ -583,6 +607,65 @@ void c_getNormMoments_CapDod_TTTT_LocSep_SepVol(
     const c_CapDod_TTTT* a_poly, const c_LocSep* a_localized_separator,
     c_SepVol* a_moments_to_return);
 
+/// \brief Batched versions of the c_getNormMoments functions, which compute
+/// the normalized moments of `a_number_of_cells` cells in one call from
+/// flat arrays instead of one object per cell.
+///
+/// - `a_vertices` holds the vertices of each cell in the order expected by
+/// the `construct` function of its polytope, with 3 doubles per vertex,
+/// i.e. 24 doubles per cell for a RectCub, Hex or Dod and 12 for a Tet.
+/// - A PlanarSeparator is given by `a_number_of_planes[n]` planes stored
+/// from `a_planes[4 * a_max_planes * n]`, each as its normal followed by
+/// its distance, as returned by c_PlanarSep_getPlane. These separators are
+/// not flipped. A cell with more planes than `a_max_planes` or than a
+/// PlanarSeparator can hold is reported and the program exits.
+/// - A LocalizedSeparatorLink is given by an element of an array of
+/// c_LocSepLink handles.
+/// - Volumes are returned as 1 double per cell. SeparatedMoments<VM> are
+/// returned as 8 doubles per cell: the liquid volume and centroid followed
+/// by the gas volume and centroid.
+///
+/// The cells are shared between the threads set by
+/// c_getMoments_setNumberOfThreads, and are cut by the method set by
+/// c_getMoments_setMethod. A RectCub cut by a single plane is processed
+/// several cells at a time with the vectorized kernel of
+/// src/generic_cutting/batched_cutting.h. Batch calls must not be made
+/// concurrently.
+void c_getNormMomentsBatch_RectCub_PlanarSep_Vol(
+    const int* a_number_of_cells, const double* a_vertices,
+    const int* a_max_planes, const int* a_number_of_planes,
+    const double* a_planes, double* a_moments_to_return);
+
+void c_getNormMomentsBatch_Tet_PlanarSep_Vol(
+    const int* a_number_of_cells, const double* a_vertices,
+    const int* a_max_planes, const int* a_number_of_planes,
+    const double* a_planes, double* a_moments_to_return);
+
+void c_getNormMomentsBatch_Hex_PlanarSep_Vol(
+    const int* a_number_of_cells, const double* a_vertices,
+    const int* a_max_planes, const int* a_number_of_planes,
+    const double* a_planes, double* a_moments_to_return);
+
+void c_getNormMomentsBatch_Hex_PlanarSep_SepVM(
+    const int* a_number_of_cells, const double* a_vertices,
+    const int* a_max_planes, const int* a_number_of_planes,
+    const double* a_planes, double* a_moments_to_return);
+
+void c_getNormMomentsBatch_Dod_PlanarSep_SepVM(
+    const int* a_number_of_cells, const double* a_vertices,
+    const int* a_max_planes, const int* a_number_of_planes,
+    const double* a_planes, double* a_moments_to_return);
+
+void c_getNormMomentsBatch_Dod_LocSepLink_Vol(
+    const int* a_number_of_cells, const double* a_vertices,
+    const c_LocSepLink* a_localized_separator_links,
+    double* a_moments_to_return);
+
+void c_getNormMomentsBatch_Dod_LocSepLink_SepVM(
+    const int* a_number_of_cells, const double* a_vertices,
+    const c_LocSepLink* a_localized_separator_links,
+    double* a_moments_to_return);
+
 }  // end extern C
 
 #endif  // IRL_C_INTERFACE_GENERIC_CUTTING_C_GENERIC_CUTTING_H_
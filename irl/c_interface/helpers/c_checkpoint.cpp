@@ -0,0 +1,165 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/c_interface/helpers/c_checkpoint.h"
+
+#include <cassert>
+#include <memory>
+#include <vector>
+
+namespace {
+
+// The wrapper arrays are usually temporaries on the Fortran side, so keep
+// our own copy of the object pointers until the writer is done with them.
+template <class ObjectType, class WrapperType>
+void addObjectSection(IRL::CheckpointWriter* a_writer, const char* a_name,
+                      const IRL::LargeOffsetIndex_t a_size,
+                      const WrapperType* a_objects) {
+  auto pointers = std::make_shared<std::vector<const ObjectType*>>(a_size);
+  for (IRL::LargeOffsetIndex_t n = 0; n < a_size; ++n) {
+    assert(a_objects[n].obj_ptr != nullptr);
+    (*pointers)[n] = a_objects[n].obj_ptr;
+  }
+  a_writer->addSection<ObjectType>(
+      a_name, a_size,
+      [pointers](const IRL::LargeOffsetIndex_t a_n) -> const ObjectType& {
+        return *(*pointers)[a_n];
+      });
+}
+
+template <class ObjectType, class WrapperType>
+bool readObjectSection(const IRL::CheckpointReader* a_reader,
+                       const char* a_name, const IRL::LargeOffsetIndex_t a_size,
+                       WrapperType* a_objects) {
+  return a_reader->read<ObjectType>(
+      a_name, a_size,
+      [a_objects](const IRL::LargeOffsetIndex_t a_n) -> ObjectType& {
+        assert(a_objects[a_n].obj_ptr != nullptr);
+        return *a_objects[a_n].obj_ptr;
+      });
+}
+
+}  // namespace
+
+extern "C" {
+
+void c_CheckpointWriter_new(c_CheckpointWriter* a_self) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr == nullptr);
+  a_self->obj_ptr = new IRL::CheckpointWriter;
+}
+
+void c_CheckpointWriter_delete(c_CheckpointWriter* a_self) {
+  delete a_self->obj_ptr;
+  a_self->obj_ptr = nullptr;
+}
+
+void c_CheckpointWriter_addPlanarSep(c_CheckpointWriter* a_self,
+                                     const char* a_name,
+                                     const IRL::LargeOffsetIndex_t* a_size,
+                                     const c_PlanarSep* a_separators) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  addObjectSection<IRL::PlanarSeparator>(a_self->obj_ptr, a_name, *a_size,
+                                         a_separators);
+}
+
+void c_CheckpointWriter_addPlanarLoc(c_CheckpointWriter* a_self,
+                                     const char* a_name,
+                                     const IRL::LargeOffsetIndex_t* a_size,
+                                     const c_PlanarLoc* a_localizers) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  addObjectSection<IRL::PlanarLocalizer>(a_self->obj_ptr, a_name, *a_size,
+                                         a_localizers);
+}
+
+void c_CheckpointWriter_addDoubles(c_CheckpointWriter* a_self,
+                                   const char* a_name,
+                                   const IRL::LargeOffsetIndex_t* a_size,
+                                   const double* a_values) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  a_self->obj_ptr->addSection(a_name, a_values, *a_size);
+}
+
+void c_CheckpointWriter_clear(c_CheckpointWriter* a_self) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  a_self->obj_ptr->clear();
+}
+
+bool c_CheckpointWriter_write(const c_CheckpointWriter* a_self,
+                              const char* a_file_name) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  return a_self->obj_ptr->write(a_file_name);
+}
+
+void c_CheckpointReader_new(c_CheckpointReader* a_self) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr == nullptr);
+  a_self->obj_ptr = new IRL::CheckpointReader;
+}
+
+void c_CheckpointReader_delete(c_CheckpointReader* a_self) {
+  delete a_self->obj_ptr;
+  a_self->obj_ptr = nullptr;
+}
+
+bool c_CheckpointReader_open(c_CheckpointReader* a_self,
+                             const char* a_file_name) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  return a_self->obj_ptr->open(a_file_name);
+}
+
+void c_CheckpointReader_close(c_CheckpointReader* a_self) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  a_self->obj_ptr->close();
+}
+
+IRL::LargeOffsetIndex_t c_CheckpointReader_getNumberOfRecords(
+    const c_CheckpointReader* a_self, const char* a_name) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  return a_self->obj_ptr->getNumberOfRecords(a_name);
+}
+
+bool c_CheckpointReader_readPlanarSep(const c_CheckpointReader* a_self,
+                                      const char* a_name,
+                                      const IRL::LargeOffsetIndex_t* a_size,
+                                      c_PlanarSep* a_separators) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  return readObjectSection<IRL::PlanarSeparator>(a_self->obj_ptr, a_name,
+                                                 *a_size, a_separators);
+}
+
+bool c_CheckpointReader_readPlanarLoc(const c_CheckpointReader* a_self,
+                                      const char* a_name,
+                                      const IRL::LargeOffsetIndex_t* a_size,
+                                      c_PlanarLoc* a_localizers) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  return readObjectSection<IRL::PlanarLocalizer>(a_self->obj_ptr, a_name,
+                                                 *a_size, a_localizers);
+}
+
+bool c_CheckpointReader_readDoubles(const c_CheckpointReader* a_self,
+                                    const char* a_name,
+                                    const IRL::LargeOffsetIndex_t* a_size,
+                                    double* a_values) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  return a_self->obj_ptr->read(a_name, a_values, *a_size);
+}
+
+}  // end extern C
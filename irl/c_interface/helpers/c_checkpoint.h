@@ -0,0 +1,93 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_C_INTERFACE_HELPERS_C_CHECKPOINT_H_
+#define IRL_C_INTERFACE_HELPERS_C_CHECKPOINT_H_
+
+#include "irl/c_interface/planar_reconstruction/c_localizers.h"
+#include "irl/c_interface/planar_reconstruction/c_separators.h"
+#include "irl/helpers/checkpoint.h"
+#include "irl/parameters/defined_types.h"
+
+extern "C" {
+/// \file c_checkpoint.h
+///
+/// These C-style functions are mapped to the
+/// CheckpointWriter and CheckpointReader classes in
+/// src/helpers/checkpoint.h.
+///
+/// Section and file names are null-terminated strings.
+/// The objects pointed to by a `c_PlanarSep` or `c_PlanarLoc`
+/// array, and arrays of doubles, are only read when
+/// c_CheckpointWriter_write is called, so they must stay
+/// allocated until then. The `c_PlanarSep` and `c_PlanarLoc`
+/// arrays themselves may be freed after they are added.
+
+struct c_CheckpointWriter {
+  IRL::CheckpointWriter* obj_ptr = nullptr;
+};
+
+struct c_CheckpointReader {
+  IRL::CheckpointReader* obj_ptr = nullptr;
+};
+
+void c_CheckpointWriter_new(c_CheckpointWriter* a_self);
+
+void c_CheckpointWriter_delete(c_CheckpointWriter* a_self);
+
+void c_CheckpointWriter_addPlanarSep(c_CheckpointWriter* a_self,
+                                     const char* a_name,
+                                     const IRL::LargeOffsetIndex_t* a_size,
+                                     const c_PlanarSep* a_separators);
+
+void c_CheckpointWriter_addPlanarLoc(c_CheckpointWriter* a_self,
+                                     const char* a_name,
+                                     const IRL::LargeOffsetIndex_t* a_size,
+                                     const c_PlanarLoc* a_localizers);
+
+void c_CheckpointWriter_addDoubles(c_CheckpointWriter* a_self,
+                                   const char* a_name,
+                                   const IRL::LargeOffsetIndex_t* a_size,
+                                   const double* a_values);
+
+void c_CheckpointWriter_clear(c_CheckpointWriter* a_self);
+
+bool c_CheckpointWriter_write(const c_CheckpointWriter* a_self,
+                              const char* a_file_name);
+
+void c_CheckpointReader_new(c_CheckpointReader* a_self);
+
+void c_CheckpointReader_delete(c_CheckpointReader* a_self);
+
+bool c_CheckpointReader_open(c_CheckpointReader* a_self,
+                             const char* a_file_name);
+
+void c_CheckpointReader_close(c_CheckpointReader* a_self);
+
+IRL::LargeOffsetIndex_t c_CheckpointReader_getNumberOfRecords(
+    const c_CheckpointReader* a_self, const char* a_name);
+
+bool c_CheckpointReader_readPlanarSep(const c_CheckpointReader* a_self,
+                                      const char* a_name,
+                                      const IRL::LargeOffsetIndex_t* a_size,
+                                      c_PlanarSep* a_separators);
+
+bool c_CheckpointReader_readPlanarLoc(const c_CheckpointReader* a_self,
+                                      const char* a_name,
+                                      const IRL::LargeOffsetIndex_t* a_size,
+                                      c_PlanarLoc* a_localizers);
+
+bool c_CheckpointReader_readDoubles(const c_CheckpointReader* a_self,
+                                    const char* a_name,
+                                    const IRL::LargeOffsetIndex_t* a_size,
+                                    double* a_values);
+
+}  // end extern C
+
+#endif  // IRL_C_INTERFACE_HELPERS_C_CHECKPOINT_H_
@@ -31,4 +31,22 @@ void c_unpackAndStore_PlanarSep_ByteBuffer(c_PlanarSep* a_separator,
   IRL::unpackAndStore(a_separator->obj_ptr, a_container->obj_ptr);
 }
 
+void c_serializeAndPack_PackedPlanarSepArray_ByteBuffer(
+    const c_PackedPlanarSepArray* a_separators, c_ByteBuffer* a_container) {
+  assert(a_separators != nullptr);
+  assert(a_separators->obj_ptr != nullptr);
+  assert(a_container != nullptr);
+  assert(a_container->obj_ptr != nullptr);
+  IRL::serializeAndPack(*a_separators->obj_ptr, a_container->obj_ptr);
+}
+
+void c_unpackAndStore_PackedPlanarSepArray_ByteBuffer(
+    c_PackedPlanarSepArray* a_separators, c_ByteBuffer* a_container) {
+  assert(a_separators != nullptr);
+  assert(a_separators->obj_ptr != nullptr);
+  assert(a_container != nullptr);
+  assert(a_container->obj_ptr != nullptr);
+  IRL::unpackAndStore(a_separators->obj_ptr, a_container->obj_ptr);
+}
+
 }  // end extern C
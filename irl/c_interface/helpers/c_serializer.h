@@ -26,6 +26,7 @@
 /// all big-endian representation to be used.
 
 #include "irl/c_interface/helpers/c_byte_buffer.h"
+#include "irl/c_interface/planar_reconstruction/c_packed_separator_array.h"
 #include "irl/c_interface/planar_reconstruction/c_separators.h"
 #include "irl/helpers/serializer.h"
 #include "irl/parameters/defined_types.h"
@@ -38,6 +39,12 @@ void c_serializeAndPack_PlanarSep_ByteBuffer(const c_PlanarSep* a_separator,
 
 void c_unpackAndStore_PlanarSep_ByteBuffer(c_PlanarSep* a_separator,
                                            c_ByteBuffer* a_container);
+
+void c_serializeAndPack_PackedPlanarSepArray_ByteBuffer(
+    const c_PackedPlanarSepArray* a_separators, c_ByteBuffer* a_container);
+
+void c_unpackAndStore_PackedPlanarSepArray_ByteBuffer(
+    c_PackedPlanarSepArray* a_separators, c_ByteBuffer* a_container);
 }
 
 #endif // IRL_C_INTERFACE_HELPERS_C_SERIALIZER_H_
@@ -0,0 +1,37 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/c_interface/helpers/c_telemetry.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+
+extern "C" {
+
+bool c_Telemetry_isEnabled(void) { return IRL::telemetry_enabled; }
+
+void c_Telemetry_getReport(c_TelemetryReport* a_report) {
+  assert(a_report != nullptr);
+  const auto report = IRL::getTelemetryReport();
+  std::copy(report.counters.begin(), report.counters.end(),
+            a_report->counters);
+  std::copy(report.timer_calls.begin(), report.timer_calls.end(),
+            a_report->timer_calls);
+  std::copy(report.timer_ticks.begin(), report.timer_ticks.end(),
+            a_report->timer_ticks);
+  a_report->number_of_threads = report.number_of_threads;
+}
+
+void c_Telemetry_reset(void) { IRL::resetTelemetry(); }
+
+void c_Telemetry_printReport(void) {
+  std::cout << IRL::getTelemetryReport() << std::flush;
+}
+}
@@ -0,0 +1,48 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_C_INTERFACE_HELPERS_C_TELEMETRY_H_
+#define IRL_C_INTERFACE_HELPERS_C_TELEMETRY_H_
+
+#include <cstdint>
+
+#include "irl/helpers/telemetry.h"
+#include "irl/parameters/defined_types.h"
+
+extern "C" {
+/// \file c_telemetry.h
+///
+/// These C-style functions are mapped to the
+/// telemetry functions in src/helpers/telemetry.h.
+///
+/// Counters and timers are indexed in the order of the
+/// TelemetryCounter and TelemetryTimer enums. When IRL is
+/// built without IRL_ENABLE_TELEMETRY, every value is zero.
+
+/// \brief Plain copy of IRL::TelemetryReport.
+struct c_TelemetryReport {
+  std::uint64_t counters[IRL::telemetry_counters];
+  std::uint64_t timer_calls[IRL::telemetry_timers];
+  std::uint64_t timer_ticks[IRL::telemetry_timers];
+  IRL::UnsignedIndex_t number_of_threads;
+};
+
+bool c_Telemetry_isEnabled(void);
+
+/// \brief Sum the counters and timers of all threads into `a_report`.
+void c_Telemetry_getReport(c_TelemetryReport* a_report);
+
+/// \brief Set all counters and timers to zero.
+void c_Telemetry_reset(void);
+
+/// \brief Print the current report to standard output.
+void c_Telemetry_printReport(void);
+}
+
+#endif  // IRL_C_INTERFACE_HELPERS_C_TELEMETRY_H_
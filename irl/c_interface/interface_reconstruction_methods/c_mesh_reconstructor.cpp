@@ -0,0 +1,165 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/c_interface/interface_reconstruction_methods/c_mesh_reconstructor.h"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "irl/geometry/polyhedrons/hexahedron.h"
+
+namespace {
+std::vector<IRL::Pt> ptsFromRawDoubles(const IRL::UnsignedIndex_t a_size,
+                                       const double* a_values) {
+  std::vector<IRL::Pt> pts(a_size);
+  for (IRL::UnsignedIndex_t n = 0; n < a_size; ++n) {
+    pts[n] = IRL::Pt(a_values[3 * n], a_values[3 * n + 1],
+                     a_values[3 * n + 2]);
+  }
+  return pts;
+}
+
+// Start from the current separators so cells the reconstructor
+// skips (such as structured ghost cells) are returned unchanged.
+std::vector<IRL::PlanarSeparator> copySeparators(
+    const IRL::UnsignedIndex_t a_size, const c_PlanarSep* a_separators) {
+  std::vector<IRL::PlanarSeparator> separators(a_size);
+  for (IRL::UnsignedIndex_t n = 0; n < a_size; ++n) {
+    assert(a_separators[n].obj_ptr != nullptr);
+    separators[n] = *a_separators[n].obj_ptr;
+  }
+  return separators;
+}
+
+void returnSeparators(const std::vector<IRL::PlanarSeparator>& a_separators,
+                      c_PlanarSep* a_c_separators) {
+  for (std::size_t n = 0; n < a_separators.size(); ++n) {
+    *a_c_separators[n].obj_ptr = a_separators[n];
+  }
+}
+}  // namespace
+
+extern "C" {
+
+void c_MeshReconstructor_new(c_MeshReconstructor* a_self,
+                             const int* a_number_of_threads) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr == nullptr);
+  assert(*a_number_of_threads > 0);
+  a_self->obj_ptr = new IRL::MeshReconstructor(
+      static_cast<IRL::UnsignedIndex_t>(*a_number_of_threads));
+}
+
+void c_MeshReconstructor_delete(c_MeshReconstructor* a_self) {
+  delete a_self->obj_ptr;
+  a_self->obj_ptr = nullptr;
+}
+
+void c_MeshReconstructor_setMethod(c_MeshReconstructor* a_self,
+                                   const int* a_method) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  assert(*a_method >= 0 && *a_method <= 3);
+  a_self->obj_ptr->setMethod(
+      static_cast<IRL::MeshReconstructionMethod>(*a_method));
+}
+
+void c_MeshReconstructor_setGrainSize(c_MeshReconstructor* a_self,
+                                      const int* a_grain_size) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  assert(*a_grain_size > 0);
+  a_self->obj_ptr->setGrainSize(
+      static_cast<IRL::UnsignedIndex_t>(*a_grain_size));
+}
+
+int c_MeshReconstructor_getNumberOfThreads(const c_MeshReconstructor* a_self) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  return static_cast<int>(a_self->obj_ptr->getNumberOfThreads());
+}
+
+void c_MeshReconstructor_reconstructStructured(
+    c_MeshReconstructor* a_self, const int* a_dimensions, const double* a_x,
+    const double* a_y, const double* a_z,
+    const double* a_liquid_volume_fraction, const double* a_liquid_centroid,
+    const double* a_gas_centroid, c_PlanarSep* a_separators) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  const auto nx = static_cast<IRL::UnsignedIndex_t>(a_dimensions[0]);
+  const auto ny = static_cast<IRL::UnsignedIndex_t>(a_dimensions[1]);
+  const auto nz = static_cast<IRL::UnsignedIndex_t>(a_dimensions[2]);
+  const IRL::UnsignedIndex_t number_of_cells = nx * ny * nz;
+  const auto liquid_centroid =
+      ptsFromRawDoubles(number_of_cells, a_liquid_centroid);
+  const auto gas_centroid = ptsFromRawDoubles(number_of_cells, a_gas_centroid);
+  auto separators = copySeparators(number_of_cells, a_separators);
+  a_self->obj_ptr->reconstruct(nx, ny, nz, a_x, a_y, a_z,
+                               a_liquid_volume_fraction,
+                               liquid_centroid.data(), gas_centroid.data(),
+                               separators.data());
+  returnSeparators(separators, a_separators);
+}
+
+void c_MeshReconstructor_reconstructHexahedra(
+    c_MeshReconstructor* a_self, const int* a_number_of_cells,
+    const double* a_vertices, const int* a_neighbor_offsets,
+    const int* a_neighbors, const double* a_liquid_volume_fraction,
+    const double* a_liquid_centroid, const double* a_gas_centroid,
+    c_PlanarSep* a_separators) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  const auto number_of_cells =
+      static_cast<IRL::UnsignedIndex_t>(*a_number_of_cells);
+  std::vector<IRL::Hexahedron> cells(number_of_cells);
+  for (IRL::UnsignedIndex_t n = 0; n < number_of_cells; ++n) {
+    cells[n] = IRL::Hexahedron::fromRawDoublePointer(8, a_vertices + 24 * n);
+  }
+  const std::vector<IRL::UnsignedIndex_t> offsets(
+      a_neighbor_offsets, a_neighbor_offsets + number_of_cells + 1);
+  const std::vector<IRL::UnsignedIndex_t> neighbors(
+      a_neighbors, a_neighbors + offsets.back());
+  const auto liquid_centroid =
+      ptsFromRawDoubles(number_of_cells, a_liquid_centroid);
+  const auto gas_centroid = ptsFromRawDoubles(number_of_cells, a_gas_centroid);
+  auto separators = copySeparators(number_of_cells, a_separators);
+  a_self->obj_ptr->reconstruct(number_of_cells, cells.data(), offsets.data(),
+                               neighbors.data(), a_liquid_volume_fraction,
+                               liquid_centroid.data(), gas_centroid.data(),
+                               separators.data());
+  returnSeparators(separators, a_separators);
+}
+
+void c_MeshReconstructor_getCellTimes(const c_MeshReconstructor* a_self,
+                                      double* a_cell_times) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  const auto& cell_times = a_self->obj_ptr->getCellTimes();
+  std::copy(cell_times.begin(), cell_times.end(), a_cell_times);
+}
+
+void c_MeshReconstructor_getCellIterations(const c_MeshReconstructor* a_self,
+                                           int* a_cell_iterations) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  const auto& cell_iterations = a_self->obj_ptr->getCellIterations();
+  for (std::size_t n = 0; n < cell_iterations.size(); ++n) {
+    a_cell_iterations[n] = static_cast<int>(cell_iterations[n]);
+  }
+}
+
+int c_MeshReconstructor_getNumberOfMixedCells(
+    const c_MeshReconstructor* a_self) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  return static_cast<int>(a_self->obj_ptr->getNumberOfMixedCells());
+}
+
+}  // end extern C
@@ -0,0 +1,70 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_C_INTERFACE_INTERFACE_RECONSTRUCTION_METHODS_C_MESH_RECONSTRUCTOR_H_
+#define IRL_C_INTERFACE_INTERFACE_RECONSTRUCTION_METHODS_C_MESH_RECONSTRUCTOR_H_
+
+#include "irl/c_interface/planar_reconstruction/c_separators.h"
+#include "irl/interface_reconstruction_methods/mesh_reconstructor.h"
+
+extern "C" {
+/// \file c_mesh_reconstructor.h
+///
+/// These C-style functions are mapped to the
+/// MeshReconstructor class in
+/// src/interface_reconstruction_methods/mesh_reconstructor.h.
+///
+/// Points are passed as consecutive (x, y, z) triplets, and
+/// every `c_PlanarSep` in `a_separators` must already be
+/// allocated. The integer method ids follow
+/// IRL::MeshReconstructionMethod: 0 = ELVIRA, 1 = LVIRA,
+/// 2 = R2P, 3 = MOF.
+
+struct c_MeshReconstructor {
+  IRL::MeshReconstructor* obj_ptr = nullptr;
+};
+
+void c_MeshReconstructor_new(c_MeshReconstructor* a_self,
+                             const int* a_number_of_threads);
+
+void c_MeshReconstructor_delete(c_MeshReconstructor* a_self);
+
+void c_MeshReconstructor_setMethod(c_MeshReconstructor* a_self,
+                                   const int* a_method);
+
+void c_MeshReconstructor_setGrainSize(c_MeshReconstructor* a_self,
+                                      const int* a_grain_size);
+
+int c_MeshReconstructor_getNumberOfThreads(const c_MeshReconstructor* a_self);
+
+void c_MeshReconstructor_reconstructStructured(
+    c_MeshReconstructor* a_self, const int* a_dimensions, const double* a_x,
+    const double* a_y, const double* a_z,
+    const double* a_liquid_volume_fraction, const double* a_liquid_centroid,
+    const double* a_gas_centroid, c_PlanarSep* a_separators);
+
+void c_MeshReconstructor_reconstructHexahedra(
+    c_MeshReconstructor* a_self, const int* a_number_of_cells,
+    const double* a_vertices, const int* a_neighbor_offsets,
+    const int* a_neighbors, const double* a_liquid_volume_fraction,
+    const double* a_liquid_centroid, const double* a_gas_centroid,
+    c_PlanarSep* a_separators);
+
+void c_MeshReconstructor_getCellTimes(const c_MeshReconstructor* a_self,
+                                      double* a_cell_times);
+
+void c_MeshReconstructor_getCellIterations(const c_MeshReconstructor* a_self,
+                                           int* a_cell_iterations);
+
+int c_MeshReconstructor_getNumberOfMixedCells(
+    const c_MeshReconstructor* a_self);
+
+}  // end extern C
+
+#endif  // IRL_C_INTERFACE_INTERFACE_RECONSTRUCTION_METHODS_C_MESH_RECONSTRUCTOR_H_
@@ -10,6 +10,8 @@
 #include "irl/c_interface/planar_reconstruction/c_localized_separator.h"
 
 #include <cassert>
+#include <cstdlib>
+#include <iostream>
 
 extern "C" {
 
@@ -37,6 +39,13 @@ void c_LocSep_newFromObjectAllocationServer(
   assert(a_separator->obj_ptr != nullptr);
   a_self->is_owning = false;
   a_self->obj_ptr = a_object_allocation_server->obj_ptr->getNewObject();
+  if (a_self->obj_ptr == nullptr) {
+    std::cout << "During call to c_LocSep_newFromObjectAllocationServer: "
+                 "object allocation server is exhausted. Increase the number "
+                 "of objects it allocates."
+              << std::endl;
+    std::exit(-1);
+  }
   *a_self->obj_ptr =
       IRL::LocalizedSeparator(a_localizer->obj_ptr, a_separator->obj_ptr);
 }
@@ -9,6 +9,10 @@
 
 #include "irl/c_interface/planar_reconstruction/c_localizer_link.h"
 
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+
 extern "C" {
 
 void c_LocLink_new(c_LocLink* a_self, const c_PlanarLoc* a_localizer) {
@@ -27,6 +31,13 @@ void c_LocLink_newFromObjectAllocationServer(
   assert(a_localizer != nullptr);
   a_self->is_owning = false;
   a_self->obj_ptr = a_object_allocation_server->obj_ptr->getNewObject();
+  if (a_self->obj_ptr == nullptr) {
+    std::cout << "During call to c_LocLink_newFromObjectAllocationServer: "
+                 "object allocation server is exhausted. Increase the number "
+                 "of objects it allocates."
+              << std::endl;
+    std::exit(-1);
+  }
   *(a_self->obj_ptr) = IRL::LocalizerLink(a_localizer->obj_ptr);
 }
 
@@ -10,6 +10,7 @@
 #include "irl/c_interface/planar_reconstruction/c_localizers.h"
 
 #include <cassert>
+#include <cstdlib>
 #include <iostream>
 
 extern "C" {
@@ -27,6 +28,13 @@ void c_PlanarLoc_newFromObjectAllocationServer(
   assert(a_object_allocation_server->obj_ptr != nullptr);
   a_self->is_owning = false;
   a_self->obj_ptr = a_object_allocation_server->obj_ptr->getNewObject();
+  if (a_self->obj_ptr == nullptr) {
+    std::cout << "During call to c_PlanarLoc_newFromObjectAllocationServer: "
+                 "object allocation server is exhausted. Increase the number "
+                 "of objects it allocates."
+              << std::endl;
+    std::exit(-1);
+  }
 }
 
 void c_PlanarLoc_delete(c_PlanarLoc* a_self) {
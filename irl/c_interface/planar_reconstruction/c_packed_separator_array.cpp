@@ -0,0 +1,84 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/c_interface/planar_reconstruction/c_packed_separator_array.h"
+
+#include <cassert>
+
+extern "C" {
+
+void c_PackedPlanarSepArray_new(c_PackedPlanarSepArray* a_self,
+                                const int* a_size) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr == nullptr);
+  assert(*a_size >= 0);
+  a_self->obj_ptr = new IRL::PackedPlanarSeparatorArray(
+      static_cast<IRL::UnsignedIndex_t>(*a_size));
+}
+
+void c_PackedPlanarSepArray_delete(c_PackedPlanarSepArray* a_self) {
+  delete a_self->obj_ptr;
+  a_self->obj_ptr = nullptr;
+}
+
+void c_PackedPlanarSepArray_resize(c_PackedPlanarSepArray* a_self,
+                                   const int* a_size) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  assert(*a_size >= 0);
+  a_self->obj_ptr->resize(static_cast<IRL::UnsignedIndex_t>(*a_size));
+}
+
+int c_PackedPlanarSepArray_getSize(const c_PackedPlanarSepArray* a_self) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  return static_cast<int>(a_self->obj_ptr->size());
+}
+
+void c_PackedPlanarSepArray_set(c_PackedPlanarSepArray* a_self,
+                                const int* a_index,
+                                const c_PlanarSep* a_separator) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  assert(a_separator != nullptr);
+  assert(a_separator->obj_ptr != nullptr);
+  assert(*a_index >= 0);
+  a_self->obj_ptr->set(static_cast<IRL::UnsignedIndex_t>(*a_index),
+                       *a_separator->obj_ptr);
+}
+
+void c_PackedPlanarSepArray_get(const c_PackedPlanarSepArray* a_self,
+                                const int* a_index, c_PlanarSep* a_separator) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  assert(a_separator != nullptr);
+  assert(a_separator->obj_ptr != nullptr);
+  assert(*a_index >= 0);
+  a_self->obj_ptr->get(static_cast<IRL::UnsignedIndex_t>(*a_index),
+                       a_separator->obj_ptr);
+}
+
+int c_PackedPlanarSepArray_getNumberOfPlanes(
+    const c_PackedPlanarSepArray* a_self, const int* a_index) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  assert(*a_index >= 0);
+  return static_cast<int>(a_self->obj_ptr->getNumberOfPlanes(
+      static_cast<IRL::UnsignedIndex_t>(*a_index)));
+}
+
+int c_PackedPlanarSepArray_getNumberOfOverflowSeparators(
+    const c_PackedPlanarSepArray* a_self) {
+  assert(a_self != nullptr);
+  assert(a_self->obj_ptr != nullptr);
+  return static_cast<int>(
+      a_self->obj_ptr->getNumberOfOverflowSeparators());
+}
+
+}  // end extern C
@@ -0,0 +1,55 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_C_INTERFACE_PLANAR_RECONSTRUCTION_C_PACKED_SEPARATOR_ARRAY_H_
+#define IRL_C_INTERFACE_PLANAR_RECONSTRUCTION_C_PACKED_SEPARATOR_ARRAY_H_
+
+#include "irl/c_interface/planar_reconstruction/c_separators.h"
+#include "irl/parameters/defined_types.h"
+#include "irl/planar_reconstruction/packed_planar_separator_array.h"
+
+extern "C" {
+/// \file c_packed_separator_array.h
+///
+/// These C-style functions are mapped to the
+/// PackedPlanarSeparatorArray class in
+/// src/planar_reconstruction/packed_planar_separator_array.h.
+///
+/// Cell indices are zero-based.
+
+struct c_PackedPlanarSepArray {
+  IRL::PackedPlanarSeparatorArray* obj_ptr = nullptr;
+};
+
+void c_PackedPlanarSepArray_new(c_PackedPlanarSepArray* a_self,
+                                const int* a_size);
+
+void c_PackedPlanarSepArray_delete(c_PackedPlanarSepArray* a_self);
+
+void c_PackedPlanarSepArray_resize(c_PackedPlanarSepArray* a_self,
+                                   const int* a_size);
+
+int c_PackedPlanarSepArray_getSize(const c_PackedPlanarSepArray* a_self);
+
+void c_PackedPlanarSepArray_set(c_PackedPlanarSepArray* a_self,
+                                const int* a_index,
+                                const c_PlanarSep* a_separator);
+
+void c_PackedPlanarSepArray_get(const c_PackedPlanarSepArray* a_self,
+                                const int* a_index, c_PlanarSep* a_separator);
+
+int c_PackedPlanarSepArray_getNumberOfPlanes(
+    const c_PackedPlanarSepArray* a_self, const int* a_index);
+
+int c_PackedPlanarSepArray_getNumberOfOverflowSeparators(
+    const c_PackedPlanarSepArray* a_self);
+
+}  // end extern C
+
+#endif  // IRL_C_INTERFACE_PLANAR_RECONSTRUCTION_C_PACKED_SEPARATOR_ARRAY_H_
@@ -9,6 +9,7 @@
 
 #include "irl/c_interface/planar_reconstruction/c_separators.h"
 
+#include <cstdlib>
 #include <iostream>
 
 #include "irl/interface_reconstruction_methods/volume_fraction_matching.h"
@@ -31,6 +32,13 @@ void c_PlanarSep_newFromObjectAllocationServer(
   assert(a_object_allocation_server->obj_ptr != nullptr);
   a_self->is_owning = false;
   a_self->obj_ptr = a_object_allocation_server->obj_ptr->getNewObject();
+  if (a_self->obj_ptr == nullptr) {
+    std::cout << "During call to c_PlanarSep_newFromObjectAllocationServer: "
+                 "object allocation server is exhausted. Increase the number "
+                 "of objects it allocates."
+              << std::endl;
+    std::exit(-1);
+  }
 }
 
 void c_PlanarSep_delete(c_PlanarSep* a_self) {
@@ -0,0 +1,129 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_DATA_STRUCTURES_CONCURRENT_OBJECT_ALLOCATION_SERVER_H_
+#define IRL_DATA_STRUCTURES_CONCURRENT_OBJECT_ALLOCATION_SERVER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "irl/data_structures/unordered_map.h"
+#include "irl/parameters/defined_types.h"
+
+namespace IRL {
+
+/// \brief Thread-safe version of ObjectAllocationServer.
+///
+/// Storage for `a_number_to_allocate` objects is reserved up front but left
+/// untouched. It is handed out in slabs of `a_slab_size` objects, with each
+/// thread owning the slab it is currently serving from, so `getNewObject()`
+/// only performs an atomic operation when a thread needs a new slab. Objects
+/// in a slab are constructed by the thread that first claims it, which
+/// places the backing pages on that thread's NUMA node under the usual
+/// first-touch policy.
+///
+/// `reset()` returns all objects to the server at once so the same storage
+/// can be reused (e.g., every timestep) without freeing it. Objects served
+/// after a reset are reassigned to a default-constructed state.
+///
+/// Since partially used slabs stay with the thread that claimed them,
+/// the capacity should allow for up to one slab of slack per thread, as
+/// given by `capacityWithSlack(...)`.
+/// The per-thread cursors are owned by the server and freed with it.
+template <class ObjectType>
+class ConcurrentObjectAllocationServer {
+  struct alignas(64) SlabCursor {
+    std::size_t epoch;
+    LargeOffsetIndex_t next_object;
+    LargeOffsetIndex_t end_object;
+    bool reinitialize_objects;
+  };
+
+ public:
+  static constexpr LargeOffsetIndex_t default_slab_size = 512;
+
+  ConcurrentObjectAllocationServer(void) = delete;
+
+  explicit ConcurrentObjectAllocationServer(
+      const LargeOffsetIndex_t a_number_to_allocate,
+      const LargeOffsetIndex_t a_slab_size = default_slab_size);
+
+  /// \brief Capacity that serves at least `a_number_of_objects` objects
+  /// when each of `a_number_of_threads` threads leaves a partially used
+  /// slab of `a_slab_size` objects behind.
+  static LargeOffsetIndex_t capacityWithSlack(
+      const LargeOffsetIndex_t a_number_of_objects,
+      const LargeOffsetIndex_t a_number_of_threads,
+      const LargeOffsetIndex_t a_slab_size = default_slab_size);
+
+  /// \brief Return a pointer to an unused object, or nullptr if
+  /// the server is exhausted. Safe to call concurrently.
+  ObjectType* getNewObject(void);
+
+  /// \brief Return all served objects to the server. Must not be called
+  /// concurrently with getNewObject().
+  void reset(void);
+
+  /// \brief Total number of objects the server can hold.
+  LargeOffsetIndex_t capacity(void) const;
+
+  /// \brief Number of objects per slab.
+  LargeOffsetIndex_t slabSize(void) const;
+
+  /// \brief Number of slabs handed out since construction or
+  /// the last reset.
+  LargeOffsetIndex_t getNumberOfClaimedSlabs(void) const;
+
+  explicit ConcurrentObjectAllocationServer(
+      const ConcurrentObjectAllocationServer& other) = delete;
+
+  explicit ConcurrentObjectAllocationServer(
+      ConcurrentObjectAllocationServer&& other) noexcept = delete;
+
+  ConcurrentObjectAllocationServer& operator=(
+      const ConcurrentObjectAllocationServer& other) = delete;
+
+  ConcurrentObjectAllocationServer& operator=(
+      ConcurrentObjectAllocationServer&& other) noexcept = delete;
+
+  ~ConcurrentObjectAllocationServer(void);
+
+ private:
+  SlabCursor& getThreadCursor(void);
+
+  bool claimSlab(SlabCursor* a_cursor);
+
+  void constructObjectsInRange(const LargeOffsetIndex_t a_begin,
+                               const LargeOffsetIndex_t a_end);
+
+  static std::size_t getUniqueServerID(void);
+
+  ObjectType* object_storage_m;
+  LargeOffsetIndex_t capacity_m;
+  LargeOffsetIndex_t slab_size_m;
+  LargeOffsetIndex_t number_of_slabs_m;
+  // Slabs below this index hold constructed objects from a previous epoch.
+  LargeOffsetIndex_t number_of_constructed_slabs_m;
+  std::size_t server_id_m;
+  std::size_t epoch_m;
+  // Cursor of each thread that has been served, looked up under the mutex
+  // only when the thread's cache of recently used cursors misses.
+  std::mutex cursor_mutex_m;
+  unordered_map<std::thread::id, std::unique_ptr<SlabCursor>> cursors_m;
+  alignas(64) std::atomic<LargeOffsetIndex_t> next_slab_m;
+};
+
+}  // namespace IRL
+
+#include "irl/data_structures/concurrent_object_allocation_server.tpp"
+
+#endif  // IRL_DATA_STRUCTURES_CONCURRENT_OBJECT_ALLOCATION_SERVER_H_
@@ -0,0 +1,190 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_DATA_STRUCTURES_CONCURRENT_OBJECT_ALLOCATION_SERVER_TPP_
+#define IRL_DATA_STRUCTURES_CONCURRENT_OBJECT_ALLOCATION_SERVER_TPP_
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+namespace IRL {
+
+namespace concurrent_object_allocation_server_details {
+// Align storage to cache lines so slabs owned by different
+// threads do not share a line at their boundaries more than necessary.
+template <class ObjectType>
+constexpr std::size_t storageAlignment(void) {
+  return std::max(static_cast<std::size_t>(64), alignof(ObjectType));
+}
+}  // namespace concurrent_object_allocation_server_details
+
+template <class ObjectType>
+ConcurrentObjectAllocationServer<ObjectType>::ConcurrentObjectAllocationServer(
+    const LargeOffsetIndex_t a_number_to_allocate,
+    const LargeOffsetIndex_t a_slab_size)
+    : object_storage_m{nullptr},
+      capacity_m{a_number_to_allocate},
+      slab_size_m{std::max(static_cast<LargeOffsetIndex_t>(1), a_slab_size)},
+      number_of_slabs_m{0},
+      number_of_constructed_slabs_m{0},
+      server_id_m{getUniqueServerID()},
+      epoch_m{0},
+      cursor_mutex_m(),
+      cursors_m(),
+      next_slab_m{0} {
+  number_of_slabs_m = (capacity_m + slab_size_m - 1) / slab_size_m;
+  if (capacity_m > 0) {
+    // Raw storage is deliberately not touched here, so that pages are
+    // placed by the threads that later construct objects in them.
+    object_storage_m = static_cast<ObjectType*>(::operator new(
+        static_cast<std::size_t>(capacity_m) * sizeof(ObjectType),
+        std::align_val_t{concurrent_object_allocation_server_details::
+                             storageAlignment<ObjectType>()}));
+  }
+}
+
+template <class ObjectType>
+LargeOffsetIndex_t
+ConcurrentObjectAllocationServer<ObjectType>::capacityWithSlack(
+    const LargeOffsetIndex_t a_number_of_objects,
+    const LargeOffsetIndex_t a_number_of_threads,
+    const LargeOffsetIndex_t a_slab_size) {
+  const LargeOffsetIndex_t slab_size =
+      std::max(static_cast<LargeOffsetIndex_t>(1), a_slab_size);
+  return a_number_of_objects + a_number_of_threads * (slab_size - 1);
+}
+
+template <class ObjectType>
+ObjectType* ConcurrentObjectAllocationServer<ObjectType>::getNewObject(void) {
+  SlabCursor& cursor = this->getThreadCursor();
+  if (cursor.epoch != epoch_m || cursor.next_object == cursor.end_object) {
+    if (!this->claimSlab(&cursor)) {
+      return nullptr;
+    }
+  }
+  ObjectType* object = object_storage_m + cursor.next_object;
+  ++cursor.next_object;
+  if (cursor.reinitialize_objects) {
+    *object = ObjectType();
+  }
+  return object;
+}
+
+template <class ObjectType>
+void ConcurrentObjectAllocationServer<ObjectType>::reset(void) {
+  number_of_constructed_slabs_m =
+      std::max(number_of_constructed_slabs_m, this->getNumberOfClaimedSlabs());
+  next_slab_m.store(0, std::memory_order_relaxed);
+  ++epoch_m;
+}
+
+template <class ObjectType>
+LargeOffsetIndex_t ConcurrentObjectAllocationServer<ObjectType>::capacity(
+    void) const {
+  return capacity_m;
+}
+
+template <class ObjectType>
+LargeOffsetIndex_t ConcurrentObjectAllocationServer<ObjectType>::slabSize(
+    void) const {
+  return slab_size_m;
+}
+
+template <class ObjectType>
+LargeOffsetIndex_t
+ConcurrentObjectAllocationServer<ObjectType>::getNumberOfClaimedSlabs(
+    void) const {
+  return std::min(next_slab_m.load(std::memory_order_relaxed),
+                  number_of_slabs_m);
+}
+
+template <class ObjectType>
+ConcurrentObjectAllocationServer<
+    ObjectType>::~ConcurrentObjectAllocationServer(void) {
+  const LargeOffsetIndex_t constructed_slabs =
+      std::max(number_of_constructed_slabs_m, this->getNumberOfClaimedSlabs());
+  const LargeOffsetIndex_t constructed_objects =
+      std::min(constructed_slabs * slab_size_m, capacity_m);
+  for (LargeOffsetIndex_t n = 0; n < constructed_objects; ++n) {
+    object_storage_m[n].~ObjectType();
+  }
+  if (object_storage_m != nullptr) {
+    ::operator delete(
+        object_storage_m,
+        std::align_val_t{concurrent_object_allocation_server_details::
+                             storageAlignment<ObjectType>()});
+  }
+  object_storage_m = nullptr;
+}
+
+template <class ObjectType>
+typename ConcurrentObjectAllocationServer<ObjectType>::SlabCursor&
+ConcurrentObjectAllocationServer<ObjectType>::getThreadCursor(void) {
+  // Small direct-mapped cache of cursors per thread. Server IDs are never
+  // reused, so entries left behind by destroyed servers are never matched
+  // again and the cache does not grow with the number of servers.
+  struct CachedCursor {
+    std::size_t server_id = static_cast<std::size_t>(-1);
+    SlabCursor* cursor = nullptr;
+  };
+  static constexpr std::size_t cache_size = 8;
+  static thread_local CachedCursor cached_cursors[cache_size];
+  CachedCursor& cached = cached_cursors[server_id_m % cache_size];
+  if (cached.server_id != server_id_m) {
+    std::lock_guard<std::mutex> lock(cursor_mutex_m);
+    auto& cursor = cursors_m[std::this_thread::get_id()];
+    if (cursor == nullptr) {
+      cursor.reset(new SlabCursor{epoch_m, 0, 0, false});
+    }
+    cached.server_id = server_id_m;
+    cached.cursor = cursor.get();
+  }
+  return *cached.cursor;
+}
+
+template <class ObjectType>
+bool ConcurrentObjectAllocationServer<ObjectType>::claimSlab(
+    SlabCursor* a_cursor) {
+  const LargeOffsetIndex_t slab =
+      next_slab_m.fetch_add(1, std::memory_order_relaxed);
+  a_cursor->epoch = epoch_m;
+  if (slab >= number_of_slabs_m) {
+    a_cursor->next_object = 0;
+    a_cursor->end_object = 0;
+    return false;
+  }
+  a_cursor->next_object = slab * slab_size_m;
+  a_cursor->end_object =
+      std::min(a_cursor->next_object + slab_size_m, capacity_m);
+  a_cursor->reinitialize_objects = slab < number_of_constructed_slabs_m;
+  if (!a_cursor->reinitialize_objects) {
+    this->constructObjectsInRange(a_cursor->next_object, a_cursor->end_object);
+  }
+  return true;
+}
+
+template <class ObjectType>
+void ConcurrentObjectAllocationServer<ObjectType>::constructObjectsInRange(
+    const LargeOffsetIndex_t a_begin, const LargeOffsetIndex_t a_end) {
+  for (LargeOffsetIndex_t n = a_begin; n < a_end; ++n) {
+    new (object_storage_m + n) ObjectType();
+  }
+}
+
+template <class ObjectType>
+std::size_t ConcurrentObjectAllocationServer<ObjectType>::getUniqueServerID(
+    void) {
+  static std::atomic<std::size_t> next_server_id{0};
+  return next_server_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace IRL
+
+#endif  // IRL_DATA_STRUCTURES_CONCURRENT_OBJECT_ALLOCATION_SERVER_TPP_
@@ -0,0 +1,373 @@
+!  This file is part of the Interface Reconstruction Library (IRL),
+!  a library for interface reconstruction and computational geometry operations.
+!
+!  Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+!
+!  This Source Code Form is subject to the terms of the Mozilla Public
+!  License, v. 2.0. If a copy of the MPL was not distributed with this
+!  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+!> \file f_checkpoint_class.f90
+!!
+!! This file contains the Fortran interface for the
+!! CheckpointWriter and CheckpointReader classes.
+
+!> \brief Fortran type classes that allow writing and
+!! reading memory-mapped IRL checkpoint files.
+!!
+!! Objects and arrays given to addSection are only read
+!! when writeCheckpoint is called, so they must stay
+!! allocated, and arrays of doubles must be contiguous,
+!! until then.
+module f_Checkpoint_class
+  use, intrinsic :: iso_c_binding
+  use f_DefinedTypes
+  use f_PlanarSep_class
+  use f_PlanarLoc_class
+  implicit none
+
+  type, public, bind(C) :: c_CheckpointWriter
+    type(C_PTR), private :: object = C_NULL_PTR
+  end type c_CheckpointWriter
+
+  type, public, bind(C) :: c_CheckpointReader
+    type(C_PTR), private :: object = C_NULL_PTR
+  end type c_CheckpointReader
+
+  type, public :: CheckpointWriter_type
+    type(c_CheckpointWriter) :: c_object
+  contains
+    final :: CheckpointWriter_class_delete
+  end type CheckpointWriter_type
+
+  type, public :: CheckpointReader_type
+    type(c_CheckpointReader) :: c_object
+  contains
+    final :: CheckpointReader_class_delete
+  end type CheckpointReader_type
+
+  interface new
+    module procedure CheckpointWriter_class_new
+    module procedure CheckpointReader_class_new
+  end interface
+  interface addSection
+    module procedure CheckpointWriter_class_addPlanarSep
+    module procedure CheckpointWriter_class_addPlanarLoc
+    module procedure CheckpointWriter_class_addDoubles
+  end interface
+  interface clear
+    module procedure CheckpointWriter_class_clear
+  end interface
+  interface writeCheckpoint
+    module procedure CheckpointWriter_class_write
+  end interface
+  interface openCheckpoint
+    module procedure CheckpointReader_class_open
+  end interface
+  interface closeCheckpoint
+    module procedure CheckpointReader_class_close
+  end interface
+  interface getNumberOfRecords
+    module procedure CheckpointReader_class_getNumberOfRecords
+  end interface
+  interface readSection
+    module procedure CheckpointReader_class_readPlanarSep
+    module procedure CheckpointReader_class_readPlanarLoc
+    module procedure CheckpointReader_class_readDoubles
+  end interface
+
+
+  interface
+
+    subroutine F_CheckpointWriter_new(this) &
+      bind(C, name="c_CheckpointWriter_new")
+      import
+      implicit none
+      type(c_CheckpointWriter) :: this
+    end subroutine F_CheckpointWriter_new
+
+    subroutine F_CheckpointWriter_delete(this) &
+      bind(C, name="c_CheckpointWriter_delete")
+      import
+      implicit none
+      type(c_CheckpointWriter) :: this
+    end subroutine F_CheckpointWriter_delete
+
+    subroutine F_CheckpointWriter_addPlanarSep(this, a_name, a_size, &
+      a_separators) &
+      bind(C, name="c_CheckpointWriter_addPlanarSep")
+      import
+      implicit none
+      type(c_CheckpointWriter) :: this
+      character(kind=C_CHAR), dimension(*), intent(in) :: a_name ! Null terminated
+      integer(C_SIZE_T), intent(in) :: a_size
+      type(c_PlanarSep), dimension(*), intent(in) :: a_separators
+    end subroutine F_CheckpointWriter_addPlanarSep
+
+    subroutine F_CheckpointWriter_addPlanarLoc(this, a_name, a_size, &
+      a_localizers) &
+      bind(C, name="c_CheckpointWriter_addPlanarLoc")
+      import
+      implicit none
+      type(c_CheckpointWriter) :: this
+      character(kind=C_CHAR), dimension(*), intent(in) :: a_name ! Null terminated
+      integer(C_SIZE_T), intent(in) :: a_size
+      type(c_PlanarLoc), dimension(*), intent(in) :: a_localizers
+    end subroutine F_CheckpointWriter_addPlanarLoc
+
+    subroutine F_CheckpointWriter_addDoubles(this, a_name, a_size, a_values) &
+      bind(C, name="c_CheckpointWriter_addDoubles")
+      import
+      implicit none
+      type(c_CheckpointWriter) :: this
+      character(kind=C_CHAR), dimension(*), intent(in) :: a_name ! Null terminated
+      integer(C_SIZE_T), intent(in) :: a_size
+      real(C_DOUBLE), dimension(*), intent(in) :: a_values
+    end subroutine F_CheckpointWriter_addDoubles
+
+    subroutine F_CheckpointWriter_clear(this) &
+      bind(C, name="c_CheckpointWriter_clear")
+      import
+      implicit none
+      type(c_CheckpointWriter) :: this
+    end subroutine F_CheckpointWriter_clear
+
+    function F_CheckpointWriter_write(this, a_file_name) result(a_success) &
+      bind(C, name="c_CheckpointWriter_write")
+      import
+      implicit none
+      type(c_CheckpointWriter) :: this
+      character(kind=C_CHAR), dimension(*), intent(in) :: a_file_name ! Null terminated
+      logical(C_BOOL) :: a_success
+    end function F_CheckpointWriter_write
+
+    subroutine F_CheckpointReader_new(this) &
+      bind(C, name="c_CheckpointReader_new")
+      import
+      implicit none
+      type(c_CheckpointReader) :: this
+    end subroutine F_CheckpointReader_new
+
+    subroutine F_CheckpointReader_delete(this) &
+      bind(C, name="c_CheckpointReader_delete")
+      import
+      implicit none
+      type(c_CheckpointReader) :: this
+    end subroutine F_CheckpointReader_delete
+
+    function F_CheckpointReader_open(this, a_file_name) result(a_success) &
+      bind(C, name="c_CheckpointReader_open")
+      import
+      implicit none
+      type(c_CheckpointReader) :: this
+      character(kind=C_CHAR), dimension(*), intent(in) :: a_file_name ! Null terminated
+      logical(C_BOOL) :: a_success
+    end function F_CheckpointReader_open
+
+    subroutine F_CheckpointReader_close(this) &
+      bind(C, name="c_CheckpointReader_close")
+      import
+      implicit none
+      type(c_CheckpointReader) :: this
+    end subroutine F_CheckpointReader_close
+
+    function F_CheckpointReader_getNumberOfRecords(this, a_name) &
+      result(a_number) &
+      bind(C, name="c_CheckpointReader_getNumberOfRecords")
+      import
+      implicit none
+      type(c_CheckpointReader) :: this
+      character(kind=C_CHAR), dimension(*), intent(in) :: a_name ! Null terminated
+      integer(C_SIZE_T) :: a_number
+    end function F_CheckpointReader_getNumberOfRecords
+
+    function F_CheckpointReader_readPlanarSep(this, a_name, a_size, &
+      a_separators) result(a_success) &
+      bind(C, name="c_CheckpointReader_readPlanarSep")
+      import
+      implicit none
+      type(c_CheckpointReader) :: this
+      character(kind=C_CHAR), dimension(*), intent(in) :: a_name ! Null terminated
+      integer(C_SIZE_T), intent(in) :: a_size
+      type(c_PlanarSep), dimension(*) :: a_separators
+      logical(C_BOOL) :: a_success
+    end function F_CheckpointReader_readPlanarSep
+
+    function F_CheckpointReader_readPlanarLoc(this, a_name, a_size, &
+      a_localizers) result(a_success) &
+      bind(C, name="c_CheckpointReader_readPlanarLoc")
+      import
+      implicit none
+      type(c_CheckpointReader) :: this
+      character(kind=C_CHAR), dimension(*), intent(in) :: a_name ! Null terminated
+      integer(C_SIZE_T), intent(in) :: a_size
+      type(c_PlanarLoc), dimension(*) :: a_localizers
+      logical(C_BOOL) :: a_success
+    end function F_CheckpointReader_readPlanarLoc
+
+    function F_CheckpointReader_readDoubles(this, a_name, a_size, &
+      a_values) result(a_success) &
+      bind(C, name="c_CheckpointReader_readDoubles")
+      import
+      implicit none
+      type(c_CheckpointReader) :: this
+      character(kind=C_CHAR), dimension(*), intent(in) :: a_name ! Null terminated
+      integer(C_SIZE_T), intent(in) :: a_size
+      real(C_DOUBLE), dimension(*), intent(out) :: a_values
+      logical(C_BOOL) :: a_success
+    end function F_CheckpointReader_readDoubles
+
+  end interface
+
+
+  contains
+
+    subroutine CheckpointWriter_class_new(this)
+      implicit none
+      type(CheckpointWriter_type), intent(inout) :: this
+      call F_CheckpointWriter_new(this%c_object)
+    end subroutine CheckpointWriter_class_new
+
+    impure elemental subroutine CheckpointWriter_class_delete(this)
+      implicit none
+      type(CheckpointWriter_type), intent(in) :: this
+      call F_CheckpointWriter_delete(this%c_object)
+    end subroutine CheckpointWriter_class_delete
+
+    subroutine CheckpointWriter_class_addPlanarSep(this, a_name, a_separators)
+      implicit none
+      type(CheckpointWriter_type), intent(inout) :: this
+      character(len=*), intent(in) :: a_name
+      type(PlanarSep_type), dimension(:), intent(in) :: a_separators
+      type(c_PlanarSep), dimension(size(a_separators)) :: c_separators
+      integer :: n
+      do n = 1, size(a_separators)
+        c_separators(n) = a_separators(n)%c_object
+      end do
+      call F_CheckpointWriter_addPlanarSep(this%c_object, &
+        trim(a_name)//C_NULL_CHAR, int(size(a_separators), C_SIZE_T), &
+        c_separators)
+    end subroutine CheckpointWriter_class_addPlanarSep
+
+    subroutine CheckpointWriter_class_addPlanarLoc(this, a_name, a_localizers)
+      implicit none
+      type(CheckpointWriter_type), intent(inout) :: this
+      character(len=*), intent(in) :: a_name
+      type(PlanarLoc_type), dimension(:), intent(in) :: a_localizers
+      type(c_PlanarLoc), dimension(size(a_localizers)) :: c_localizers
+      integer :: n
+      do n = 1, size(a_localizers)
+        c_localizers(n) = a_localizers(n)%c_object
+      end do
+      call F_CheckpointWriter_addPlanarLoc(this%c_object, &
+        trim(a_name)//C_NULL_CHAR, int(size(a_localizers), C_SIZE_T), &
+        c_localizers)
+    end subroutine CheckpointWriter_class_addPlanarLoc
+
+    subroutine CheckpointWriter_class_addDoubles(this, a_name, a_values)
+      implicit none
+      type(CheckpointWriter_type), intent(inout) :: this
+      character(len=*), intent(in) :: a_name
+      real(IRL_double), dimension(:), contiguous, target, intent(in) :: a_values
+      call F_CheckpointWriter_addDoubles(this%c_object, &
+        trim(a_name)//C_NULL_CHAR, int(size(a_values), C_SIZE_T), a_values)
+    end subroutine CheckpointWriter_class_addDoubles
+
+    subroutine CheckpointWriter_class_clear(this)
+      implicit none
+      type(CheckpointWriter_type), intent(inout) :: this
+      call F_CheckpointWriter_clear(this%c_object)
+    end subroutine CheckpointWriter_class_clear
+
+    function CheckpointWriter_class_write(this, a_file_name) result(a_success)
+      implicit none
+      type(CheckpointWriter_type), intent(in) :: this
+      character(len=*), intent(in) :: a_file_name
+      logical(1) :: a_success
+      a_success = F_CheckpointWriter_write(this%c_object, &
+        trim(a_file_name)//C_NULL_CHAR)
+    end function CheckpointWriter_class_write
+
+    subroutine CheckpointReader_class_new(this)
+      implicit none
+      type(CheckpointReader_type), intent(inout) :: this
+      call F_CheckpointReader_new(this%c_object)
+    end subroutine CheckpointReader_class_new
+
+    impure elemental subroutine CheckpointReader_class_delete(this)
+      implicit none
+      type(CheckpointReader_type), intent(in) :: this
+      call F_CheckpointReader_delete(this%c_object)
+    end subroutine CheckpointReader_class_delete
+
+    function CheckpointReader_class_open(this, a_file_name) result(a_success)
+      implicit none
+      type(CheckpointReader_type), intent(inout) :: this
+      character(len=*), intent(in) :: a_file_name
+      logical(1) :: a_success
+      a_success = F_CheckpointReader_open(this%c_object, &
+        trim(a_file_name)//C_NULL_CHAR)
+    end function CheckpointReader_class_open
+
+    subroutine CheckpointReader_class_close(this)
+      implicit none
+      type(CheckpointReader_type), intent(inout) :: this
+      call F_CheckpointReader_close(this%c_object)
+    end subroutine CheckpointReader_class_close
+
+    function CheckpointReader_class_getNumberOfRecords(this, a_name) &
+      result(a_number)
+      implicit none
+      type(CheckpointReader_type), intent(in) :: this
+      character(len=*), intent(in) :: a_name
+      integer(IRL_LargeOffsetIndex_t) :: a_number
+      a_number = F_CheckpointReader_getNumberOfRecords(this%c_object, &
+        trim(a_name)//C_NULL_CHAR)
+    end function CheckpointReader_class_getNumberOfRecords
+
+    function CheckpointReader_class_readPlanarSep(this, a_name, &
+      a_separators) result(a_success)
+      implicit none
+      type(CheckpointReader_type), intent(in) :: this
+      character(len=*), intent(in) :: a_name
+      type(PlanarSep_type), dimension(:), intent(inout) :: a_separators
+      logical(1) :: a_success
+      type(c_PlanarSep), dimension(size(a_separators)) :: c_separators
+      integer :: n
+      do n = 1, size(a_separators)
+        c_separators(n) = a_separators(n)%c_object
+      end do
+      a_success = F_CheckpointReader_readPlanarSep(this%c_object, &
+        trim(a_name)//C_NULL_CHAR, int(size(a_separators), C_SIZE_T), &
+        c_separators)
+    end function CheckpointReader_class_readPlanarSep
+
+    function CheckpointReader_class_readPlanarLoc(this, a_name, &
+      a_localizers) result(a_success)
+      implicit none
+      type(CheckpointReader_type), intent(in) :: this
+      character(len=*), intent(in) :: a_name
+      type(PlanarLoc_type), dimension(:), intent(inout) :: a_localizers
+      logical(1) :: a_success
+      type(c_PlanarLoc), dimension(size(a_localizers)) :: c_localizers
+      integer :: n
+      do n = 1, size(a_localizers)
+        c_localizers(n) = a_localizers(n)%c_object
+      end do
+      a_success = F_CheckpointReader_readPlanarLoc(this%c_object, &
+        trim(a_name)//C_NULL_CHAR, int(size(a_localizers), C_SIZE_T), &
+        c_localizers)
+    end function CheckpointReader_class_readPlanarLoc
+
+    function CheckpointReader_class_readDoubles(this, a_name, a_values) &
+      result(a_success)
+      implicit none
+      type(CheckpointReader_type), intent(in) :: this
+      character(len=*), intent(in) :: a_name
+      real(IRL_double), dimension(:), contiguous, intent(out) :: a_values
+      logical(1) :: a_success
+      a_success = F_CheckpointReader_readDoubles(this%c_object, &
+        trim(a_name)//C_NULL_CHAR, int(size(a_values), C_SIZE_T), a_values)
+    end function CheckpointReader_class_readDoubles
+
+end module f_Checkpoint_class
@@ -68,6 +68,26 @@ module f_getMoments
     module procedure getMoments_setMethod
   end interface getMoments_setMethod
 
+  interface getMoments_calibrateMethods
+    module procedure getMoments_calibrateMethods
+  end interface getMoments_calibrateMethods
+
+  interface getMoments_saveMethodTable
+    module procedure getMoments_saveMethodTable
+  end interface getMoments_saveMethodTable
+
+  interface getMoments_loadMethodTable
+    module procedure getMoments_loadMethodTable
+  end interface getMoments_loadMethodTable
+
+  interface getMoments_setNumberOfThreads
+    module procedure getMoments_setNumberOfThreads
+  end interface getMoments_setNumberOfThreads
+
+  interface getMoments_getNumberOfThreads
+    module procedure getMoments_getNumberOfThreads
+  end interface getMoments_getNumberOfThreads
+
   ! Moments that have been normalized by volume
   interface getNormMoments
     ! Cut Dod by LocSepLink to get SeparatedMoments<VM>
@@ -438,6 +458,134 @@ module f_getMoments
     module procedure getNormMoments_CapDod_TTTT_LocSep_SepVol
   end interface getMoments
 
+  interface
+    subroutine F_getMoments_setNumberOfThreads(a_number_of_threads) &
+    bind(C, name="c_getMoments_setNumberOfThreads")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      integer(C_INT) :: a_number_of_threads
+    end subroutine F_getMoments_setNumberOfThreads
+  end interface
+
+  interface
+    function F_getMoments_getNumberOfThreads() result(a_number_of_threads) &
+    bind(C, name="c_getMoments_getNumberOfThreads")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      integer(C_INT) :: a_number_of_threads
+    end function F_getMoments_getNumberOfThreads
+  end interface
+
+  interface
+    subroutine F_getNormMomentsBatch_RectCub_PlanarSep_Vol(a_number_of_cells, a_vertices, a_max_planes, &
+        a_number_of_planes, a_planes, a_moments_to_return) &
+    bind(C, name="c_getNormMomentsBatch_RectCub_PlanarSep_Vol")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      integer(C_INT) :: a_number_of_cells ! Number of cells in the batch
+      real(C_DOUBLE), dimension(*) :: a_vertices ! Vertices of each RectCub
+      integer(C_INT) :: a_max_planes ! Planes stored for each cell
+      integer(C_INT), dimension(*) :: a_number_of_planes ! Planes in the PlanarSep of each cell
+      real(C_DOUBLE), dimension(*) :: a_planes ! Normal and distance of each plane
+      real(C_DOUBLE), dimension(*) :: a_moments_to_return ! Where volumes are returned to
+    end subroutine F_getNormMomentsBatch_RectCub_PlanarSep_Vol
+  end interface
+
+  interface
+    subroutine F_getNormMomentsBatch_Tet_PlanarSep_Vol(a_number_of_cells, a_vertices, a_max_planes, &
+        a_number_of_planes, a_planes, a_moments_to_return) &
+    bind(C, name="c_getNormMomentsBatch_Tet_PlanarSep_Vol")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      integer(C_INT) :: a_number_of_cells ! Number of cells in the batch
+      real(C_DOUBLE), dimension(*) :: a_vertices ! Vertices of each Tet
+      integer(C_INT) :: a_max_planes ! Planes stored for each cell
+      integer(C_INT), dimension(*) :: a_number_of_planes ! Planes in the PlanarSep of each cell
+      real(C_DOUBLE), dimension(*) :: a_planes ! Normal and distance of each plane
+      real(C_DOUBLE), dimension(*) :: a_moments_to_return ! Where volumes are returned to
+    end subroutine F_getNormMomentsBatch_Tet_PlanarSep_Vol
+  end interface
+
+  interface
+    subroutine F_getNormMomentsBatch_Hex_PlanarSep_Vol(a_number_of_cells, a_vertices, a_max_planes, &
+        a_number_of_planes, a_planes, a_moments_to_return) &
+    bind(C, name="c_getNormMomentsBatch_Hex_PlanarSep_Vol")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      integer(C_INT) :: a_number_of_cells ! Number of cells in the batch
+      real(C_DOUBLE), dimension(*) :: a_vertices ! Vertices of each Hex
+      integer(C_INT) :: a_max_planes ! Planes stored for each cell
+      integer(C_INT), dimension(*) :: a_number_of_planes ! Planes in the PlanarSep of each cell
+      real(C_DOUBLE), dimension(*) :: a_planes ! Normal and distance of each plane
+      real(C_DOUBLE), dimension(*) :: a_moments_to_return ! Where volumes are returned to
+    end subroutine F_getNormMomentsBatch_Hex_PlanarSep_Vol
+  end interface
+
+  interface
+    subroutine F_getNormMomentsBatch_Hex_PlanarSep_SepVM(a_number_of_cells, a_vertices, a_max_planes, &
+        a_number_of_planes, a_planes, a_moments_to_return) &
+    bind(C, name="c_getNormMomentsBatch_Hex_PlanarSep_SepVM")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      integer(C_INT) :: a_number_of_cells ! Number of cells in the batch
+      real(C_DOUBLE), dimension(*) :: a_vertices ! Vertices of each Hex
+      integer(C_INT) :: a_max_planes ! Planes stored for each cell
+      integer(C_INT), dimension(*) :: a_number_of_planes ! Planes in the PlanarSep of each cell
+      real(C_DOUBLE), dimension(*) :: a_planes ! Normal and distance of each plane
+      real(C_DOUBLE), dimension(*) :: a_moments_to_return ! Where separated moments are returned to
+    end subroutine F_getNormMomentsBatch_Hex_PlanarSep_SepVM
+  end interface
+
+  interface
+    subroutine F_getNormMomentsBatch_Dod_PlanarSep_SepVM(a_number_of_cells, a_vertices, a_max_planes, &
+        a_number_of_planes, a_planes, a_moments_to_return) &
+    bind(C, name="c_getNormMomentsBatch_Dod_PlanarSep_SepVM")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      integer(C_INT) :: a_number_of_cells ! Number of cells in the batch
+      real(C_DOUBLE), dimension(*) :: a_vertices ! Vertices of each Dod
+      integer(C_INT) :: a_max_planes ! Planes stored for each cell
+      integer(C_INT), dimension(*) :: a_number_of_planes ! Planes in the PlanarSep of each cell
+      real(C_DOUBLE), dimension(*) :: a_planes ! Normal and distance of each plane
+      real(C_DOUBLE), dimension(*) :: a_moments_to_return ! Where separated moments are returned to
+    end subroutine F_getNormMomentsBatch_Dod_PlanarSep_SepVM
+  end interface
+
+  interface
+    subroutine F_getNormMomentsBatch_Dod_LocSepLink_Vol(a_number_of_cells, a_vertices, &
+        a_localized_separator_links, a_moments_to_return) &
+    bind(C, name="c_getNormMomentsBatch_Dod_LocSepLink_Vol")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      integer(C_INT) :: a_number_of_cells ! Number of cells in the batch
+      real(C_DOUBLE), dimension(*) :: a_vertices ! Vertices of each Dod
+      type(c_LocSepLink), dimension(*) :: a_localized_separator_links ! LocSepLink of each cell
+      real(C_DOUBLE), dimension(*) :: a_moments_to_return ! Where volumes are returned to
+    end subroutine F_getNormMomentsBatch_Dod_LocSepLink_Vol
+  end interface
+
+  interface
+    subroutine F_getNormMomentsBatch_Dod_LocSepLink_SepVM(a_number_of_cells, a_vertices, &
+        a_localized_separator_links, a_moments_to_return) &
+    bind(C, name="c_getNormMomentsBatch_Dod_LocSepLink_SepVM")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      integer(C_INT) :: a_number_of_cells ! Number of cells in the batch
+      real(C_DOUBLE), dimension(*) :: a_vertices ! Vertices of each Dod
+      type(c_LocSepLink), dimension(*) :: a_localized_separator_links ! LocSepLink of each cell
+      real(C_DOUBLE), dimension(*) :: a_moments_to_return ! Where separated moments are returned to
+    end subroutine F_getNormMomentsBatch_Dod_LocSepLink_SepVM
+  end interface
+
   interface
     subroutine F_getMoments_setMethod(a_cutting_method) &
     bind(C, name="c_getMoments_setMethod")
@@ -448,6 +596,37 @@ module f_getMoments
     end subroutine F_getMoments_setMethod
   end interface
 
+  interface
+    subroutine F_getMoments_calibrateMethods() &
+    bind(C, name="c_getMoments_calibrateMethods")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+    end subroutine F_getMoments_calibrateMethods
+  end interface
+
+  interface
+    function F_getMoments_saveMethodTable(a_file_name) result(a_success) &
+    bind(C, name="c_getMoments_saveMethodTable")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      character(kind=C_CHAR), dimension(*), intent(in) :: a_file_name ! Null terminated
+      logical(C_BOOL) :: a_success
+    end function F_getMoments_saveMethodTable
+  end interface
+
+  interface
+    function F_getMoments_loadMethodTable(a_file_name) result(a_success) &
+    bind(C, name="c_getMoments_loadMethodTable")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      character(kind=C_CHAR), dimension(*), intent(in) :: a_file_name ! Null terminated
+      logical(C_BOOL) :: a_success
+    end function F_getMoments_loadMethodTable
+  end interface
+
   interface
     subroutine F_getNormMoments_Dod_LocSepLink_SepVM(a_Dod, a_localized_separator_link, a_moments_to_return) &
     bind(C, name="c_getNormMoments_Dod_LocSepLink_SepVM")
@@ -1839,6 +2018,145 @@ contains
     call F_getMoments_setMethod(a_cutting_method)
   end subroutine getMoments_setMethod
 
+  subroutine getMoments_calibrateMethods()
+    use, intrinsic :: iso_c_binding
+    implicit none
+    call F_getMoments_calibrateMethods()
+  end subroutine getMoments_calibrateMethods
+
+  function getMoments_saveMethodTable(a_file_name) result(a_success)
+    use, intrinsic :: iso_c_binding
+    implicit none
+    character(len=*), intent(in) :: a_file_name
+    logical(1) :: a_success
+    a_success = F_getMoments_saveMethodTable(trim(a_file_name)//C_NULL_CHAR)
+  end function getMoments_saveMethodTable
+
+  function getMoments_loadMethodTable(a_file_name) result(a_success)
+    use, intrinsic :: iso_c_binding
+    implicit none
+    character(len=*), intent(in) :: a_file_name
+    logical(1) :: a_success
+    a_success = F_getMoments_loadMethodTable(trim(a_file_name)//C_NULL_CHAR)
+  end function getMoments_loadMethodTable
+
+  subroutine getMoments_setNumberOfThreads(a_number_of_threads)
+    use, intrinsic :: iso_c_binding
+    implicit none
+    integer(IRL_SignedIndex_t), intent(in) :: a_number_of_threads
+    call F_getMoments_setNumberOfThreads(a_number_of_threads)
+  end subroutine getMoments_setNumberOfThreads
+
+  function getMoments_getNumberOfThreads() result(a_number_of_threads)
+    use, intrinsic :: iso_c_binding
+    implicit none
+    integer(IRL_SignedIndex_t) :: a_number_of_threads
+    a_number_of_threads = F_getMoments_getNumberOfThreads()
+  end function getMoments_getNumberOfThreads
+
+  ! The getNormMomentsBatch subroutines compute the normalized moments of
+  ! many cells in one call. The vertices of cell n are a_vertices(:,:,n),
+  ! and its PlanarSep is made of the planes a_planes(:,1:a_number_of_planes(n),n),
+  ! each stored as its normal followed by its distance. Moments are returned
+  ! in a_moments_to_return(n) for a volume, or a_moments_to_return(:,n) as the
+  ! liquid volume and centroid followed by the gas volume and centroid.
+
+  subroutine getNormMomentsBatch_RectCub_PlanarSep_Vol(a_vertices, a_number_of_planes, a_planes, a_moments_to_return)
+    use, intrinsic :: iso_c_binding
+    implicit none
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_vertices ! (3, 8, number of cells)
+      integer(IRL_SignedIndex_t), dimension(:), intent(in) :: a_number_of_planes ! (number of cells)
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_planes ! (4, max planes, number of cells)
+      real(IRL_double), dimension(:), intent(inout) :: a_moments_to_return ! (number of cells)
+
+      call F_getNormMomentsBatch_RectCub_PlanarSep_Vol &
+          (size(a_number_of_planes), a_vertices, size(a_planes, 2), &
+           a_number_of_planes, a_planes, a_moments_to_return)
+
+  end subroutine getNormMomentsBatch_RectCub_PlanarSep_Vol
+
+  subroutine getNormMomentsBatch_Tet_PlanarSep_Vol(a_vertices, a_number_of_planes, a_planes, a_moments_to_return)
+    use, intrinsic :: iso_c_binding
+    implicit none
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_vertices ! (3, 4, number of cells)
+      integer(IRL_SignedIndex_t), dimension(:), intent(in) :: a_number_of_planes ! (number of cells)
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_planes ! (4, max planes, number of cells)
+      real(IRL_double), dimension(:), intent(inout) :: a_moments_to_return ! (number of cells)
+
+      call F_getNormMomentsBatch_Tet_PlanarSep_Vol &
+          (size(a_number_of_planes), a_vertices, size(a_planes, 2), &
+           a_number_of_planes, a_planes, a_moments_to_return)
+
+  end subroutine getNormMomentsBatch_Tet_PlanarSep_Vol
+
+  subroutine getNormMomentsBatch_Hex_PlanarSep_Vol(a_vertices, a_number_of_planes, a_planes, a_moments_to_return)
+    use, intrinsic :: iso_c_binding
+    implicit none
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_vertices ! (3, 8, number of cells)
+      integer(IRL_SignedIndex_t), dimension(:), intent(in) :: a_number_of_planes ! (number of cells)
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_planes ! (4, max planes, number of cells)
+      real(IRL_double), dimension(:), intent(inout) :: a_moments_to_return ! (number of cells)
+
+      call F_getNormMomentsBatch_Hex_PlanarSep_Vol &
+          (size(a_number_of_planes), a_vertices, size(a_planes, 2), &
+           a_number_of_planes, a_planes, a_moments_to_return)
+
+  end subroutine getNormMomentsBatch_Hex_PlanarSep_Vol
+
+  subroutine getNormMomentsBatch_Hex_PlanarSep_SepVM(a_vertices, a_number_of_planes, a_planes, a_moments_to_return)
+    use, intrinsic :: iso_c_binding
+    implicit none
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_vertices ! (3, 8, number of cells)
+      integer(IRL_SignedIndex_t), dimension(:), intent(in) :: a_number_of_planes ! (number of cells)
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_planes ! (4, max planes, number of cells)
+      real(IRL_double), dimension(:,:), intent(inout) :: a_moments_to_return ! (8, number of cells)
+
+      call F_getNormMomentsBatch_Hex_PlanarSep_SepVM &
+          (size(a_number_of_planes), a_vertices, size(a_planes, 2), &
+           a_number_of_planes, a_planes, a_moments_to_return)
+
+  end subroutine getNormMomentsBatch_Hex_PlanarSep_SepVM
+
+  subroutine getNormMomentsBatch_Dod_PlanarSep_SepVM(a_vertices, a_number_of_planes, a_planes, a_moments_to_return)
+    use, intrinsic :: iso_c_binding
+    implicit none
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_vertices ! (3, 8, number of cells)
+      integer(IRL_SignedIndex_t), dimension(:), intent(in) :: a_number_of_planes ! (number of cells)
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_planes ! (4, max planes, number of cells)
+      real(IRL_double), dimension(:,:), intent(inout) :: a_moments_to_return ! (8, number of cells)
+
+      call F_getNormMomentsBatch_Dod_PlanarSep_SepVM &
+          (size(a_number_of_planes), a_vertices, size(a_planes, 2), &
+           a_number_of_planes, a_planes, a_moments_to_return)
+
+  end subroutine getNormMomentsBatch_Dod_PlanarSep_SepVM
+
+  subroutine getNormMomentsBatch_Dod_LocSepLink_Vol(a_vertices, a_localized_separator_links, a_moments_to_return)
+    use, intrinsic :: iso_c_binding
+    implicit none
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_vertices ! (3, 8, number of cells)
+      type(LocSepLink_type), dimension(:), intent(in) :: a_localized_separator_links ! (number of cells)
+      real(IRL_double), dimension(:), intent(inout) :: a_moments_to_return ! (number of cells)
+
+      call F_getNormMomentsBatch_Dod_LocSepLink_Vol &
+          (size(a_localized_separator_links), a_vertices, &
+           a_localized_separator_links%c_object, a_moments_to_return)
+
+  end subroutine getNormMomentsBatch_Dod_LocSepLink_Vol
+
+  subroutine getNormMomentsBatch_Dod_LocSepLink_SepVM(a_vertices, a_localized_separator_links, a_moments_to_return)
+    use, intrinsic :: iso_c_binding
+    implicit none
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_vertices ! (3, 8, number of cells)
+      type(LocSepLink_type), dimension(:), intent(in) :: a_localized_separator_links ! (number of cells)
+      real(IRL_double), dimension(:,:), intent(inout) :: a_moments_to_return ! (8, number of cells)
+
+      call F_getNormMomentsBatch_Dod_LocSepLink_SepVM &
+          (size(a_localized_separator_links), a_vertices, &
+           a_localized_separator_links%c_object, a_moments_to_return)
+
+  end subroutine getNormMomentsBatch_Dod_LocSepLink_SepVM
+
   subroutine getNormMoments_Dod_LocSepLink_SepVM(a_Dod, a_localized_separator_link, a_moments_to_return)
     use, intrinsic :: iso_c_binding
     implicit none
@@ -0,0 +1,281 @@
+!  This file is part of the Interface Reconstruction Library (IRL),
+!  a library for interface reconstruction and computational geometry operations.
+!
+!  Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+!
+!  This Source Code Form is subject to the terms of the Mozilla Public
+!  License, v. 2.0. If a copy of the MPL was not distributed with this
+!  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+!> \file f_meshreconstructor_class.f90
+!!
+!! This file contains the Fortran interface for the
+!! MeshReconstructor class.
+
+!> \brief A fortran type class that allows the creation of
+!! IRL's MeshReconstructor class along with enabling
+!! some of its methods.
+!!
+!! Cell (i,j,k) of a structured mesh is stored at
+!! index i + nx*(j + ny*k) (0-based), and neighbor lists
+!! for hexahedra use 0-based cell indices in CSR form.
+module f_MeshReconstructor_class
+  use, intrinsic :: iso_c_binding
+  use f_DefinedTypes
+  use f_PlanarSep_class
+  implicit none
+
+  integer(C_INT), parameter, public :: IRL_MeshReconstruction_ELVIRA3D = 0
+  integer(C_INT), parameter, public :: IRL_MeshReconstruction_LVIRA3D = 1
+  integer(C_INT), parameter, public :: IRL_MeshReconstruction_R2P3D = 2
+  integer(C_INT), parameter, public :: IRL_MeshReconstruction_MOF3D = 3
+
+  type, public, bind(C) :: c_MeshReconstructor
+    type(C_PTR), private :: object = C_NULL_PTR
+  end type c_MeshReconstructor
+
+  type, public :: MeshReconstructor_type
+    type(c_MeshReconstructor) :: c_object
+  contains
+    final :: MeshReconstructor_class_delete
+  end type MeshReconstructor_type
+
+  interface new
+    module procedure MeshReconstructor_class_new
+  end interface
+  interface setMethod
+    module procedure MeshReconstructor_class_setMethod
+  end interface
+  interface setGrainSize
+    module procedure MeshReconstructor_class_setGrainSize
+  end interface
+  interface getNumberOfThreads
+    module procedure MeshReconstructor_class_getNumberOfThreads
+  end interface
+  interface reconstructStructured
+    module procedure MeshReconstructor_class_reconstructStructured
+  end interface
+  interface reconstructHexahedra
+    module procedure MeshReconstructor_class_reconstructHexahedra
+  end interface
+  interface getCellTimes
+    module procedure MeshReconstructor_class_getCellTimes
+  end interface
+  interface getCellIterations
+    module procedure MeshReconstructor_class_getCellIterations
+  end interface
+  interface getNumberOfMixedCells
+    module procedure MeshReconstructor_class_getNumberOfMixedCells
+  end interface
+
+
+  interface
+
+    subroutine F_MeshReconstructor_new(this, a_number_of_threads) &
+      bind(C, name="c_MeshReconstructor_new")
+      import
+      implicit none
+      type(c_MeshReconstructor) :: this
+      integer(C_INT), intent(in) :: a_number_of_threads
+    end subroutine F_MeshReconstructor_new
+
+    subroutine F_MeshReconstructor_delete(this) &
+      bind(C, name="c_MeshReconstructor_delete")
+      import
+      implicit none
+      type(c_MeshReconstructor) :: this
+    end subroutine F_MeshReconstructor_delete
+
+    subroutine F_MeshReconstructor_setMethod(this, a_method) &
+      bind(C, name="c_MeshReconstructor_setMethod")
+      import
+      implicit none
+      type(c_MeshReconstructor) :: this
+      integer(C_INT), intent(in) :: a_method
+    end subroutine F_MeshReconstructor_setMethod
+
+    subroutine F_MeshReconstructor_setGrainSize(this, a_grain_size) &
+      bind(C, name="c_MeshReconstructor_setGrainSize")
+      import
+      implicit none
+      type(c_MeshReconstructor) :: this
+      integer(C_INT), intent(in) :: a_grain_size
+    end subroutine F_MeshReconstructor_setGrainSize
+
+    function F_MeshReconstructor_getNumberOfThreads(this) result(a_number) &
+      bind(C, name="c_MeshReconstructor_getNumberOfThreads")
+      import
+      implicit none
+      type(c_MeshReconstructor) :: this
+      integer(C_INT) :: a_number
+    end function F_MeshReconstructor_getNumberOfThreads
+
+    subroutine F_MeshReconstructor_reconstructStructured(this, a_dimensions, &
+      a_x, a_y, a_z, a_liquid_volume_fraction, a_liquid_centroid, &
+      a_gas_centroid, a_separators) &
+      bind(C, name="c_MeshReconstructor_reconstructStructured")
+      import
+      implicit none
+      type(c_MeshReconstructor) :: this
+      integer(C_INT), dimension(*), intent(in) :: a_dimensions ! dimension(3)
+      real(C_DOUBLE), dimension(*), intent(in) :: a_x
+      real(C_DOUBLE), dimension(*), intent(in) :: a_y
+      real(C_DOUBLE), dimension(*), intent(in) :: a_z
+      real(C_DOUBLE), dimension(*), intent(in) :: a_liquid_volume_fraction
+      real(C_DOUBLE), dimension(*), intent(in) :: a_liquid_centroid
+      real(C_DOUBLE), dimension(*), intent(in) :: a_gas_centroid
+      type(c_PlanarSep), dimension(*) :: a_separators
+    end subroutine F_MeshReconstructor_reconstructStructured
+
+    subroutine F_MeshReconstructor_reconstructHexahedra(this, &
+      a_number_of_cells, a_vertices, a_neighbor_offsets, a_neighbors, &
+      a_liquid_volume_fraction, a_liquid_centroid, a_gas_centroid, &
+      a_separators) &
+      bind(C, name="c_MeshReconstructor_reconstructHexahedra")
+      import
+      implicit none
+      type(c_MeshReconstructor) :: this
+      integer(C_INT), intent(in) :: a_number_of_cells
+      real(C_DOUBLE), dimension(*), intent(in) :: a_vertices
+      integer(C_INT), dimension(*), intent(in) :: a_neighbor_offsets
+      integer(C_INT), dimension(*), intent(in) :: a_neighbors
+      real(C_DOUBLE), dimension(*), intent(in) :: a_liquid_volume_fraction
+      real(C_DOUBLE), dimension(*), intent(in) :: a_liquid_centroid
+      real(C_DOUBLE), dimension(*), intent(in) :: a_gas_centroid
+      type(c_PlanarSep), dimension(*) :: a_separators
+    end subroutine F_MeshReconstructor_reconstructHexahedra
+
+    subroutine F_MeshReconstructor_getCellTimes(this, a_cell_times) &
+      bind(C, name="c_MeshReconstructor_getCellTimes")
+      import
+      implicit none
+      type(c_MeshReconstructor) :: this
+      real(C_DOUBLE), dimension(*), intent(out) :: a_cell_times
+    end subroutine F_MeshReconstructor_getCellTimes
+
+    subroutine F_MeshReconstructor_getCellIterations(this, a_cell_iterations) &
+      bind(C, name="c_MeshReconstructor_getCellIterations")
+      import
+      implicit none
+      type(c_MeshReconstructor) :: this
+      integer(C_INT), dimension(*), intent(out) :: a_cell_iterations
+    end subroutine F_MeshReconstructor_getCellIterations
+
+    function F_MeshReconstructor_getNumberOfMixedCells(this) result(a_number) &
+      bind(C, name="c_MeshReconstructor_getNumberOfMixedCells")
+      import
+      implicit none
+      type(c_MeshReconstructor) :: this
+      integer(C_INT) :: a_number
+    end function F_MeshReconstructor_getNumberOfMixedCells
+
+  end interface
+
+
+  contains
+
+    subroutine MeshReconstructor_class_new(this, a_number_of_threads)
+      implicit none
+      type(MeshReconstructor_type), intent(inout) :: this
+      integer, intent(in) :: a_number_of_threads
+      call F_MeshReconstructor_new(this%c_object, a_number_of_threads)
+    end subroutine MeshReconstructor_class_new
+
+    impure elemental subroutine MeshReconstructor_class_delete(this)
+      implicit none
+      type(MeshReconstructor_type), intent(in) :: this
+      call F_MeshReconstructor_delete(this%c_object)
+    end subroutine MeshReconstructor_class_delete
+
+    subroutine MeshReconstructor_class_setMethod(this, a_method)
+      implicit none
+      type(MeshReconstructor_type), intent(inout) :: this
+      integer, intent(in) :: a_method
+      call F_MeshReconstructor_setMethod(this%c_object, a_method)
+    end subroutine MeshReconstructor_class_setMethod
+
+    subroutine MeshReconstructor_class_setGrainSize(this, a_grain_size)
+      implicit none
+      type(MeshReconstructor_type), intent(inout) :: this
+      integer, intent(in) :: a_grain_size
+      call F_MeshReconstructor_setGrainSize(this%c_object, a_grain_size)
+    end subroutine MeshReconstructor_class_setGrainSize
+
+    function MeshReconstructor_class_getNumberOfThreads(this) result(a_number)
+      implicit none
+      type(MeshReconstructor_type), intent(in) :: this
+      integer :: a_number
+      a_number = F_MeshReconstructor_getNumberOfThreads(this%c_object)
+    end function MeshReconstructor_class_getNumberOfThreads
+
+    subroutine MeshReconstructor_class_reconstructStructured(this, &
+      a_dimensions, a_x, a_y, a_z, a_liquid_volume_fraction, &
+      a_liquid_centroid, a_gas_centroid, a_separators)
+      implicit none
+      type(MeshReconstructor_type), intent(inout) :: this
+      integer, dimension(3), intent(in) :: a_dimensions
+      real(IRL_double), dimension(:), intent(in) :: a_x
+      real(IRL_double), dimension(:), intent(in) :: a_y
+      real(IRL_double), dimension(:), intent(in) :: a_z
+      real(IRL_double), dimension(:), intent(in) :: a_liquid_volume_fraction
+      real(IRL_double), dimension(:,:), intent(in) :: a_liquid_centroid
+      real(IRL_double), dimension(:,:), intent(in) :: a_gas_centroid
+      type(PlanarSep_type), dimension(:), intent(inout) :: a_separators
+      type(c_PlanarSep), dimension(size(a_separators)) :: c_separators
+      integer :: n
+      do n = 1, size(a_separators)
+        c_separators(n) = a_separators(n)%c_object
+      end do
+      call F_MeshReconstructor_reconstructStructured(this%c_object, &
+        a_dimensions, a_x, a_y, a_z, a_liquid_volume_fraction, &
+        a_liquid_centroid, a_gas_centroid, c_separators)
+    end subroutine MeshReconstructor_class_reconstructStructured
+
+    subroutine MeshReconstructor_class_reconstructHexahedra(this, &
+      a_vertices, a_neighbor_offsets, a_neighbors, a_liquid_volume_fraction, &
+      a_liquid_centroid, a_gas_centroid, a_separators)
+      implicit none
+      type(MeshReconstructor_type), intent(inout) :: this
+      real(IRL_double), dimension(:,:,:), intent(in) :: a_vertices ! (3,8,N)
+      integer, dimension(:), intent(in) :: a_neighbor_offsets
+      integer, dimension(:), intent(in) :: a_neighbors
+      real(IRL_double), dimension(:), intent(in) :: a_liquid_volume_fraction
+      real(IRL_double), dimension(:,:), intent(in) :: a_liquid_centroid
+      real(IRL_double), dimension(:,:), intent(in) :: a_gas_centroid
+      type(PlanarSep_type), dimension(:), intent(inout) :: a_separators
+      type(c_PlanarSep), dimension(size(a_separators)) :: c_separators
+      integer :: n
+      do n = 1, size(a_separators)
+        c_separators(n) = a_separators(n)%c_object
+      end do
+      call F_MeshReconstructor_reconstructHexahedra(this%c_object, &
+        size(a_separators), a_vertices, a_neighbor_offsets, a_neighbors, &
+        a_liquid_volume_fraction, a_liquid_centroid, a_gas_centroid, &
+        c_separators)
+    end subroutine MeshReconstructor_class_reconstructHexahedra
+
+    subroutine MeshReconstructor_class_getCellTimes(this, a_cell_times)
+      implicit none
+      type(MeshReconstructor_type), intent(in) :: this
+      real(IRL_double), dimension(:), intent(out) :: a_cell_times
+      call F_MeshReconstructor_getCellTimes(this%c_object, a_cell_times)
+    end subroutine MeshReconstructor_class_getCellTimes
+
+    subroutine MeshReconstructor_class_getCellIterations(this, &
+      a_cell_iterations)
+      implicit none
+      type(MeshReconstructor_type), intent(in) :: this
+      integer, dimension(:), intent(out) :: a_cell_iterations
+      call F_MeshReconstructor_getCellIterations(this%c_object, &
+        a_cell_iterations)
+    end subroutine MeshReconstructor_class_getCellIterations
+
+    function MeshReconstructor_class_getNumberOfMixedCells(this) &
+      result(a_number)
+      implicit none
+      type(MeshReconstructor_type), intent(in) :: this
+      integer :: a_number
+      a_number = F_MeshReconstructor_getNumberOfMixedCells(this%c_object)
+    end function MeshReconstructor_class_getNumberOfMixedCells
+
+end module f_MeshReconstructor_class
@@ -34,6 +34,10 @@ module f_ObjServer_LocSep_class
     module procedure ObjServer_LocSep_class_new
   end interface
 
+  interface reset
+    module procedure ObjServer_LocSep_class_reset
+  end interface
+
   interface
 
     subroutine F_ObjServer_LocSep_new(this, a_number_to_allocate) &
@@ -51,6 +55,13 @@ module f_ObjServer_LocSep_class
       type(c_ObjServer_LocSep) :: this
     end subroutine F_ObjServer_LocSep_delete
 
+    subroutine F_ObjServer_LocSep_reset(this) &
+      bind(C, name="c_ObjServer_LocSep_reset")
+      import
+      implicit none
+      type(c_ObjServer_LocSep) :: this
+    end subroutine F_ObjServer_LocSep_reset
+
   end interface
 
   contains
@@ -62,6 +73,12 @@ module f_ObjServer_LocSep_class
       call F_ObjServer_LocSep_new(this%c_object, a_number_to_allocate)
     end subroutine ObjServer_LocSep_class_new
 
+    subroutine ObjServer_LocSep_class_reset(this)
+      implicit none
+      type(ObjServer_LocSep_type), intent(inout) :: this
+      call F_ObjServer_LocSep_reset(this%c_object)
+    end subroutine ObjServer_LocSep_class_reset
+
     impure elemental subroutine ObjServer_LocSep_class_delete(this)
       implicit none
       type(ObjServer_LocSep_type), intent(in) :: this
@@ -34,6 +34,10 @@ module f_ObjServer_LocLink_class
     module procedure ObjServer_LocLink_class_new
   end interface
 
+  interface reset
+    module procedure ObjServer_LocLink_class_reset
+  end interface
+
   interface
 
     subroutine F_ObjServer_LocLink_new(this, a_number_to_allocate) &
@@ -51,6 +55,13 @@ module f_ObjServer_LocLink_class
       type(c_ObjServer_LocLink) :: this
     end subroutine F_ObjServer_LocLink_delete
 
+    subroutine F_ObjServer_LocLink_reset(this) &
+      bind(C, name="c_ObjServer_LocLink_reset")
+      import
+      implicit none
+      type(c_ObjServer_LocLink) :: this
+    end subroutine F_ObjServer_LocLink_reset
+
   end interface
 
   contains
@@ -62,6 +73,12 @@ module f_ObjServer_LocLink_class
       call F_ObjServer_LocLink_new(this%c_object, a_number_to_allocate)
     end subroutine ObjServer_LocLink_class_new
 
+    subroutine ObjServer_LocLink_class_reset(this)
+      implicit none
+      type(ObjServer_LocLink_type), intent(inout) :: this
+      call F_ObjServer_LocLink_reset(this%c_object)
+    end subroutine ObjServer_LocLink_class_reset
+
     impure elemental subroutine ObjServer_LocLink_class_delete(this)
       implicit none
       type(ObjServer_LocLink_type), intent(in) :: this
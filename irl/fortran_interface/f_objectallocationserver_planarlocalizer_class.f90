@@ -34,6 +34,10 @@ module f_ObjServer_PlanarLoc_class
     module procedure ObjServer_PlanarLoc_class_new
   end interface
 
+  interface reset
+    module procedure ObjServer_PlanarLoc_class_reset
+  end interface
+
   interface
 
     subroutine F_ObjServer_PlanarLoc_new(this, a_number_to_allocate) &
@@ -51,6 +55,13 @@ module f_ObjServer_PlanarLoc_class
       type(c_ObjServer_PlanarLoc) :: this
     end subroutine F_ObjServer_PlanarLoc_delete
 
+    subroutine F_ObjServer_PlanarLoc_reset(this) &
+      bind(C, name="c_ObjServer_PlanarLoc_reset")
+      import
+      implicit none
+      type(c_ObjServer_PlanarLoc) :: this
+    end subroutine F_ObjServer_PlanarLoc_reset
+
   end interface
 
   contains
@@ -62,6 +73,12 @@ module f_ObjServer_PlanarLoc_class
       call F_ObjServer_PlanarLoc_new(this%c_object, a_number_to_allocate)
     end subroutine ObjServer_PlanarLoc_class_new
 
+    subroutine ObjServer_PlanarLoc_class_reset(this)
+      implicit none
+      type(ObjServer_PlanarLoc_type), intent(inout) :: this
+      call F_ObjServer_PlanarLoc_reset(this%c_object)
+    end subroutine ObjServer_PlanarLoc_class_reset
+
     impure elemental subroutine ObjServer_PlanarLoc_class_delete(this)
       implicit none
       type(ObjServer_PlanarLoc_type), intent(in) :: this
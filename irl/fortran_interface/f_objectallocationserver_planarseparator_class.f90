@@ -34,6 +34,10 @@ module f_ObjServer_PlanarSep_class
     module procedure ObjServer_PlanarSep_class_new
   end interface
 
+  interface reset
+    module procedure ObjServer_PlanarSep_class_reset
+  end interface
+
   interface
 
     subroutine F_ObjServer_PlanarSep_new(this, a_number_to_allocate) &
@@ -51,6 +55,13 @@ module f_ObjServer_PlanarSep_class
       type(c_ObjServer_PlanarSep) :: this
     end subroutine F_ObjServer_PlanarSep_delete
 
+    subroutine F_ObjServer_PlanarSep_reset(this) &
+      bind(C, name="c_ObjServer_PlanarSep_reset")
+      import
+      implicit none
+      type(c_ObjServer_PlanarSep) :: this
+    end subroutine F_ObjServer_PlanarSep_reset
+
   end interface
 
   contains
@@ -62,6 +73,12 @@ module f_ObjServer_PlanarSep_class
       call F_ObjServer_PlanarSep_new(this%c_object, a_number_to_allocate)
     end subroutine ObjServer_PlanarSep_class_new
 
+    subroutine ObjServer_PlanarSep_class_reset(this)
+      implicit none
+      type(ObjServer_PlanarSep_type), intent(inout) :: this
+      call F_ObjServer_PlanarSep_reset(this%c_object)
+    end subroutine ObjServer_PlanarSep_class_reset
+
     impure elemental subroutine ObjServer_PlanarSep_class_delete(this)
       implicit none
       type(ObjServer_PlanarSep_type), intent(in) :: this
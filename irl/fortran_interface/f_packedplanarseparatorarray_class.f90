@@ -0,0 +1,190 @@
+!  This file is part of the Interface Reconstruction Library (IRL),
+!  a library for interface reconstruction and computational geometry operations.
+!
+!  Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+!
+!  This Source Code Form is subject to the terms of the Mozilla Public
+!  License, v. 2.0. If a copy of the MPL was not distributed with this
+!  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+!> \file f_PackedPlanarSeparatorArray_class.f90
+!!
+!! This file allows use of the IRL PackedPlanarSeparatorArray
+!! class through a fortran interface.
+
+!> \brief A fortran type class that allows the creation of
+!! IRL's PackedPlanarSeparatorArray class, which stores one
+!! PlanarSeparator per cell in a compact form. Cell indices
+!! are zero-based.
+module f_PackedPlanarSepArray_class
+  use, intrinsic :: iso_c_binding
+  use f_DefinedTypes
+  use f_PlanarSep_class
+  implicit none
+
+  type, public, bind(C) :: c_PackedPlanarSepArray
+    type(C_PTR), private :: object = C_NULL_PTR
+  end type c_PackedPlanarSepArray
+
+  type, public :: PackedPlanarSepArray_type
+    type(c_PackedPlanarSepArray) :: c_object
+  contains
+    final :: PackedPlanarSepArray_class_delete
+  end type PackedPlanarSepArray_type
+
+  interface new
+    module procedure PackedPlanarSepArray_class_new
+  end interface
+  interface resize
+    module procedure PackedPlanarSepArray_class_resize
+  end interface
+  interface getSize
+    module procedure PackedPlanarSepArray_class_getSize
+  end interface
+  interface setSeparator
+    module procedure PackedPlanarSepArray_class_set
+  end interface
+  interface getSeparator
+    module procedure PackedPlanarSepArray_class_get
+  end interface
+  interface getNumberOfPlanes
+    module procedure PackedPlanarSepArray_class_getNumberOfPlanes
+  end interface
+  interface getNumberOfOverflowSeparators
+    module procedure PackedPlanarSepArray_class_getNumberOfOverflowSeparators
+  end interface
+
+
+  interface
+
+    subroutine F_PackedPlanarSepArray_new(this, a_size) &
+      bind(C, name="c_PackedPlanarSepArray_new")
+      import
+      implicit none
+      type(c_PackedPlanarSepArray) :: this
+      integer(C_INT), intent(in) :: a_size ! scalar
+    end subroutine F_PackedPlanarSepArray_new
+
+    subroutine F_PackedPlanarSepArray_delete(this) &
+      bind(C, name="c_PackedPlanarSepArray_delete")
+      import
+      implicit none
+      type(c_PackedPlanarSepArray) :: this
+    end subroutine F_PackedPlanarSepArray_delete
+
+    subroutine F_PackedPlanarSepArray_resize(this, a_size) &
+      bind(C, name="c_PackedPlanarSepArray_resize")
+      import
+      implicit none
+      type(c_PackedPlanarSepArray) :: this
+      integer(C_INT), intent(in) :: a_size ! scalar
+    end subroutine F_PackedPlanarSepArray_resize
+
+    function F_PackedPlanarSepArray_getSize(this) result(a_size) &
+      bind(C, name="c_PackedPlanarSepArray_getSize")
+      import
+      implicit none
+      type(c_PackedPlanarSepArray) :: this
+      integer(C_INT) :: a_size
+    end function F_PackedPlanarSepArray_getSize
+
+    subroutine F_PackedPlanarSepArray_set(this, a_index, a_separator) &
+      bind(C, name="c_PackedPlanarSepArray_set")
+      import
+      implicit none
+      type(c_PackedPlanarSepArray) :: this
+      integer(C_INT), intent(in) :: a_index ! scalar
+      type(c_PlanarSep) :: a_separator
+    end subroutine F_PackedPlanarSepArray_set
+
+    subroutine F_PackedPlanarSepArray_get(this, a_index, a_separator) &
+      bind(C, name="c_PackedPlanarSepArray_get")
+      import
+      implicit none
+      type(c_PackedPlanarSepArray) :: this
+      integer(C_INT), intent(in) :: a_index ! scalar
+      type(c_PlanarSep) :: a_separator
+    end subroutine F_PackedPlanarSepArray_get
+
+    function F_PackedPlanarSepArray_getNumberOfPlanes(this, a_index) result(a_number_of_planes) &
+      bind(C, name="c_PackedPlanarSepArray_getNumberOfPlanes")
+      import
+      implicit none
+      type(c_PackedPlanarSepArray) :: this
+      integer(C_INT), intent(in) :: a_index ! scalar
+      integer(C_INT) :: a_number_of_planes
+    end function F_PackedPlanarSepArray_getNumberOfPlanes
+
+    function F_PackedPlanarSepArray_getNumberOfOverflowSeparators(this) result(a_number) &
+      bind(C, name="c_PackedPlanarSepArray_getNumberOfOverflowSeparators")
+      import
+      implicit none
+      type(c_PackedPlanarSepArray) :: this
+      integer(C_INT) :: a_number
+    end function F_PackedPlanarSepArray_getNumberOfOverflowSeparators
+
+  end interface
+
+
+  contains
+
+    subroutine PackedPlanarSepArray_class_new(this, a_size)
+      implicit none
+      type(PackedPlanarSepArray_type), intent(inout) :: this
+      integer(IRL_UnsignedIndex_t), intent(in) :: a_size
+      call F_PackedPlanarSepArray_new(this%c_object, a_size)
+    end subroutine PackedPlanarSepArray_class_new
+
+    impure elemental subroutine PackedPlanarSepArray_class_delete(this)
+      implicit none
+      type(PackedPlanarSepArray_type), intent(in) :: this
+      call F_PackedPlanarSepArray_delete(this%c_object)
+    end subroutine PackedPlanarSepArray_class_delete
+
+    subroutine PackedPlanarSepArray_class_resize(this, a_size)
+      implicit none
+      type(PackedPlanarSepArray_type), intent(in) :: this
+      integer(IRL_UnsignedIndex_t), intent(in) :: a_size
+      call F_PackedPlanarSepArray_resize(this%c_object, a_size)
+    end subroutine PackedPlanarSepArray_class_resize
+
+    function PackedPlanarSepArray_class_getSize(this) result(a_size)
+      implicit none
+      type(PackedPlanarSepArray_type), intent(in) :: this
+      integer(IRL_UnsignedIndex_t) :: a_size
+      a_size = F_PackedPlanarSepArray_getSize(this%c_object)
+    end function PackedPlanarSepArray_class_getSize
+
+    subroutine PackedPlanarSepArray_class_set(this, a_index, a_separator)
+      implicit none
+      type(PackedPlanarSepArray_type), intent(in) :: this
+      integer(IRL_UnsignedIndex_t), intent(in) :: a_index
+      type(PlanarSep_type), intent(in) :: a_separator
+      call F_PackedPlanarSepArray_set(this%c_object, a_index, a_separator%c_object)
+    end subroutine PackedPlanarSepArray_class_set
+
+    subroutine PackedPlanarSepArray_class_get(this, a_index, a_separator)
+      implicit none
+      type(PackedPlanarSepArray_type), intent(in) :: this
+      integer(IRL_UnsignedIndex_t), intent(in) :: a_index
+      type(PlanarSep_type), intent(inout) :: a_separator
+      call F_PackedPlanarSepArray_get(this%c_object, a_index, a_separator%c_object)
+    end subroutine PackedPlanarSepArray_class_get
+
+    function PackedPlanarSepArray_class_getNumberOfPlanes(this, a_index) result(a_number_of_planes)
+      implicit none
+      type(PackedPlanarSepArray_type), intent(in) :: this
+      integer(IRL_UnsignedIndex_t), intent(in) :: a_index
+      integer(IRL_UnsignedIndex_t) :: a_number_of_planes
+      a_number_of_planes = F_PackedPlanarSepArray_getNumberOfPlanes(this%c_object, a_index)
+    end function PackedPlanarSepArray_class_getNumberOfPlanes
+
+    function PackedPlanarSepArray_class_getNumberOfOverflowSeparators(this) result(a_number)
+      implicit none
+      type(PackedPlanarSepArray_type), intent(in) :: this
+      integer(IRL_UnsignedIndex_t) :: a_number
+      a_number = F_PackedPlanarSepArray_getNumberOfOverflowSeparators(this%c_object)
+    end function PackedPlanarSepArray_class_getNumberOfOverflowSeparators
+
+
+end module f_PackedPlanarSepArray_class
@@ -21,17 +21,22 @@
 module f_Serializer
   use f_DefinedTypes
   use f_PlanarSep_class
+  use f_PackedPlanarSepArray_class
   use f_ByteBuffer_class
   implicit none
 
   interface serializeAndPack
     ! Pack a PlanarSep object into a ByteBuffer
     module procedure serializeAndPack_PlanarSep_ByteBuffer
+    ! Pack a PackedPlanarSepArray object into a ByteBuffer
+    module procedure serializeAndPack_PackedPlanarSepArray_ByteBuffer
   end interface serializeAndPack
 
   interface unpackAndStore
     ! Unpack a ByteBuffer to store into a PlanarSep
     module procedure unpackAndStore_PlanarSep_ByteBuffer
+    ! Unpack a ByteBuffer to store into a PackedPlanarSepArray
+    module procedure unpackAndStore_PackedPlanarSepArray_ByteBuffer
   end interface unpackAndStore
 
   interface
@@ -56,6 +61,28 @@ module f_Serializer
     end subroutine F_unpackAndStore_PlanarSep_ByteBuffer
   end interface
 
+  interface
+    subroutine F_serializeAndPack_PackedPlanarSepArray_ByteBuffer(a_separators, a_byte_buffer) &
+    bind(C, name="c_serializeAndPack_PackedPlanarSepArray_ByteBuffer")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      type(c_PackedPlanarSepArray) :: a_separators ! Pointer to PackedPlanarSepArray object
+      type(c_ByteBuffer) :: a_byte_buffer ! Pointer to ByteBuffer object
+    end subroutine F_serializeAndPack_PackedPlanarSepArray_ByteBuffer
+  end interface
+
+  interface
+    subroutine F_unpackAndStore_PackedPlanarSepArray_ByteBuffer(a_separators, a_byte_buffer) &
+    bind(C, name="c_unpackAndStore_PackedPlanarSepArray_ByteBuffer")
+      use, intrinsic :: iso_c_binding
+      import
+      implicit none
+      type(c_PackedPlanarSepArray) :: a_separators ! Pointer to PackedPlanarSepArray object
+      type(c_ByteBuffer) :: a_byte_buffer ! Pointer to ByteBuffer object
+    end subroutine F_unpackAndStore_PackedPlanarSepArray_ByteBuffer
+  end interface
+
 contains
 
   subroutine serializeAndPack_PlanarSep_ByteBuffer(a_separator, a_byte_buffer)
@@ -76,5 +103,23 @@ contains
           (a_separator%c_object, a_byte_buffer%c_object)
   end subroutine unpackAndStore_PlanarSep_ByteBuffer
 
+  subroutine serializeAndPack_PackedPlanarSepArray_ByteBuffer(a_separators, a_byte_buffer)
+    implicit none
+      type(PackedPlanarSepArray_type) :: a_separators
+      type(ByteBuffer_type) :: a_byte_buffer
+
+      call F_serializeAndPack_PackedPlanarSepArray_ByteBuffer &
+          (a_separators%c_object, a_byte_buffer%c_object)
+  end subroutine serializeAndPack_PackedPlanarSepArray_ByteBuffer
+
+  subroutine unpackAndStore_PackedPlanarSepArray_ByteBuffer(a_separators, a_byte_buffer)
+    implicit none
+      type(PackedPlanarSepArray_type) :: a_separators
+      type(ByteBuffer_type) :: a_byte_buffer
+
+      call F_unpackAndStore_PackedPlanarSepArray_ByteBuffer &
+          (a_separators%c_object, a_byte_buffer%c_object)
+  end subroutine unpackAndStore_PackedPlanarSepArray_ByteBuffer
+
 
 end module f_Serializer
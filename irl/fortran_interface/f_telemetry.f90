@@ -0,0 +1,109 @@
+!  This file is part of the Interface Reconstruction Library (IRL),
+!  a library for interface reconstruction and computational geometry operations.
+!
+!  Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+!
+!  This Source Code Form is subject to the terms of the Mozilla Public
+!  License, v. 2.0. If a copy of the MPL was not distributed with this
+!  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+!> \file f_telemetry.f90
+!!
+!! This file contains the Fortran interface to
+!! the IRL hot-path counters and timers.
+
+!> \brief This module contains mappings to the
+!! IRL C interface for reading and resetting the
+!! counters and timers kept when IRL is built with
+!! IRL_ENABLE_TELEMETRY. Otherwise all values are zero.
+!!
+!! Entries of TelemetryReport_type%counters and of the
+!! timer arrays are indexed with the IRL_Telemetry_*
+!! parameters below.
+module f_Telemetry
+  use, intrinsic :: iso_c_binding
+  use f_DefinedTypes
+  implicit none
+
+  integer, parameter :: IRL_Telemetry_number_of_counters = 8
+  integer, parameter :: IRL_Telemetry_HalfEdgePolytopeBuilds = 1
+  integer, parameter :: IRL_Telemetry_PlaneClips = 2
+  integer, parameter :: IRL_Telemetry_LinkTraversals = 3
+  integer, parameter :: IRL_Telemetry_SimplexDecompositions = 4
+  integer, parameter :: IRL_Telemetry_DistanceSolverIterations = 5
+  integer, parameter :: IRL_Telemetry_LevenbergMarquardtIterations = 6
+  integer, parameter :: IRL_Telemetry_BFGSIterations = 7
+  integer, parameter :: IRL_Telemetry_HalfEdgeTemplateRebuilds = 8
+
+  integer, parameter :: IRL_Telemetry_number_of_timers = 4
+  integer, parameter :: IRL_Telemetry_Cutting = 1
+  integer, parameter :: IRL_Telemetry_DistanceSolver = 2
+  integer, parameter :: IRL_Telemetry_LevenbergMarquardt = 3
+  integer, parameter :: IRL_Telemetry_BFGS = 4
+
+  type, public, bind(C) :: TelemetryReport_type
+    integer(C_INT64_T) :: counters(IRL_Telemetry_number_of_counters)
+    integer(C_INT64_T) :: timer_calls(IRL_Telemetry_number_of_timers)
+    integer(C_INT64_T) :: timer_ticks(IRL_Telemetry_number_of_timers)
+    integer(C_INT32_T) :: number_of_threads
+  end type TelemetryReport_type
+
+  interface
+    function F_Telemetry_isEnabled() result(a_enabled) &
+      bind(C, name="c_Telemetry_isEnabled")
+      import
+      implicit none
+      logical(C_BOOL) :: a_enabled
+    end function F_Telemetry_isEnabled
+  end interface
+
+  interface
+    subroutine F_Telemetry_getReport(a_report) &
+      bind(C, name="c_Telemetry_getReport")
+      import
+      implicit none
+      type(TelemetryReport_type), intent(out) :: a_report
+    end subroutine F_Telemetry_getReport
+  end interface
+
+  interface
+    subroutine F_Telemetry_reset() &
+      bind(C, name="c_Telemetry_reset")
+      import
+      implicit none
+    end subroutine F_Telemetry_reset
+  end interface
+
+  interface
+    subroutine F_Telemetry_printReport() &
+      bind(C, name="c_Telemetry_printReport")
+      import
+      implicit none
+    end subroutine F_Telemetry_printReport
+  end interface
+
+contains
+
+  function isTelemetryEnabled() result(a_enabled)
+    implicit none
+    logical(1) :: a_enabled
+    a_enabled = F_Telemetry_isEnabled()
+  end function isTelemetryEnabled
+
+  subroutine getTelemetryReport(a_report)
+    implicit none
+    type(TelemetryReport_type), intent(out) :: a_report
+    call F_Telemetry_getReport(a_report)
+  end subroutine getTelemetryReport
+
+  subroutine resetTelemetry()
+    implicit none
+    call F_Telemetry_reset()
+  end subroutine resetTelemetry
+
+  subroutine printTelemetryReport()
+    implicit none
+    call F_Telemetry_printReport()
+  end subroutine printTelemetryReport
+
+end module f_Telemetry
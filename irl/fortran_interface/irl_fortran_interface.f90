@@ -30,6 +30,7 @@ module irl_fortran_interface
   use f_VMAN_class
   use f_PlanarLoc_class
   use f_PlanarSep_class
+  use f_PackedPlanarSepArray_class
   use f_LocLink_class
   use f_PlanarSepPath_class
   use f_PlanarSepPathGroup_class
@@ -86,5 +87,8 @@ module irl_fortran_interface
   use f_ByteBuffer_class
   use f_R2PWeighting_class
   use f_OptimizationBehavior_class
+  use f_MeshReconstructor_class
+  use f_Checkpoint_class
+  use f_Telemetry
 
 end module irl_fortran_interface
@@ -56,6 +56,71 @@ static double calculateVolumeByRegime(const std::array<double, 3>& a_mm,
   }
 }
 
+// Volume and first moments of the unit cube below the plane
+// m0*x + m1*y + m2*z = alpha, for m sorted in ascending order, summing to
+// one, and alpha in [0, 0.5]. Each regime is written so that no quantity is
+// divided by a slope that can be smaller than the distances it multiplies,
+// which keeps the result accurate for nearly face-aligned planes.
+static void calculateMomentsByRegime(const std::array<double, 3>& a_mm,
+                                     const double a_alpha, double* a_volume,
+                                     std::array<double, 3>* a_first_moment) {
+  assert(a_mm[0] >= 0.0);
+  assert(a_mm[0] <= a_mm[1]);
+  assert(a_mm[1] <= a_mm[2]);
+  assert(a_alpha >= 0.0);
+  assert(a_alpha <= 0.5);
+
+  const double m0 = a_mm[0];
+  const double m1 = a_mm[1];
+  const double m2 = a_mm[2];
+  const double a = a_alpha;
+
+  if (a < m0) {
+    // Tetrahedron at the origin.
+    *a_volume = a * a * a / (6.0 * m0 * m1 * m2);
+    (*a_first_moment)[0] = *a_volume * a / (4.0 * m0);
+    (*a_first_moment)[1] = *a_volume * a / (4.0 * m1);
+    (*a_first_moment)[2] = *a_volume * a / (4.0 * m2);
+  } else if (a < m1) {
+    // Triangular slices along x, integrated over x in [0, 1].
+    const double int_c2 = a * a - a * m0 + m0 * m0 / 3.0;
+    const double int_xc2 = 0.5 * a * a - 2.0 * a * m0 / 3.0 + 0.25 * m0 * m0;
+    const double int_c3 =
+        a * a * a - 1.5 * a * a * m0 + a * m0 * m0 - 0.25 * m0 * m0 * m0;
+    *a_volume = int_c2 / (2.0 * m1 * m2);
+    (*a_first_moment)[0] = int_xc2 / (2.0 * m1 * m2);
+    (*a_first_moment)[1] = int_c3 / (6.0 * m1 * m1 * m2);
+    (*a_first_moment)[2] = int_c3 / (6.0 * m1 * m2 * m2);
+  } else {
+    // Columns along z of height c/m2, c = alpha - m0*x - m1*y, integrated
+    // over the unit square. Two corner triangles correct the integrals: one
+    // at (1,1) where c < 0 (size d), one at (0,0) where c > m2 and the
+    // column is capped at z = 1 (size e). Both are smaller than m0 when they
+    // exist, so the ratios d/m0, d/m1, e/m0, e/m1 never exceed one.
+    const double d = std::max(m0 + m1 - a, 0.0);
+    const double e = std::max(a - m2, 0.0);
+    const double d_m0 = d > 0.0 ? d / m0 : 0.0;
+    const double d_m1 = d > 0.0 ? d / m1 : 0.0;
+    const double e_m0 = e > 0.0 ? e / m0 : 0.0;
+    const double e_m1 = e > 0.0 ? e / m1 : 0.0;
+
+    const double int_c = a - 0.5 * (m0 + m1);
+    const double int_xc = 0.5 * a - m0 / 3.0 - 0.25 * m1;
+    const double int_yc = 0.5 * a - 0.25 * m0 - m1 / 3.0;
+    const double int_c2 = int_c * int_c + (m0 * m0 + m1 * m1) / 12.0;
+
+    const double d3 = d * d_m0 * d_m1;
+    const double e3 = e * e_m0 * e_m1;
+    *a_volume = (int_c + (d3 - e3) / 6.0) / m2;
+    (*a_first_moment)[0] =
+        (int_xc + d3 / 6.0 - (d_m0 * d3 + e_m0 * e3) / 24.0) / m2;
+    (*a_first_moment)[1] =
+        (int_yc + d3 / 6.0 - (d_m1 * d3 + e_m1 * e3) / 24.0) / m2;
+    (*a_first_moment)[2] =
+        (int_c2 - (d * d3 + e * e3) / 12.0 - m2 * e3 / 3.0) / (2.0 * m2 * m2);
+  }
+}
+
 }  // namespace analytic_rectangular_cuboid
 
 Volume getAnalyticVolume(const RectangularCuboid& a_rectangular_cuboid,
@@ -94,4 +159,77 @@ Volume getAnalyticVolume(const RectangularCuboid& a_rectangular_cuboid,
   return alpha > 0.5 ? (1.0 - tmp_vol) * cell_volume : tmp_vol * cell_volume;
 }
 
+VolumeMoments getAnalyticVolumeMoments(
+    const RectangularCuboid& a_rectangular_cuboid, const Plane& a_plane) {
+  const auto plane_normal = a_plane.normal();
+  if (squaredMagnitude(plane_normal) < DBL_MIN) {
+    return a_plane.distance() > 0.0 ? a_rectangular_cuboid.calculateMoments()
+                                    : VolumeMoments();
+  }
+  const Pt side_length(a_rectangular_cuboid.calculateSideLength(0),
+                       a_rectangular_cuboid.calculateSideLength(1),
+                       a_rectangular_cuboid.calculateSideLength(2));
+  const Pt lower_point =
+      a_rectangular_cuboid.calculateCentroid() - 0.5 * side_length;
+  auto mm = std::array<double, 3>{{plane_normal[0] * side_length[0],
+                                   plane_normal[1] * side_length[1],
+                                   plane_normal[2] * side_length[2]}};
+  const double norm = std::fabs(mm[0]) + std::fabs(mm[1]) + std::fabs(mm[2]);
+  double alpha = (a_plane.distance() - plane_normal * lower_point) / norm;
+  std::array<bool, 3> mirrored = {{false, false, false}};
+  for (UnsignedIndex_t d = 0; d < 3; ++d) {
+    mm[d] /= norm;
+    if (mm[d] < 0.0) {
+      mm[d] = -mm[d];
+      alpha += mm[d];
+      mirrored[d] = true;
+    }
+  }
+  if (alpha <= 0.0) {
+    return VolumeMoments();
+  } else if (alpha >= 1.0) {
+    return a_rectangular_cuboid.calculateMoments();
+  }
+
+  // Sort slopes while remembering which axis each came from.
+  std::array<UnsignedIndex_t, 3> axis = {{0, 1, 2}};
+  if (mm[axis[0]] > mm[axis[1]]) {
+    std::swap(axis[0], axis[1]);
+  }
+  if (mm[axis[1]] > mm[axis[2]]) {
+    std::swap(axis[1], axis[2]);
+  }
+  if (mm[axis[0]] > mm[axis[1]]) {
+    std::swap(axis[0], axis[1]);
+  }
+  const auto sorted_mm =
+      std::array<double, 3>{{mm[axis[0]], mm[axis[1]], mm[axis[2]]}};
+
+  // Use the complement about the cube center for alpha > 0.5.
+  double unit_volume;
+  std::array<double, 3> sorted_moment;
+  if (alpha > 0.5) {
+    analytic_rectangular_cuboid::calculateMomentsByRegime(
+        sorted_mm, 1.0 - alpha, &unit_volume, &sorted_moment);
+    for (auto& element : sorted_moment) {
+      element = 0.5 - unit_volume + element;
+    }
+    unit_volume = 1.0 - unit_volume;
+  } else {
+    analytic_rectangular_cuboid::calculateMomentsByRegime(
+        sorted_mm, alpha, &unit_volume, &sorted_moment);
+  }
+
+  const double cell_volume = a_rectangular_cuboid.calculateVolume();
+  Pt first_moment;
+  for (UnsignedIndex_t n = 0; n < 3; ++n) {
+    const UnsignedIndex_t d = axis[n];
+    const double unit_moment =
+        mirrored[d] ? unit_volume - sorted_moment[n] : sorted_moment[n];
+    first_moment[d] = cell_volume * (unit_volume * lower_point[d] +
+                                     side_length[d] * unit_moment);
+  }
+  return VolumeMoments(unit_volume * cell_volume, first_moment);
+}
+
 }  // namespace IRL
@@ -12,12 +12,19 @@
 
 #include "irl/geometry/polyhedrons/rectangular_cuboid.h"
 #include "irl/moments/volume.h"
+#include "irl/moments/volume_moments.h"
 
 namespace IRL {
 
 Volume getAnalyticVolume(const RectangularCuboid& a_geometry,
                          const Plane& a_plane);
 
+/// \brief Closed-form volume and first moment of the portion of
+/// `a_geometry` below `a_plane`. The centroid of the returned moments is
+/// not normalized by the volume.
+VolumeMoments getAnalyticVolumeMoments(const RectangularCuboid& a_geometry,
+                                       const Plane& a_plane);
+
 }  // namespace IRL
 
 #endif // IRL_GENERIC_CUTTING_ANALYTIC_RECTANGULAR_CUBOID_H_
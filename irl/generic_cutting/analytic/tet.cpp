@@ -97,6 +97,20 @@ double calculateRegimeVolume<2>(const std::array<double, 4>& a_vd,
   return std::pow(mu, 3.0) * a_section_volume_fraction;
 }
 
+// Moments of the tet spanned by the four points, using its absolute volume.
+static VolumeMoments absoluteTetMoments(const Pt& a_p0, const Pt& a_p1,
+                                        const Pt& a_p2, const Pt& a_p3) {
+  const Pt edge_0 = a_p1 - a_p0;
+  const Pt edge_1 = a_p2 - a_p0;
+  const Pt edge_2 = a_p3 - a_p0;
+  const double volume =
+      std::fabs(edge_0[0] * (edge_1[1] * edge_2[2] - edge_1[2] * edge_2[1]) -
+                edge_0[1] * (edge_1[0] * edge_2[2] - edge_1[2] * edge_2[0]) +
+                edge_0[2] * (edge_1[0] * edge_2[1] - edge_1[1] * edge_2[0])) /
+      6.0;
+  return VolumeMoments(volume, volume * 0.25 * (a_p0 + a_p1 + a_p2 + a_p3));
+}
+
 }  // namespace analytic_tet
 
 Volume getAnalyticVolume(const Tet& a_tet, const Plane& a_plane) {
@@ -149,4 +163,68 @@ if (squaredMagnitude(a_plane.normal()) < DBL_MIN) {
   }
 }
 
+VolumeMoments getAnalyticVolumeMoments(const Tet& a_tet, const Plane& a_plane) {
+  const auto& plane_normal = a_plane.normal();
+  if (squaredMagnitude(plane_normal) < DBL_MIN) {
+    return a_plane.distance() > 0.0 ? a_tet.calculateMoments()
+                                    : VolumeMoments();
+  }
+  std::array<double, 4> vertex_dist;
+  std::array<UnsignedIndex_t, 4> below;
+  std::array<UnsignedIndex_t, 4> above;
+  UnsignedIndex_t number_below = 0;
+  UnsignedIndex_t number_above = 0;
+  for (UnsignedIndex_t v = 0; v < 4; ++v) {
+    vertex_dist[v] = plane_normal * a_tet[v] - a_plane.distance();
+    if (vertex_dist[v] < 0.0) {
+      below[number_below++] = v;
+    } else {
+      above[number_above++] = v;
+    }
+  }
+  const auto intersection = [&a_tet, &vertex_dist](const UnsignedIndex_t a_v0,
+                                                   const UnsignedIndex_t a_v1) {
+    return Pt::fromEdgeIntersection(a_tet[a_v0], vertex_dist[a_v0],
+                                    a_tet[a_v1], vertex_dist[a_v1]);
+  };
+
+  // Pieces are built with absolute volumes, then given the
+  // orientation of the tet so results match calculateMoments().
+  switch (number_below) {
+    case 0:
+      return VolumeMoments();
+    case 1: {
+      auto moments = analytic_tet::absoluteTetMoments(
+          a_tet[below[0]], intersection(below[0], above[0]),
+          intersection(below[0], above[1]), intersection(below[0], above[2]));
+      moments *= a_tet.calculateSign();
+      return moments;
+    }
+    case 2: {
+      // Triangular prism between the two edges leaving the plane,
+      // split into three tets.
+      const Pt a0 = a_tet[below[0]];
+      const Pt b0 = a_tet[below[1]];
+      const Pt a1 = intersection(below[0], above[0]);
+      const Pt a2 = intersection(below[0], above[1]);
+      const Pt b1 = intersection(below[1], above[0]);
+      const Pt b2 = intersection(below[1], above[1]);
+      auto moments = analytic_tet::absoluteTetMoments(a0, a1, a2, b2);
+      moments += analytic_tet::absoluteTetMoments(a0, a1, b1, b2);
+      moments += analytic_tet::absoluteTetMoments(a0, b0, b1, b2);
+      moments *= a_tet.calculateSign();
+      return moments;
+    }
+    case 3: {
+      auto moments = analytic_tet::absoluteTetMoments(
+          a_tet[above[0]], intersection(above[0], below[0]),
+          intersection(above[0], below[1]), intersection(above[0], below[2]));
+      moments *= a_tet.calculateSign();
+      return a_tet.calculateMoments() - moments;
+    }
+    default:
+      return a_tet.calculateMoments();
+  }
+}
+
 }  // namespace IRL
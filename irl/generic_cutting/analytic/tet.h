@@ -12,11 +12,18 @@
 
 #include "irl/geometry/polyhedrons/tet.h"
 #include "irl/moments/volume.h"
+#include "irl/moments/volume_moments.h"
 
 namespace IRL {
 
 Volume getAnalyticVolume(const Tet& a_geometry, const Plane& a_plane);
 
+/// \brief Closed-form volume and first moment of the portion of
+/// `a_geometry` below `a_plane`. The centroid of the returned moments is
+/// not normalized by the volume.
+VolumeMoments getAnalyticVolumeMoments(const Tet& a_geometry,
+                                       const Plane& a_plane);
+
 }  // namespace IRL
 
 #endif // IRL_GENERIC_CUTTING_ANALYTIC_TET_H_
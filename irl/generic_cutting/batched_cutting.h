@@ -0,0 +1,89 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GENERIC_CUTTING_BATCHED_CUTTING_H_
+#define IRL_GENERIC_CUTTING_BATCHED_CUTTING_H_
+
+#include <array>
+#include <type_traits>
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/moments/volume.h"
+#include "irl/parameters/defined_types.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace IRL {
+
+/// \brief Number of cells processed together in the structure-of-arrays
+/// kernels. Chosen so that one block fills an AVX-512 register of doubles
+/// (two AVX2 registers). The kernels are written as plain fixed-length loops
+/// so the compiler emits the widest vector instructions enabled for the
+/// target (e.g., `-march=native`), falling back to scalar code otherwise.
+static constexpr UnsignedIndex_t kBatchedCuttingLaneWidth = 8;
+
+/// \brief Compute the normalized moments for `a_number_of_cells`
+/// polytopes, each cut by the reconstruction at the same index.
+///
+/// This is equivalent to calling
+/// `getNormalizedVolumeMoments<ReturnType, CuttingMethod>(a_polytopes[n],
+/// a_reconstructions[n])` for every `n`, storing the result in
+/// `a_moments[n]`. Combinations that have a vectorized kernel (currently a
+/// `RectangularCuboid` cut by a single-plane `PlanarSeparator` returning
+/// `Volume`) are processed `kBatchedCuttingLaneWidth` cells at a time in a
+/// structure-of-arrays layout. Lanes that the kernel cannot handle
+/// accurately, and all other combinations, use the scalar path.
+template <class ReturnType, class CuttingMethod = DefaultCuttingMethod,
+          class EncompassingType, class ReconstructionType>
+__attribute__((hot)) inline void getNormalizedVolumeMoments(
+    const EncompassingType* a_polytopes,
+    const ReconstructionType* a_reconstructions,
+    const UnsignedIndex_t a_number_of_cells, ReturnType* a_moments);
+
+namespace batched_cutting_details {
+
+/// \brief Structure-of-arrays storage for one block of cells, containing the
+/// normalized plane slopes and intercept of the unit-cube problem
+/// m0*x + m1*y + m2*z = alpha.
+struct alignas(64) UnitCubeLanes {
+  std::array<double, kBatchedCuttingLaneWidth> m0;
+  std::array<double, kBatchedCuttingLaneWidth> m1;
+  std::array<double, kBatchedCuttingLaneWidth> m2;
+  std::array<double, kBatchedCuttingLaneWidth> alpha;
+  std::array<double, kBatchedCuttingLaneWidth> cell_volume;
+  std::array<double, kBatchedCuttingLaneWidth> fraction;
+  std::array<bool, kBatchedCuttingLaneWidth> use_scalar;
+};
+
+template <class ReturnType, class CuttingMethod, class EncompassingType,
+          class ReconstructionType, class Enable = void>
+struct getNormalizedVolumeMomentsBatched {
+  inline static void getNormalizedVolumeMomentsImplementation(
+      const EncompassingType* a_polytopes,
+      const ReconstructionType* a_reconstructions,
+      const UnsignedIndex_t a_number_of_cells, ReturnType* a_moments);
+};
+
+template <class ReturnType, class CuttingMethod>
+struct getNormalizedVolumeMomentsBatched<
+    ReturnType, CuttingMethod, RectangularCuboid, PlanarSeparator,
+    enable_if_t<IsOnlyVolume<ReturnType>::value>> {
+  inline static void getNormalizedVolumeMomentsImplementation(
+      const RectangularCuboid* a_polytopes,
+      const PlanarSeparator* a_reconstructions,
+      const UnsignedIndex_t a_number_of_cells, ReturnType* a_moments);
+};
+
+}  // namespace batched_cutting_details
+
+}  // namespace IRL
+
+#include "irl/generic_cutting/batched_cutting.tpp"
+
+#endif  // IRL_GENERIC_CUTTING_BATCHED_CUTTING_H_
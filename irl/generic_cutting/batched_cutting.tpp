@@ -0,0 +1,171 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GENERIC_CUTTING_BATCHED_CUTTING_TPP_
+#define IRL_GENERIC_CUTTING_BATCHED_CUTTING_TPP_
+
+#include <algorithm>
+#include <cmath>
+
+namespace IRL {
+
+template <class ReturnType, class CuttingMethod, class EncompassingType,
+          class ReconstructionType>
+inline void getNormalizedVolumeMoments(
+    const EncompassingType* a_polytopes,
+    const ReconstructionType* a_reconstructions,
+    const UnsignedIndex_t a_number_of_cells, ReturnType* a_moments) {
+  batched_cutting_details::getNormalizedVolumeMomentsBatched<
+      ReturnType, CuttingMethod, EncompassingType, ReconstructionType>::
+      getNormalizedVolumeMomentsImplementation(
+          a_polytopes, a_reconstructions, a_number_of_cells, a_moments);
+}
+
+namespace batched_cutting_details {
+
+// The inclusion-exclusion formula used in the unit-cube kernel loses
+// accuracy as the plane becomes aligned with a cube face, i.e. as
+// m0*m1*m2 -> 0. Lanes with a normalized slope below this are
+// sent through the scalar analytic path instead.
+static constexpr double kMinimumLaneSlope = 1.0e-2;
+
+// Fill lane `a_lane` of `a_lanes` with the normalized unit-cube
+// problem for the cuboid/plane pair. Mirrors the transformation performed
+// in getAnalyticVolume(const RectangularCuboid&, const Plane&).
+inline void loadUnitCubeLane(const RectangularCuboid& a_cuboid,
+                             const PlanarSeparator& a_separator,
+                             const UnsignedIndex_t a_lane,
+                             UnitCubeLanes* a_lanes) {
+  if (a_separator.getNumberOfPlanes() != 1 || a_separator.isFlipped()) {
+    a_lanes->use_scalar[a_lane] = true;
+    return;
+  }
+  const Plane& plane = a_separator[0];
+  const Normal& normal = plane.normal();
+  const Pt side_lengths(a_cuboid.calculateSideLength(0),
+                       a_cuboid.calculateSideLength(1),
+                       a_cuboid.calculateSideLength(2));
+  const Pt lower_point = a_cuboid.calculateCentroid() - 0.5 * side_lengths;
+  const double mm0 = normal[0] * side_lengths[0];
+  const double mm1 = normal[1] * side_lengths[1];
+  const double mm2 = normal[2] * side_lengths[2];
+  const double norm = std::fabs(mm0) + std::fabs(mm1) + std::fabs(mm2);
+  if (norm < DBL_MIN) {
+    a_lanes->use_scalar[a_lane] = true;
+    return;
+  }
+  const double inv_norm = 1.0 / norm;
+  const double m0 = mm0 * inv_norm;
+  const double m1 = mm1 * inv_norm;
+  const double m2 = mm2 * inv_norm;
+  a_lanes->m0[a_lane] = std::fabs(m0);
+  a_lanes->m1[a_lane] = std::fabs(m1);
+  a_lanes->m2[a_lane] = std::fabs(m2);
+  a_lanes->alpha[a_lane] = (plane.distance() - normal * lower_point) * inv_norm +
+                           std::max(-m0, 0.0) + std::max(-m1, 0.0) +
+                           std::max(-m2, 0.0);
+  a_lanes->cell_volume[a_lane] =
+      side_lengths[0] * side_lengths[1] * side_lengths[2];
+  a_lanes->use_scalar[a_lane] =
+      std::min({a_lanes->m0[a_lane], a_lanes->m1[a_lane],
+                a_lanes->m2[a_lane]}) < kMinimumLaneSlope;
+}
+
+inline double cubeOfPositivePart(const double a_value) {
+  const double positive_part = std::max(a_value, 0.0);
+  return positive_part * positive_part * positive_part;
+}
+
+// Volume fraction of the unit cube below m0*x + m1*y + m2*z = alpha for
+// every lane, computed without branches through the inclusion-exclusion
+// sum over the eight cube vertices. Symmetry about alpha = 0.5 is used to
+// keep the summed terms small.
+__attribute__((hot)) inline void calculateUnitCubeFractions(
+    UnitCubeLanes* a_lanes) {
+  for (UnsignedIndex_t l = 0; l < kBatchedCuttingLaneWidth; ++l) {
+    const double m0 = a_lanes->m0[l];
+    const double m1 = a_lanes->m1[l];
+    const double m2 = a_lanes->m2[l];
+    const double alpha = a_lanes->alpha[l];
+    const double a = std::max(std::min(alpha, 1.0 - alpha), 0.0);
+    const double sum =
+        cubeOfPositivePart(a) - cubeOfPositivePart(a - m0) -
+        cubeOfPositivePart(a - m1) - cubeOfPositivePart(a - m2) +
+        cubeOfPositivePart(a - m0 - m1) + cubeOfPositivePart(a - m0 - m2) +
+        cubeOfPositivePart(a - m1 - m2) - cubeOfPositivePart(a - 1.0);
+    const double denominator = 6.0 * m0 * m1 * m2;
+    const double partial =
+        sum / (denominator > DBL_MIN ? denominator : DBL_MIN);
+    a_lanes->fraction[l] = alpha > 0.5 ? 1.0 - partial : partial;
+  }
+}
+
+template <class ReturnType, class CuttingMethod, class EncompassingType,
+          class ReconstructionType, class Enable>
+inline void getNormalizedVolumeMomentsBatched<
+    ReturnType, CuttingMethod, EncompassingType, ReconstructionType, Enable>::
+    getNormalizedVolumeMomentsImplementation(
+        const EncompassingType* a_polytopes,
+        const ReconstructionType* a_reconstructions,
+        const UnsignedIndex_t a_number_of_cells, ReturnType* a_moments) {
+  for (UnsignedIndex_t n = 0; n < a_number_of_cells; ++n) {
+    a_moments[n] =
+        IRL::getNormalizedVolumeMoments<ReturnType, CuttingMethod>(
+            a_polytopes[n], a_reconstructions[n]);
+  }
+}
+
+template <class ReturnType, class CuttingMethod>
+inline void getNormalizedVolumeMomentsBatched<
+    ReturnType, CuttingMethod, RectangularCuboid, PlanarSeparator,
+    enable_if_t<IsOnlyVolume<ReturnType>::value>>::
+    getNormalizedVolumeMomentsImplementation(
+        const RectangularCuboid* a_polytopes,
+        const PlanarSeparator* a_reconstructions,
+        const UnsignedIndex_t a_number_of_cells, ReturnType* a_moments) {
+  UnitCubeLanes lanes;
+  for (UnsignedIndex_t block_start = 0; block_start < a_number_of_cells;
+       block_start += kBatchedCuttingLaneWidth) {
+    const UnsignedIndex_t lanes_in_block = std::min(
+        kBatchedCuttingLaneWidth, a_number_of_cells - block_start);
+
+    // Gather into structure-of-arrays layout. Unused lanes of a partial
+    // block are given a harmless problem so the kernel stays branch free.
+    lanes.m0.fill(1.0 / 3.0);
+    lanes.m1.fill(1.0 / 3.0);
+    lanes.m2.fill(1.0 / 3.0);
+    lanes.alpha.fill(0.0);
+    lanes.cell_volume.fill(0.0);
+    lanes.use_scalar.fill(false);
+    for (UnsignedIndex_t l = 0; l < lanes_in_block; ++l) {
+      loadUnitCubeLane(a_polytopes[block_start + l],
+                       a_reconstructions[block_start + l], l, &lanes);
+    }
+
+    calculateUnitCubeFractions(&lanes);
+
+    // Scatter results, recomputing any lanes flagged for the scalar path.
+    for (UnsignedIndex_t l = 0; l < lanes_in_block; ++l) {
+      const UnsignedIndex_t n = block_start + l;
+      if (lanes.use_scalar[l]) {
+        a_moments[n] =
+            IRL::getNormalizedVolumeMoments<ReturnType, CuttingMethod>(
+                a_polytopes[n], a_reconstructions[n]);
+      } else {
+        a_moments[n] = lanes.fraction[l] * lanes.cell_volume[l];
+      }
+    }
+  }
+}
+
+}  // namespace batched_cutting_details
+
+}  // namespace IRL
+
+#endif  // IRL_GENERIC_CUTTING_BATCHED_CUTTING_TPP_
@@ -0,0 +1,119 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/generic_cutting/cutting_method_table.h"
+
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace IRL {
+
+namespace {
+// First line of a saved table, bumped if the format changes.
+const char* const cutting_method_table_header = "IRL_CuttingMethodTable 1";
+}  // namespace
+
+CuttingMethodTable& CuttingMethodTable::getTable(void) {
+  static CuttingMethodTable table;
+  return table;
+}
+
+std::atomic<int>* CuttingMethodTable::getEntry(const std::string& a_key) {
+  std::lock_guard<std::mutex> lock(mutex_m);
+  auto& entry = entries_m[a_key];
+  if (entry == nullptr) {
+    entry = std::make_unique<std::atomic<int>>(uncalibrated_m);
+  }
+  return entry.get();
+}
+
+void CuttingMethodTable::setMethod(const std::string& a_key,
+                                   const CuttingMethodId a_method) {
+  this->getEntry(a_key)->store(static_cast<int>(a_method),
+                               std::memory_order_relaxed);
+}
+
+CuttingMethodId CuttingMethodTable::getMethod(const std::string& a_key) {
+  const int method = this->getEntry(a_key)->load(std::memory_order_relaxed);
+  return method == uncalibrated_m ? CuttingMethodId::HalfEdgeCutting
+                                  : static_cast<CuttingMethodId>(method);
+}
+
+bool CuttingMethodTable::isCalibrated(const std::string& a_key) {
+  return this->getEntry(a_key)->load(std::memory_order_relaxed) !=
+         uncalibrated_m;
+}
+
+UnsignedIndex_t CuttingMethodTable::getNumberOfCalibratedEntries(
+    void) const {
+  std::lock_guard<std::mutex> lock(mutex_m);
+  UnsignedIndex_t number_calibrated = 0;
+  for (const auto& entry : entries_m) {
+    if (entry.second->load(std::memory_order_relaxed) != uncalibrated_m) {
+      ++number_calibrated;
+    }
+  }
+  return number_calibrated;
+}
+
+bool CuttingMethodTable::save(const std::string& a_file_name) const {
+  std::ofstream file(a_file_name);
+  if (!file) {
+    return false;
+  }
+  file << cutting_method_table_header << '\n';
+  std::lock_guard<std::mutex> lock(mutex_m);
+  for (const auto& entry : entries_m) {
+    const int method = entry.second->load(std::memory_order_relaxed);
+    if (method != uncalibrated_m) {
+      file << method << ' ' << entry.first << '\n';
+    }
+  }
+  return static_cast<bool>(file);
+}
+
+bool CuttingMethodTable::load(const std::string& a_file_name) {
+  std::ifstream file(a_file_name);
+  std::string line;
+  if (!std::getline(file, line) || line != cutting_method_table_header) {
+    return false;
+  }
+  // Parse the whole file before changing anything.
+  std::vector<std::pair<std::string, int>> loaded_entries;
+  while (std::getline(file, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    std::istringstream stream(line);
+    int method;
+    std::string key;
+    if (!(stream >> method >> key) ||
+        method < static_cast<int>(CuttingMethodId::RecursiveSimplexCutting) ||
+        method > static_cast<int>(CuttingMethodId::SimplexCutting)) {
+      return false;
+    }
+    loaded_entries.emplace_back(key, method);
+  }
+  for (const auto& entry : loaded_entries) {
+    this->getEntry(entry.first)
+        ->store(entry.second, std::memory_order_relaxed);
+  }
+  return true;
+}
+
+void CuttingMethodTable::reset(void) {
+  std::lock_guard<std::mutex> lock(mutex_m);
+  for (auto& entry : entries_m) {
+    entry.second->store(uncalibrated_m, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace IRL
@@ -0,0 +1,105 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GENERIC_CUTTING_CUTTING_METHOD_TABLE_H_
+#define IRL_GENERIC_CUTTING_CUTTING_METHOD_TABLE_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "irl/parameters/defined_types.h"
+
+namespace IRL {
+
+/// \brief Cutting methods AutoTunedCutting can dispatch to. The values match
+/// those accepted by c_getMoments_setMethod.
+enum class CuttingMethodId : int {
+  RecursiveSimplexCutting = 0,
+  HalfEdgeCutting = 1,
+  SimplexCutting = 2,
+};
+
+/// \brief Process-wide dispatch table used by AutoTunedCutting, holding the
+/// cutting method to use for each combination of return type, polytope type,
+/// and reconstruction type.
+///
+/// Entries are filled by calibrateCuttingMethod() (see
+/// cutting_method_tuner.h) or read from a file written by a previous run
+/// with save(). Combinations without an entry use HalfEdgeCutting, the same
+/// as DefaultCuttingMethod.
+///
+/// Keys are built from `typeid(...).name()`, so a saved table is only
+/// meaningful to executables built with the same compiler.
+///
+/// Lookups through getTunedCuttingMethod() are a single relaxed atomic load
+/// after the first call for a combination. All methods are thread-safe.
+class CuttingMethodTable {
+ public:
+  /// \brief Return the table shared by the whole process.
+  static CuttingMethodTable& getTable(void);
+
+  /// \brief Return the entry for `a_key`, creating an uncalibrated one if
+  /// needed. The returned pointer stays valid for the life of the process.
+  std::atomic<int>* getEntry(const std::string& a_key);
+
+  /// \brief Set the method used for `a_key`.
+  void setMethod(const std::string& a_key, const CuttingMethodId a_method);
+
+  /// \brief Return the method used for `a_key`.
+  CuttingMethodId getMethod(const std::string& a_key);
+
+  /// \brief Return whether `a_key` has been calibrated or loaded.
+  bool isCalibrated(const std::string& a_key);
+
+  /// \brief Return the number of calibrated combinations.
+  UnsignedIndex_t getNumberOfCalibratedEntries(void) const;
+
+  /// \brief Write all calibrated entries to `a_file_name`, returning
+  /// whether the file could be written.
+  bool save(const std::string& a_file_name) const;
+
+  /// \brief Read entries written by save(), replacing the method for every
+  /// combination in the file. Returns false, leaving the table unchanged,
+  /// if the file cannot be opened or is not a valid table.
+  bool load(const std::string& a_file_name);
+
+  /// \brief Return every combination to the uncalibrated state.
+  void reset(void);
+
+  CuttingMethodTable(const CuttingMethodTable& other) = delete;
+  CuttingMethodTable& operator=(const CuttingMethodTable& other) = delete;
+
+ private:
+  CuttingMethodTable(void) = default;
+
+  static constexpr int uncalibrated_m = -1;
+
+  mutable std::mutex mutex_m;
+  std::unordered_map<std::string, std::unique_ptr<std::atomic<int>>>
+      entries_m;
+};
+
+/// \brief Key identifying a combination in the CuttingMethodTable.
+template <class ReturnType, class EncompassingType, class ReconstructionType>
+std::string getCuttingMethodKey(void);
+
+/// \brief Return the cutting method AutoTunedCutting uses for the
+/// combination.
+template <class ReturnType, class EncompassingType, class ReconstructionType>
+CuttingMethodId getTunedCuttingMethod(void);
+
+}  // namespace IRL
+
+#include "irl/generic_cutting/cutting_method_table.tpp"
+
+#endif  // IRL_GENERIC_CUTTING_CUTTING_METHOD_TABLE_H_
@@ -0,0 +1,35 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GENERIC_CUTTING_CUTTING_METHOD_TABLE_TPP_
+#define IRL_GENERIC_CUTTING_CUTTING_METHOD_TABLE_TPP_
+
+namespace IRL {
+
+template <class ReturnType, class EncompassingType, class ReconstructionType>
+std::string getCuttingMethodKey(void) {
+  return std::string(typeid(ReturnType).name()) + ',' +
+         typeid(EncompassingType).name() + ',' +
+         typeid(ReconstructionType).name();
+}
+
+template <class ReturnType, class EncompassingType, class ReconstructionType>
+CuttingMethodId getTunedCuttingMethod(void) {
+  static std::atomic<int>* const entry =
+      CuttingMethodTable::getTable().getEntry(
+          getCuttingMethodKey<ReturnType, EncompassingType,
+                              ReconstructionType>());
+  const int method = entry->load(std::memory_order_relaxed);
+  return method < 0 ? CuttingMethodId::HalfEdgeCutting
+                    : static_cast<CuttingMethodId>(method);
+}
+
+}  // namespace IRL
+
+#endif  // IRL_GENERIC_CUTTING_CUTTING_METHOD_TABLE_TPP_
@@ -0,0 +1,62 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/generic_cutting/cutting_method_tuner.h"
+
+#include <vector>
+
+#include "irl/helpers/cutting_samples.h"
+#include "irl/moments/volume.h"
+#include "irl/moments/volume_moments.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace IRL {
+
+namespace {
+
+// Three in four calibration separators have one plane, the rest two.
+constexpr UnsignedIndex_t number_of_one_plane_samples = 192;
+constexpr UnsignedIndex_t number_of_two_plane_samples = 64;
+constexpr UnsignedIndex_t number_of_calibration_samples =
+    number_of_one_plane_samples + number_of_two_plane_samples;
+
+// Calibrate on the same polyhedron and separators as the cutting benchmarks.
+template <class PolyhedronType>
+void calibratePolyhedron(void) {
+  const auto polyhedron = makeSamplePolyhedron<PolyhedronType>();
+  const std::vector<PolyhedronType> polyhedra(number_of_calibration_samples,
+                                              polyhedron);
+  const Pt centroid = polyhedron.calculateCentroid();
+  auto separators = generateSampleSeparators(
+      centroid, number_of_one_plane_samples, 1);
+  const auto two_plane_separators = generateSampleSeparators(
+      centroid, number_of_two_plane_samples, 2);
+  separators.insert(separators.end(), two_plane_separators.begin(),
+                    two_plane_separators.end());
+  calibrateCuttingMethod<Volume>(polyhedra.data(), separators.data(),
+                                 number_of_calibration_samples);
+  calibrateCuttingMethod<VolumeMoments>(polyhedra.data(), separators.data(),
+                                        number_of_calibration_samples);
+}
+
+}  // namespace
+
+void calibrateCuttingMethods(void) {
+  calibratePolyhedron<RectangularCuboid>();
+  calibratePolyhedron<Hexahedron>();
+  calibratePolyhedron<Tet>();
+  calibratePolyhedron<TriangularPrism>();
+  calibratePolyhedron<Pyramid>();
+  calibratePolyhedron<Octahedron>();
+  calibratePolyhedron<Dodecahedron>();
+  calibratePolyhedron<CappedDodecahedron>();
+  calibratePolyhedron<Polyhedron24>();
+}
+
+}  // namespace IRL
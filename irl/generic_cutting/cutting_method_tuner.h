@@ -0,0 +1,49 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GENERIC_CUTTING_CUTTING_METHOD_TUNER_H_
+#define IRL_GENERIC_CUTTING_CUTTING_METHOD_TUNER_H_
+
+#include "irl/generic_cutting/cutting_method_table.h"
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/parameters/defined_types.h"
+
+namespace IRL {
+
+/// \brief Time HalfEdgeCutting, RecursiveSimplexCutting, and SimplexCutting
+/// on the given sample of polytopes and reconstructions, and store the
+/// fastest in the CuttingMethodTable entry used by AutoTunedCutting for this
+/// combination of types.
+///
+/// Each method is timed `a_repetitions` times over the whole sample and its
+/// best time kept. A method is only eligible if every volume it returns
+/// matches HalfEdgeCutting to within 1.0e-10 of the polytope volume, so a
+/// method with a defect for part of the sample is never selected.
+///
+/// ReturnType must be Volume or a moments type with a `volume()` method, and
+/// not a SeparatedMoments type, since AutoTunedCutting looks up the table
+/// for each phase separately.
+///
+/// Returns the selected method.
+template <class ReturnType, class EncompassingType, class ReconstructionType>
+CuttingMethodId calibrateCuttingMethod(
+    const EncompassingType* a_polytopes,
+    const ReconstructionType* a_reconstructions, const UnsignedIndex_t a_size,
+    const UnsignedIndex_t a_repetitions = 3);
+
+/// \brief Calibrate every polyhedron in irl/geometry/polyhedrons cut by a
+/// PlanarSeparator, for Volume and VolumeMoments, using unit-sized
+/// polyhedra cut by random planes through them.
+void calibrateCuttingMethods(void);
+
+}  // namespace IRL
+
+#include "irl/generic_cutting/cutting_method_tuner.tpp"
+
+#endif  // IRL_GENERIC_CUTTING_CUTTING_METHOD_TUNER_H_
@@ -0,0 +1,108 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GENERIC_CUTTING_CUTTING_METHOD_TUNER_TPP_
+#define IRL_GENERIC_CUTTING_CUTTING_METHOD_TUNER_TPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "irl/moments/volume.h"
+
+namespace IRL {
+
+namespace cutting_method_tuner_details {
+
+inline double calibrationVolume(const Volume& a_volume) {
+  return static_cast<double>(a_volume);
+}
+
+template <class MomentsType>
+double calibrationVolume(const MomentsType& a_moments) {
+  return a_moments.volume();
+}
+
+// Volumes of the sample cut with `CuttingMethod`, and the best time over
+// `a_repetitions` passes in seconds.
+template <class ReturnType, class CuttingMethod, class EncompassingType,
+          class ReconstructionType>
+double timeCuttingMethod(const EncompassingType* a_polytopes,
+                         const ReconstructionType* a_reconstructions,
+                         const UnsignedIndex_t a_size,
+                         const UnsignedIndex_t a_repetitions,
+                         std::vector<double>* a_volumes) {
+  a_volumes->resize(a_size);
+  const UnsignedIndex_t number_of_passes =
+      std::max(a_repetitions, static_cast<UnsignedIndex_t>(1));
+  double best_time = std::numeric_limits<double>::max();
+  for (UnsignedIndex_t r = 0; r < number_of_passes; ++r) {
+    const auto start = std::chrono::steady_clock::now();
+    for (UnsignedIndex_t n = 0; n < a_size; ++n) {
+      (*a_volumes)[n] = calibrationVolume(
+          getVolumeMoments<ReturnType, CuttingMethod>(a_polytopes[n],
+                                                      a_reconstructions[n]));
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    best_time = std::min(best_time, elapsed.count());
+  }
+  return best_time;
+}
+
+}  // namespace cutting_method_tuner_details
+
+template <class ReturnType, class EncompassingType, class ReconstructionType>
+CuttingMethodId calibrateCuttingMethod(
+    const EncompassingType* a_polytopes,
+    const ReconstructionType* a_reconstructions, const UnsignedIndex_t a_size,
+    const UnsignedIndex_t a_repetitions) {
+  static_assert(!is_separated_moments<ReturnType>::value,
+                "Calibrate the moments type contained in SeparatedMoments.");
+  using namespace cutting_method_tuner_details;
+  std::vector<double> reference_volumes;
+  std::vector<double> volumes;
+  CuttingMethodId best_method = CuttingMethodId::HalfEdgeCutting;
+  double best_time = timeCuttingMethod<ReturnType, HalfEdgeCutting>(
+      a_polytopes, a_reconstructions, a_size, a_repetitions,
+      &reference_volumes);
+
+  auto try_method = [&](const CuttingMethodId a_method, const double a_time) {
+    for (UnsignedIndex_t n = 0; n < a_size; ++n) {
+      const double tolerance =
+          1.0e-10 * std::fabs(calibrationVolume(
+                        getVolumeMoments<Volume>(a_polytopes[n])));
+      if (!(std::fabs(volumes[n] - reference_volumes[n]) <= tolerance)) {
+        return;
+      }
+    }
+    if (a_time < best_time) {
+      best_time = a_time;
+      best_method = a_method;
+    }
+  };
+
+  double time = timeCuttingMethod<ReturnType, RecursiveSimplexCutting>(
+      a_polytopes, a_reconstructions, a_size, a_repetitions, &volumes);
+  try_method(CuttingMethodId::RecursiveSimplexCutting, time);
+  time = timeCuttingMethod<ReturnType, SimplexCutting>(
+      a_polytopes, a_reconstructions, a_size, a_repetitions, &volumes);
+  try_method(CuttingMethodId::SimplexCutting, time);
+
+  CuttingMethodTable::getTable().setMethod(
+      getCuttingMethodKey<ReturnType, EncompassingType, ReconstructionType>(),
+      best_method);
+  return best_method;
+}
+
+}  // namespace IRL
+
+#endif  // IRL_GENERIC_CUTTING_CUTTING_METHOD_TUNER_TPP_
@@ -16,6 +16,13 @@ namespace IRL {
 struct HalfEdgeCutting {};
 struct RecursiveSimplexCutting {};
 struct SimplexCutting {};
+// Closed-form cutting of a RectangularCuboid or Tet by a single plane,
+// falling back to HalfEdgeCutting for anything else.
+struct AnalyticCutting {};
+// Chooses HalfEdgeCutting, RecursiveSimplexCutting, or SimplexCutting at
+// runtime from the CuttingMethodTable, using HalfEdgeCutting until the
+// combination has been calibrated (see cutting_method_tuner.h).
+struct AutoTunedCutting {};
 
 // Default
 using DefaultCuttingMethod = HalfEdgeCutting;
@@ -0,0 +1,97 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/generic_cutting/flux_volume_computer.h"
+
+#include <algorithm>
+
+namespace IRL {
+
+FluxVolumeComputer::FluxVolumeComputer(
+    const UnsignedIndex_t a_number_of_threads)
+    : pool_m(a_number_of_threads),
+      grain_size_m(16),
+      store_tagged_fluxes_m(false),
+      face_fluxes_m(),
+      tagged_face_fluxes_m(),
+      cell_face_offsets_m(),
+      cell_faces_m(),
+      cell_face_signs_m() {}
+
+void FluxVolumeComputer::setGrainSize(const UnsignedIndex_t a_grain_size) {
+  grain_size_m = std::max(static_cast<UnsignedIndex_t>(1), a_grain_size);
+}
+
+void FluxVolumeComputer::setStoreTaggedFluxes(
+    const bool a_store_tagged_fluxes) {
+  store_tagged_fluxes_m = a_store_tagged_fluxes;
+}
+
+UnsignedIndex_t FluxVolumeComputer::getNumberOfThreads(void) const {
+  return pool_m.getNumberOfThreads();
+}
+
+const std::vector<FluxVolumeComputer::FaceFluxType>&
+FluxVolumeComputer::getFaceFluxes(void) const {
+  return face_fluxes_m;
+}
+
+const std::vector<FluxVolumeComputer::TaggedFaceFluxType>&
+FluxVolumeComputer::getTaggedFaceFluxes(void) const {
+  return tagged_face_fluxes_m;
+}
+
+void FluxVolumeComputer::scatterFluxes(const UnsignedIndex_t a_number_of_cells,
+                                       const UnsignedIndex_t* a_face_cells,
+                                       FaceFluxType* a_cell_fluxes) {
+  const auto number_of_faces =
+      static_cast<UnsignedIndex_t>(face_fluxes_m.size());
+
+  // Transpose the face to cell connectivity so that each cell can gather
+  // its own faces.
+  cell_face_offsets_m.assign(a_number_of_cells + 1, 0);
+  for (UnsignedIndex_t f = 0; f < 2 * number_of_faces; ++f) {
+    if (a_face_cells[f] != no_cell) {
+      ++cell_face_offsets_m[a_face_cells[f] + 1];
+    }
+  }
+  for (UnsignedIndex_t c = 0; c < a_number_of_cells; ++c) {
+    cell_face_offsets_m[c + 1] += cell_face_offsets_m[c];
+  }
+  cell_faces_m.resize(cell_face_offsets_m[a_number_of_cells]);
+  cell_face_signs_m.resize(cell_face_offsets_m[a_number_of_cells]);
+  for (UnsignedIndex_t f = 0; f < number_of_faces; ++f) {
+    for (UnsignedIndex_t side = 0; side < 2; ++side) {
+      const UnsignedIndex_t cell = a_face_cells[2 * f + side];
+      if (cell != no_cell) {
+        const UnsignedIndex_t slot = cell_face_offsets_m[cell]++;
+        cell_faces_m[slot] = f;
+        cell_face_signs_m[slot] = side == 0 ? -1.0 : 1.0;
+      }
+    }
+  }
+  // The fill above advanced each offset to the start of the next cell.
+  for (UnsignedIndex_t c = a_number_of_cells; c > 0; --c) {
+    cell_face_offsets_m[c] = cell_face_offsets_m[c - 1];
+  }
+  cell_face_offsets_m[0] = 0;
+
+  pool_m.parallelFor(
+      a_number_of_cells, grain_size_m,
+      [&](const UnsignedIndex_t a_cell, const UnsignedIndex_t) {
+        FaceFluxType& cell_flux = a_cell_fluxes[a_cell];
+        cell_flux = FaceFluxType();
+        for (UnsignedIndex_t n = cell_face_offsets_m[a_cell];
+             n < cell_face_offsets_m[a_cell + 1]; ++n) {
+          cell_flux += cell_face_signs_m[n] * face_fluxes_m[cell_faces_m[n]];
+        }
+      });
+}
+
+}  // namespace IRL
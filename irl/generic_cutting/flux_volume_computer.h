@@ -0,0 +1,129 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GENERIC_CUTTING_FLUX_VOLUME_COMPUTER_H_
+#define IRL_GENERIC_CUTTING_FLUX_VOLUME_COMPUTER_H_
+
+#include <limits>
+#include <vector>
+
+#include "irl/geometry/general/pt.h"
+#include "irl/helpers/work_stealing_thread_pool.h"
+#include "irl/moments/separated_volume_moments.h"
+#include "irl/moments/tagged_accumulated_volume_moments.h"
+#include "irl/moments/volume_moments.h"
+#include "irl/parameters/defined_types.h"
+#include "irl/planar_reconstruction/localized_separator_link.h"
+
+namespace IRL {
+
+/// \brief Computes the semi-Lagrangian flux volumes through every face of a
+/// mesh and accumulates them into the cells.
+///
+/// Each face is a quadrilateral given by four vertices. Its flux volume is
+/// the CappedDodecahedron spanned by the face, the back projection of its
+/// vertices, and the back projection of its center as the cap, optionally
+/// adjusted so that its volume matches a given (e.g., discretely
+/// divergence-free) flux. The flux volume is cut by the
+/// LocalizedSeparatorLink graph starting from a link given for each face,
+/// giving its liquid and gas moments. If requested with
+/// setStoreTaggedFluxes(), the moments are also kept tagged by the id of
+/// the link that contained them.
+///
+/// The faces are shared between a WorkStealingThreadPool's threads, with
+/// the flux polyhedra built on each thread's stack. Results are stored per
+/// face, and scatterFluxes() gathers them into cells with one thread
+/// writing each cell, so no atomics or locks are needed.
+class FluxVolumeComputer {
+ public:
+  using FaceFluxType = SeparatedMoments<VolumeMoments>;
+  using TaggedFaceFluxType = TaggedAccumulatedVolumeMoments<FaceFluxType>;
+
+  /// \brief Marks the side of a boundary face that has no cell.
+  static constexpr UnsignedIndex_t no_cell =
+      std::numeric_limits<UnsignedIndex_t>::max();
+
+  /// \brief Construct with `a_number_of_threads` threads, including the
+  /// calling thread.
+  explicit FluxVolumeComputer(const UnsignedIndex_t a_number_of_threads);
+
+  /// \brief Set the number of consecutive faces or cells a thread takes at
+  /// once.
+  void setGrainSize(const UnsignedIndex_t a_grain_size);
+
+  /// \brief Return the number of threads work is shared between.
+  UnsignedIndex_t getNumberOfThreads(void) const;
+
+  /// \brief Whether computeFluxes() also stores the moments of each face
+  /// tagged by link. Off by default, since it is slower and
+  /// TaggedAccumulatedVolumeMoments holds a limited number of tags.
+  void setStoreTaggedFluxes(const bool a_store_tagged_fluxes);
+
+  /// \brief Compute the flux through `a_number_of_faces` faces.
+  ///
+  /// The vertices of face f are `a_face_vertices[4 * f]` to
+  /// `a_face_vertices[4 * f + 3]`, ordered so that their right-hand normal
+  /// points in the direction a positive flux moves material. The flux
+  /// volume is positive when material moves that way.
+  ///
+  /// `a_back_project(pt)` must return where the material at `pt` was at the
+  /// start of the time step, and is called concurrently from every thread.
+  ///
+  /// If `a_flux_volumes` is not a nullptr, the cap of face f's flux volume
+  /// is moved so the volume is `a_flux_volumes[f]`.
+  ///
+  /// Cutting of face f starts from the link `*a_starting_links[f]`, which
+  /// should be the link of a cell the flux volume overlaps.
+  template <class BackProjectionType>
+  void computeFluxes(const UnsignedIndex_t a_number_of_faces,
+                     const Pt* a_face_vertices,
+                     const BackProjectionType& a_back_project,
+                     const double* a_flux_volumes,
+                     const LocalizedSeparatorLink* const* a_starting_links);
+
+  /// \brief Liquid and gas moments of each face's flux volume from the last
+  /// call to computeFluxes(). Moments are not normalized, and are negative
+  /// for a negative flux.
+  const std::vector<FaceFluxType>& getFaceFluxes(void) const;
+
+  /// \brief Moments of each face's flux volume from the last call to
+  /// computeFluxes(), tagged by the id of the link they were found in.
+  /// Empty unless setStoreTaggedFluxes(true) was called.
+  const std::vector<TaggedFaceFluxType>& getTaggedFaceFluxes(void) const;
+
+  /// \brief Sum the face fluxes from the last call to computeFluxes() into
+  /// `a_number_of_cells` cells.
+  ///
+  /// Face f moves material from cell `a_face_cells[2 * f]` into cell
+  /// `a_face_cells[2 * f + 1]`, either of which can be `no_cell`. On return,
+  /// `a_cell_fluxes[c]` holds the net moments entering cell c.
+  void scatterFluxes(const UnsignedIndex_t a_number_of_cells,
+                     const UnsignedIndex_t* a_face_cells,
+                     FaceFluxType* a_cell_fluxes);
+
+  ~FluxVolumeComputer(void) = default;
+
+ private:
+  WorkStealingThreadPool pool_m;
+  UnsignedIndex_t grain_size_m;
+  bool store_tagged_fluxes_m;
+  std::vector<FaceFluxType> face_fluxes_m;
+  std::vector<TaggedFaceFluxType> tagged_face_fluxes_m;
+  // Faces of each cell in compressed rows, with the sign of their
+  // contribution, rebuilt by scatterFluxes().
+  std::vector<UnsignedIndex_t> cell_face_offsets_m;
+  std::vector<UnsignedIndex_t> cell_faces_m;
+  std::vector<double> cell_face_signs_m;
+};
+
+}  // namespace IRL
+
+#include "irl/generic_cutting/flux_volume_computer.tpp"
+
+#endif  // IRL_GENERIC_CUTTING_FLUX_VOLUME_COMPUTER_H_
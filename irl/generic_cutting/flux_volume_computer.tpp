@@ -0,0 +1,59 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GENERIC_CUTTING_FLUX_VOLUME_COMPUTER_TPP_
+#define IRL_GENERIC_CUTTING_FLUX_VOLUME_COMPUTER_TPP_
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/polyhedrons/capped_dodecahedron.h"
+
+namespace IRL {
+
+template <class BackProjectionType>
+void FluxVolumeComputer::computeFluxes(
+    const UnsignedIndex_t a_number_of_faces, const Pt* a_face_vertices,
+    const BackProjectionType& a_back_project, const double* a_flux_volumes,
+    const LocalizedSeparatorLink* const* a_starting_links) {
+  face_fluxes_m.resize(a_number_of_faces);
+  tagged_face_fluxes_m.resize(store_tagged_fluxes_m ? a_number_of_faces : 0);
+  pool_m.parallelFor(
+      a_number_of_faces, grain_size_m,
+      [&](const UnsignedIndex_t a_face, const UnsignedIndex_t) {
+        const Pt* face_vertices = a_face_vertices + 4 * a_face;
+        CappedDodecahedron flux_volume;
+        for (UnsignedIndex_t v = 0; v < 4; ++v) {
+          flux_volume[v] = face_vertices[v];
+          flux_volume[v + 4] = a_back_project(face_vertices[v]);
+        }
+        flux_volume[8] = a_back_project(
+            0.25 * (face_vertices[0] + face_vertices[1] + face_vertices[2] +
+                    face_vertices[3]));
+        if (a_flux_volumes != nullptr) {
+          flux_volume.adjustCapToMatchVolume(a_flux_volumes[a_face]);
+        }
+
+        if (!store_tagged_fluxes_m) {
+          face_fluxes_m[a_face] = getVolumeMoments<FaceFluxType>(
+              flux_volume, *a_starting_links[a_face]);
+          return;
+        }
+        TaggedFaceFluxType& tagged_flux = tagged_face_fluxes_m[a_face];
+        tagged_flux = getVolumeMoments<TaggedFaceFluxType>(
+            flux_volume, *a_starting_links[a_face]);
+        FaceFluxType& flux = face_fluxes_m[a_face];
+        flux = FaceFluxType();
+        for (UnsignedIndex_t t = 0; t < tagged_flux.size(); ++t) {
+          flux += tagged_flux.getMomentsForIndex(t);
+        }
+      });
+}
+
+}  // namespace IRL
+
+#endif  // IRL_GENERIC_CUTTING_FLUX_VOLUME_COMPUTER_TPP_
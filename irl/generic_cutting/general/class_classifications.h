@@ -44,6 +44,24 @@ struct isSimplexCutting<const C> : isSimplexCutting<C> {};
 template <>
 struct isSimplexCutting<SimplexCutting> : std::true_type {};
 
+template <class C>
+struct isAnalyticCutting : std::false_type {};
+
+template <class C>
+struct isAnalyticCutting<const C> : isAnalyticCutting<C> {};
+
+template <>
+struct isAnalyticCutting<AnalyticCutting> : std::true_type {};
+
+template <class C>
+struct isAutoTunedCutting : std::false_type {};
+
+template <class C>
+struct isAutoTunedCutting<const C> : isAutoTunedCutting<C> {};
+
+template <>
+struct isAutoTunedCutting<AutoTunedCutting> : std::true_type {};
+
 // More explanatory characterizations of different classes used for cutting.
 template <class ReconstructionType>
 struct IsNullReconstruction {
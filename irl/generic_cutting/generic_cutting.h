@@ -14,13 +14,16 @@
 #include <type_traits>
 #include <vector>
 
+#include "irl/generic_cutting/cutting_method_table.h"
 #include "irl/generic_cutting/generic_cutting_definitions.h"
 #include "irl/generic_cutting/half_edge_cutting/half_edge_cutting_drivers.h"
 #include "irl/generic_cutting/half_edge_cutting/half_edge_cutting_initializer.h"
 #include "irl/generic_cutting/recursive_simplex_cutting/recursive_simplex_cutting_initializer.h"
 #include "irl/generic_cutting/simplex_cutting/simplex_cutting_initializer.h"
 #include "irl/helpers/SFINAE_boiler_plate.h"
+#include "irl/helpers/telemetry.h"
 #include "irl/moments/separated_volume_moments.h"
+#include "irl/parameters/tolerance_context.h"
 #include "irl/planar_reconstruction/null_reconstruction.h"
 #include "irl/planar_reconstruction/planar_separator.h"
 #include "irl/planar_reconstruction/planar_separator_path_group.h"
@@ -96,6 +99,36 @@ struct getVolumeMoments<
       const ReconstructionType& a_separating_reconstruction);
 };
 
+template <class ReturnType, class CuttingMethod, class EncompassingType,
+          class ReconstructionType>
+struct getVolumeMoments<
+    ReturnType, CuttingMethod, EncompassingType, ReconstructionType,
+    enable_if_t<isAnalyticCutting<CuttingMethod>::value &&
+                IsNotANullReconstruction<ReconstructionType>::value &&
+                IsNotAPlanarSeparatorPathGroup<ReconstructionType>::value &&
+                !(IsPlanarSeparator<ReconstructionType>::value &&
+                  is_separated_moments<ReturnType>::value)>> {
+  __attribute__((pure)) __attribute__((hot)) inline static ReturnType
+  getVolumeMomentsImplementation(
+      const EncompassingType& a_encompassing_polyhedron,
+      const ReconstructionType& a_separating_reconstruction);
+};
+
+template <class ReturnType, class CuttingMethod, class EncompassingType,
+          class ReconstructionType>
+struct getVolumeMoments<
+    ReturnType, CuttingMethod, EncompassingType, ReconstructionType,
+    enable_if_t<isAutoTunedCutting<CuttingMethod>::value &&
+                IsNotANullReconstruction<ReconstructionType>::value &&
+                IsNotAPlanarSeparatorPathGroup<ReconstructionType>::value &&
+                !(IsPlanarSeparator<ReconstructionType>::value &&
+                  is_separated_moments<ReturnType>::value)>> {
+  // Not pure, since the result depends on the CuttingMethodTable entry.
+  __attribute__((hot)) inline static ReturnType getVolumeMomentsImplementation(
+      const EncompassingType& a_encompassing_polyhedron,
+      const ReconstructionType& a_separating_reconstruction);
+};
+
 // Cut polyhedron for SeparatedMoments<VolumeMoments>
 template <class ReturnType, class CuttingMethod, class EncompassingType>
 struct getVolumeMoments<ReturnType, CuttingMethod, EncompassingType,
@@ -196,6 +229,32 @@ struct getVolumeMomentsProvidedStorage<
       const PlanarSeparator& a_reconstruction);
 };
 
+// Analytic cutting needs a complete polytope, so provided-storage cutting
+// is done through half-edge structures instead.
+template <class ReturnType, class CuttingMethod, class SegmentedPolytopeType,
+          class HalfEdgePolytopeType, class ReconstructionType>
+struct getVolumeMomentsProvidedStorage<
+    ReturnType, CuttingMethod, SegmentedPolytopeType, HalfEdgePolytopeType,
+    ReconstructionType, enable_if_t<isAnalyticCutting<CuttingMethod>::value>> {
+  __attribute__((hot)) inline static ReturnType getVolumeMomentsImplementation(
+      SegmentedPolytopeType* a_polytope,
+      HalfEdgePolytopeType* a_complete_polytope,
+      const ReconstructionType& a_reconstruction);
+};
+
+// The storage is already laid out for half-edge cutting, so auto-tuned
+// provided-storage cutting always uses it.
+template <class ReturnType, class CuttingMethod, class SegmentedPolytopeType,
+          class HalfEdgePolytopeType, class ReconstructionType>
+struct getVolumeMomentsProvidedStorage<
+    ReturnType, CuttingMethod, SegmentedPolytopeType, HalfEdgePolytopeType,
+    ReconstructionType, enable_if_t<isAutoTunedCutting<CuttingMethod>::value>> {
+  __attribute__((hot)) inline static ReturnType getVolumeMomentsImplementation(
+      SegmentedPolytopeType* a_polytope,
+      HalfEdgePolytopeType* a_complete_polytope,
+      const ReconstructionType& a_reconstruction);
+};
+
 }  // namespace generic_cutting_details
 
 }  // namespace IRL
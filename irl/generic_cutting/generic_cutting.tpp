@@ -29,7 +29,7 @@ template <class EncompassingType>
 enable_if_t<is_polygon<EncompassingType>::value, bool> polytopeIsValid(
     const EncompassingType& a_polytope) {
   return a_polytope.calculateAbsoluteVolume() <
-             global_constants::MINIMUM_SURFACE_AREA_TO_TRACK ||
+             getMinimumSurfaceAreaToTrack() ||
          a_polytope.getPlaneOfExistence().normal().calculateMagnitude() > 0.999;
 }
 
@@ -43,11 +43,34 @@ template <class EncompassingType>
 enable_if_t<is_polygon<EncompassingType>::value, bool> polytopeIsValid(
     const EncompassingType* a_polytope) {
   return a_polytope->calculateAbsoluteVolume() <
-             global_constants::MINIMUM_SURFACE_AREA_TO_TRACK ||
+             getMinimumSurfaceAreaToTrack() ||
          a_polytope->getPlaneOfExistence().normal().calculateMagnitude() >
              0.999;
 }
 
+// Pairs of moments and polytopes with a closed-form solution for
+// a single cutting plane.
+template <class ReturnType, class EncompassingType>
+struct hasAnalyticMoments {
+  static constexpr bool value =
+      (std::is_same<ReturnType, Volume>::value ||
+       std::is_same<ReturnType, VolumeMoments>::value) &&
+      (std::is_same<EncompassingType, RectangularCuboid>::value ||
+       std::is_same<EncompassingType, Tet>::value);
+};
+
+template <class ReturnType, class EncompassingType>
+inline enable_if_t<std::is_same<ReturnType, Volume>::value, ReturnType>
+getAnalyticMoments(const EncompassingType& a_polytope, const Plane& a_plane) {
+  return getAnalyticVolume(a_polytope, a_plane);
+}
+
+template <class ReturnType, class EncompassingType>
+inline enable_if_t<std::is_same<ReturnType, VolumeMoments>::value, ReturnType>
+getAnalyticMoments(const EncompassingType& a_polytope, const Plane& a_plane) {
+  return getAnalyticVolumeMoments(a_polytope, a_plane);
+}
+
 }  // namespace generic_cutting_details
 
 //******************************************************************* //
@@ -66,6 +89,7 @@ __attribute__((pure)) __attribute__((hot)) inline ReturnType getVolumeMoments(
     const EncompassingType& a_encompassing_polyhedron,
     const ReconstructionType& a_reconstruction) {
   assert(generic_cutting_details::polytopeIsValid(a_encompassing_polyhedron));
+  TelemetryScopedTimer timer(TelemetryTimer::Cutting);
   return generic_cutting_details::getVolumeMoments<
       ReturnType, CuttingMethod, EncompassingType, ReconstructionType>::
       getVolumeMomentsImplementation(a_encompassing_polyhedron,
@@ -78,6 +102,7 @@ __attribute__((pure)) __attribute__((
 getVolumeMoments(const Tet& a_encompassing_polyhedron,
                  const PlanarSeparator& a_reconstruction) {
   assert(generic_cutting_details::polytopeIsValid(a_encompassing_polyhedron));
+  TelemetryScopedTimer timer(TelemetryTimer::Cutting);
   if (a_reconstruction.getNumberOfPlanes() == 1) {
     return getAnalyticVolume(a_encompassing_polyhedron, a_reconstruction[0]);
   } else {
@@ -94,6 +119,7 @@ __attribute__((pure)) __attribute__((
 getVolumeMoments(const RectangularCuboid& a_encompassing_polyhedron,
                  const PlanarSeparator& a_reconstruction) {
   assert(generic_cutting_details::polytopeIsValid(a_encompassing_polyhedron));
+  TelemetryScopedTimer timer(TelemetryTimer::Cutting);
   if (a_reconstruction.getNumberOfPlanes() == 1) {
     return getAnalyticVolume(a_encompassing_polyhedron, a_reconstruction[0]);
   } else {
@@ -241,6 +267,87 @@ ReturnType getVolumeMoments<
   return cutThroughRecursiveSimplex<ReturnType>(a_polytope, a_reconstruction);
 }
 
+template <class ReturnType, class CuttingMethod, class EncompassingType,
+          class ReconstructionType>
+ReturnType getVolumeMoments<
+    ReturnType, CuttingMethod, EncompassingType, ReconstructionType,
+    enable_if_t<isAnalyticCutting<CuttingMethod>::value &&
+                IsNotANullReconstruction<ReconstructionType>::value &&
+                IsNotAPlanarSeparatorPathGroup<ReconstructionType>::value &&
+                !(IsPlanarSeparator<ReconstructionType>::value &&
+                  is_separated_moments<ReturnType>::value)>>::
+    getVolumeMomentsImplementation(const EncompassingType& a_polytope,
+                                   const ReconstructionType& a_reconstruction) {
+  if constexpr (IsPlanarSeparator<ReconstructionType>::value &&
+                hasAnalyticMoments<ReturnType, EncompassingType>::value) {
+    if (a_reconstruction.getNumberOfPlanes() == 1) {
+      ReturnType moments =
+          getAnalyticMoments<ReturnType>(a_polytope, a_reconstruction[0]);
+      if (a_reconstruction.isFlipped()) {
+        moments = ReturnType::calculateMoments(&a_polytope) - moments;
+      }
+      return moments;
+    }
+  }
+  return cutThroughHalfEdgeStructures<ReturnType>(a_polytope, a_reconstruction);
+}
+
+template <class ReturnType, class CuttingMethod, class EncompassingType,
+          class ReconstructionType>
+ReturnType getVolumeMoments<
+    ReturnType, CuttingMethod, EncompassingType, ReconstructionType,
+    enable_if_t<isAutoTunedCutting<CuttingMethod>::value &&
+                IsNotANullReconstruction<ReconstructionType>::value &&
+                IsNotAPlanarSeparatorPathGroup<ReconstructionType>::value &&
+                !(IsPlanarSeparator<ReconstructionType>::value &&
+                  is_separated_moments<ReturnType>::value)>>::
+    getVolumeMomentsImplementation(const EncompassingType& a_polytope,
+                                   const ReconstructionType& a_reconstruction) {
+  switch (getTunedCuttingMethod<ReturnType, EncompassingType,
+                                ReconstructionType>()) {
+    case CuttingMethodId::RecursiveSimplexCutting:
+      return cutThroughRecursiveSimplex<ReturnType>(a_polytope,
+                                                    a_reconstruction);
+    case CuttingMethodId::SimplexCutting:
+      return cutThroughSimplex<ReturnType>(a_polytope, a_reconstruction);
+    default:
+      return cutThroughHalfEdgeStructures<ReturnType>(a_polytope,
+                                                      a_reconstruction);
+  }
+}
+
+template <class ReturnType, class CuttingMethod, class SegmentedPolytopeType,
+          class HalfEdgePolytopeType, class ReconstructionType>
+inline ReturnType getVolumeMomentsProvidedStorage<
+    ReturnType, CuttingMethod, SegmentedPolytopeType, HalfEdgePolytopeType,
+    ReconstructionType,
+    enable_if_t<isAutoTunedCutting<CuttingMethod>::value>>::
+    getVolumeMomentsImplementation(SegmentedPolytopeType* a_polytope,
+                                   HalfEdgePolytopeType* a_complete_polytope,
+                                   const ReconstructionType& a_reconstruction) {
+  return getVolumeMomentsProvidedStorage<
+      ReturnType, HalfEdgeCutting, SegmentedPolytopeType, HalfEdgePolytopeType,
+      ReconstructionType>::getVolumeMomentsImplementation(a_polytope,
+                                                          a_complete_polytope,
+                                                          a_reconstruction);
+}
+
+template <class ReturnType, class CuttingMethod, class SegmentedPolytopeType,
+          class HalfEdgePolytopeType, class ReconstructionType>
+inline ReturnType getVolumeMomentsProvidedStorage<
+    ReturnType, CuttingMethod, SegmentedPolytopeType, HalfEdgePolytopeType,
+    ReconstructionType,
+    enable_if_t<isAnalyticCutting<CuttingMethod>::value>>::
+    getVolumeMomentsImplementation(SegmentedPolytopeType* a_polytope,
+                                   HalfEdgePolytopeType* a_complete_polytope,
+                                   const ReconstructionType& a_reconstruction) {
+  return getVolumeMomentsProvidedStorage<
+      ReturnType, HalfEdgeCutting, SegmentedPolytopeType, HalfEdgePolytopeType,
+      ReconstructionType>::getVolumeMomentsImplementation(a_polytope,
+                                                          a_complete_polytope,
+                                                          a_reconstruction);
+}
+
 template <class ReturnType, class CuttingMethod, class SegmentedPolytopeType,
           class HalfEdgePolytopeType, class ReconstructionType>
 inline ReturnType getVolumeMomentsProvidedStorage<
@@ -0,0 +1,130 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GENERIC_CUTTING_HALF_EDGE_CUTTING_DISTANCE_CUT_SESSION_H_
+#define IRL_GENERIC_CUTTING_HALF_EDGE_CUTTING_DISTANCE_CUT_SESSION_H_
+
+#include "irl/data_structures/small_vector.h"
+#include "irl/generic_cutting/half_edge_cutting/half_edge_cutting.h"
+#include "irl/geometry/general/normal.h"
+#include "irl/geometry/general/plane.h"
+#include "irl/geometry/half_edge_structures/half_edge_polyhedron.h"
+#include "irl/geometry/half_edge_structures/segmented_half_edge_polyhedron.h"
+#include "irl/helpers/telemetry.h"
+#include "irl/parameters/constants.h"
+#include "irl/parameters/defined_types.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace IRL {
+
+/// \brief Volume of a polyhedron underneath a PlanarSeparator whose planes
+/// only change in distance between calls, as during a distance solve.
+///
+/// The first call clips a half-edge version of the cell owned by the
+/// session, exactly as `getVolumeMoments<Volume, HalfEdgeCutting>(...)`
+/// does, and records the side of each plane every vertex was on along with
+/// the edge each intersection vertex was created on. Later calls with the
+/// same normals keep this topology as long as no vertex changes side,
+/// i.e., while every plane stays within the same bracket of vertex
+/// distances. Only the intersection vertices are then moved before the
+/// volume is recomputed. The cell is clipped again when a plane crosses a
+/// vertex or the normals change. Volumes are identical to those of
+/// `getVolumeMoments<Volume, HalfEdgeCutting>(...)`.
+///
+/// Cuts that would not fit in the session's storage are made without
+/// being recorded, so that the cell is clipped again on every call.
+template <class CellType>
+class DistanceCutSession {
+  using pt_type = typename CellType::pt_type;
+  using HalfEdgePolytopeType = HalfEdgePolyhedron<pt_type>;
+  using SegmentedPolytopeType =
+      SegmentedHalfEdgePolyhedron<typename HalfEdgePolytopeType::face_type,
+                                  typename HalfEdgePolytopeType::vertex_type>;
+  // Same bound as the plane storage of PlanarSeparator, which may hold
+  // more than MAX_PLANAR_SEPARATOR_PLANES planes.
+  static constexpr UnsignedIndex_t kMaxPlanes =
+      global_constants::MAX_PLANAR_LOCALIZER_PLANES;
+  // Largest number of vertices polytope_m can hold.
+  static constexpr UnsignedIndex_t kMaxVertices =
+      segmented_half_edge_polytope::default_sizes::segmented_max_vertices;
+  // Storage for the vertices created by cuts is sized so that cuts by
+  // MAX_PLANAR_SEPARATOR_PLANES planes of the largest cells are recorded.
+  static constexpr UnsignedIndex_t kMaxRecordedVertices =
+      global_constants::MAX_PLANAR_SEPARATOR_PLANES * kMaxVertices;
+
+ public:
+  DistanceCutSession(void);
+
+  /// \brief Set the cell to cut, discarding any recorded cut. The cell
+  /// must outlive its use by the session.
+  void setCell(const CellType& a_cell);
+
+  /// \brief Volume of the cell underneath `a_reconstruction`.
+  double calculateVolume(const PlanarSeparator& a_reconstruction);
+
+  /// \brief Number of times the cell has been clipped from scratch
+  /// since the last `setCell(...)`.
+  UnsignedIndex_t getNumberOfClips(void) const;
+
+ private:
+  // Intersection vertex on the edge from an unclipped to a clipped vertex.
+  struct IntersectionEdge {
+    UnsignedIndex_t under;
+    UnsignedIndex_t over;
+  };
+
+  // Side of a plane a vertex was on when the cut was recorded.
+  struct VertexSide {
+    UnsignedIndex_t vertex;
+    bool clipped;
+  };
+
+  static Plane cuttingPlane(const PlanarSeparator& a_reconstruction,
+                            const UnsignedIndex_t a_plane);
+
+  bool hasSameNormals(const PlanarSeparator& a_reconstruction) const;
+
+  void clipCell(const PlanarSeparator& a_reconstruction);
+
+  bool recordCut(const Plane& a_plane);
+
+  bool moveIntersectionVertices(const PlanarSeparator& a_reconstruction);
+
+  const CellType* cell_m;
+  HalfEdgePolytopeType complete_polytope_m;
+  SegmentedPolytopeType polytope_m;
+  bool cut_recorded_m;
+  bool flipped_m;
+  UnsignedIndex_t number_of_clips_m;
+  UnsignedIndex_t number_of_cut_planes_m;
+  UnsignedIndex_t number_of_cell_vertices_m;
+  double cell_volume_m;
+  SmallVector<Normal, kMaxPlanes> normals_m;
+  // Locations of the cell vertices followed by the intersection vertices,
+  // in the order they were created.
+  SmallVector<pt_type, kMaxVertices + kMaxRecordedVertices> locations_m;
+  SmallVector<double, kMaxVertices + kMaxRecordedVertices> distances_m;
+  SmallVector<IntersectionEdge, kMaxRecordedVertices> intersections_m;
+  SmallVector<UnsignedIndex_t, kMaxPlanes + 1> intersection_offsets_m;
+  SmallVector<VertexSide, kMaxRecordedVertices> sides_m;
+  SmallVector<UnsignedIndex_t, kMaxPlanes + 1> side_offsets_m;
+  // Index in locations_m of each vertex of polytope_m.
+  SmallVector<UnsignedIndex_t, kMaxVertices> polytope_vertices_m;
+};
+
+/// \brief Session kept for `CellType` on the calling thread, so that its
+/// storage is reused between distance solves.
+template <class CellType>
+DistanceCutSession<CellType>& getDistanceCutSession(void);
+
+}  // namespace IRL
+
+#include "irl/generic_cutting/half_edge_cutting/distance_cut_session.tpp"
+
+#endif  // IRL_GENERIC_CUTTING_HALF_EDGE_CUTTING_DISTANCE_CUT_SESSION_H_
@@ -0,0 +1,258 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GENERIC_CUTTING_HALF_EDGE_CUTTING_DISTANCE_CUT_SESSION_TPP_
+#define IRL_GENERIC_CUTTING_HALF_EDGE_CUTTING_DISTANCE_CUT_SESSION_TPP_
+
+#include <cfloat>
+
+namespace IRL {
+
+template <class CellType>
+DistanceCutSession<CellType>::DistanceCutSession(void)
+    : cell_m(nullptr),
+      cut_recorded_m(false),
+      flipped_m(false),
+      number_of_clips_m(0),
+      number_of_cut_planes_m(0),
+      number_of_cell_vertices_m(0),
+      cell_volume_m(0.0) {}
+
+template <class CellType>
+void DistanceCutSession<CellType>::setCell(const CellType& a_cell) {
+  cell_m = &a_cell;
+  cut_recorded_m = false;
+  number_of_clips_m = 0;
+}
+
+template <class CellType>
+double DistanceCutSession<CellType>::calculateVolume(
+    const PlanarSeparator& a_reconstruction) {
+  assert(cell_m != nullptr);
+  if (!cut_recorded_m || !this->hasSameNormals(a_reconstruction) ||
+      !this->moveIntersectionVertices(a_reconstruction)) {
+    this->clipCell(a_reconstruction);
+  }
+  double volume = 0.0;
+  if (polytope_m.getNumberOfFaces() > 0) {
+    volume += polytope_m.calculateVolume();
+  }
+  return flipped_m ? cell_volume_m - volume : volume;
+}
+
+template <class CellType>
+UnsignedIndex_t DistanceCutSession<CellType>::getNumberOfClips(void) const {
+  return number_of_clips_m;
+}
+
+template <class CellType>
+Plane DistanceCutSession<CellType>::cuttingPlane(
+    const PlanarSeparator& a_reconstruction, const UnsignedIndex_t a_plane) {
+  return a_reconstruction.isFlipped()
+             ? a_reconstruction[a_plane].generateFlippedPlane()
+             : a_reconstruction[a_plane];
+}
+
+template <class CellType>
+bool DistanceCutSession<CellType>::hasSameNormals(
+    const PlanarSeparator& a_reconstruction) const {
+  if (a_reconstruction.isFlipped() != flipped_m ||
+      a_reconstruction.getNumberOfPlanes() != normals_m.size()) {
+    return false;
+  }
+  for (UnsignedIndex_t p = 0; p < normals_m.size(); ++p) {
+    const Normal& normal = a_reconstruction[p].normal();
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      if (normal[d] != normals_m[p][d]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <class CellType>
+void DistanceCutSession<CellType>::clipCell(
+    const PlanarSeparator& a_reconstruction) {
+  countTelemetry(TelemetryCounter::HalfEdgePolytopeBuilds);
+  ++number_of_clips_m;
+  cell_m->setHalfEdgeVersion(&complete_polytope_m);
+  polytope_m = complete_polytope_m.generateSegmentedPolyhedron();
+  assert(polytope_m.checkValidHalfEdgeStructure());
+
+  flipped_m = a_reconstruction.isFlipped();
+  if (flipped_m) {
+    cell_volume_m = polytope_m.calculateVolume();
+  }
+  normals_m.resize(a_reconstruction.getNumberOfPlanes());
+  for (UnsignedIndex_t p = 0; p < normals_m.size(); ++p) {
+    normals_m[p] = a_reconstruction[p].normal();
+  }
+
+  number_of_cell_vertices_m = polytope_m.getNumberOfVertices();
+  locations_m.resize(number_of_cell_vertices_m);
+  polytope_vertices_m.resize(number_of_cell_vertices_m);
+  for (UnsignedIndex_t v = 0; v < number_of_cell_vertices_m; ++v) {
+    locations_m[v] = polytope_m.getVertex(v)->getLocation();
+    polytope_vertices_m[v] = v;
+  }
+  intersections_m.clear();
+  intersection_offsets_m.resize(1);
+  intersection_offsets_m[0] = 0;
+  sides_m.clear();
+  side_offsets_m.resize(1);
+  side_offsets_m[0] = 0;
+
+  // Same sequence of truncations as localizeInternalToReconstruction(...).
+  cut_recorded_m = true;
+  number_of_cut_planes_m = 0;
+  for (UnsignedIndex_t p = 0; p < a_reconstruction.getNumberOfPlanes(); ++p) {
+    if (polytope_m.getNumberOfFaces() == 0) {
+      break;
+    }
+    const Plane cutting_plane = cuttingPlane(a_reconstruction, p);
+    // Planes with no normal are handled without distances to vertices,
+    // so are not recorded.
+    if (squaredMagnitude(cutting_plane.normal()) < DBL_MIN) {
+      cut_recorded_m = false;
+    }
+    if (cut_recorded_m) {
+      cut_recorded_m = this->recordCut(cutting_plane);
+    }
+    if (cut_recorded_m) {
+      ++number_of_cut_planes_m;
+    } else {
+      truncateHalfEdgePolytope(&polytope_m, &complete_polytope_m,
+                               cutting_plane);
+    }
+  }
+}
+
+template <class CellType>
+bool DistanceCutSession<CellType>::recordCut(const Plane& a_plane) {
+  polytope_m.calculateAndStoreDistanceToVertices(a_plane);
+  const UnsignedIndex_t starting_number_of_vertices =
+      polytope_m.getNumberOfVertices();
+  const UnsignedIndex_t first_side =
+      static_cast<UnsignedIndex_t>(sides_m.size());
+  const UnsignedIndex_t first_intersection = intersection_offsets_m.back();
+  if (first_side + starting_number_of_vertices > sides_m.capacity()) {
+    return false;
+  }
+  for (UnsignedIndex_t v = 0; v < starting_number_of_vertices; ++v) {
+    sides_m.push_back(VertexSide{polytope_vertices_m[v],
+                                 polytope_m.getVertex(v)->isClipped()});
+  }
+  side_offsets_m.push_back(static_cast<UnsignedIndex_t>(sides_m.size()));
+
+  // Visit the edges in the same order truncateHalfEdgePolytope(...) creates
+  // the intersection vertices on them.
+  for (UnsignedIndex_t v = 0; v < starting_number_of_vertices; ++v) {
+    const auto& vertex = *(polytope_m.getVertex(v));
+    if (vertex.isNotClipped()) {
+      continue;
+    }
+    auto current_edge = vertex.getHalfEdge();
+    const auto starting_edge = current_edge;
+    do {
+      const auto previous_vertex = current_edge->getPreviousVertex();
+      if (previous_vertex->isNotClipped()) {
+        // Leave the cut unrecorded if its vertices do not fit.
+        if (intersections_m.size() == intersections_m.capacity() ||
+            locations_m.size() + intersections_m.size() - first_intersection ==
+                locations_m.capacity()) {
+          sides_m.resize(first_side);
+          side_offsets_m.pop_back();
+          intersections_m.resize(first_intersection);
+          return false;
+        }
+        UnsignedIndex_t under = 0;
+        while (polytope_m.getVertex(under) != previous_vertex) {
+          ++under;
+        }
+        intersections_m.push_back(IntersectionEdge{
+            polytope_vertices_m[under], polytope_vertices_m[v]});
+      }
+      current_edge = current_edge->getOppositeHalfEdge()->getPreviousHalfEdge();
+    } while (current_edge != starting_edge);
+  }
+  const UnsignedIndex_t number_of_intersections =
+      static_cast<UnsignedIndex_t>(intersections_m.size()) -
+      first_intersection;
+  intersection_offsets_m.push_back(
+      static_cast<UnsignedIndex_t>(intersections_m.size()));
+
+  truncateHalfEdgePolytope(&polytope_m, &complete_polytope_m, a_plane);
+
+  // Unclipped vertices are kept in order, followed by the intersection
+  // vertices in the order they were created.
+  UnsignedIndex_t kept_vertices = 0;
+  if (polytope_m.getNumberOfVertices() > 0) {
+    for (UnsignedIndex_t v = 0; v < starting_number_of_vertices; ++v) {
+      if (!sides_m[first_side + v].clipped) {
+        polytope_vertices_m[kept_vertices] = polytope_vertices_m[v];
+        ++kept_vertices;
+      }
+    }
+  } else {
+    assert(number_of_intersections == 0);
+  }
+  polytope_vertices_m.resize(kept_vertices + number_of_intersections);
+  for (UnsignedIndex_t n = 0; n < number_of_intersections; ++n) {
+    polytope_vertices_m[kept_vertices + n] =
+        static_cast<UnsignedIndex_t>(locations_m.size());
+    locations_m.push_back(
+        polytope_m.getVertex(kept_vertices + n)->getLocation());
+  }
+  assert(polytope_vertices_m.size() == polytope_m.getNumberOfVertices());
+  assert(locations_m.size() ==
+         number_of_cell_vertices_m + intersections_m.size());
+  return true;
+}
+
+template <class CellType>
+bool DistanceCutSession<CellType>::moveIntersectionVertices(
+    const PlanarSeparator& a_reconstruction) {
+  distances_m.resize(locations_m.size());
+  for (UnsignedIndex_t p = 0; p < number_of_cut_planes_m; ++p) {
+    const Plane cutting_plane = cuttingPlane(a_reconstruction, p);
+    for (UnsignedIndex_t s = side_offsets_m[p]; s < side_offsets_m[p + 1];
+         ++s) {
+      const auto vertex = sides_m[s].vertex;
+      const double distance =
+          cutting_plane.signedDistanceToPoint(locations_m[vertex]);
+      if ((distance > 0.0) != sides_m[s].clipped) {
+        return false;
+      }
+      distances_m[vertex] = distance;
+    }
+    for (UnsignedIndex_t n = intersection_offsets_m[p];
+         n < intersection_offsets_m[p + 1]; ++n) {
+      const auto& edge = intersections_m[n];
+      locations_m[number_of_cell_vertices_m + n] =
+          pt_type::fromEdgeIntersection(
+              locations_m[edge.under], distances_m[edge.under],
+              locations_m[edge.over], distances_m[edge.over]);
+    }
+  }
+  for (UnsignedIndex_t v = 0; v < polytope_vertices_m.size(); ++v) {
+    polytope_m.getVertex(v)->setLocation(locations_m[polytope_vertices_m[v]]);
+  }
+  return true;
+}
+
+template <class CellType>
+DistanceCutSession<CellType>& getDistanceCutSession(void) {
+  thread_local static DistanceCutSession<CellType> session;
+  return session;
+}
+
+}  // namespace IRL
+
+#endif  // IRL_GENERIC_CUTTING_HALF_EDGE_CUTTING_DISTANCE_CUT_SESSION_TPP_
@@ -17,6 +17,7 @@
 #include "irl/geometry/general/geometry_type_traits.h"
 #include "irl/geometry/half_edge_structures/half_edge.h"
 #include "irl/helpers/SFINAE_boiler_plate.h"
+#include "irl/helpers/telemetry.h"
 
 namespace IRL {
 
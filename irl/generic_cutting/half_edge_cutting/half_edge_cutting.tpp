@@ -81,6 +81,7 @@ splitHalfEdgePolytope(SegmentedHalfEdgePolyhedronType *a_polytope,
                       SegmentedHalfEdgePolyhedronType *a_clipped_polytope,
                       HalfEdgePolytopeType *a_complete_polytope,
                       const Plane &a_plane) {
+  countTelemetry(TelemetryCounter::PlaneClips);
   using VertexType = typename HalfEdgePolytopeType::vertex_type;
   using FaceType = typename HalfEdgePolytopeType::face_type;
   using HalfEdgeType = typename HalfEdgePolytopeType::half_edge_type;
@@ -344,6 +345,7 @@ splitHalfEdgePolytope(SegmentedHalfEdgePolygonType *a_polytope,
                       SegmentedHalfEdgePolygonType *a_clipped_polytope,
                       HalfEdgePolytopeType *a_complete_polytope,
                       const Plane &a_plane) {
+  countTelemetry(TelemetryCounter::PlaneClips);
   using VertexType = typename HalfEdgePolytopeType::vertex_type;
   using FaceType = typename HalfEdgePolytopeType::face_type;
   using HalfEdgeType = typename HalfEdgePolytopeType::half_edge_type;
@@ -624,6 +626,7 @@ enable_if_t<is_polyhedron<SegmentedHalfEdgePolyhedronType>::value>
 truncateHalfEdgePolytope(SegmentedHalfEdgePolyhedronType *a_polytope,
                          HalfEdgePolytopeType *a_complete_polytope,
                          const Plane &a_plane) {
+  countTelemetry(TelemetryCounter::PlaneClips);
   using VertexType = typename HalfEdgePolytopeType::vertex_type;
   using FaceType = typename HalfEdgePolytopeType::face_type;
   using HalfEdgeType = typename HalfEdgePolytopeType::half_edge_type;
@@ -772,6 +775,7 @@ enable_if_t<is_polygon<SegmentedHalfEdgePolygonType>::value>
 truncateHalfEdgePolytope(SegmentedHalfEdgePolygonType *a_polytope,
                          HalfEdgePolytopeType *a_complete_polytope,
                          const Plane &a_plane) {
+  countTelemetry(TelemetryCounter::PlaneClips);
   using VertexType = typename HalfEdgePolytopeType::vertex_type;
   using FaceType = typename HalfEdgePolytopeType::face_type;
   using HalfEdgeType = typename HalfEdgePolytopeType::half_edge_type;
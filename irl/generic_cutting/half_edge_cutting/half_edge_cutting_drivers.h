@@ -13,6 +13,8 @@
 #include "irl/generic_cutting/general/class_classifications.h"
 #include "irl/generic_cutting/half_edge_cutting/half_edge_cutting.h"
 #include "irl/helpers/SFINAE_boiler_plate.h"
+#include "irl/helpers/telemetry.h"
+#include "irl/parameters/tolerance_context.h"
 
 namespace IRL {
 
@@ -395,17 +395,16 @@ void getVolumeMomentsForPolytopeKnownOriginStaticStructWrapper<
 } // namespace getVolumeMomentsForPolytopeDetails
 
 template <class SegmentedHalfEdgePolytopeType>
-static constexpr enable_if_t<
-    is_polyhedron<SegmentedHalfEdgePolytopeType>::value, double>
+static enable_if_t<is_polyhedron<SegmentedHalfEdgePolytopeType>::value,
+                   double>
 getGlobalVolumeTolerance(void) {
-  return global_constants::MINIMUM_VOLUME_TO_TRACK;
+  return getMinimumVolumeToTrack();
 }
 
 template <class SegmentedHalfEdgePolytopeType>
-static constexpr enable_if_t<is_polygon<SegmentedHalfEdgePolytopeType>::value,
-                             double>
+static enable_if_t<is_polygon<SegmentedHalfEdgePolytopeType>::value, double>
 getGlobalVolumeTolerance(void) {
-  return global_constants::MINIMUM_SURFACE_AREA_TO_TRACK;
+  return getMinimumSurfaceAreaToTrack();
 }
 
 template <class SegmentedPolytopeType, class HalfEdgePolytopeType,
@@ -438,6 +437,22 @@ inline bool isIdPresent(const EncounteredIdList &a_list,
   return std::find(a_list.begin(), end, a_id) != end;
 }
 
+// Returns true if every point in the axis-aligned box `a_bounding_box` is
+// strictly under `a_plane`, in which case cutting anything inside the box by
+// the plane leaves it unchanged. The corner farthest along the normal is
+// evaluated with the same expression as the vertex distances, so this never
+// disagrees with the vertex-based check in
+// calculateAndStoreDistanceToVertices.
+inline bool isBoundingBoxUnderPlane(const std::array<Pt, 2> &a_bounding_box,
+                                    const Plane &a_plane) {
+  const auto &normal = a_plane.normal();
+  const Pt farthest_corner(
+      a_bounding_box[normal[0] > 0.0 ? 1 : 0][0],
+      a_bounding_box[normal[1] > 0.0 ? 1 : 0][1],
+      a_bounding_box[normal[2] > 0.0 ? 1 : 0][2]);
+  return a_plane.signedDistanceToPoint(farthest_corner) < 0.0;
+}
+
 } // namespace details
 
 template <class SegmentedPolytopeType, class HalfEdgePolytopeType,
@@ -447,10 +462,16 @@ void splitAndShareThroughLinks(SegmentedPolytopeType *a_polytope,
                                const ReconstructionType &a_reconstruction,
                                EncounteredIdList *a_id_list,
                                ReturnType *a_moments_to_return) {
+  countTelemetry(TelemetryCounter::LinkTraversals);
   const auto &cutting_reconstruction =
       a_reconstruction.getCurrentReconstruction();
   a_id_list->push_back(a_reconstruction.getId());
 
+  // The polytope only shrinks as it is cut by each plane, so the bounding
+  // box taken on entry stays a valid bound for all planes of this link. Planes
+  // that lie entirely above it are skipped without touching the vertices,
+  // which is the common case for far neighbors of a large flux volume.
+  const auto bounding_box = a_polytope->getBoundingBox();
   SegmentedPolytopeType clipped_polytope;
   for (UnsignedIndex_t plane_index = 0;
        plane_index < cutting_reconstruction.getNumberOfPlanes();
@@ -464,6 +485,10 @@ void splitAndShareThroughLinks(SegmentedPolytopeType *a_polytope,
             ? cutting_reconstruction[plane_index].generateFlippedPlane()
             : cutting_reconstruction[plane_index];
 
+    if (details::isBoundingBoxUnderPlane(bounding_box, cutting_plane)) {
+      continue;
+    }
+
     if (a_reconstruction.hasNeighbor(plane_index)) {
       if (!details::isIdPresent(
               *a_id_list, a_reconstruction.getNeighbor(plane_index).getId())) {
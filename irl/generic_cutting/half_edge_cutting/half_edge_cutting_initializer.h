@@ -46,9 +46,15 @@
 /// invalid if the complete_polytope is modified directly, so it's best
 /// not to do this if SegmentedPolytopes you hope to use still exist.
 
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
 #include "irl/generic_cutting/general/class_classifications.h"
 #include "irl/geometry/general/geometry_type_traits.h"
 #include "irl/helpers/SFINAE_boiler_plate.h"
+#include "irl/helpers/telemetry.h"
 
 namespace IRL {
 
@@ -58,6 +64,38 @@ inline ReturnType cutThroughHalfEdgeStructures(
     const EncompassingType& a_polytope,
     const ReconstructionType& a_reconstruction);
 
+/// \brief Counts kept by the half-edge templates of one thread.
+///
+/// A template is built the first time a polyhedron type is cut. Whenever
+/// the central storage the templates point into is reallocated, every
+/// template is invalidated and rebuilt on its next use. `rebuilds` counts
+/// these rebuilds and `invalidations` the reallocations that caused them.
+struct HalfEdgeGeometryStatistics {
+  std::size_t registered_types = 0;
+  std::size_t rebuilds = 0;
+  std::size_t invalidations = 0;
+};
+
+/// \brief Register the half-edge templates of `GeometryTypes` up front, on
+/// every thread.
+///
+/// The templates are normally registered lazily by the first cut of each
+/// type, where a new type can grow the central storage and force all
+/// others to be rebuilt. This registers all given types at once on the
+/// calling thread, and on every other thread before its next half-edge
+/// cut. After registering, the central storage is made one contiguous
+/// block of at least `a_capacity_headroom` times the largest template, so
+/// that the vertices and faces added during cutting do not reallocate it.
+/// All types must be polyhedra with a fixed connectivity (not
+/// GeneralPolyhedron). Safe to call from any thread.
+template <class... GeometryTypes>
+void preregisterHalfEdgeGeometries(const double a_capacity_headroom = 16.0);
+
+/// \brief Statistics of the half-edge templates for vertices of type
+/// `VertexType` on the calling thread.
+template <class VertexType = Pt>
+HalfEdgeGeometryStatistics getHalfEdgeGeometryStatistics(void);
+
 }  // namespace IRL
 
 #include "irl/generic_cutting/half_edge_cutting/half_edge_cutting_initializer.tpp"
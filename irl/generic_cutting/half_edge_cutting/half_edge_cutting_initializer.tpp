@@ -41,7 +41,10 @@ public:
   HalfEdgeGeometryInitializer(void) = default;
 
   void setAllToUpdate(void) {
-    std::fill(needs_updating_m.begin(), needs_updating_m.end(), 1);
+    if (!needs_updating_m.empty()) {
+      std::fill(needs_updating_m.begin(), needs_updating_m.end(), 1);
+      ++statistics_m.invalidations;
+    }
   }
 
   void setAllOthersToUpdate(std::size_t a_type_id) {
@@ -58,7 +61,6 @@ public:
       already_set = true;
       type_id = template_polytopes_m.size();
       const auto starting_capacity = central_polytope_storage_m.rawCapacity();
-      PolytopeType tmp;
       template_polytopes_m.push_back(PolytopeType());
       needs_updating_m.push_back(0);
       this->resetTemplatePolytope(a_geometry, type_id);
@@ -81,6 +83,36 @@ public:
     }
   }
 
+  /// \brief Make the central storage one contiguous block of at least
+  /// `a_capacity` bytes.
+  void reserveCentralStorage(const std::size_t a_capacity) {
+    const auto current_capacity = central_polytope_storage_m.rawCapacity();
+    const auto capacity = std::max(a_capacity, current_capacity);
+    if (capacity > 0 &&
+        (current_capacity == 0 ||
+         central_polytope_storage_m.firstBlockCapacity() < capacity)) {
+      central_polytope_storage_m.resizeRawCapacity(capacity);
+      this->setAllToUpdate();
+    }
+  }
+
+  /// \brief Bytes of storage taken by the template of `GeometryType`.
+  template <class GeometryType> static std::size_t getTemplateSize(void) {
+    PolytopeType polytope;
+    GeometryType{}.setHalfEdgeVersion(&polytope);
+    return polytope.rawCapacity();
+  }
+
+  /// \brief Register `GeometryType`, or rebuild its template now if it
+  /// was invalidated instead of during its next cut.
+  template <class GeometryType> void refreshTemplatePolytope(void) {
+    const GeometryType geometry{};
+    const std::size_t type_id = this->getID(geometry);
+    if (needs_updating_m[type_id] == 1) {
+      this->resetTemplatePolytope(geometry, type_id);
+    }
+  }
+
   template <class GeometryType>
   void resetTemplatePolytope(const GeometryType &a_geometry,
                              const std::size_t a_type_id) {
@@ -88,6 +120,10 @@ public:
     assert(a_type_id < needs_updating_m.size());
     a_geometry.setHalfEdgeVersion(&central_polytope_storage_m);
     template_polytopes_m[a_type_id] = central_polytope_storage_m;
+    if (needs_updating_m[a_type_id] == 1) {
+      ++statistics_m.rebuilds;
+      countTelemetry(TelemetryCounter::HalfEdgeTemplateRebuilds);
+    }
     needs_updating_m[a_type_id] = 0;
   }
 
@@ -104,14 +140,53 @@ public:
     return central_polytope_storage_m;
   }
 
+  HalfEdgeGeometryStatistics getStatistics(void) const {
+    HalfEdgeGeometryStatistics statistics = statistics_m;
+    statistics.registered_types = template_polytopes_m.size();
+    return statistics;
+  }
+
+  /// \brief Number of entries of the preregistration list already applied
+  /// on this thread.
+  std::size_t &preregisteredCount(void) { return preregistered_m; }
+
   ~HalfEdgeGeometryInitializer(void) = default;
 
 private:
   PolytopeType central_polytope_storage_m;
-  SmallVector<PolytopeType, 8> template_polytopes_m;
-  SmallVector<UnsignedIndex_t, 8> needs_updating_m;
+  SmallVector<PolytopeType, 16> template_polytopes_m;
+  SmallVector<UnsignedIndex_t, 16> needs_updating_m;
+  HalfEdgeGeometryStatistics statistics_m;
+  std::size_t preregistered_m = 0;
+};
+
+/// \brief Geometry types given to `preregisterHalfEdgeGeometries(...)`,
+/// applied by each thread to its own templates. Entries are only ever
+/// appended, and `size` is published after an entry is complete.
+template <class VertexType> struct HalfEdgeGeometryPreregistration {
+  using InitializerType =
+      HalfEdgeGeometryInitializer<HalfEdgePolyhedron<VertexType>>;
+  struct Entry {
+    std::size_t (*get_template_size)(void);
+    void (*refresh)(InitializerType *);
+    double capacity_headroom;
+  };
+
+  std::mutex mutex;
+  std::vector<Entry> entries;
+  std::atomic<std::size_t> size{0};
 };
 
+template <class VertexType>
+HalfEdgeGeometryPreregistration<VertexType> &
+getHalfEdgeGeometryPreregistration(void);
+
+/// \brief Apply the entries of the preregistration list that this thread
+/// has not seen yet.
+template <class VertexType>
+void applyHalfEdgeGeometryPreregistration(
+    HalfEdgeGeometryInitializer<HalfEdgePolyhedron<VertexType>> *a_storage);
+
 template <class VertexType>
 HalfEdgeGeometryInitializer<HalfEdgePolyhedron<VertexType>> &
 getHalfEdgePolyhedronStorage(void);
@@ -203,6 +278,75 @@ getHalfEdgePolyhedronStorage(void) {
   return storage;
 }
 
+template <class VertexType>
+HalfEdgeGeometryPreregistration<VertexType> &
+getHalfEdgeGeometryPreregistration(void) {
+  static HalfEdgeGeometryPreregistration<VertexType> preregistration;
+  return preregistration;
+}
+
+template <class VertexType>
+void applyHalfEdgeGeometryPreregistration(
+    HalfEdgeGeometryInitializer<HalfEdgePolyhedron<VertexType>> *a_storage) {
+  auto &preregistration = getHalfEdgeGeometryPreregistration<VertexType>();
+  std::size_t &applied = a_storage->preregisteredCount();
+  if (preregistration.size.load(std::memory_order_acquire) == applied) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(preregistration.mutex);
+  const std::size_t end = preregistration.entries.size();
+  // Size the central storage for every new type first, so that registering
+  // them does not reallocate it and each template is built only once.
+  std::size_t capacity = 0;
+  for (std::size_t n = applied; n < end; ++n) {
+    const auto &entry = preregistration.entries[n];
+    capacity = std::max(
+        capacity, static_cast<std::size_t>(
+                      entry.capacity_headroom *
+                      static_cast<double>(entry.get_template_size())));
+  }
+  a_storage->reserveCentralStorage(capacity);
+  for (std::size_t n = applied; n < end; ++n) {
+    preregistration.entries[n].refresh(a_storage);
+  }
+  applied = end;
+}
+
+template <class GeometryType>
+void addHalfEdgeGeometryPreregistration(const double a_capacity_headroom) {
+  static_assert(is_polyhedron<GeometryType>::value &&
+                    !is_general_polyhedron<GeometryType>::value,
+                "Only polyhedra with a fixed connectivity use half-edge "
+                "templates.");
+  using VertexType = typename GeometryType::pt_type;
+  using InitializerType =
+      HalfEdgeGeometryInitializer<HalfEdgePolyhedron<VertexType>>;
+  auto &preregistration = getHalfEdgeGeometryPreregistration<VertexType>();
+  std::lock_guard<std::mutex> lock(preregistration.mutex);
+  preregistration.entries.push_back(
+      {&InitializerType::template getTemplateSize<GeometryType>,
+       [](InitializerType *a_storage) {
+         a_storage->template refreshTemplatePolytope<GeometryType>();
+       },
+       a_capacity_headroom});
+  preregistration.size.store(preregistration.entries.size(),
+                             std::memory_order_release);
+}
+
+template <class... GeometryTypes>
+void preregisterHalfEdgeGeometries(const double a_capacity_headroom) {
+  (addHalfEdgeGeometryPreregistration<GeometryTypes>(a_capacity_headroom),
+   ...);
+  (applyHalfEdgeGeometryPreregistration<typename GeometryTypes::pt_type>(
+       &getHalfEdgePolyhedronStorage<typename GeometryTypes::pt_type>()),
+   ...);
+}
+
+template <class VertexType>
+HalfEdgeGeometryStatistics getHalfEdgeGeometryStatistics(void) {
+  return getHalfEdgePolyhedronStorage<VertexType>().getStatistics();
+}
+
 template <class EncompassingGeometryType>
 enable_if_t<is_polyhedron<EncompassingGeometryType>::value &&
                 !is_general_polyhedron<EncompassingGeometryType>::value,
@@ -233,6 +377,7 @@ template <class VertexType, class GeometryType>
 HalfEdgePolyhedron<VertexType> &
 getHalfEdgePolyhedron(const GeometryType &a_geometry) {
   auto &storage = getHalfEdgePolyhedronStorage<VertexType>();
+  applyHalfEdgeGeometryPreregistration(&storage);
   return storage.getHalfEdgePolytopeBase(a_geometry);
 }
 
@@ -247,6 +392,7 @@ enable_if_t<is_polyhedron<EncompassingGeometryType>::value &&
                 !is_general_polyhedron<EncompassingGeometryType>::value,
             HalfEdgePolyhedron<typename EncompassingGeometryType::pt_type> &>
 setHalfEdgeStructure(const EncompassingGeometryType &a_geometry) {
+  countTelemetry(TelemetryCounter::HalfEdgePolytopeBuilds);
   auto &complete_polyhedron_buffer =
       getHalfEdgePolyhedron<typename EncompassingGeometryType::pt_type>(
           a_geometry);
@@ -259,6 +405,7 @@ enable_if_t<is_polyhedron<EncompassingGeometryType>::value &&
                 is_general_polyhedron<EncompassingGeometryType>::value,
             HalfEdgePolyhedron<typename EncompassingGeometryType::pt_type> &>
 setHalfEdgeStructure(const EncompassingGeometryType &a_geometry) {
+  countTelemetry(TelemetryCounter::HalfEdgePolytopeBuilds);
   // Can't lazy evaluate GeneralPolyhedron's because they change, i.e.
   // since a GeneralPolyhedron doesn't have a fixed number of vertices or
   // connectivity like other polyhedrons in IRL, the connectivity cannot
@@ -273,6 +420,7 @@ template <class EncompassingGeometryType>
 enable_if_t<is_tri<EncompassingGeometryType>::value,
             HalfEdgePolygon<typename EncompassingGeometryType::pt_type> &>
 setHalfEdgeStructure(const EncompassingGeometryType &a_geometry) {
+  countTelemetry(TelemetryCounter::HalfEdgePolytopeBuilds);
   thread_local static bool already_set = false;
   thread_local static HalfEdgePolygon<typename EncompassingGeometryType::pt_type>
       half_edge_geometry_template;
@@ -297,6 +445,7 @@ enable_if_t<is_polygon<EncompassingGeometryType>::value &&
                 !is_tri<EncompassingGeometryType>::value,
             HalfEdgePolygon<typename EncompassingGeometryType::pt_type> &>
 setHalfEdgeStructure(const EncompassingGeometryType &a_geometry) {
+  countTelemetry(TelemetryCounter::HalfEdgePolytopeBuilds);
   // Can't lazy evaluate polygons because they change, i.e.
   // since a Polygon doesn't have a fixed number of vertices like
   // a polyhedron does in IRL, the connectivity cannot simply
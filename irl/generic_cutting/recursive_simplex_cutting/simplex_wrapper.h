@@ -18,6 +18,7 @@
 #include "irl/geometry/polyhedrons/tet.h"
 #include "irl/helpers/SFINAE_boiler_plate.h"
 #include "irl/helpers/geometric_cutting_helpers.h"
+#include "irl/parameters/tolerance_context.h"
 
 namespace IRL {
 
@@ -44,7 +45,7 @@ struct SimplexWrapper<SimplexType, enable_if_t<is_tet<SimplexType>::value>> {
     return cut_tet_by_plane::number_of_tets_after_cut[a_cutting_case];
   }
   static double minimumAmountToTrack(void) {
-    return global_constants::MINIMUM_VOLUME_TO_TRACK;
+    return getMinimumVolumeToTrack();
   }
 
   static constexpr bool isSimplexFullyBelowPlane(
@@ -147,7 +148,7 @@ struct SimplexWrapper<SimplexType, enable_if_t<is_tri<SimplexType>::value>> {
     return cut_tri_by_plane::number_of_tris_after_cut[a_cutting_case];
   }
   static double minimumAmountToTrack(void) {
-    return global_constants::MINIMUM_SURFACE_AREA_TO_TRACK;
+    return getMinimumSurfaceAreaToTrack();
   }
 
   static constexpr bool isSimplexFullyBelowPlane(
@@ -11,12 +11,15 @@
 #define IRL_GENERIC_CUTTING_SIMPLEX_CUTTING_SIMPLEX_CUTTING_H_
 
 #include <algorithm>
+#include <array>
 #include <utility>
 
 #include "irl/generic_cutting/half_edge_cutting/half_edge_cutting_helpers.h"
 #include "irl/geometry/general/geometry_type_traits.h"
 #include "irl/geometry/half_edge_structures/half_edge.h"
 #include "irl/helpers/SFINAE_boiler_plate.h"
+#include "irl/moments/volume.h"
+#include "irl/moments/volume_moments.h"
 
 namespace IRL {
 
@@ -51,6 +54,44 @@ truncateDecomposedPolytope(SegmentedHalfEdgePolygonType* a_polytope,
                            HalfEdgePolytopeType* a_complete_polytope,
                            const Plane& a_plane);
 
+/// \brief Number of tets cut together by getVolumeMomentsBelowPlane. One
+/// block of doubles fills an AVX-512 register, or two AVX2 registers.
+static constexpr UnsignedIndex_t kSimplexCuttingLaneWidth = 8;
+
+/// \brief Moments of the part of the decomposed polyhedron below `a_plane`.
+///
+/// Gives the same result as truncating `a_polytope` by `a_plane` and
+/// calculating the moments of what is left, but does not create any new
+/// vertices or simplices. The tets are cut `kSimplexCuttingLaneWidth` at a
+/// time with branch-free, fixed-length loops so the compiler can vectorize
+/// them. `ReturnType` must be `Volume` or `VolumeMoments`; the centroid of
+/// returned `VolumeMoments` is not normalized by the volume.
+template <class ReturnType, class SegmentedHalfEdgePolyhedronType>
+enable_if_t<is_polyhedron<SegmentedHalfEdgePolyhedronType>::value, ReturnType>
+getVolumeMomentsBelowPlane(const SegmentedHalfEdgePolyhedronType& a_polytope,
+                           const Plane& a_plane);
+
+namespace simplex_cutting_details {
+
+/// \brief Structure-of-arrays storage for one block of tets. Indexed as
+/// [vertex][lane].
+struct alignas(64) TetLanes {
+  using LaneArray = std::array<double, kSimplexCuttingLaneWidth>;
+  std::array<LaneArray, 4> x;
+  std::array<LaneArray, 4> y;
+  std::array<LaneArray, 4> z;
+  std::array<LaneArray, 4> distance;
+  std::array<UnsignedIndex_t, kSimplexCuttingLaneWidth> cutting_case;
+  LaneArray parity;
+  LaneArray number_below;
+  LaneArray six_volume;
+  LaneArray x_moment;
+  LaneArray y_moment;
+  LaneArray z_moment;
+};
+
+}  // namespace simplex_cutting_details
+
 }  // namespace IRL
 
 #include "irl/generic_cutting/simplex_cutting/simplex_cutting.tpp"
@@ -10,9 +10,13 @@
 #ifndef IRL_GENERIC_CUTTING_SIMPLEX_CUTTING_SIMPLEX_CUTTING_TPP_
 #define IRL_GENERIC_CUTTING_SIMPLEX_CUTTING_SIMPLEX_CUTTING_TPP_
 
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
 #include <utility>
 
 #include "irl/generic_cutting/recursive_simplex_cutting/simplex_wrapper.h"
+#include "irl/helpers/helper.h"
 
 namespace IRL {
 template <class SegmentedHalfEdgePolyhedronType, class HalfEdgePolytopeType>
@@ -814,6 +818,260 @@ truncateDecomposedPolytope(SegmentedHalfEdgePolygonType* a_polytope,
   }
   vertex_list.resize(number_kept + (new_length - starting_number_of_vertices));
 }
+
+namespace simplex_cutting_details {
+
+// Order in which the vertices of a tet are cut for each of the 16 cases,
+// where bit n of the case is set when vertex n is above the plane, as in
+// getGeometricCaseId. Vertices below the plane come first, except when a
+// single vertex is above the plane, which then comes first. The parity of
+// the reordering recovers the orientation of the original tet.
+struct TetCuttingCase {
+  std::array<UnsignedIndex_t, 4> order;
+  double parity;
+  double number_below;
+};
+
+constexpr TetCuttingCase makeTetCuttingCase(const UnsignedIndex_t a_case) {
+  std::array<UnsignedIndex_t, 4> below{{0, 0, 0, 0}};
+  std::array<UnsignedIndex_t, 4> above{{0, 0, 0, 0}};
+  UnsignedIndex_t number_below = 0;
+  UnsignedIndex_t number_above = 0;
+  for (UnsignedIndex_t v = 0; v < 4; ++v) {
+    if (((a_case >> v) & 1U) == 1U) {
+      above[number_above++] = v;
+    } else {
+      below[number_below++] = v;
+    }
+  }
+  TetCuttingCase cutting_case{{{0, 1, 2, 3}}, 1.0,
+                              static_cast<double>(number_below)};
+  if (number_below == 3) {
+    cutting_case.order[0] = above[0];
+    for (UnsignedIndex_t v = 0; v < 3; ++v) {
+      cutting_case.order[v + 1] = below[v];
+    }
+  } else if (number_below == 1 || number_below == 2) {
+    for (UnsignedIndex_t v = 0; v < number_below; ++v) {
+      cutting_case.order[v] = below[v];
+    }
+    for (UnsignedIndex_t v = 0; v < number_above; ++v) {
+      cutting_case.order[number_below + v] = above[v];
+    }
+  }
+  for (UnsignedIndex_t i = 0; i < 4; ++i) {
+    for (UnsignedIndex_t j = i + 1; j < 4; ++j) {
+      if (cutting_case.order[i] > cutting_case.order[j]) {
+        cutting_case.parity = -cutting_case.parity;
+      }
+    }
+  }
+  return cutting_case;
+}
+
+constexpr std::array<TetCuttingCase, 16> makeTetCuttingCases(void) {
+  std::array<TetCuttingCase, 16> cutting_cases{};
+  for (UnsignedIndex_t c = 0; c < 16; ++c) {
+    cutting_cases[c] = makeTetCuttingCase(c);
+  }
+  return cutting_cases;
+}
+
+static constexpr std::array<TetCuttingCase, 16> tet_cutting_cases =
+    makeTetCuttingCases();
+
+struct LanePt {
+  double x;
+  double y;
+  double z;
+};
+
+// Same as Pt::fromEdgeIntersection, with the edge parameter clamped to
+// [0, 1] so that edges which are not cut, and whose contributions are
+// masked out, still produce finite points.
+inline LanePt edgeIntersection(const LanePt& a_pt_0, const double a_dist_0,
+                               const LanePt& a_pt_1, const double a_dist_1) {
+  const double mu = std::min(
+      std::max(a_dist_0 / safelyTiny(a_dist_0 - a_dist_1), 0.0), 1.0);
+  return {a_pt_0.x + mu * (a_pt_1.x - a_pt_0.x),
+          a_pt_0.y + mu * (a_pt_1.y - a_pt_0.y),
+          a_pt_0.z + mu * (a_pt_1.z - a_pt_0.z)};
+}
+
+// Six times the signed volume, with the same vertex convention as
+// Volume3D_Functor.
+inline double sixSignedVolume(const LanePt& a_pt_0, const LanePt& a_pt_1,
+                              const LanePt& a_pt_2, const LanePt& a_pt_3) {
+  const double e0x = a_pt_0.x - a_pt_3.x;
+  const double e0y = a_pt_0.y - a_pt_3.y;
+  const double e0z = a_pt_0.z - a_pt_3.z;
+  const double e1x = a_pt_1.x - a_pt_3.x;
+  const double e1y = a_pt_1.y - a_pt_3.y;
+  const double e1z = a_pt_1.z - a_pt_3.z;
+  const double e2x = a_pt_2.x - a_pt_3.x;
+  const double e2y = a_pt_2.y - a_pt_3.y;
+  const double e2z = a_pt_2.z - a_pt_3.z;
+  return e0x * (e1y * e2z - e1z * e2y) - e0y * (e1x * e2z - e1z * e2x) +
+         e0z * (e1x * e2y - e1y * e2x);
+}
+
+// Adds a_weight times six times the absolute volume of the tet, and the
+// matching first moment scaled by 24.
+inline void addTet(const LanePt& a_pt_0, const LanePt& a_pt_1,
+                   const LanePt& a_pt_2, const LanePt& a_pt_3,
+                   const double a_weight, double* a_six_volume,
+                   LanePt* a_moment) {
+  const double six_volume =
+      a_weight * std::fabs(sixSignedVolume(a_pt_0, a_pt_1, a_pt_2, a_pt_3));
+  *a_six_volume += six_volume;
+  a_moment->x += six_volume * (a_pt_0.x + a_pt_1.x + a_pt_2.x + a_pt_3.x);
+  a_moment->y += six_volume * (a_pt_0.y + a_pt_1.y + a_pt_2.y + a_pt_3.y);
+  a_moment->z += six_volume * (a_pt_0.z + a_pt_1.z + a_pt_2.z + a_pt_3.z);
+}
+
+// Cuts every lane, with vertices already reordered by tet_cutting_cases.
+// With v0 first in that order, the part below the plane is
+//   - the whole tet when no vertex is above,
+//   - the corner tet at v0 when only v0 is below,
+//   - the whole tet minus the corner tet at v0 when only v0 is above,
+//   - the prism between edges v0-v2, v0-v3, v1-v2 and v1-v3 otherwise.
+// All are evaluated and masked, as in getAnalyticVolumeMoments(Tet, Plane),
+// so the loop has no branches.
+__attribute__((hot)) inline void cutTetLanes(TetLanes* a_lanes) {
+  for (UnsignedIndex_t l = 0; l < kSimplexCuttingLaneWidth; ++l) {
+    const LanePt v0{a_lanes->x[0][l], a_lanes->y[0][l], a_lanes->z[0][l]};
+    const LanePt v1{a_lanes->x[1][l], a_lanes->y[1][l], a_lanes->z[1][l]};
+    const LanePt v2{a_lanes->x[2][l], a_lanes->y[2][l], a_lanes->z[2][l]};
+    const LanePt v3{a_lanes->x[3][l], a_lanes->y[3][l], a_lanes->z[3][l]};
+    const double d0 = a_lanes->distance[0][l];
+    const double d1 = a_lanes->distance[1][l];
+    const double d2 = a_lanes->distance[2][l];
+    const double d3 = a_lanes->distance[3][l];
+    const double number_below = a_lanes->number_below[l];
+
+    const double tet_six_volume =
+        a_lanes->parity[l] * sixSignedVolume(v0, v1, v2, v3);
+    const double sign = std::copysign(1.0, tet_six_volume);
+    const double tet_weight = number_below > 2.5 ? 1.0 : 0.0;
+    const double corner_weight =
+        number_below == 1.0 ? sign : (number_below == 3.0 ? -sign : 0.0);
+    const double prism_weight = number_below == 2.0 ? sign : 0.0;
+
+    const LanePt i01 = edgeIntersection(v0, d0, v1, d1);
+    const LanePt i02 = edgeIntersection(v0, d0, v2, d2);
+    const LanePt i03 = edgeIntersection(v0, d0, v3, d3);
+    const LanePt i12 = edgeIntersection(v1, d1, v2, d2);
+    const LanePt i13 = edgeIntersection(v1, d1, v3, d3);
+
+    double six_volume = tet_weight * tet_six_volume;
+    LanePt moment{six_volume * (v0.x + v1.x + v2.x + v3.x),
+                  six_volume * (v0.y + v1.y + v2.y + v3.y),
+                  six_volume * (v0.z + v1.z + v2.z + v3.z)};
+    addTet(v0, i01, i02, i03, corner_weight, &six_volume, &moment);
+    addTet(v0, i02, i03, i13, prism_weight, &six_volume, &moment);
+    addTet(v0, i02, i12, i13, prism_weight, &six_volume, &moment);
+    addTet(v0, v1, i12, i13, prism_weight, &six_volume, &moment);
+
+    a_lanes->six_volume[l] = six_volume;
+    a_lanes->x_moment[l] = moment.x;
+    a_lanes->y_moment[l] = moment.y;
+    a_lanes->z_moment[l] = moment.z;
+  }
+}
+
+}  // namespace simplex_cutting_details
+
+template <class ReturnType, class SegmentedHalfEdgePolyhedronType>
+enable_if_t<is_polyhedron<SegmentedHalfEdgePolyhedronType>::value, ReturnType>
+getVolumeMomentsBelowPlane(const SegmentedHalfEdgePolyhedronType& a_polytope,
+                           const Plane& a_plane) {
+  static_assert(std::is_same<ReturnType, Volume>::value ||
+                    std::is_same<ReturnType, VolumeMoments>::value,
+                "getVolumeMomentsBelowPlane only returns Volume or "
+                "VolumeMoments.");
+  using simplex_cutting_details::tet_cutting_cases;
+  const UnsignedIndex_t number_of_tets =
+      a_polytope.getNumberOfSimplicesInDecomposition();
+  const Normal& normal = a_plane.normal();
+  const double plane_distance = a_plane.distance();
+
+  simplex_cutting_details::TetLanes lanes;
+  double six_volume = 0.0;
+  std::array<double, 3> moment{{0.0, 0.0, 0.0}};
+  for (UnsignedIndex_t block_start = 0; block_start < number_of_tets;
+       block_start += kSimplexCuttingLaneWidth) {
+    const UnsignedIndex_t lanes_in_block =
+        std::min(kSimplexCuttingLaneWidth, number_of_tets - block_start);
+
+    // Unused lanes of a partial block are left as tets collapsed to the
+    // origin, which contribute nothing.
+    for (UnsignedIndex_t v = 0; v < 4; ++v) {
+      lanes.x[v].fill(0.0);
+      lanes.y[v].fill(0.0);
+      lanes.z[v].fill(0.0);
+    }
+    for (UnsignedIndex_t l = 0; l < lanes_in_block; ++l) {
+      const auto& tet = a_polytope.getSimplexFromDecomposition(block_start + l);
+      for (UnsignedIndex_t v = 0; v < 4; ++v) {
+        const Pt& pt = tet[v].getPt();
+        lanes.x[v][l] = pt[0];
+        lanes.y[v][l] = pt[1];
+        lanes.z[v][l] = pt[2];
+      }
+    }
+
+    for (UnsignedIndex_t l = 0; l < kSimplexCuttingLaneWidth; ++l) {
+      UnsignedIndex_t cutting_case = 0;
+      for (UnsignedIndex_t v = 0; v < 4; ++v) {
+        const double distance = normal[0] * lanes.x[v][l] +
+                                normal[1] * lanes.y[v][l] +
+                                normal[2] * lanes.z[v][l] - plane_distance;
+        lanes.distance[v][l] = distance;
+        cutting_case |= (distance > 0.0 ? 1U : 0U) << v;
+      }
+      lanes.cutting_case[l] = cutting_case;
+    }
+
+    for (UnsignedIndex_t l = 0; l < kSimplexCuttingLaneWidth; ++l) {
+      const auto& cutting_case = tet_cutting_cases[lanes.cutting_case[l]];
+      lanes.parity[l] = cutting_case.parity;
+      lanes.number_below[l] = cutting_case.number_below;
+      const std::array<double, 4> x{
+          {lanes.x[0][l], lanes.x[1][l], lanes.x[2][l], lanes.x[3][l]}};
+      const std::array<double, 4> y{
+          {lanes.y[0][l], lanes.y[1][l], lanes.y[2][l], lanes.y[3][l]}};
+      const std::array<double, 4> z{
+          {lanes.z[0][l], lanes.z[1][l], lanes.z[2][l], lanes.z[3][l]}};
+      const std::array<double, 4> distance{
+          {lanes.distance[0][l], lanes.distance[1][l], lanes.distance[2][l],
+           lanes.distance[3][l]}};
+      for (UnsignedIndex_t v = 0; v < 4; ++v) {
+        const UnsignedIndex_t original = cutting_case.order[v];
+        lanes.x[v][l] = x[original];
+        lanes.y[v][l] = y[original];
+        lanes.z[v][l] = z[original];
+        lanes.distance[v][l] = distance[original];
+      }
+    }
+
+    simplex_cutting_details::cutTetLanes(&lanes);
+
+    for (UnsignedIndex_t l = 0; l < kSimplexCuttingLaneWidth; ++l) {
+      six_volume += lanes.six_volume[l];
+      moment[0] += lanes.x_moment[l];
+      moment[1] += lanes.y_moment[l];
+      moment[2] += lanes.z_moment[l];
+    }
+  }
+
+  if constexpr (std::is_same<ReturnType, Volume>::value) {
+    return six_volume / 6.0;
+  } else {
+    return VolumeMoments(six_volume / 6.0,
+                         Pt(moment[0], moment[1], moment[2]) / 24.0);
+  }
+}
+
 }  // namespace IRL
 
 #endif // IRL_GENERIC_CUTTING_SIMPLEX_CUTTING_SIMPLEX_CUTTING_TPP_
@@ -12,6 +12,7 @@
 
 #include "irl/generic_cutting/general/class_classifications.h"
 #include "irl/helpers/SFINAE_boiler_plate.h"
+#include "irl/helpers/telemetry.h"
 
 namespace IRL {
 
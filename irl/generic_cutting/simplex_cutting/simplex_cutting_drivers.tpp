@@ -10,6 +10,8 @@
 #ifndef IRL_GENERIC_CUTTING_SIMPLEX_CUTTING_SIMPLEX_CUTTING_DRIVERS_TPP_
 #define IRL_GENERIC_CUTTING_SIMPLEX_CUTTING_SIMPLEX_CUTTING_DRIVERS_TPP_
 
+#include <type_traits>
+
 #include "irl/generic_cutting/simplex_cutting/simplex_cutting.h"
 
 namespace IRL {
@@ -229,6 +231,40 @@ void getVolumeMomentsForDecomposedPolytopeStaticStructWrapper<
         HalfEdgePolytopeType* a_complete_polytope,
         const ReconstructionType& a_reconstruction,
         ReturnType* a_moments_to_return) {
+  using NextReconstructionType =
+      std::decay_t<decltype(a_reconstruction.getNextReconstruction())>;
+  if constexpr (is_polyhedron<SegmentedPolytopeType>::value &&
+                IsNullReconstruction<NextReconstructionType>::value &&
+                (std::is_same<ReturnType, Volume>::value ||
+                 std::is_same<ReturnType, VolumeMoments>::value)) {
+    // Only the moments below the last plane are needed, so cut it with the
+    // multi-tet kernel instead of truncating the polytope.
+    const auto& cutting_reconstruction =
+        a_reconstruction.getCurrentReconstruction();
+    const UnsignedIndex_t number_of_planes =
+        cutting_reconstruction.getNumberOfPlanes();
+    if (number_of_planes > 0) {
+      for (UnsignedIndex_t plane_index = 0; plane_index < number_of_planes;
+           ++plane_index) {
+        if (a_polytope->getNumberOfSimplicesInDecomposition() == 0) {
+          return;
+        }
+        const auto cutting_plane =
+            cutting_reconstruction.isFlipped()
+                ? cutting_reconstruction[plane_index].generateFlippedPlane()
+                : cutting_reconstruction[plane_index];
+        if (plane_index + 1 == number_of_planes) {
+          *a_moments_to_return +=
+              getVolumeMomentsBelowPlane<ReturnType>(*a_polytope,
+                                                     cutting_plane);
+        } else {
+          truncateDecomposedPolytope(a_polytope, a_complete_polytope,
+                                     cutting_plane);
+        }
+      }
+      return;
+    }
+  }
   localizeSimplexInternalToReconstruction(a_polytope, a_complete_polytope,
                                           a_reconstruction);
   if (a_polytope->getNumberOfSimplicesInDecomposition() > 0) {
@@ -429,6 +465,7 @@ void splitAndShareSimplexThroughLinks(
     HalfEdgePolytopeType* a_complete_polytope,
     const ReconstructionType& a_reconstruction,
     ReturnType* a_moments_to_return) {
+  countTelemetry(TelemetryCounter::LinkTraversals);
   const auto& cutting_reconstruction =
       a_reconstruction.getCurrentReconstruction();
 
@@ -466,6 +503,7 @@ void splitAndShareSimplexThroughLinks(
     const ReconstructionType& a_originating_reconstruction,
     const ReconstructionType& a_reconstruction,
     ReturnType* a_moments_to_return) {
+  countTelemetry(TelemetryCounter::LinkTraversals);
   const auto& cutting_reconstruction =
       a_reconstruction.getCurrentReconstruction();
 
@@ -45,6 +45,7 @@
 // Rewrite above to be the non-recursive case
 
 #include "irl/generic_cutting/simplex_cutting/simplex_cutting_drivers.h"
+#include "irl/helpers/telemetry.h"
 #include "irl/parameters/defined_types.h"
 
 namespace IRL {
@@ -63,7 +63,7 @@ enable_if_t<
     is_polygon<EncompassingGeometryType>::value,
     DecomposedPolygonVertexStorage<typename EncompassingGeometryType::pt_type>&>
 getVertexStorage(const EncompassingGeometryType& a_geometry) {
-  static DecomposedPolygonVertexStorage<
+  thread_local static DecomposedPolygonVertexStorage<
       typename EncompassingGeometryType::pt_type>
       vertex_storage;
   vertex_storage.resetFromGeometry(a_geometry);
@@ -77,7 +77,7 @@ enable_if_t<is_polyhedron<EncompassingGeometryType>::value,
             DecomposedPolyhedronVertexStorage<
                 typename EncompassingGeometryType::pt_type>&>
 getVertexStorage(const EncompassingGeometryType& a_geometry) {
-  static DecomposedPolyhedronVertexStorage<
+  thread_local static DecomposedPolyhedronVertexStorage<
       typename EncompassingGeometryType::pt_type>
       vertex_storage;
   vertex_storage.resetFromGeometry(a_geometry);
@@ -89,6 +89,7 @@ enable_if_t<is_polyhedron<EncompassingGeometryType>::value,
             SegmentedDecomposedPolyhedron<typename VertexStorageType::pt_type>>
 getInitialSimplexList(const EncompassingGeometryType& a_geometry,
                       VertexStorageType* a_vertex_storage) {
+  countTelemetry(TelemetryCounter::SimplexDecompositions);
   return SegmentedDecomposedPolyhedron<typename VertexStorageType::pt_type>(
       a_geometry, *a_vertex_storage);
 }
@@ -98,6 +99,7 @@ enable_if_t<is_polygon<EncompassingGeometryType>::value,
             SegmentedDecomposedPolygon<typename VertexStorageType::pt_type>>
 getInitialSimplexList(const EncompassingGeometryType& a_geometry,
                       VertexStorageType* a_vertex_storage) {
+  countTelemetry(TelemetryCounter::SimplexDecompositions);
   SegmentedDecomposedPolygon<typename VertexStorageType::pt_type>
       segmented_polygon(a_geometry, *a_vertex_storage);
   segmented_polygon.setPlaneOfExistence(
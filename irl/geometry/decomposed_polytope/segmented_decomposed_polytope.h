@@ -131,7 +131,7 @@ class VertexList {
 
  private:
   VertexStorage& reference_list_m;
-  SmallVector<UnsignedIndex_t, 40> referenced_vertices_m;
+  SmallVector<UnsignedIndex_t, 256> referenced_vertices_m;
 };
 
 template <class VertexType>
@@ -259,8 +259,8 @@ class SegmentedDecomposedPolytope
   }
 
  protected:
-  SmallVector<ProxyType, 40> simplex_decomposition_m;
-  SmallVector<uint8_t, 40> valid_simplex_mask;
+  SmallVector<ProxyType, 256> simplex_decomposition_m;
+  SmallVector<uint8_t, 256> valid_simplex_mask;
   VertexList<VertexStorageType, VertexType> vertex_list_m;
 };
 
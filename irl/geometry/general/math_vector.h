@@ -112,39 +112,39 @@ using Vec3 = MathVector<3>;
 
 /// \brief Overload * operator to be dot product of the two vectors
 template <UnsignedIndex_t kNumberOfElements>
-__attribute__((const)) inline double operator*(
+__attribute__((pure)) inline double operator*(
     const MathVector<kNumberOfElements>& a_vec_0,
     const MathVector<kNumberOfElements>& a_vec_1);
 
 /// \brief Overload + operator between MathVectors of same length to add
 /// elements.
 template <UnsignedIndex_t kNumberOfElements>
-__attribute__((const)) inline MathVector<kNumberOfElements> operator+(
+__attribute__((pure)) inline MathVector<kNumberOfElements> operator+(
     const MathVector<kNumberOfElements>& a_vec_0,
     const MathVector<kNumberOfElements>& a_vec_1);
 
 /// \brief Overload - operator between MathVectors of same length to add
 /// elements.
 template <UnsignedIndex_t kNumberOfElements>
-__attribute__((const)) inline MathVector<kNumberOfElements> operator-(
+__attribute__((pure)) inline MathVector<kNumberOfElements> operator-(
     const MathVector<kNumberOfElements>& a_vec_0,
     const MathVector<kNumberOfElements>& a_vec_1);
 
 /// \brief Overload * operator between double and MathVector to return a
 /// MathVector.
 template <UnsignedIndex_t kNumberOfElements>
-__attribute__((const)) inline MathVector<kNumberOfElements> operator*(
+__attribute__((pure)) inline MathVector<kNumberOfElements> operator*(
     const double a_double, const MathVector<kNumberOfElements>& a_vec);
 /// \brief Overload * operator between double and MathVector to be return a
 /// MathVector.
 template <UnsignedIndex_t kNumberOfElements>
-__attribute__((const)) inline MathVector<kNumberOfElements> operator*(
+__attribute__((pure)) inline MathVector<kNumberOfElements> operator*(
     const MathVector<kNumberOfElements>& a_vec, const double a_double);
 
 /// \brief Overload / operator between double and MathVector to be return a
 /// MathVector.
 template <UnsignedIndex_t kNumberOfElements>
-__attribute__((const)) inline MathVector<kNumberOfElements> operator/(
+__attribute__((pure)) inline MathVector<kNumberOfElements> operator/(
     const MathVector<kNumberOfElements>& a_vec, const double a_double);
 
 }  // namespace IRL
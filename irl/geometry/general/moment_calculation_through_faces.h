@@ -0,0 +1,119 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GEOMETRY_GENERAL_MOMENT_CALCULATION_THROUGH_FACES_H_
+#define IRL_GEOMETRY_GENERAL_MOMENT_CALCULATION_THROUGH_FACES_H_
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "irl/geometry/general/pt.h"
+#include "irl/moments/general_moments.h"
+#include "irl/parameters/defined_types.h"
+
+namespace IRL {
+
+namespace face_moments_detail {
+
+/// \brief Exponents of each monomial in the row-major GeneralMoments3D
+/// layout, along with the position of the monomials one order lower.
+template <UnsignedIndex_t ORDER>
+struct MonomialTable {
+  static constexpr std::size_t size = GeneralMoments3D<ORDER>::linear_length;
+
+  std::array<std::array<UnsignedIndex_t, 3>, size> exponents;
+  // Index of the monomial with exponent d lowered by one, when it exists.
+  std::array<std::array<UnsignedIndex_t, 3>, size> lower;
+  std::array<UnsignedIndex_t, size> order;
+  // A direction with a non-zero exponent, so monomial m is
+  // x_d * monomial lower[m][d].
+  std::array<UnsignedIndex_t, size> parent_direction;
+};
+
+/// \brief Number of terms in the binomial expansion of all monomials
+/// up to ORDER.
+template <UnsignedIndex_t ORDER>
+constexpr std::size_t shiftTableSize(void);
+
+/// \brief Binomial expansion terms to translate moments by a datum,
+/// moment[target] += coefficient * datum^power * moment_at_datum[source].
+template <UnsignedIndex_t ORDER>
+struct ShiftTable {
+  static constexpr std::size_t size = shiftTableSize<ORDER>();
+
+  std::array<UnsignedIndex_t, size> target;
+  std::array<UnsignedIndex_t, size> source;
+  std::array<UnsignedIndex_t, size> power;
+  std::array<double, size> coefficient;
+};
+
+template <UnsignedIndex_t ORDER>
+constexpr MonomialTable<ORDER> makeMonomialTable(void);
+
+template <UnsignedIndex_t ORDER>
+constexpr ShiftTable<ORDER> makeShiftTable(void);
+
+template <UnsignedIndex_t ORDER>
+inline constexpr MonomialTable<ORDER> monomial_table =
+    makeMonomialTable<ORDER>();
+
+template <UnsignedIndex_t ORDER>
+inline constexpr ShiftTable<ORDER> shift_table = makeShiftTable<ORDER>();
+
+}  // namespace face_moments_detail
+
+/// \brief Compute general moments of a polyhedron from its faces using the
+/// divergence theorem, without decomposing it into simplices.
+///
+/// For a monomial f of degree q, Euler's theorem for homogeneous functions
+/// turns the volume integral into a sum of face integrals,
+/// \int_V f dV = 1/(q+3) \sum_F (x.n) \int_F f dS, and each face integral
+/// into a sum of edge integrals plus face integrals of the monomials one
+/// order lower (Chin, Lasserre & Sukumar, Comput. Mech. 2015).
+/// Edge integrals reduce the same way to vertex values. The recursions are
+/// unrolled at compile time for each ORDER.
+///
+/// Faces are integrated as the fan of triangles from their starting vertex,
+/// so polyhedra with non-planar faces receive the same moments as from the
+/// tet decomposition used by `GeneralMoments3D_Functor`. Coordinates are
+/// taken relative to a datum set with `setDatum(...)` before the first face,
+/// and faces touching the datum contribute nothing.
+///
+/// Moments returned are ordered in row-major, i.e.,
+/// 1, x, y, z, x^2, xy, xz, y^2, yz, z^2, x^3, x^2 y, ...
+template <UnsignedIndex_t ORDER>
+class GeneralMoments3DFace_Functor {
+ public:
+  using ReturnType = GeneralMoments3D<ORDER>;
+
+  static constexpr std::size_t linear_length = ReturnType::linear_length;
+
+  GeneralMoments3DFace_Functor(void) : moments_m(), datum_m() {}
+
+  /// \brief Set the point moments are accumulated about.
+  inline void setDatum(const Pt& a_datum);
+
+  /// \brief Add the contribution of a half-edge face.
+  template <class FaceType>
+  inline void operator()(const FaceType& a_face);
+
+  inline ReturnType getMoments(void) const;
+
+ private:
+  using mom_array = std::array<double, linear_length>;
+  mom_array moments_m;
+  Pt datum_m;
+};
+
+}  // namespace IRL
+
+#include "irl/geometry/general/moment_calculation_through_faces.tpp"
+
+#endif  // IRL_GEOMETRY_GENERAL_MOMENT_CALCULATION_THROUGH_FACES_H_
@@ -0,0 +1,238 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GEOMETRY_GENERAL_MOMENT_CALCULATION_THROUGH_FACES_TPP_
+#define IRL_GEOMETRY_GENERAL_MOMENT_CALCULATION_THROUGH_FACES_TPP_
+
+#include "irl/helpers/mymath.h"
+
+namespace IRL {
+
+namespace face_moments_detail {
+
+// Position of x^i y^j z^k in the row-major layout.
+constexpr UnsignedIndex_t monomialIndex(const UnsignedIndex_t a_i,
+                                        const UnsignedIndex_t a_j,
+                                        const UnsignedIndex_t a_k) {
+  const UnsignedIndex_t order = a_i + a_j + a_k;
+  const UnsignedIndex_t remainder = order - a_i;
+  return order * (order + 1) * (order + 2) / 6 +
+         remainder * (remainder + 1) / 2 + (remainder - a_j);
+}
+
+constexpr double binomialCoefficient(const UnsignedIndex_t a_n,
+                                     const UnsignedIndex_t a_k) {
+  double coefficient = 1.0;
+  for (UnsignedIndex_t n = 1; n <= a_k; ++n) {
+    coefficient = coefficient * static_cast<double>(a_n - a_k + n) /
+                  static_cast<double>(n);
+  }
+  return coefficient;
+}
+
+template <UnsignedIndex_t ORDER>
+constexpr MonomialTable<ORDER> makeMonomialTable(void) {
+  MonomialTable<ORDER> table{};
+  UnsignedIndex_t m = 0;
+  for (UnsignedIndex_t corder = 0; corder <= ORDER; ++corder) {
+    for (UnsignedIndex_t i = corder + 1; i-- > 0;) {
+      for (UnsignedIndex_t j = corder - i + 1; j-- > 0; ++m) {
+        const UnsignedIndex_t k = corder - i - j;
+        table.exponents[m][0] = i;
+        table.exponents[m][1] = j;
+        table.exponents[m][2] = k;
+        table.order[m] = corder;
+        table.lower[m][0] = i > 0 ? monomialIndex(i - 1, j, k) : 0;
+        table.lower[m][1] = j > 0 ? monomialIndex(i, j - 1, k) : 0;
+        table.lower[m][2] = k > 0 ? monomialIndex(i, j, k - 1) : 0;
+        table.parent_direction[m] = i > 0 ? 0 : (j > 0 ? 1 : 2);
+      }
+    }
+  }
+  return table;
+}
+
+template <UnsignedIndex_t ORDER>
+constexpr std::size_t shiftTableSize(void) {
+  std::size_t size = 0;
+  for (UnsignedIndex_t corder = 0; corder <= ORDER; ++corder) {
+    for (UnsignedIndex_t i = 0; i <= corder; ++i) {
+      for (UnsignedIndex_t j = 0; j <= corder - i; ++j) {
+        size += (i + 1) * (j + 1) * (corder - i - j + 1);
+      }
+    }
+  }
+  return size;
+}
+
+template <UnsignedIndex_t ORDER>
+constexpr ShiftTable<ORDER> makeShiftTable(void) {
+  ShiftTable<ORDER> table{};
+  std::size_t n = 0;
+  for (UnsignedIndex_t corder = 0; corder <= ORDER; ++corder) {
+    for (UnsignedIndex_t i = corder + 1; i-- > 0;) {
+      for (UnsignedIndex_t j = corder - i + 1; j-- > 0;) {
+        const UnsignedIndex_t k = corder - i - j;
+        for (UnsignedIndex_t a = 0; a <= i; ++a) {
+          for (UnsignedIndex_t b = 0; b <= j; ++b) {
+            for (UnsignedIndex_t c = 0; c <= k; ++c, ++n) {
+              table.target[n] = monomialIndex(i, j, k);
+              table.source[n] = monomialIndex(a, b, c);
+              table.power[n] = monomialIndex(i - a, j - b, k - c);
+              table.coefficient[n] = binomialCoefficient(i, a) *
+                                     binomialCoefficient(j, b) *
+                                     binomialCoefficient(k, c);
+            }
+          }
+        }
+      }
+    }
+  }
+  return table;
+}
+
+// Sum over directions of exponent_d * a_pt[d] * a_values[lower_d], which is
+// <a_pt, grad(f)> for monomial M written in terms of lower order values.
+template <UnsignedIndex_t ORDER, std::size_t M, std::size_t kLength>
+inline double gradientTerm(const Pt& a_pt,
+                           const std::array<double, kLength>& a_values) {
+  constexpr auto& table = monomial_table<ORDER>;
+  double sum = 0.0;
+  if constexpr (table.exponents[M][0] > 0) {
+    sum += static_cast<double>(table.exponents[M][0]) * a_pt[0] *
+           a_values[table.lower[M][0]];
+  }
+  if constexpr (table.exponents[M][1] > 0) {
+    sum += static_cast<double>(table.exponents[M][1]) * a_pt[1] *
+           a_values[table.lower[M][1]];
+  }
+  if constexpr (table.exponents[M][2] > 0) {
+    sum += static_cast<double>(table.exponents[M][2]) * a_pt[2] *
+           a_values[table.lower[M][2]];
+  }
+  return sum;
+}
+
+// Value of monomial M at a_end and its average along the edge from a_start
+// to a_end, \int_E f dl / L = (f(a_end) + <a_start, grad(f)>_E / L) / (q + 1).
+template <UnsignedIndex_t ORDER, std::size_t M, std::size_t kLength>
+inline void edgeAverage(const Pt& a_start, const Pt& a_end,
+                        std::array<double, kLength>* a_end_values,
+                        std::array<double, kLength>* a_averages) {
+  constexpr auto& table = monomial_table<ORDER>;
+  constexpr UnsignedIndex_t direction = table.parent_direction[M];
+  (*a_end_values)[M] =
+      a_end[direction] * (*a_end_values)[table.lower[M][direction]];
+  (*a_averages)[M] =
+      ((*a_end_values)[M] + gradientTerm<ORDER, M>(a_start, *a_averages)) *
+      (1.0 / static_cast<double>(table.order[M] + 1));
+}
+
+template <UnsignedIndex_t ORDER, std::size_t kLength, std::size_t... Ms>
+inline void edgeAverages(const Pt& a_start, const Pt& a_end,
+                         std::array<double, kLength>* a_end_values,
+                         std::array<double, kLength>* a_averages,
+                         std::index_sequence<0, Ms...>) {
+  (*a_end_values)[0] = 1.0;
+  (*a_averages)[0] = 1.0;
+  (edgeAverage<ORDER, Ms>(a_start, a_end, a_end_values, a_averages), ...);
+}
+
+// Face integrals weighted by (x.n) from the weighted edge averages,
+// (x.n) \int_F f dS = (edge terms + (x.n) <a_start, grad(f)>_F) / (q + 2).
+template <UnsignedIndex_t ORDER, std::size_t kLength, std::size_t... Ms>
+inline void faceIntegrals(const Pt& a_start,
+                          const std::array<double, kLength>& a_edge_terms,
+                          std::array<double, kLength>* a_integrals,
+                          std::index_sequence<Ms...>) {
+  constexpr auto& table = monomial_table<ORDER>;
+  (((*a_integrals)[Ms] = (a_edge_terms[Ms] +
+                          gradientTerm<ORDER, Ms>(a_start, *a_integrals)) *
+                         (1.0 / static_cast<double>(table.order[Ms] + 2))),
+   ...);
+}
+
+}  // namespace face_moments_detail
+
+template <UnsignedIndex_t ORDER>
+void GeneralMoments3DFace_Functor<ORDER>::setDatum(const Pt& a_datum) {
+  datum_m = a_datum;
+}
+
+template <UnsignedIndex_t ORDER>
+template <class FaceType>
+void GeneralMoments3DFace_Functor<ORDER>::operator()(const FaceType& a_face) {
+  using sequence = std::make_index_sequence<linear_length>;
+  const auto starting_half_edge = a_face.getStartingHalfEdge();
+  const Pt start = starting_half_edge->getVertex()->getLocation().getPt() -
+                   datum_m;
+  auto current_half_edge = starting_half_edge->getNextHalfEdge();
+  Pt edge_start = current_half_edge->getVertex()->getLocation().getPt() -
+                  datum_m;
+  current_half_edge = current_half_edge->getNextHalfEdge();
+
+  // Edges touching the starting vertex lie on lines through it and do not
+  // contribute. Every other edge is weighted by (x.n) times twice the area
+  // of the triangle it forms with the starting vertex.
+  mom_array edge_terms{};
+  mom_array end_values;
+  mom_array averages;
+  do {
+    const Pt edge_end =
+        current_half_edge->getVertex()->getLocation().getPt() - datum_m;
+    const double weight = scalarTripleProduct(start, edge_start, edge_end);
+    face_moments_detail::edgeAverages<ORDER>(edge_start, edge_end, &end_values,
+                                             &averages, sequence());
+    for (std::size_t m = 0; m < linear_length; ++m) {
+      edge_terms[m] += weight * averages[m];
+    }
+    edge_start = edge_end;
+    current_half_edge = current_half_edge->getNextHalfEdge();
+  } while (current_half_edge != starting_half_edge);
+
+  mom_array face_integrals;
+  face_moments_detail::faceIntegrals<ORDER>(start, edge_terms, &face_integrals,
+                                            sequence());
+  for (std::size_t m = 0; m < linear_length; ++m) {
+    moments_m[m] += face_integrals[m];
+  }
+}
+
+template <UnsignedIndex_t ORDER>
+inline typename GeneralMoments3DFace_Functor<ORDER>::ReturnType
+GeneralMoments3DFace_Functor<ORDER>::getMoments(void) const {
+  constexpr auto& monomials = face_moments_detail::monomial_table<ORDER>;
+  constexpr auto& shift = face_moments_detail::shift_table<ORDER>;
+
+  mom_array datum_powers;
+  datum_powers[0] = 1.0;
+  for (std::size_t m = 1; m < linear_length; ++m) {
+    const auto direction = monomials.parent_direction[m];
+    datum_powers[m] =
+        datum_m[direction] * datum_powers[monomials.lower[m][direction]];
+  }
+
+  // Moments about the datum, \int_V f dV = 1/(q+3) \sum_F (x.n) \int_F f dS,
+  // then shifted back to the global coordinate system.
+  mom_array mom;
+  for (std::size_t m = 0; m < linear_length; ++m) {
+    mom[m] = moments_m[m] / static_cast<double>(monomials.order[m] + 3);
+  }
+  auto mom_shifted = ReturnType::fromScalarConstant(0.0);
+  for (std::size_t n = 0; n < shift.size; ++n) {
+    mom_shifted[shift.target[n]] += shift.coefficient[n] *
+                                    datum_powers[shift.power[n]] *
+                                    mom[shift.source[n]];
+  }
+  return mom_shifted;
+}
+
+}  // namespace IRL
+
+#endif  // IRL_GEOMETRY_GENERAL_MOMENT_CALCULATION_THROUGH_FACES_TPP_
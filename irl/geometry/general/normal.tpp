@@ -180,34 +180,34 @@ inline Normal::Normal(const Pt& a_pt) : normal_m{a_pt[0], a_pt[1], a_pt[2]} {}
 inline Normal::Normal(const double a_constant)
     : normal_m{a_constant, a_constant, a_constant} {}
 
-__attribute__((const)) inline double operator*(const Normal& a_normal_0,
-                                               const Normal& a_normal_1) {
+__attribute__((pure)) inline double operator*(const Normal& a_normal_0,
+                                              const Normal& a_normal_1) {
   return dotProduct(a_normal_0, a_normal_1);
 }
 
-__attribute__((const)) inline double operator*(const Pt& a_pt,
-                                               const Normal& a_normal) {
+__attribute__((pure)) inline double operator*(const Pt& a_pt,
+                                              const Normal& a_normal) {
   return dotProduct(a_pt, a_normal);
 }
 
-__attribute__((const)) inline double operator*(const Normal& a_normal,
-                                               const Pt& a_pt) {
+__attribute__((pure)) inline double operator*(const Normal& a_normal,
+                                              const Pt& a_pt) {
   return a_pt * a_normal;
 }
 
-__attribute__((const)) inline Normal operator*(const double a_double,
-                                               const Normal& a_normal) {
+__attribute__((pure)) inline Normal operator*(const double a_double,
+                                              const Normal& a_normal) {
   return Normal(a_normal[0] * a_double, a_normal[1] * a_double,
                 a_normal[2] * a_double);
 }
 
-__attribute__((const)) inline Normal operator*(const Normal& a_normal,
-                                               const double a_double) {
+__attribute__((pure)) inline Normal operator*(const Normal& a_normal,
+                                              const double a_double) {
   return a_double * a_normal;
 }
 
-__attribute__((const)) inline Normal operator/(const Normal& a_normal,
-                                               const double a_double) {
+__attribute__((pure)) inline Normal operator/(const Normal& a_normal,
+                                              const double a_double) {
   return Normal(a_normal[0] / a_double, a_normal[1] / a_double,
                 a_normal[2] / a_double);
 }
@@ -43,7 +43,7 @@ inline bool Plane::operator!=(const Plane& a_other_plane) const {
 }
 
 template <class PtType>
-__attribute__((const)) inline double Plane::signedDistanceToPoint(
+__attribute__((pure)) inline double Plane::signedDistanceToPoint(
     const PtType& a_pt) const {
   return this->normal()*a_pt.getPt() - this->distance();
 }
@@ -0,0 +1,71 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GEOMETRY_GENERAL_PT_FLOAT_H_
+#define IRL_GEOMETRY_GENERAL_PT_FLOAT_H_
+
+#include <array>
+#include <ostream>
+
+#include "irl/geometry/general/pt.h"
+#include "irl/parameters/defined_types.h"
+
+namespace IRL {
+
+/// \brief A point in 3D space stored in single precision.
+///
+/// Used as the vertex type of a polytope, e.g.
+/// `StoredDodecahedron<PtFloat>`, it gives a mixed-precision cutting path:
+/// vertices are stored, and new vertices on cut edges are computed, in
+/// float, halving the memory of the vertex arrays, while `getPt()` widens
+/// the point to a `Pt` so that distances to planes and all moments are
+/// computed and accumulated in double.
+class PtFloat {
+ public:
+  using value_type = float;
+
+  /// \brief The default constructor, performs NO INITIALIZATION.
+  PtFloat(void) = default;
+
+  constexpr PtFloat(const float a_x, const float a_y, const float a_z);
+
+  /// \brief Round a double-precision point to single precision.
+  explicit PtFloat(const Pt& a_pt);
+
+  PtFloat& operator=(const Pt& a_pt);
+
+  /// \brief Intersection of the edge between `a_pt_0` and `a_pt_1` with
+  /// the plane their signed distances are given for, computed in float.
+  static PtFloat fromEdgeIntersection(const PtFloat& a_pt_0,
+                                      const double a_dist_0,
+                                      const PtFloat& a_pt_1,
+                                      const double a_dist_1);
+
+  float& operator[](const UnsignedIndex_t a_d);
+  const float& operator[](const UnsignedIndex_t a_d) const;
+
+  /// \brief The point widened to double precision.
+  Pt getPt(void) const;
+
+  PtFloat& operator+=(const PtFloat& a_rhs);
+  PtFloat& operator/=(const double a_rhs);
+
+  ~PtFloat(void) = default;
+
+ private:
+  std::array<float, 3> loc_m;
+};
+
+inline std::ostream& operator<<(std::ostream& out, const PtFloat& a_pt);
+
+}  // namespace IRL
+
+#include "irl/geometry/general/pt_float.tpp"
+
+#endif  // IRL_GEOMETRY_GENERAL_PT_FLOAT_H_
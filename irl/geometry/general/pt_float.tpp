@@ -0,0 +1,77 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GEOMETRY_GENERAL_PT_FLOAT_TPP_
+#define IRL_GEOMETRY_GENERAL_PT_FLOAT_TPP_
+
+#include <cassert>
+
+namespace IRL {
+
+inline constexpr PtFloat::PtFloat(const float a_x, const float a_y,
+                                  const float a_z)
+    : loc_m{{a_x, a_y, a_z}} {}
+
+inline PtFloat::PtFloat(const Pt& a_pt)
+    : loc_m{{static_cast<float>(a_pt[0]), static_cast<float>(a_pt[1]),
+             static_cast<float>(a_pt[2])}} {}
+
+inline PtFloat& PtFloat::operator=(const Pt& a_pt) {
+  *this = PtFloat(a_pt);
+  return *this;
+}
+
+inline PtFloat PtFloat::fromEdgeIntersection(const PtFloat& a_pt_0,
+                                             const double a_dist_0,
+                                             const PtFloat& a_pt_1,
+                                             const double a_dist_1) {
+  const auto mu = static_cast<float>(a_dist_0 / (a_dist_1 - a_dist_0));
+  return PtFloat(a_pt_0[0] + mu * (a_pt_0[0] - a_pt_1[0]),
+                 a_pt_0[1] + mu * (a_pt_0[1] - a_pt_1[1]),
+                 a_pt_0[2] + mu * (a_pt_0[2] - a_pt_1[2]));
+}
+
+inline float& PtFloat::operator[](const UnsignedIndex_t a_d) {
+  assert(a_d < 3);
+  return loc_m[a_d];
+}
+
+inline const float& PtFloat::operator[](const UnsignedIndex_t a_d) const {
+  assert(a_d < 3);
+  return loc_m[a_d];
+}
+
+inline Pt PtFloat::getPt(void) const {
+  return Pt(static_cast<double>(loc_m[0]), static_cast<double>(loc_m[1]),
+            static_cast<double>(loc_m[2]));
+}
+
+inline PtFloat& PtFloat::operator+=(const PtFloat& a_rhs) {
+  loc_m[0] += a_rhs[0];
+  loc_m[1] += a_rhs[1];
+  loc_m[2] += a_rhs[2];
+  return *this;
+}
+
+inline PtFloat& PtFloat::operator/=(const double a_rhs) {
+  const auto inverse = static_cast<float>(1.0 / a_rhs);
+  loc_m[0] *= inverse;
+  loc_m[1] *= inverse;
+  loc_m[2] *= inverse;
+  return *this;
+}
+
+inline std::ostream& operator<<(std::ostream& out, const PtFloat& a_pt) {
+  out << a_pt.getPt();
+  return out;
+}
+
+}  // namespace IRL
+
+#endif  // IRL_GEOMETRY_GENERAL_PT_FLOAT_TPP_
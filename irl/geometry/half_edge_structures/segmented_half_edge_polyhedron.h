@@ -40,6 +40,8 @@ class SegmentedHalfEdgePolyhedronCommon
 
   inline VolumeMoments calculateMoments(void);
 
+  /// \brief Integrates the moments over the faces, without a
+  /// decomposition into tets.
   template <std::size_t ORDER>
   inline GeneralMoments3D<ORDER> calculateGeneralMoments(void);
 
@@ -10,6 +10,7 @@
 #ifndef IRL_GEOMETRY_HALF_EDGE_STRUCTURES_SEGMENTED_HALF_EDGE_POLYHEDRON_TPP_
 #define IRL_GEOMETRY_HALF_EDGE_STRUCTURES_SEGMENTED_HALF_EDGE_POLYHEDRON_TPP_
 
+#include "irl/geometry/general/moment_calculation_through_faces.h"
 #include "irl/geometry/general/moment_calculation_through_simplices.h"
 
 namespace IRL {
@@ -20,6 +21,11 @@ auto calculateMoments(GeometryType* a_geometry,
                       CalculationFunctor a_moment_accumulator) ->
     typename CalculationFunctor::ReturnType;
 
+template <class GeometryType, class CalculationFunctor>
+auto calculateMomentsThroughFaces(GeometryType* a_geometry,
+                                  CalculationFunctor a_moment_accumulator) ->
+    typename CalculationFunctor::ReturnType;
+
 template <class VertexType>
 class TetPtReferenceWrapper {
  public:
@@ -91,6 +97,36 @@ auto calculateMoments(GeometryType* a_geometry,
   return a_moment_accumulator.getMoments();
 }
 
+template <class GeometryType, class CalculationFunctor>
+auto calculateMomentsThroughFaces(GeometryType* a_geometry,
+                                  CalculationFunctor a_moment_accumulator) ->
+    typename CalculationFunctor::ReturnType {
+  if (a_geometry->getNumberOfFaces() == 0) {
+    return a_moment_accumulator.getMoments();
+  }
+
+  // Same datum and skipped faces as calculateMoments, so both give the
+  // same moments for non-planar faces.
+  auto& datum_vertex = *(a_geometry->getVertex(0));
+  a_moment_accumulator.setDatum(datum_vertex.getLocation().getPt());
+  for (auto& face : (*a_geometry)) {
+    face->markAsNotVisited();
+  }
+  auto current_half_edge = datum_vertex.getHalfEdge();
+  do {
+    current_half_edge->getFace()->markAsVisited();
+    current_half_edge =
+        current_half_edge->getOppositeHalfEdge()->getPreviousHalfEdge();
+  } while (current_half_edge != datum_vertex.getHalfEdge());
+
+  for (const auto& face : (*a_geometry)) {
+    if (face->hasNotBeenVisited()) {
+      a_moment_accumulator(*face);
+    }
+  }
+  return a_moment_accumulator.getMoments();
+}
+
 }  // namespace segmented_half_edge_polyhedron_detail
 
 template <class FaceType, class VertexType, UnsignedIndex_t kMaxFaces,
@@ -131,8 +167,8 @@ template <std::size_t ORDER>
 GeneralMoments3D<ORDER>
 SegmentedHalfEdgePolyhedronCommon<FaceType, VertexType, kMaxFaces,
                                   kMaxVertices>::calculateGeneralMoments(void) {
-  return segmented_half_edge_polyhedron_detail::calculateMoments(
-      this, GeneralMoments3D_Functor<ORDER>());
+  return segmented_half_edge_polyhedron_detail::calculateMomentsThroughFaces(
+      this, GeneralMoments3DFace_Functor<ORDER>());
 }
 
 template <class FaceType, class VertexType, UnsignedIndex_t kMaxFaces,
@@ -121,7 +121,7 @@ Pt SegmentedHalfEdgePolytope<FaceType, VertexType, kMaxFaces,
                              kMaxVertices>::getLowerLimits(void) const {
   Pt pt_to_return(DBL_MAX, DBL_MAX, DBL_MAX);
   for (const auto &vertex : vertices_m) {
-    const auto &pt = vertex->getLocation();
+    const auto &pt = vertex->getLocation().getPt();
     pt_to_return[0] = std::min(pt_to_return[0], pt[0]);
     pt_to_return[1] = std::min(pt_to_return[1], pt[1]);
     pt_to_return[2] = std::min(pt_to_return[2], pt[2]);
@@ -135,7 +135,7 @@ Pt SegmentedHalfEdgePolytope<FaceType, VertexType, kMaxFaces,
                              kMaxVertices>::getUpperLimits(void) const {
   Pt pt_to_return(-DBL_MAX, -DBL_MAX, -DBL_MAX);
   for (const auto &vertex : vertices_m) {
-    const auto &pt = vertex->getLocation();
+    const auto &pt = vertex->getLocation().getPt();
     pt_to_return[0] = std::max(pt_to_return[0], pt[0]);
     pt_to_return[1] = std::max(pt_to_return[1], pt[1]);
     pt_to_return[2] = std::max(pt_to_return[2], pt[2]);
@@ -151,7 +151,7 @@ SegmentedHalfEdgePolytope<FaceType, VertexType, kMaxFaces,
   std::array<Pt, 2> bounding_box{
       {Pt(DBL_MAX, DBL_MAX, DBL_MAX), Pt(-DBL_MAX, -DBL_MAX, -DBL_MAX)}};
   for (const auto &vertex : vertices_m) {
-    const auto &pt = vertex->getLocation();
+    const auto &pt = vertex->getLocation().getPt();
     for (UnsignedIndex_t dim = 0; dim < 3; ++dim) {
       bounding_box[0][dim] = std::min(bounding_box[0][dim], pt[dim]);
       bounding_box[1][dim] = std::max(bounding_box[1][dim], pt[dim]);
@@ -0,0 +1,157 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GRAPHS_COMPACT_GRAPH_H_
+#define IRL_GRAPHS_COMPACT_GRAPH_H_
+
+#include <cassert>
+#include <vector>
+
+#include "irl/parameters/defined_types.h"
+
+namespace IRL {
+
+template <class NodeType>
+class CompactGraphNode;
+
+/// \brief Edge storage for an entire mesh of nodes inheriting from
+/// CompactGraphNode, kept in compressed sparse row (CSR) format.
+///
+/// The edges of node `n` are the neighbor indices in
+/// [offsets[n], offsets[n+1]) of a single contiguous array, with
+/// `no_neighbor` marking an edge to nowhere. The nodes themselves must be
+/// stored contiguously and must not be moved or copied after the graph
+/// is built, since neighbors are found by their index in that array.
+/// The graph must outlive the nodes that use it.
+template <class NodeType>
+class CompactGraph {
+ public:
+  using node_type = NodeType;
+
+  /// \brief Neighbor index for an edge to nowhere.
+  static constexpr UnsignedIndex_t no_neighbor =
+      static_cast<UnsignedIndex_t>(-1);
+
+  /// \brief Default constructor, with no nodes.
+  CompactGraph(void);
+
+  /// \brief Build the graph for `a_number_of_nodes` nodes in `a_nodes` from
+  /// CSR data. `a_offsets` has `a_number_of_nodes + 1` entries and the
+  /// edges of node `n` are `a_neighbors[a_offsets[n]]` to
+  /// `a_neighbors[a_offsets[n+1] - 1]`, in the order of the planes of
+  /// the node's reconstruction. Each node's ID is set to its index.
+  void buildUnstructured(NodeType* a_nodes,
+                         const UnsignedIndex_t a_number_of_nodes,
+                         const LargeOffsetIndex_t* a_offsets,
+                         const UnsignedIndex_t* a_neighbors);
+
+  /// \brief Build the graph for a structured mesh of `a_nx` by `a_ny` by
+  /// `a_nz` nodes, where node (i,j,k) is `a_nodes[i + a_nx*(j + a_ny*k)]`.
+  ///
+  /// Each node receives six edges ordered as (-x, +x, -y, +y, -z, +z),
+  /// matching the planes of RectangularCuboid::getLocalizer(). Edges
+  /// leaving the mesh are to nowhere. Each node's ID is set to its index.
+  void buildStructured(NodeType* a_nodes, const UnsignedIndex_t a_nx,
+                       const UnsignedIndex_t a_ny, const UnsignedIndex_t a_nz);
+
+  /// \brief Number of nodes in the graph.
+  UnsignedIndex_t getNumberOfNodes(void) const;
+
+  /// \brief Total number of edges stored, including edges to nowhere.
+  LargeOffsetIndex_t getNumberOfEdges(void) const;
+
+  /// \brief Number of edges of node `a_node`.
+  UnsignedIndex_t getNumberOfEdges(const UnsignedIndex_t a_node) const;
+
+  /// \brief Index of the neighbor across edge `a_edge` of node `a_node`, or
+  /// `no_neighbor`.
+  UnsignedIndex_t getNeighborIndex(const UnsignedIndex_t a_node,
+                                   const UnsignedIndex_t a_edge) const;
+
+  /// \brief Set the neighbor across an existing edge of node `a_node`.
+  void setNeighborIndex(const UnsignedIndex_t a_node,
+                        const UnsignedIndex_t a_edge,
+                        const UnsignedIndex_t a_neighbor);
+
+  /// \brief Return the node at `a_node`.
+  const NodeType* getNode(const UnsignedIndex_t a_node) const;
+
+  /// \brief Index of `a_node` in the node array, which must be part of it.
+  UnsignedIndex_t getNodeIndex(const NodeType* a_node) const;
+
+  CompactGraph(const CompactGraph& a_other) = delete;
+  CompactGraph& operator=(const CompactGraph& a_other) = delete;
+
+  /// \brief Default destructor.
+  ~CompactGraph(void) = default;
+
+ private:
+  /// \brief Point every node at this graph and set its ID.
+  void attachNodes(NodeType* a_nodes, const UnsignedIndex_t a_number_of_nodes);
+
+  NodeType* nodes_m;
+  UnsignedIndex_t number_of_nodes_m;
+  std::vector<LargeOffsetIndex_t> offsets_m;
+  std::vector<UnsignedIndex_t> neighbors_m;
+};
+
+/// \brief Graph policy to inherit from (as the `GraphType` of
+/// ReconstructionLink) that provides the same interface as
+/// UnDirectedGraphNode, but keeps its edges in a CompactGraph shared by
+/// the whole mesh instead of in a per-node std::vector.
+///
+/// Nodes are connected by building the CompactGraph over the array
+/// that contains them.
+template <class NodeType>
+class CompactGraphNode {
+  friend CompactGraph<NodeType>;
+
+ public:
+  using node_type = NodeType;
+
+  /// \brief Default constructor, not connected to any graph.
+  CompactGraphNode(void);
+
+  /// \brief Set the neighbor for the edge `a_edge_index`, which must
+  /// already exist in the CompactGraph. `a_neighbor_ptr` must be nullptr
+  /// or a node of the same graph.
+  void setEdgeConnectivity(const UnsignedIndex_t a_edge_index,
+                           const NodeType* a_neighbor_ptr);
+
+  /// \brief Return the number of edges. Note, some might be to nowhere.
+  UnsignedIndex_t getNumberOfEdges(void) const;
+
+  void setId(const UnsignedIndex_t a_unique_id);
+  UnsignedIndex_t getId(void) const;
+  bool isIdSet(void) const;
+
+  bool hasNeighbor(const UnsignedIndex_t a_neighbor_index) const;
+
+  /// \brief Return neighboring node.
+  const NodeType& getNeighbor(const UnsignedIndex_t a_neighbor_index) const;
+
+  const NodeType* getNeighborAddress(
+      const UnsignedIndex_t a_neighbor_index) const;
+
+  const NodeType* getNodeMemoryAddress(void) const;
+
+  /// \brief Default destructor.
+  ~CompactGraphNode(void) = default;
+
+ private:
+  CompactGraph<NodeType>* graph_m;
+  UnsignedIndex_t index_m;
+  UnsignedIndex_t id_m;
+};
+
+}  // namespace IRL
+
+#include "irl/graphs/compact_graph.tpp"
+
+#endif  // IRL_GRAPHS_COMPACT_GRAPH_H_
@@ -0,0 +1,199 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_GRAPHS_COMPACT_GRAPH_TPP_
+#define IRL_GRAPHS_COMPACT_GRAPH_TPP_
+
+#include <algorithm>
+
+namespace IRL {
+
+template <class NodeType>
+CompactGraph<NodeType>::CompactGraph(void)
+    : nodes_m(nullptr), number_of_nodes_m(0), offsets_m(1, 0), neighbors_m() {}
+
+template <class NodeType>
+void CompactGraph<NodeType>::buildUnstructured(
+    NodeType* a_nodes, const UnsignedIndex_t a_number_of_nodes,
+    const LargeOffsetIndex_t* a_offsets, const UnsignedIndex_t* a_neighbors) {
+  assert(a_offsets[0] == 0);
+  offsets_m.assign(a_offsets, a_offsets + a_number_of_nodes + 1);
+  neighbors_m.assign(a_neighbors, a_neighbors + offsets_m.back());
+#ifndef NDEBUG
+  for (const auto neighbor : neighbors_m) {
+    assert(neighbor == no_neighbor || neighbor < a_number_of_nodes);
+  }
+#endif
+  this->attachNodes(a_nodes, a_number_of_nodes);
+}
+
+template <class NodeType>
+void CompactGraph<NodeType>::buildStructured(NodeType* a_nodes,
+                                             const UnsignedIndex_t a_nx,
+                                             const UnsignedIndex_t a_ny,
+                                             const UnsignedIndex_t a_nz) {
+  static constexpr UnsignedIndex_t edges_per_node = 6;
+  const auto number_of_nodes = a_nx * a_ny * a_nz;
+  offsets_m.resize(static_cast<LargeOffsetIndex_t>(number_of_nodes) + 1);
+  for (LargeOffsetIndex_t n = 0; n < offsets_m.size(); ++n) {
+    offsets_m[n] = n * edges_per_node;
+  }
+  neighbors_m.resize(offsets_m.back());
+  const UnsignedIndex_t stride_y = a_nx;
+  const UnsignedIndex_t stride_z = a_nx * a_ny;
+  for (UnsignedIndex_t k = 0; k < a_nz; ++k) {
+    for (UnsignedIndex_t j = 0; j < a_ny; ++j) {
+      for (UnsignedIndex_t i = 0; i < a_nx; ++i) {
+        const UnsignedIndex_t n = i + stride_y * j + stride_z * k;
+        UnsignedIndex_t* edges =
+            neighbors_m.data() +
+            static_cast<LargeOffsetIndex_t>(n) * edges_per_node;
+        edges[0] = i > 0 ? n - 1 : no_neighbor;
+        edges[1] = i + 1 < a_nx ? n + 1 : no_neighbor;
+        edges[2] = j > 0 ? n - stride_y : no_neighbor;
+        edges[3] = j + 1 < a_ny ? n + stride_y : no_neighbor;
+        edges[4] = k > 0 ? n - stride_z : no_neighbor;
+        edges[5] = k + 1 < a_nz ? n + stride_z : no_neighbor;
+      }
+    }
+  }
+  this->attachNodes(a_nodes, number_of_nodes);
+}
+
+template <class NodeType>
+UnsignedIndex_t CompactGraph<NodeType>::getNumberOfNodes(void) const {
+  return number_of_nodes_m;
+}
+
+template <class NodeType>
+LargeOffsetIndex_t CompactGraph<NodeType>::getNumberOfEdges(void) const {
+  return neighbors_m.size();
+}
+
+template <class NodeType>
+UnsignedIndex_t CompactGraph<NodeType>::getNumberOfEdges(
+    const UnsignedIndex_t a_node) const {
+  assert(a_node < number_of_nodes_m);
+  return static_cast<UnsignedIndex_t>(offsets_m[a_node + 1] -
+                                      offsets_m[a_node]);
+}
+
+template <class NodeType>
+UnsignedIndex_t CompactGraph<NodeType>::getNeighborIndex(
+    const UnsignedIndex_t a_node, const UnsignedIndex_t a_edge) const {
+  assert(a_edge < this->getNumberOfEdges(a_node));
+  return neighbors_m[offsets_m[a_node] + a_edge];
+}
+
+template <class NodeType>
+void CompactGraph<NodeType>::setNeighborIndex(
+    const UnsignedIndex_t a_node, const UnsignedIndex_t a_edge,
+    const UnsignedIndex_t a_neighbor) {
+  assert(a_edge < this->getNumberOfEdges(a_node));
+  assert(a_neighbor == no_neighbor || a_neighbor < number_of_nodes_m);
+  neighbors_m[offsets_m[a_node] + a_edge] = a_neighbor;
+}
+
+template <class NodeType>
+const NodeType* CompactGraph<NodeType>::getNode(
+    const UnsignedIndex_t a_node) const {
+  assert(a_node < number_of_nodes_m);
+  return nodes_m + a_node;
+}
+
+template <class NodeType>
+UnsignedIndex_t CompactGraph<NodeType>::getNodeIndex(
+    const NodeType* a_node) const {
+  assert(a_node >= nodes_m && a_node < nodes_m + number_of_nodes_m);
+  return static_cast<UnsignedIndex_t>(a_node - nodes_m);
+}
+
+template <class NodeType>
+void CompactGraph<NodeType>::attachNodes(
+    NodeType* a_nodes, const UnsignedIndex_t a_number_of_nodes) {
+  nodes_m = a_nodes;
+  number_of_nodes_m = a_number_of_nodes;
+  for (UnsignedIndex_t n = 0; n < a_number_of_nodes; ++n) {
+    CompactGraphNode<NodeType>& node = a_nodes[n];
+    node.graph_m = this;
+    node.index_m = n;
+    node.id_m = n;
+  }
+}
+
+template <class NodeType>
+CompactGraphNode<NodeType>::CompactGraphNode(void)
+    : graph_m(nullptr),
+      index_m(static_cast<UnsignedIndex_t>(-1)),
+      id_m(static_cast<UnsignedIndex_t>(-1)) {}
+
+template <class NodeType>
+void CompactGraphNode<NodeType>::setEdgeConnectivity(
+    const UnsignedIndex_t a_edge_index, const NodeType* a_neighbor_ptr) {
+  assert(graph_m != nullptr);
+  graph_m->setNeighborIndex(index_m, a_edge_index,
+                            a_neighbor_ptr == nullptr
+                                ? CompactGraph<NodeType>::no_neighbor
+                                : graph_m->getNodeIndex(a_neighbor_ptr));
+}
+
+template <class NodeType>
+UnsignedIndex_t CompactGraphNode<NodeType>::getNumberOfEdges(void) const {
+  return graph_m == nullptr ? 0 : graph_m->getNumberOfEdges(index_m);
+}
+
+template <class NodeType>
+void CompactGraphNode<NodeType>::setId(const UnsignedIndex_t a_unique_id) {
+  id_m = a_unique_id;
+}
+
+template <class NodeType>
+UnsignedIndex_t CompactGraphNode<NodeType>::getId(void) const {
+  return id_m;
+}
+
+template <class NodeType>
+bool CompactGraphNode<NodeType>::isIdSet(void) const {
+  return id_m != static_cast<UnsignedIndex_t>(-1);
+}
+
+template <class NodeType>
+bool CompactGraphNode<NodeType>::hasNeighbor(
+    const UnsignedIndex_t a_neighbor_index) const {
+  return a_neighbor_index < this->getNumberOfEdges() &&
+         graph_m->getNeighborIndex(index_m, a_neighbor_index) !=
+             CompactGraph<NodeType>::no_neighbor;
+}
+
+template <class NodeType>
+const NodeType& CompactGraphNode<NodeType>::getNeighbor(
+    const UnsignedIndex_t a_neighbor_index) const {
+  assert(this->hasNeighbor(a_neighbor_index));
+  return *(graph_m->getNode(graph_m->getNeighborIndex(index_m,
+                                                      a_neighbor_index)));
+}
+
+template <class NodeType>
+const NodeType* CompactGraphNode<NodeType>::getNeighborAddress(
+    const UnsignedIndex_t a_neighbor_index) const {
+  const auto neighbor = graph_m->getNeighborIndex(index_m, a_neighbor_index);
+  return neighbor == CompactGraph<NodeType>::no_neighbor
+             ? nullptr
+             : graph_m->getNode(neighbor);
+}
+
+template <class NodeType>
+const NodeType* CompactGraphNode<NodeType>::getNodeMemoryAddress(
+    void) const {
+  return static_cast<const NodeType*>(this);
+}
+
+}  // namespace IRL
+
+#endif  // IRL_GRAPHS_COMPACT_GRAPH_TPP_
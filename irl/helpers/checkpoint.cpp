@@ -0,0 +1,260 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/helpers/checkpoint.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace IRL {
+
+namespace {
+
+constexpr char checkpoint_magic[8] = {'I', 'R', 'L', 'C', 'K', 'P', 'T', '\0'};
+constexpr uint32_t checkpoint_byte_order = 0x01020304;
+// Records are converted into a buffer of this many bytes before writing.
+constexpr LargeOffsetIndex_t checkpoint_block_size = 1 << 22;
+
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint64_t number_of_sections;
+  uint64_t file_size;
+};
+static_assert(sizeof(FileHeader) == 32, "Checkpoint header layout changed.");
+
+struct SectionEntry {
+  char name[checkpoint_name_length];
+  uint32_t type;
+  uint32_t record_size;
+  uint64_t number_of_records;
+  uint64_t offset;
+};
+static_assert(sizeof(SectionEntry) == 64,
+              "Checkpoint section entry layout changed.");
+
+uint64_t alignOffset(const uint64_t a_offset) {
+  return (a_offset + checkpoint_alignment - 1) / checkpoint_alignment *
+         checkpoint_alignment;
+}
+
+// Size of the record for each CheckpointRecordType, or 0 if unknown.
+uint32_t getRecordSize(const uint32_t a_type) {
+  switch (static_cast<CheckpointRecordType>(a_type)) {
+    case CheckpointRecordType::Double:
+      return sizeof(double);
+    case CheckpointRecordType::UnsignedIndex:
+      return sizeof(UnsignedIndex_t);
+    case CheckpointRecordType::LargeOffsetIndex:
+      return sizeof(LargeOffsetIndex_t);
+    case CheckpointRecordType::PlanarSeparator:
+    case CheckpointRecordType::PlanarLocalizer:
+      return sizeof(PlanarReconstructionRecord);
+    case CheckpointRecordType::Volume:
+      return sizeof(double);
+    case CheckpointRecordType::VolumeMoments:
+      return sizeof(VolumeMomentsRecord);
+    case CheckpointRecordType::SeparatedVolumeMoments:
+      return sizeof(SeparatedVolumeMomentsRecord);
+  }
+  return 0;
+}
+
+bool writePadding(std::FILE* a_file, const uint64_t a_bytes) {
+  static constexpr Byte_t zeros[checkpoint_alignment] = {};
+  assert(a_bytes <= checkpoint_alignment);
+  return std::fwrite(zeros, 1, a_bytes, a_file) == a_bytes;
+}
+
+}  // namespace
+
+UnsignedIndex_t CheckpointWriter::getNumberOfSections(void) const {
+  return static_cast<UnsignedIndex_t>(sections_m.size());
+}
+
+void CheckpointWriter::clear(void) { sections_m.clear(); }
+
+void CheckpointWriter::appendSection(Section&& a_section) {
+  assert(a_section.name.size() < checkpoint_name_length);
+  sections_m.push_back(std::move(a_section));
+}
+
+bool CheckpointWriter::write(const std::string& a_file_name) const {
+  // Lay out the header, the section table, and then each section.
+  FileHeader header;
+  std::memcpy(header.magic, checkpoint_magic, sizeof(header.magic));
+  header.version = checkpoint_version;
+  header.byte_order = checkpoint_byte_order;
+  header.number_of_sections = sections_m.size();
+  std::vector<SectionEntry> entries(sections_m.size());
+  uint64_t offset = sizeof(FileHeader) + sizeof(SectionEntry) * entries.size();
+  for (std::size_t s = 0; s < sections_m.size(); ++s) {
+    const Section& section = sections_m[s];
+    SectionEntry& entry = entries[s];
+    std::memset(entry.name, 0, sizeof(entry.name));
+    std::memcpy(entry.name, section.name.c_str(),
+                std::min<std::size_t>(section.name.size(),
+                                      checkpoint_name_length - 1));
+    entry.type = static_cast<uint32_t>(section.type);
+    entry.record_size = section.record_size;
+    entry.number_of_records = section.number_of_records;
+    entry.offset = alignOffset(offset);
+    offset = entry.offset + section.record_size * section.number_of_records;
+  }
+  header.file_size = offset;
+
+  std::FILE* file = std::fopen(a_file_name.c_str(), "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  bool success = std::fwrite(&header, sizeof(header), 1, file) == 1;
+  success = success && (entries.empty() ||
+                        std::fwrite(entries.data(), sizeof(SectionEntry),
+                                    entries.size(),
+                                    file) == entries.size());
+  offset = sizeof(FileHeader) + sizeof(SectionEntry) * entries.size();
+  std::vector<Byte_t> block;
+  for (std::size_t s = 0; s < sections_m.size() && success; ++s) {
+    const Section& section = sections_m[s];
+    success = writePadding(file, entries[s].offset - offset);
+    const LargeOffsetIndex_t size =
+        section.record_size * section.number_of_records;
+    const void* raw_records = section.owned_records.empty()
+                                  ? section.raw_records
+                                  : section.owned_records.data();
+    if (raw_records != nullptr) {
+      success = success && (size == 0 || std::fwrite(raw_records, 1, size,
+                                                     file) == size);
+    } else if (size > 0) {
+      const LargeOffsetIndex_t records_per_block =
+          std::max<LargeOffsetIndex_t>(
+              1, checkpoint_block_size / section.record_size);
+      block.resize(records_per_block * section.record_size);
+      for (LargeOffsetIndex_t first = 0;
+           first < section.number_of_records && success;
+           first += records_per_block) {
+        const LargeOffsetIndex_t count = std::min(
+            records_per_block, section.number_of_records - first);
+        section.pack(first, count, block.data());
+        success = std::fwrite(block.data(), section.record_size, count,
+                              file) == count;
+      }
+    }
+    offset = entries[s].offset + size;
+  }
+  success = std::fclose(file) == 0 && success;
+  return success;
+}
+
+CheckpointReader::CheckpointReader(void)
+    : data_m(nullptr), size_m(0), section_names_m(), sections_m() {}
+
+bool CheckpointReader::open(const std::string& a_file_name) {
+  this->close();
+  const int descriptor = ::open(a_file_name.c_str(), O_RDONLY);
+  if (descriptor < 0) {
+    return false;
+  }
+  struct stat file_status;
+  if (::fstat(descriptor, &file_status) != 0 ||
+      static_cast<uint64_t>(file_status.st_size) < sizeof(FileHeader)) {
+    ::close(descriptor);
+    return false;
+  }
+  const auto size = static_cast<LargeOffsetIndex_t>(file_status.st_size);
+  void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+  // The mapping stays valid after the descriptor is closed.
+  ::close(descriptor);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+  data_m = static_cast<const Byte_t*>(mapping);
+  size_m = size;
+
+  FileHeader header;
+  std::memcpy(&header, data_m, sizeof(header));
+  const uint64_t table_end =
+      sizeof(FileHeader) + sizeof(SectionEntry) * header.number_of_sections;
+  if (std::memcmp(header.magic, checkpoint_magic, sizeof(header.magic)) !=
+          0 ||
+      header.version != checkpoint_version ||
+      header.byte_order != checkpoint_byte_order ||
+      header.file_size != size_m ||
+      header.number_of_sections > size_m / sizeof(SectionEntry) ||
+      table_end > size_m) {
+    this->close();
+    return false;
+  }
+
+  section_names_m.reserve(header.number_of_sections);
+  sections_m.reserve(header.number_of_sections);
+  for (uint64_t s = 0; s < header.number_of_sections; ++s) {
+    SectionEntry entry;
+    std::memcpy(&entry, data_m + sizeof(FileHeader) + s * sizeof(SectionEntry),
+                sizeof(entry));
+    const bool valid =
+        entry.name[checkpoint_name_length - 1] == '\0' &&
+        getRecordSize(entry.type) != 0 &&
+        entry.record_size == getRecordSize(entry.type) &&
+        entry.offset % checkpoint_alignment == 0 && entry.offset >= table_end &&
+        entry.offset <= size_m &&
+        entry.number_of_records <= (size_m - entry.offset) / entry.record_size;
+    if (!valid) {
+      this->close();
+      return false;
+    }
+    section_names_m.emplace_back(entry.name);
+    sections_m.push_back({static_cast<CheckpointRecordType>(entry.type),
+                          entry.number_of_records, data_m + entry.offset});
+  }
+  return true;
+}
+
+void CheckpointReader::close(void) {
+  if (data_m != nullptr) {
+    ::munmap(const_cast<Byte_t*>(data_m), size_m);
+  }
+  data_m = nullptr;
+  size_m = 0;
+  section_names_m.clear();
+  sections_m.clear();
+}
+
+bool CheckpointReader::isOpen(void) const { return data_m != nullptr; }
+
+bool CheckpointReader::hasSection(const std::string& a_name) const {
+  return this->findSection(a_name) != nullptr;
+}
+
+LargeOffsetIndex_t CheckpointReader::getNumberOfRecords(
+    const std::string& a_name) const {
+  const Section* section = this->findSection(a_name);
+  return section == nullptr ? 0 : section->number_of_records;
+}
+
+const CheckpointReader::Section* CheckpointReader::findSection(
+    const std::string& a_name) const {
+  for (std::size_t s = 0; s < section_names_m.size(); ++s) {
+    if (section_names_m[s] == a_name) {
+      return &sections_m[s];
+    }
+  }
+  return nullptr;
+}
+
+CheckpointReader::~CheckpointReader(void) { this->close(); }
+
+}  // namespace IRL
@@ -0,0 +1,241 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_HELPERS_CHECKPOINT_H_
+#define IRL_HELPERS_CHECKPOINT_H_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "irl/moments/separated_volume_moments.h"
+#include "irl/moments/volume.h"
+#include "irl/moments/volume_moments.h"
+#include "irl/parameters/constants.h"
+#include "irl/parameters/defined_types.h"
+#include "irl/planar_reconstruction/planar_localizer.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace IRL {
+
+/// \file checkpoint.h
+///
+/// A versioned, fixed-layout binary format for restart files. A checkpoint
+/// holds a header, a table of named sections, and the sections themselves.
+/// Each section is an array of fixed-size records of one type, starting on
+/// a `checkpoint_alignment` byte boundary, so a CheckpointReader can map
+/// the file and hand out pointers to the records without copying.
+///
+/// Like serializer.h, the format assumes the file is read on a machine
+/// with the same byte order it was written on. This is checked when the
+/// file is opened.
+
+/// \brief Version of the layout written by CheckpointWriter.
+static constexpr uint32_t checkpoint_version = 1;
+
+/// \brief Alignment, in bytes, of the start of every section.
+static constexpr uint64_t checkpoint_alignment = 64;
+
+/// \brief Maximum length of a section name, including the null terminator.
+static constexpr UnsignedIndex_t checkpoint_name_length = 40;
+
+/// \brief Type of the records stored in a section.
+enum class CheckpointRecordType : uint32_t {
+  Double = 0,
+  UnsignedIndex = 1,
+  LargeOffsetIndex = 2,
+  PlanarSeparator = 3,
+  PlanarLocalizer = 4,
+  Volume = 5,
+  VolumeMoments = 6,
+  SeparatedVolumeMoments = 7
+};
+
+/// \brief Record for a PlanarSeparator or PlanarLocalizer. Unused planes
+/// are zero, and `flip_cut` is 1.0 for a PlanarLocalizer.
+struct PlanarReconstructionRecord {
+  uint32_t number_of_planes;
+  uint32_t padding;
+  double flip_cut;
+  /// \brief Normal x, y, z and distance of each plane.
+  double planes[global_constants::MAX_PLANAR_LOCALIZER_PLANES][4];
+};
+
+/// \brief Record for VolumeMoments.
+struct VolumeMomentsRecord {
+  double volume;
+  double centroid[3];
+};
+
+/// \brief Record for SeparatedMoments<VolumeMoments>.
+struct SeparatedVolumeMomentsRecord {
+  VolumeMomentsRecord moments[2];
+};
+
+/// \brief Traits mapping an IRL object to its record in a checkpoint.
+///
+/// Each specialization provides the `record_type`, its
+/// CheckpointRecordType `type`, and static `pack` and `unpack` functions
+/// that convert between the object and its record. The static `isValid`
+/// checks that a record read from a file can be unpacked.
+template <class ObjectType>
+struct CheckpointRecord;
+
+/// \brief Writes named sections of IRL objects to a checkpoint file.
+///
+/// Sections are registered with the add methods and only read from when
+/// write() is called, so the objects must outlive that call. Records are
+/// converted in blocks and written with large sequential writes. Sections
+/// of doubles and indices are written straight from the caller's memory.
+class CheckpointWriter {
+ public:
+  /// \brief Default constructor.
+  CheckpointWriter(void) = default;
+
+  /// \brief Add a section named `a_name` holding `a_number_of_objects`
+  /// objects from the array `a_objects`.
+  template <class ObjectType>
+  void addSection(const std::string& a_name, const ObjectType* a_objects,
+                  const LargeOffsetIndex_t a_number_of_objects);
+
+  /// \brief Add a section named `a_name` holding `a_number_of_objects`
+  /// objects, where `a_accessor(n)` returns a const reference to object n.
+  template <class ObjectType, class AccessorType>
+  void addSection(const std::string& a_name,
+                  const LargeOffsetIndex_t a_number_of_objects,
+                  const AccessorType& a_accessor);
+
+  /// \brief Add the connectivity of `a_number_of_links` links stored in the
+  /// array `a_links`, as sections `a_name.ids`, `a_name.offsets`, and
+  /// `a_name.neighbors`.
+  ///
+  /// Neighbors are stored as their index in `a_links`. Neighbors outside of
+  /// the array, and edges to nowhere, are stored as `no_neighbor`.
+  template <class LinkType>
+  void addLinkConnectivity(const std::string& a_name, const LinkType* a_links,
+                           const LargeOffsetIndex_t a_number_of_links);
+
+  /// \brief Return the number of sections added.
+  UnsignedIndex_t getNumberOfSections(void) const;
+
+  /// \brief Remove all sections.
+  void clear(void);
+
+  /// \brief Write all sections to `a_file_name`, replacing it. Returns false
+  /// if the file could not be written.
+  bool write(const std::string& a_file_name) const;
+
+  /// \brief Marks a link edge with no neighbor in the written array.
+  static constexpr UnsignedIndex_t no_neighbor =
+      static_cast<UnsignedIndex_t>(-1);
+
+  /// \brief Default destructor.
+  ~CheckpointWriter(void) = default;
+
+ private:
+  struct Section {
+    std::string name;
+    CheckpointRecordType type;
+    uint32_t record_size;
+    LargeOffsetIndex_t number_of_records;
+    // Records already in their final layout, written without conversion.
+    const void* raw_records;
+    // Data owned by the section, for connectivity built by the writer.
+    std::vector<Byte_t> owned_records;
+    // Packs `count` records starting at `first` into the output.
+    std::function<void(LargeOffsetIndex_t, LargeOffsetIndex_t, Byte_t*)>
+        pack;
+  };
+
+  void appendSection(Section&& a_section);
+
+  std::vector<Section> sections_m;
+};
+
+/// \brief Maps a checkpoint file written by CheckpointWriter and reads its
+/// sections in place.
+class CheckpointReader {
+ public:
+  /// \brief Default constructor, with no file open.
+  CheckpointReader(void);
+
+  CheckpointReader(const CheckpointReader&) = delete;
+  CheckpointReader& operator=(const CheckpointReader&) = delete;
+
+  /// \brief Map `a_file_name`, closing any file already open. Returns false,
+  /// with no file open, if it can not be mapped or is not a valid
+  /// checkpoint of this version.
+  bool open(const std::string& a_file_name);
+
+  /// \brief Unmap the open file.
+  void close(void);
+
+  /// \brief Whether a file is open.
+  bool isOpen(void) const;
+
+  /// \brief Whether the open file has a section named `a_name`.
+  bool hasSection(const std::string& a_name) const;
+
+  /// \brief Number of records in section `a_name`, or 0 if it does not
+  /// exist.
+  LargeOffsetIndex_t getNumberOfRecords(const std::string& a_name) const;
+
+  /// \brief Pointer to the records of section `a_name` in the mapped file.
+  /// Returns nullptr if the section does not exist or does not hold
+  /// ObjectType records. Valid until the file is closed.
+  template <class ObjectType>
+  const typename CheckpointRecord<ObjectType>::record_type* getRecords(
+      const std::string& a_name) const;
+
+  /// \brief Unpack section `a_name` into the `a_number_of_objects` objects
+  /// in `a_objects`. Returns false, without changing the objects, if the
+  /// section does not exist, does not hold ObjectType records, does not
+  /// have `a_number_of_objects` records, or has a malformed record.
+  template <class ObjectType>
+  bool read(const std::string& a_name, ObjectType* a_objects,
+            const LargeOffsetIndex_t a_number_of_objects) const;
+
+  /// \brief As above, where `a_accessor(n)` returns a reference to object n.
+  template <class ObjectType, class AccessorType>
+  bool read(const std::string& a_name,
+            const LargeOffsetIndex_t a_number_of_objects,
+            const AccessorType& a_accessor) const;
+
+  /// \brief Restore the ids and edges of the `a_number_of_links` links in
+  /// `a_links` from sections written by CheckpointWriter::addLinkConnectivity.
+  /// Returns false, without changing the links, if the sections are missing
+  /// or do not match.
+  template <class LinkType>
+  bool readLinkConnectivity(const std::string& a_name, LinkType* a_links,
+                            const LargeOffsetIndex_t a_number_of_links) const;
+
+  /// \brief Unmaps the file.
+  ~CheckpointReader(void);
+
+ private:
+  struct Section {
+    CheckpointRecordType type;
+    LargeOffsetIndex_t number_of_records;
+    const Byte_t* records;
+  };
+
+  const Section* findSection(const std::string& a_name) const;
+
+  const Byte_t* data_m;
+  LargeOffsetIndex_t size_m;
+  std::vector<std::string> section_names_m;
+  std::vector<Section> sections_m;
+};
+
+}  // namespace IRL
+
+#include "irl/helpers/checkpoint.tpp"
+
+#endif  // IRL_HELPERS_CHECKPOINT_H_
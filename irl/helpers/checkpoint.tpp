@@ -0,0 +1,384 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_HELPERS_CHECKPOINT_TPP_
+#define IRL_HELPERS_CHECKPOINT_TPP_
+
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace IRL {
+
+namespace checkpoint_details {
+
+/// \brief Record for a type stored as itself.
+template <class ObjectType, CheckpointRecordType kType>
+struct RawCheckpointRecord {
+  using record_type = ObjectType;
+  static constexpr CheckpointRecordType type = kType;
+  static constexpr bool is_raw = true;
+
+  static void pack(const ObjectType& a_object, record_type* a_record) {
+    *a_record = a_object;
+  }
+  static bool isValid(const record_type&) { return true; }
+  static void unpack(const record_type& a_record, ObjectType* a_object) {
+    *a_object = a_record;
+  }
+};
+
+template <class ReconstructionType>
+void packPlanarReconstruction(const ReconstructionType& a_reconstruction,
+                              const double a_flip_cut,
+                              PlanarReconstructionRecord* a_record) {
+  assert(a_reconstruction.getNumberOfPlanes() <=
+         global_constants::MAX_PLANAR_LOCALIZER_PLANES);
+  std::memset(static_cast<void*>(a_record), 0,
+              sizeof(PlanarReconstructionRecord));
+  a_record->number_of_planes = a_reconstruction.getNumberOfPlanes();
+  a_record->flip_cut = a_flip_cut;
+  for (UnsignedIndex_t p = 0; p < a_reconstruction.getNumberOfPlanes(); ++p) {
+    const Plane& plane = a_reconstruction[p];
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      a_record->planes[p][d] = plane.normal()[d];
+    }
+    a_record->planes[p][3] = plane.distance();
+  }
+}
+
+// Both PlanarSeparator and PlanarLocalizer hold as many planes as a record.
+inline bool isValidPlanarReconstruction(
+    const PlanarReconstructionRecord& a_record) {
+  return a_record.number_of_planes <=
+         global_constants::MAX_PLANAR_LOCALIZER_PLANES;
+}
+
+template <class ReconstructionType>
+void unpackPlanarReconstruction(const PlanarReconstructionRecord& a_record,
+                                ReconstructionType* a_reconstruction) {
+  assert(isValidPlanarReconstruction(a_record));
+  a_reconstruction->setNumberOfPlanes(a_record.number_of_planes);
+  for (UnsignedIndex_t p = 0; p < a_record.number_of_planes; ++p) {
+    (*a_reconstruction)[p] =
+        Plane(Normal(a_record.planes[p][0], a_record.planes[p][1],
+                     a_record.planes[p][2]),
+              a_record.planes[p][3]);
+  }
+}
+
+inline void packVolumeMoments(const VolumeMoments& a_moments,
+                              VolumeMomentsRecord* a_record) {
+  a_record->volume = a_moments.volume();
+  for (UnsignedIndex_t d = 0; d < 3; ++d) {
+    a_record->centroid[d] = a_moments.centroid()[d];
+  }
+}
+
+inline void unpackVolumeMoments(const VolumeMomentsRecord& a_record,
+                                VolumeMoments* a_moments) {
+  a_moments->volume() = a_record.volume;
+  for (UnsignedIndex_t d = 0; d < 3; ++d) {
+    a_moments->centroid()[d] = a_record.centroid[d];
+  }
+}
+
+}  // namespace checkpoint_details
+
+template <>
+struct CheckpointRecord<double>
+    : checkpoint_details::RawCheckpointRecord<double,
+                                              CheckpointRecordType::Double> {};
+
+template <>
+struct CheckpointRecord<UnsignedIndex_t>
+    : checkpoint_details::RawCheckpointRecord<
+          UnsignedIndex_t, CheckpointRecordType::UnsignedIndex> {};
+
+template <>
+struct CheckpointRecord<LargeOffsetIndex_t>
+    : checkpoint_details::RawCheckpointRecord<
+          LargeOffsetIndex_t, CheckpointRecordType::LargeOffsetIndex> {
+  static_assert(sizeof(LargeOffsetIndex_t) == sizeof(uint64_t),
+                "Checkpoints store LargeOffsetIndex_t as 64 bits.");
+};
+
+template <>
+struct CheckpointRecord<PlanarSeparator> {
+  using record_type = PlanarReconstructionRecord;
+  static constexpr CheckpointRecordType type =
+      CheckpointRecordType::PlanarSeparator;
+  static constexpr bool is_raw = false;
+
+  static void pack(const PlanarSeparator& a_object, record_type* a_record) {
+    checkpoint_details::packPlanarReconstruction(a_object, a_object.flip(),
+                                                 a_record);
+  }
+  static bool isValid(const record_type& a_record) {
+    return checkpoint_details::isValidPlanarReconstruction(a_record);
+  }
+  static void unpack(const record_type& a_record, PlanarSeparator* a_object) {
+    checkpoint_details::unpackPlanarReconstruction(a_record, a_object);
+    a_object->setFlip(a_record.flip_cut);
+  }
+};
+
+template <>
+struct CheckpointRecord<PlanarLocalizer> {
+  using record_type = PlanarReconstructionRecord;
+  static constexpr CheckpointRecordType type =
+      CheckpointRecordType::PlanarLocalizer;
+  static constexpr bool is_raw = false;
+
+  static void pack(const PlanarLocalizer& a_object, record_type* a_record) {
+    checkpoint_details::packPlanarReconstruction(a_object, 1.0, a_record);
+  }
+  static bool isValid(const record_type& a_record) {
+    return checkpoint_details::isValidPlanarReconstruction(a_record);
+  }
+  static void unpack(const record_type& a_record, PlanarLocalizer* a_object) {
+    checkpoint_details::unpackPlanarReconstruction(a_record, a_object);
+  }
+};
+
+template <>
+struct CheckpointRecord<Volume> {
+  using record_type = double;
+  static constexpr CheckpointRecordType type = CheckpointRecordType::Volume;
+  static constexpr bool is_raw = false;
+
+  static void pack(const Volume& a_object, record_type* a_record) {
+    *a_record = static_cast<double>(a_object);
+  }
+  static bool isValid(const record_type&) { return true; }
+  static void unpack(const record_type& a_record, Volume* a_object) {
+    *a_object = Volume(a_record);
+  }
+};
+
+template <>
+struct CheckpointRecord<VolumeMoments> {
+  using record_type = VolumeMomentsRecord;
+  static constexpr CheckpointRecordType type =
+      CheckpointRecordType::VolumeMoments;
+  static constexpr bool is_raw = false;
+
+  static void pack(const VolumeMoments& a_object, record_type* a_record) {
+    checkpoint_details::packVolumeMoments(a_object, a_record);
+  }
+  static bool isValid(const record_type&) { return true; }
+  static void unpack(const record_type& a_record, VolumeMoments* a_object) {
+    checkpoint_details::unpackVolumeMoments(a_record, a_object);
+  }
+};
+
+template <>
+struct CheckpointRecord<SeparatedMoments<VolumeMoments>> {
+  using record_type = SeparatedVolumeMomentsRecord;
+  static constexpr CheckpointRecordType type =
+      CheckpointRecordType::SeparatedVolumeMoments;
+  static constexpr bool is_raw = false;
+
+  static void pack(const SeparatedMoments<VolumeMoments>& a_object,
+                   record_type* a_record) {
+    for (UnsignedIndex_t phase = 0; phase < 2; ++phase) {
+      checkpoint_details::packVolumeMoments(a_object[phase],
+                                            &a_record->moments[phase]);
+    }
+  }
+  static bool isValid(const record_type&) { return true; }
+  static void unpack(const record_type& a_record,
+                     SeparatedMoments<VolumeMoments>* a_object) {
+    for (UnsignedIndex_t phase = 0; phase < 2; ++phase) {
+      checkpoint_details::unpackVolumeMoments(a_record.moments[phase],
+                                              &(*a_object)[phase]);
+    }
+  }
+};
+
+template <class ObjectType>
+void CheckpointWriter::addSection(
+    const std::string& a_name, const ObjectType* a_objects,
+    const LargeOffsetIndex_t a_number_of_objects) {
+  using Record = CheckpointRecord<ObjectType>;
+  if (Record::is_raw) {
+    Section section;
+    section.name = a_name;
+    section.type = Record::type;
+    section.record_size = sizeof(typename Record::record_type);
+    section.number_of_records = a_number_of_objects;
+    section.raw_records = a_objects;
+    this->appendSection(std::move(section));
+  } else {
+    this->addSection<ObjectType>(
+        a_name, a_number_of_objects,
+        [a_objects](const LargeOffsetIndex_t a_n) -> const ObjectType& {
+          return a_objects[a_n];
+        });
+  }
+}
+
+template <class ObjectType, class AccessorType>
+void CheckpointWriter::addSection(const std::string& a_name,
+                                  const LargeOffsetIndex_t a_number_of_objects,
+                                  const AccessorType& a_accessor) {
+  using Record = CheckpointRecord<ObjectType>;
+  using RecordType = typename Record::record_type;
+  Section section;
+  section.name = a_name;
+  section.type = Record::type;
+  section.record_size = sizeof(RecordType);
+  section.number_of_records = a_number_of_objects;
+  section.raw_records = nullptr;
+  section.pack = [a_accessor](const LargeOffsetIndex_t a_first,
+                              const LargeOffsetIndex_t a_count,
+                              Byte_t* a_output) {
+    auto records = reinterpret_cast<RecordType*>(a_output);
+    for (LargeOffsetIndex_t n = 0; n < a_count; ++n) {
+      Record::pack(a_accessor(a_first + n), records + n);
+    }
+  };
+  this->appendSection(std::move(section));
+}
+
+template <class LinkType>
+void CheckpointWriter::addLinkConnectivity(
+    const std::string& a_name, const LinkType* a_links,
+    const LargeOffsetIndex_t a_number_of_links) {
+  std::vector<UnsignedIndex_t> ids(a_number_of_links);
+  std::vector<LargeOffsetIndex_t> offsets(a_number_of_links + 1, 0);
+  for (LargeOffsetIndex_t n = 0; n < a_number_of_links; ++n) {
+    ids[n] = a_links[n].isIdSet() ? a_links[n].getId() : no_neighbor;
+    offsets[n + 1] = offsets[n] + a_links[n].getNumberOfEdges();
+  }
+  std::vector<UnsignedIndex_t> neighbors(offsets[a_number_of_links]);
+  for (LargeOffsetIndex_t n = 0; n < a_number_of_links; ++n) {
+    for (UnsignedIndex_t e = 0; e < a_links[n].getNumberOfEdges(); ++e) {
+      const auto neighbor = a_links[n].getNeighborAddress(e);
+      const bool in_array = neighbor != nullptr && neighbor >= a_links &&
+                            neighbor < a_links + a_number_of_links;
+      neighbors[offsets[n] + e] =
+          in_array ? static_cast<UnsignedIndex_t>(neighbor - a_links)
+                   : no_neighbor;
+    }
+  }
+
+  auto add_owned = [this](const std::string& a_section_name,
+                          const CheckpointRecordType a_type,
+                          const uint32_t a_record_size, const auto& a_data) {
+    Section section;
+    section.name = a_section_name;
+    section.type = a_type;
+    section.record_size = a_record_size;
+    section.number_of_records = a_data.size();
+    section.raw_records = nullptr;
+    const auto bytes = reinterpret_cast<const Byte_t*>(a_data.data());
+    section.owned_records.assign(bytes, bytes + a_record_size * a_data.size());
+    this->appendSection(std::move(section));
+  };
+  add_owned(a_name + ".ids", CheckpointRecordType::UnsignedIndex,
+            sizeof(UnsignedIndex_t), ids);
+  add_owned(a_name + ".offsets", CheckpointRecordType::LargeOffsetIndex,
+            sizeof(LargeOffsetIndex_t), offsets);
+  add_owned(a_name + ".neighbors", CheckpointRecordType::UnsignedIndex,
+            sizeof(UnsignedIndex_t), neighbors);
+}
+
+template <class ObjectType>
+const typename CheckpointRecord<ObjectType>::record_type*
+CheckpointReader::getRecords(const std::string& a_name) const {
+  const Section* section = this->findSection(a_name);
+  if (section == nullptr ||
+      section->type != CheckpointRecord<ObjectType>::type) {
+    return nullptr;
+  }
+  return reinterpret_cast<
+      const typename CheckpointRecord<ObjectType>::record_type*>(
+      section->records);
+}
+
+template <class ObjectType>
+bool CheckpointReader::read(
+    const std::string& a_name, ObjectType* a_objects,
+    const LargeOffsetIndex_t a_number_of_objects) const {
+  return this->read<ObjectType>(
+      a_name, a_number_of_objects,
+      [a_objects](const LargeOffsetIndex_t a_n) -> ObjectType& {
+        return a_objects[a_n];
+      });
+}
+
+template <class ObjectType, class AccessorType>
+bool CheckpointReader::read(const std::string& a_name,
+                            const LargeOffsetIndex_t a_number_of_objects,
+                            const AccessorType& a_accessor) const {
+  const auto records = this->getRecords<ObjectType>(a_name);
+  if (records == nullptr ||
+      this->getNumberOfRecords(a_name) != a_number_of_objects) {
+    return false;
+  }
+  for (LargeOffsetIndex_t n = 0; n < a_number_of_objects; ++n) {
+    if (!CheckpointRecord<ObjectType>::isValid(records[n])) {
+      return false;
+    }
+  }
+  for (LargeOffsetIndex_t n = 0; n < a_number_of_objects; ++n) {
+    CheckpointRecord<ObjectType>::unpack(records[n], &a_accessor(n));
+  }
+  return true;
+}
+
+template <class LinkType>
+bool CheckpointReader::readLinkConnectivity(
+    const std::string& a_name, LinkType* a_links,
+    const LargeOffsetIndex_t a_number_of_links) const {
+  const auto ids = this->getRecords<UnsignedIndex_t>(a_name + ".ids");
+  const auto offsets =
+      this->getRecords<LargeOffsetIndex_t>(a_name + ".offsets");
+  const auto neighbors =
+      this->getRecords<UnsignedIndex_t>(a_name + ".neighbors");
+  if (ids == nullptr || offsets == nullptr || neighbors == nullptr ||
+      this->getNumberOfRecords(a_name + ".ids") != a_number_of_links ||
+      this->getNumberOfRecords(a_name + ".offsets") != a_number_of_links + 1 ||
+      this->getNumberOfRecords(a_name + ".neighbors") !=
+          offsets[a_number_of_links]) {
+    return false;
+  }
+  for (LargeOffsetIndex_t n = 0; n < a_number_of_links; ++n) {
+    if (offsets[n] > offsets[n + 1]) {
+      return false;
+    }
+  }
+  for (LargeOffsetIndex_t n = 0; n < offsets[a_number_of_links]; ++n) {
+    if (neighbors[n] != CheckpointWriter::no_neighbor &&
+        neighbors[n] >= a_number_of_links) {
+      return false;
+    }
+  }
+
+  for (LargeOffsetIndex_t n = 0; n < a_number_of_links; ++n) {
+    if (ids[n] != CheckpointWriter::no_neighbor) {
+      a_links[n].setId(ids[n]);
+    }
+    const auto number_of_edges =
+        static_cast<UnsignedIndex_t>(offsets[n + 1] - offsets[n]);
+    for (UnsignedIndex_t e = 0; e < number_of_edges; ++e) {
+      const UnsignedIndex_t neighbor = neighbors[offsets[n] + e];
+      a_links[n].setEdgeConnectivity(
+          e, neighbor == CheckpointWriter::no_neighbor ? nullptr
+                                                       : a_links + neighbor);
+    }
+  }
+  return true;
+}
+
+}  // namespace IRL
+
+#endif  // IRL_HELPERS_CHECKPOINT_TPP_
@@ -0,0 +1,119 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/helpers/cutting_samples.h"
+
+#include <algorithm>
+#include <random>
+
+namespace IRL {
+
+namespace {
+
+// Vertices of a unit cube centered at the origin, in the ordering shared by
+// Hexahedron, Dodecahedron, CappedDodecahedron and Polyhedron24.
+const Pt cube_vertices[8] = {
+    Pt(0.5, -0.5, -0.5), Pt(0.5, 0.5, -0.5),  Pt(0.5, 0.5, 0.5),
+    Pt(0.5, -0.5, 0.5),  Pt(-0.5, -0.5, -0.5), Pt(-0.5, 0.5, -0.5),
+    Pt(-0.5, 0.5, 0.5),  Pt(-0.5, -0.5, 0.5)};
+
+// Vertices of a right triangular prism, shared by TriangularPrism and
+// Octahedron.
+const Pt prism_vertices[6] = {Pt(0.0, 0.0, 0.0),  Pt(0.0, 1.0, 0.0),
+                              Pt(0.0, 0.0, 1.0),  Pt(-1.0, 0.0, 0.0),
+                              Pt(-1.0, 1.0, 0.0), Pt(-1.0, 0.0, 1.0)};
+
+}  // namespace
+
+template <>
+RectangularCuboid makeSamplePolyhedron<RectangularCuboid>(void) {
+  return unit_cell;
+}
+
+template <>
+Hexahedron makeSamplePolyhedron<Hexahedron>(void) {
+  return Hexahedron::fromRawPtPointer(8, cube_vertices);
+}
+
+template <>
+Tet makeSamplePolyhedron<Tet>(void) {
+  return Tet({Pt(1.0, 0.0, 0.0), Pt(0.0, 1.0, 0.0), Pt(0.0, 0.0, 1.0),
+              Pt(0.0, 0.0, 0.0)});
+}
+
+template <>
+TriangularPrism makeSamplePolyhedron<TriangularPrism>(void) {
+  return TriangularPrism::fromRawPtPointer(6, prism_vertices);
+}
+
+template <>
+Pyramid makeSamplePolyhedron<Pyramid>(void) {
+  return Pyramid({Pt(-0.5, -0.5, 0.0), Pt(-0.5, 0.5, 0.0), Pt(0.5, 0.5, 0.0),
+                  Pt(0.5, -0.5, 0.0), Pt(0.0, 0.0, 1.0)});
+}
+
+template <>
+Octahedron makeSamplePolyhedron<Octahedron>(void) {
+  return Octahedron::fromRawPtPointer(6, prism_vertices);
+}
+
+template <>
+Dodecahedron makeSamplePolyhedron<Dodecahedron>(void) {
+  return Dodecahedron::fromRawPtPointer(8, cube_vertices);
+}
+
+template <>
+CappedDodecahedron makeSamplePolyhedron<CappedDodecahedron>(void) {
+  Pt vertices[9];
+  std::copy(cube_vertices, cube_vertices + 8, vertices);
+  vertices[8] = Pt(-0.5, 0.0, 0.0);
+  return CappedDodecahedron::fromRawPtPointer(9, vertices);
+}
+
+template <>
+Polyhedron24 makeSamplePolyhedron<Polyhedron24>(void) {
+  // Cube vertices followed by one point per face.
+  Pt vertices[14];
+  std::copy(cube_vertices, cube_vertices + 8, vertices);
+  vertices[8] = Pt(0.5, 0.0, 0.0);
+  vertices[9] = Pt(0.0, 0.0, -0.5);
+  vertices[10] = Pt(0.0, 0.5, 0.0);
+  vertices[11] = Pt(0.0, 0.0, 0.5);
+  vertices[12] = Pt(0.0, -0.5, 0.0);
+  vertices[13] = Pt(-0.5, 0.0, 0.0);
+  return Polyhedron24::fromRawPtPointer(14, vertices);
+}
+
+std::vector<PlanarSeparator> generateSampleSeparators(
+    const Pt& a_centroid, const UnsignedIndex_t a_number_of_separators,
+    const UnsignedIndex_t a_number_of_planes) {
+  std::mt19937_64 eng(12345);
+  std::uniform_real_distribution<double> random_normal(-1.0, 1.0);
+  std::uniform_real_distribution<double> random_offset(-0.2, 0.2);
+  std::uniform_int_distribution<int> random_flip(0, 1);
+  auto random_plane = [&]() {
+    const Normal normal = Normal::normalized(
+        random_normal(eng), random_normal(eng), random_normal(eng));
+    return Plane(normal, normal * a_centroid + random_offset(eng));
+  };
+  std::vector<PlanarSeparator> separators(a_number_of_separators);
+  for (auto& separator : separators) {
+    if (a_number_of_planes == 1) {
+      separator = PlanarSeparator::fromOnePlane(random_plane());
+    } else {
+      const Plane plane_0 = random_plane();
+      const Plane plane_1 = random_plane();
+      separator = PlanarSeparator::fromTwoPlanes(
+          plane_0, plane_1, random_flip(eng) == 0 ? -1.0 : 1.0);
+    }
+  }
+  return separators;
+}
+
+}  // namespace IRL
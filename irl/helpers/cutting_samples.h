@@ -0,0 +1,66 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_HELPERS_CUTTING_SAMPLES_H_
+#define IRL_HELPERS_CUTTING_SAMPLES_H_
+
+#include <vector>
+
+#include "irl/geometry/general/pt.h"
+#include "irl/geometry/polyhedrons/capped_dodecahedron.h"
+#include "irl/geometry/polyhedrons/dodecahedron.h"
+#include "irl/geometry/polyhedrons/hexahedron.h"
+#include "irl/geometry/polyhedrons/octahedron.h"
+#include "irl/geometry/polyhedrons/polyhedron_24.h"
+#include "irl/geometry/polyhedrons/pyramid.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/geometry/polyhedrons/tet.h"
+#include "irl/geometry/polyhedrons/triangular_prism.h"
+#include "irl/parameters/defined_types.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace IRL {
+
+// Sample polyhedra and reconstructions shared by the cutting benchmarks and
+// calibrateCuttingMethods(), so that the tuned CuttingMethodTable is chosen
+// on the same cuts that are benchmarked.
+
+/// \brief Unit-sized polyhedron of each type in irl/geometry/polyhedrons.
+template <class PolyhedronType>
+PolyhedronType makeSamplePolyhedron(void);
+
+template <>
+RectangularCuboid makeSamplePolyhedron<RectangularCuboid>(void);
+template <>
+Hexahedron makeSamplePolyhedron<Hexahedron>(void);
+template <>
+Tet makeSamplePolyhedron<Tet>(void);
+template <>
+TriangularPrism makeSamplePolyhedron<TriangularPrism>(void);
+template <>
+Pyramid makeSamplePolyhedron<Pyramid>(void);
+template <>
+Octahedron makeSamplePolyhedron<Octahedron>(void);
+template <>
+Dodecahedron makeSamplePolyhedron<Dodecahedron>(void);
+template <>
+CappedDodecahedron makeSamplePolyhedron<CappedDodecahedron>(void);
+template <>
+Polyhedron24 makeSamplePolyhedron<Polyhedron24>(void);
+
+/// \brief `a_number_of_separators` separators of `a_number_of_planes`
+/// (1 or 2) random planes passing near `a_centroid`, with a random flip
+/// for two planes. The seed is fixed so every call returns the same sample.
+std::vector<PlanarSeparator> generateSampleSeparators(
+    const Pt& a_centroid, const UnsignedIndex_t a_number_of_separators,
+    const UnsignedIndex_t a_number_of_planes);
+
+}  // namespace IRL
+
+#endif  // IRL_HELPERS_CUTTING_SAMPLES_H_
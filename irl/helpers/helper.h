@@ -22,6 +22,7 @@
 #include "irl/helpers/expression_templates.h"
 #include "irl/parameters/constants.h"
 #include "irl/parameters/defined_types.h"
+#include "irl/parameters/tolerance_context.h"
 
 namespace IRL {
 
@@ -36,11 +36,11 @@ inline double clipBetween(const double a_smallest_value, const double a_value,
 }
 
 inline bool wantPurelyInternal(const double a_internal_fraction) {
-  return a_internal_fraction > global_constants::VF_HIGH;
+  return a_internal_fraction > getVolumeFractionHigh();
 }
 
 inline bool wantPurelyExternal(const double a_internal_fraction) {
-  return a_internal_fraction < global_constants::VF_LOW;
+  return a_internal_fraction < getVolumeFractionLow();
 }
 
 inline void sort3Ascending(double *a_items) {
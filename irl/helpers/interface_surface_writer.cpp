@@ -0,0 +1,377 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/helpers/interface_surface_writer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cstring>
+
+#include "irl/generic_cutting/cut_polygon.h"
+#include "irl/geometry/polygons/polygon.h"
+
+namespace IRL {
+
+namespace {
+
+// Number of entries held in each output buffer before it is written out.
+constexpr std::size_t io_buffer_length = 1 << 16;
+
+constexpr std::uint8_t vtk_polygon = 7;
+
+bool isLittleEndian(void) {
+  const std::uint16_t value = 1;
+  std::uint8_t first_byte;
+  std::memcpy(&first_byte, &value, 1);
+  return first_byte == 1;
+}
+
+// Header for the appended arrays. All numbers are zero-padded to a fixed
+// width, so the header written at the start can be overwritten in place
+// once the sizes are known.
+std::string vtuHeader(const std::uint64_t a_number_of_points,
+                      const std::uint64_t a_number_of_polygons,
+                      const std::uint64_t a_connectivity_offset,
+                      const std::uint64_t a_offsets_offset,
+                      const std::uint64_t a_types_offset) {
+  char buffer[1024];
+  const int length = std::snprintf(
+      buffer, sizeof(buffer),
+      "<?xml version=\"1.0\"?>\n"
+      "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" "
+      "byte_order=\"%s\" header_type=\"UInt64\">\n"
+      "<UnstructuredGrid>\n"
+      "<Piece NumberOfPoints=\"%020" PRIu64 "\" NumberOfCells=\"%020" PRIu64
+      "\">\n"
+      "<Points>\n"
+      "<DataArray type=\"Float64\" NumberOfComponents=\"3\" "
+      "format=\"appended\" offset=\"0\"/>\n"
+      "</Points>\n"
+      "<Cells>\n"
+      "<DataArray type=\"Int64\" Name=\"connectivity\" format=\"appended\" "
+      "offset=\"%020" PRIu64 "\"/>\n"
+      "<DataArray type=\"Int64\" Name=\"offsets\" format=\"appended\" "
+      "offset=\"%020" PRIu64 "\"/>\n"
+      "<DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" "
+      "offset=\"%020" PRIu64 "\"/>\n"
+      "</Cells>\n"
+      "</Piece>\n"
+      "</UnstructuredGrid>\n"
+      "<AppendedData encoding=\"raw\">\n"
+      "_",
+      isLittleEndian() ? "LittleEndian" : "BigEndian", a_number_of_points,
+      a_number_of_polygons, a_connectivity_offset, a_offsets_offset,
+      a_types_offset);
+  assert(length > 0 && length < static_cast<int>(sizeof(buffer)));
+  return std::string(buffer, static_cast<std::size_t>(length));
+}
+
+template <class DataType>
+bool writeArray(const DataType* a_data, const std::size_t a_length,
+                std::FILE* a_file) {
+  return std::fwrite(a_data, sizeof(DataType), a_length, a_file) == a_length;
+}
+
+// Append the contents of a_source, from its start, to a_destination.
+bool copyFile(std::FILE* a_source, std::FILE* a_destination) {
+  if (std::fflush(a_source) != 0 || std::fseek(a_source, 0, SEEK_SET) != 0) {
+    return false;
+  }
+  std::vector<char> buffer(io_buffer_length * sizeof(double));
+  std::size_t bytes_read;
+  while ((bytes_read = std::fread(buffer.data(), 1, buffer.size(),
+                                  a_source)) > 0) {
+    if (!writeArray(buffer.data(), bytes_read, a_destination)) {
+      return false;
+    }
+  }
+  return std::ferror(a_source) == 0;
+}
+
+void closeFile(std::FILE** a_file) {
+  if (*a_file != nullptr) {
+    std::fclose(*a_file);
+    *a_file = nullptr;
+  }
+}
+
+}  // namespace
+
+InterfaceSurfaceWriter::InterfaceSurfaceWriter(
+    const UnsignedIndex_t a_number_of_threads)
+    : pool_m(a_number_of_threads),
+      memory_budget_m(64 << 20),
+      block_m(),
+      welded_vertices_m(),
+      point_buffer_m(),
+      connectivity_buffer_m(),
+      offset_buffer_m(),
+      points_file_m(nullptr),
+      connectivity_file_m(nullptr),
+      offsets_file_m(nullptr),
+      write_failed_m(false),
+      number_of_points_m(0),
+      number_of_polygons_m(0),
+      number_of_connectivity_entries_m(0),
+      number_of_blocks_m(0) {}
+
+void InterfaceSurfaceWriter::setMemoryBudget(const std::size_t a_bytes) {
+  memory_budget_m = a_bytes;
+}
+
+std::size_t InterfaceSurfaceWriter::getMemoryBudget(void) const {
+  return memory_budget_m;
+}
+
+LargeOffsetIndex_t InterfaceSurfaceWriter::getNumberOfPoints(void) const {
+  return number_of_points_m;
+}
+
+LargeOffsetIndex_t InterfaceSurfaceWriter::getNumberOfPolygons(void) const {
+  return number_of_polygons_m;
+}
+
+LargeOffsetIndex_t InterfaceSurfaceWriter::getNumberOfBlocks(void) const {
+  return number_of_blocks_m;
+}
+
+bool InterfaceSurfaceWriter::write(const std::string& a_file_name,
+                                   const UnsignedIndex_t a_nx,
+                                   const UnsignedIndex_t a_ny,
+                                   const UnsignedIndex_t a_nz,
+                                   const double* a_x, const double* a_y,
+                                   const double* a_z,
+                                   const PlanarSeparator* a_reconstructions) {
+  number_of_points_m = 0;
+  number_of_polygons_m = 0;
+  number_of_connectivity_entries_m = 0;
+  number_of_blocks_m = 0;
+  write_failed_m = false;
+  welded_vertices_m.clear();
+  point_buffer_m.clear();
+  connectivity_buffer_m.clear();
+  offset_buffer_m.clear();
+  point_buffer_m.reserve(3 * io_buffer_length);
+  connectivity_buffer_m.reserve(io_buffer_length);
+  offset_buffer_m.reserve(io_buffer_length);
+
+  points_file_m = std::fopen(a_file_name.c_str(), "wb");
+  connectivity_file_m = std::tmpfile();
+  offsets_file_m = std::tmpfile();
+  if (points_file_m == nullptr || connectivity_file_m == nullptr ||
+      offsets_file_m == nullptr) {
+    closeFile(&points_file_m);
+    closeFile(&connectivity_file_m);
+    closeFile(&offsets_file_m);
+    return false;
+  }
+
+  // Placeholder header and size of the points array, overwritten at the
+  // end.
+  const std::string placeholder = vtuHeader(0, 0, 0, 0, 0);
+  const std::uint64_t placeholder_size = 0;
+  write_failed_m =
+      !writeArray(placeholder.data(), placeholder.size(), points_file_m) ||
+      !writeArray(&placeholder_size, 1, points_file_m);
+
+  if (a_nx >= 3 && a_ny >= 3 && a_nz >= 3) {
+    const UnsignedIndex_t row_length = a_nx - 2;
+    const UnsignedIndex_t number_of_rows = a_ny - 2;
+    const UnsignedIndex_t rows_per_block = static_cast<UnsignedIndex_t>(
+        std::max(static_cast<std::size_t>(1),
+                 std::min(static_cast<std::size_t>(number_of_rows),
+                          memory_budget_m /
+                              (sizeof(CellPolygons) * row_length))));
+    block_m.resize(static_cast<std::size_t>(rows_per_block) * row_length);
+
+    for (UnsignedIndex_t k = 1; k < a_nz - 1; ++k) {
+      this->forgetLayersBefore(k - 1);
+      for (UnsignedIndex_t first_row = 1; first_row < a_ny - 1;
+           first_row += rows_per_block) {
+        const UnsignedIndex_t rows =
+            std::min(rows_per_block, a_ny - 1 - first_row);
+        pool_m.parallelFor(
+            rows * row_length, 64,
+            [&](const UnsignedIndex_t a_index, const UnsignedIndex_t) {
+              const UnsignedIndex_t i = 1 + a_index % row_length;
+              const UnsignedIndex_t j = first_row + a_index / row_length;
+              const auto cell = RectangularCuboid::fromBoundingPts(
+                  Pt(a_x[i], a_y[j], a_z[k]),
+                  Pt(a_x[i + 1], a_y[j + 1], a_z[k + 1]));
+              findCellPolygons(
+                  cell,
+                  a_reconstructions[i + a_nx * (j + a_ny * k)],
+                  &block_m[a_index]);
+            });
+        for (UnsignedIndex_t n = 0; n < rows * row_length; ++n) {
+          this->addCellPolygons(block_m[n], k);
+        }
+        ++number_of_blocks_m;
+      }
+    }
+  }
+  this->flushBuffers();
+  welded_vertices_m.clear();
+
+  // Append the staged connectivity and offsets, and the cell types.
+  const std::uint64_t points_size = 3 * sizeof(double) * number_of_points_m;
+  const std::uint64_t connectivity_size =
+      sizeof(std::int64_t) * number_of_connectivity_entries_m;
+  const std::uint64_t offsets_size =
+      sizeof(std::int64_t) * number_of_polygons_m;
+  const std::uint64_t types_size = number_of_polygons_m;
+  write_failed_m = write_failed_m ||
+                   !writeArray(&connectivity_size, 1, points_file_m) ||
+                   !copyFile(connectivity_file_m, points_file_m) ||
+                   !writeArray(&offsets_size, 1, points_file_m) ||
+                   !copyFile(offsets_file_m, points_file_m) ||
+                   !writeArray(&types_size, 1, points_file_m);
+  const std::vector<std::uint8_t> types(
+      std::min(static_cast<std::size_t>(types_size), io_buffer_length),
+      vtk_polygon);
+  for (std::uint64_t written = 0; written < types_size && !write_failed_m;
+       written += types.size()) {
+    const std::size_t length = static_cast<std::size_t>(
+        std::min(static_cast<std::uint64_t>(types.size()),
+                 types_size - written));
+    write_failed_m = !writeArray(types.data(), length, points_file_m);
+  }
+  const std::string footer = "\n</AppendedData>\n</VTKFile>\n";
+  write_failed_m = write_failed_m ||
+                   !writeArray(footer.data(), footer.size(), points_file_m);
+
+  // Overwrite the placeholder header now that the sizes are known.
+  const std::uint64_t connectivity_offset = sizeof(std::uint64_t) + points_size;
+  const std::uint64_t offsets_offset =
+      connectivity_offset + sizeof(std::uint64_t) + connectivity_size;
+  const std::uint64_t types_offset =
+      offsets_offset + sizeof(std::uint64_t) + offsets_size;
+  const std::string header =
+      vtuHeader(number_of_points_m, number_of_polygons_m, connectivity_offset,
+                offsets_offset, types_offset);
+  assert(header.size() == placeholder.size());
+  write_failed_m = write_failed_m ||
+                   std::fseek(points_file_m, 0, SEEK_SET) != 0 ||
+                   !writeArray(header.data(), header.size(), points_file_m) ||
+                   !writeArray(&points_size, 1, points_file_m);
+
+  write_failed_m = std::fclose(points_file_m) != 0 || write_failed_m;
+  points_file_m = nullptr;
+  closeFile(&connectivity_file_m);
+  closeFile(&offsets_file_m);
+  return !write_failed_m;
+}
+
+bool InterfaceSurfaceWriter::WeldKey::operator==(
+    const WeldKey& a_other) const {
+  return bits[0] == a_other.bits[0] && bits[1] == a_other.bits[1] &&
+         bits[2] == a_other.bits[2];
+}
+
+std::size_t InterfaceSurfaceWriter::WeldKeyHash::operator()(
+    const WeldKey& a_key) const {
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  for (UnsignedIndex_t d = 0; d < 3; ++d) {
+    hash = (hash ^ a_key.bits[d]) * 0x100000001b3ULL;
+    hash ^= hash >> 29;
+  }
+  return static_cast<std::size_t>(hash);
+}
+
+void InterfaceSurfaceWriter::findCellPolygons(
+    const RectangularCuboid& a_cell, const PlanarSeparator& a_reconstruction,
+    CellPolygons* a_polygons) {
+  a_polygons->number_of_polygons = 0;
+  for (UnsignedIndex_t p = 0; p < a_reconstruction.getNumberOfPlanes(); ++p) {
+    const Plane& plane = a_reconstruction[p];
+    if (plane.normal()[0] == 0.0 && plane.normal()[1] == 0.0 &&
+        plane.normal()[2] == 0.0) {
+      continue;
+    }
+    const auto polygon = getPlanePolygonFromReconstruction<Polygon>(
+        a_cell, a_reconstruction, plane);
+    const UnsignedIndex_t number_of_vertices = polygon.getNumberOfVertices();
+    if (number_of_vertices < 3) {
+      continue;
+    }
+    assert(number_of_vertices <= max_polygon_vertices);
+    const UnsignedIndex_t polygon_index = a_polygons->number_of_polygons;
+    a_polygons->number_of_vertices[polygon_index] = number_of_vertices;
+    for (UnsignedIndex_t v = 0; v < number_of_vertices; ++v) {
+      a_polygons->vertices[polygon_index][v] = polygon[v];
+    }
+    ++a_polygons->number_of_polygons;
+  }
+}
+
+void InterfaceSurfaceWriter::addCellPolygons(const CellPolygons& a_polygons,
+                                             const UnsignedIndex_t a_layer) {
+  for (UnsignedIndex_t p = 0; p < a_polygons.number_of_polygons; ++p) {
+    for (UnsignedIndex_t v = 0; v < a_polygons.number_of_vertices[p]; ++v) {
+      connectivity_buffer_m.push_back(static_cast<std::int64_t>(
+          this->weldVertex(a_polygons.vertices[p][v], a_layer)));
+    }
+    number_of_connectivity_entries_m += a_polygons.number_of_vertices[p];
+    offset_buffer_m.push_back(
+        static_cast<std::int64_t>(number_of_connectivity_entries_m));
+    ++number_of_polygons_m;
+    if (connectivity_buffer_m.size() >= io_buffer_length ||
+        offset_buffer_m.size() >= io_buffer_length ||
+        point_buffer_m.size() >= 3 * io_buffer_length) {
+      this->flushBuffers();
+    }
+  }
+}
+
+LargeOffsetIndex_t InterfaceSurfaceWriter::weldVertex(
+    const Pt& a_vertex, const UnsignedIndex_t a_layer) {
+  WeldKey key;
+  for (UnsignedIndex_t d = 0; d < 3; ++d) {
+    // Adding 0.0 turns -0.0 into 0.0, so both weld together.
+    const double coordinate = a_vertex[d] + 0.0;
+    std::memcpy(&key.bits[d], &coordinate, sizeof(double));
+  }
+  const auto insertion =
+      welded_vertices_m.emplace(key, WeldEntry{number_of_points_m, a_layer});
+  if (!insertion.second) {
+    insertion.first->second.layer = a_layer;
+    return insertion.first->second.index;
+  }
+  point_buffer_m.push_back(a_vertex[0]);
+  point_buffer_m.push_back(a_vertex[1]);
+  point_buffer_m.push_back(a_vertex[2]);
+  return number_of_points_m++;
+}
+
+void InterfaceSurfaceWriter::forgetLayersBefore(const UnsignedIndex_t a_layer) {
+  for (auto it = welded_vertices_m.begin(); it != welded_vertices_m.end();) {
+    if (it->second.layer < a_layer) {
+      it = welded_vertices_m.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void InterfaceSurfaceWriter::flushBuffers(void) {
+  write_failed_m =
+      write_failed_m ||
+      !writeArray(point_buffer_m.data(), point_buffer_m.size(),
+                  points_file_m) ||
+      !writeArray(connectivity_buffer_m.data(), connectivity_buffer_m.size(),
+                  connectivity_file_m) ||
+      !writeArray(offset_buffer_m.data(), offset_buffer_m.size(),
+                  offsets_file_m);
+  point_buffer_m.clear();
+  connectivity_buffer_m.clear();
+  offset_buffer_m.clear();
+}
+
+}  // namespace IRL
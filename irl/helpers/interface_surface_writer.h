@@ -0,0 +1,150 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_HELPERS_INTERFACE_SURFACE_WRITER_H_
+#define IRL_HELPERS_INTERFACE_SURFACE_WRITER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "external/flat_hash_map.hpp"
+
+#include "irl/geometry/general/pt.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/helpers/work_stealing_thread_pool.h"
+#include "irl/parameters/constants.h"
+#include "irl/parameters/defined_types.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace IRL {
+
+/// \brief Writes the interface polygons of a mesh of PlanarSeparators to
+/// a binary VTK unstructured grid (.vtu) file.
+///
+/// The mesh is walked one block of rows at a time. The polygons of every
+/// cell in a block are found in parallel on a WorkStealingThreadPool, and
+/// then welded and streamed to the file in cell order, so the output does
+/// not depend on the number of threads. Vertices with identical
+/// coordinates are written once, whether they are shared by the planes of
+/// one cell or by neighboring cells.
+///
+/// Points are written as Float64 and connectivity and offsets as Int64,
+/// in VTK's appended raw encoding with 64-bit headers. Connectivity and
+/// offsets are staged in temporary files from `std::tmpfile()` until all
+/// points are written.
+///
+/// Memory use is bounded by the memory budget, which limits the number of
+/// cells in a block (down to a single row), plus the welding table, which
+/// holds the vertices of the current and previous layers of cells.
+class InterfaceSurfaceWriter {
+ public:
+  /// \brief Construct with `a_number_of_threads` threads, including the
+  /// calling thread.
+  explicit InterfaceSurfaceWriter(const UnsignedIndex_t a_number_of_threads);
+
+  /// \brief Set the number of bytes used to hold the polygons of a block
+  /// of cells. Defaults to 64 MiB.
+  void setMemoryBudget(const std::size_t a_bytes);
+
+  /// \brief Return the memory budget in bytes.
+  std::size_t getMemoryBudget(void) const;
+
+  /// \brief Write the interface of a rectilinear mesh of `a_nx` x `a_ny` x
+  /// `a_nz` cells to `a_file_name`, replacing it. Returns false if the
+  /// file could not be written.
+  ///
+  /// The mesh is laid out as for MeshReconstructor::reconstruct. The
+  /// outermost layer of cells is treated as ghost cells and is not
+  /// written.
+  bool write(const std::string& a_file_name, const UnsignedIndex_t a_nx,
+             const UnsignedIndex_t a_ny, const UnsignedIndex_t a_nz,
+             const double* a_x, const double* a_y, const double* a_z,
+             const PlanarSeparator* a_reconstructions);
+
+  /// \brief Number of welded points written by the last call to write().
+  LargeOffsetIndex_t getNumberOfPoints(void) const;
+
+  /// \brief Number of polygons written by the last call to write().
+  LargeOffsetIndex_t getNumberOfPolygons(void) const;
+
+  /// \brief Number of blocks of rows the last call to write() was split
+  /// into.
+  LargeOffsetIndex_t getNumberOfBlocks(void) const;
+
+  InterfaceSurfaceWriter(const InterfaceSurfaceWriter& other) = delete;
+  InterfaceSurfaceWriter& operator=(const InterfaceSurfaceWriter& other) =
+      delete;
+
+  ~InterfaceSurfaceWriter(void) = default;
+
+ private:
+  /// \brief Most vertices of a polygon of one plane, a hexahedron cut by
+  /// the plane and then by each of the other planes.
+  static constexpr UnsignedIndex_t max_polygon_vertices =
+      6 + global_constants::MAX_PLANAR_SEPARATOR_PLANES - 1;
+
+  struct CellPolygons {
+    UnsignedIndex_t number_of_polygons;
+    UnsignedIndex_t
+        number_of_vertices[global_constants::MAX_PLANAR_SEPARATOR_PLANES];
+    Pt vertices[global_constants::MAX_PLANAR_SEPARATOR_PLANES]
+               [max_polygon_vertices];
+  };
+
+  struct WeldKey {
+    std::uint64_t bits[3];
+    bool operator==(const WeldKey& a_other) const;
+  };
+
+  struct WeldKeyHash {
+    std::size_t operator()(const WeldKey& a_key) const;
+  };
+
+  struct WeldEntry {
+    LargeOffsetIndex_t index;
+    UnsignedIndex_t layer;
+  };
+
+  static void findCellPolygons(const RectangularCuboid& a_cell,
+                               const PlanarSeparator& a_reconstruction,
+                               CellPolygons* a_polygons);
+
+  void addCellPolygons(const CellPolygons& a_polygons,
+                       const UnsignedIndex_t a_layer);
+
+  LargeOffsetIndex_t weldVertex(const Pt& a_vertex,
+                                const UnsignedIndex_t a_layer);
+
+  void forgetLayersBefore(const UnsignedIndex_t a_layer);
+
+  void flushBuffers(void);
+
+  WorkStealingThreadPool pool_m;
+  std::size_t memory_budget_m;
+  std::vector<CellPolygons> block_m;
+  ska::flat_hash_map<WeldKey, WeldEntry, WeldKeyHash> welded_vertices_m;
+  std::vector<double> point_buffer_m;
+  std::vector<std::int64_t> connectivity_buffer_m;
+  std::vector<std::int64_t> offset_buffer_m;
+  std::FILE* points_file_m;
+  std::FILE* connectivity_file_m;
+  std::FILE* offsets_file_m;
+  bool write_failed_m;
+  LargeOffsetIndex_t number_of_points_m;
+  LargeOffsetIndex_t number_of_polygons_m;
+  LargeOffsetIndex_t number_of_connectivity_entries_m;
+  LargeOffsetIndex_t number_of_blocks_m;
+};
+
+}  // namespace IRL
+
+#endif  // IRL_HELPERS_INTERFACE_SURFACE_WRITER_H_
@@ -0,0 +1,114 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/helpers/telemetry.h"
+
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace IRL {
+
+namespace telemetry_details {
+
+// Records are never freed, so the counts of threads that have exited
+// still appear in the report.
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadRecord>> records;
+};
+
+static Registry& getRegistry(void) {
+  static Registry registry;
+  return registry;
+}
+
+static void zeroRecord(ThreadRecord* a_record) {
+  for (auto& value : a_record->counters) {
+    value.store(0, std::memory_order_relaxed);
+  }
+  for (UnsignedIndex_t n = 0; n < telemetry_timers; ++n) {
+    a_record->timer_calls[n].store(0, std::memory_order_relaxed);
+    a_record->timer_ticks[n].store(0, std::memory_order_relaxed);
+  }
+}
+
+ThreadRecord* registerThread(void) {
+  auto record = std::make_unique<ThreadRecord>();
+  zeroRecord(record.get());
+  auto& registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.records.push_back(std::move(record));
+  return registry.records.back().get();
+}
+
+}  // namespace telemetry_details
+
+TelemetryReport getTelemetryReport(void) {
+  TelemetryReport report;
+  auto& registry = telemetry_details::getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const auto& record : registry.records) {
+    for (UnsignedIndex_t n = 0; n < telemetry_counters; ++n) {
+      report.counters[n] += record->counters[n].load(std::memory_order_relaxed);
+    }
+    for (UnsignedIndex_t n = 0; n < telemetry_timers; ++n) {
+      report.timer_calls[n] +=
+          record->timer_calls[n].load(std::memory_order_relaxed);
+      report.timer_ticks[n] +=
+          record->timer_ticks[n].load(std::memory_order_relaxed);
+    }
+  }
+  report.number_of_threads =
+      static_cast<UnsignedIndex_t>(registry.records.size());
+  return report;
+}
+
+void resetTelemetry(void) {
+  auto& registry = telemetry_details::getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto& record : registry.records) {
+    telemetry_details::zeroRecord(record.get());
+  }
+}
+
+std::ostream& operator<<(std::ostream& out, const TelemetryReport& a_report) {
+  out << "IRL telemetry (" << a_report.number_of_threads << " threads)"
+      << (telemetry_enabled ? "" : ", compiled out") << '\n';
+  for (UnsignedIndex_t n = 0; n < telemetry_counters; ++n) {
+    out << "  " << getTelemetryName(static_cast<TelemetryCounter>(n)) << ": "
+        << a_report.counters[n] << '\n';
+  }
+  for (UnsignedIndex_t n = 0; n < telemetry_timers; ++n) {
+    out << "  " << getTelemetryName(static_cast<TelemetryTimer>(n)) << ": "
+        << a_report.timer_calls[n] << " calls, " << a_report.timer_ticks[n]
+        << " ticks" << '\n';
+  }
+  return out;
+}
+
+const char* getTelemetryName(const TelemetryCounter a_counter) {
+  static constexpr std::array<const char*, telemetry_counters> names{
+      {"HalfEdgePolytopeBuilds", "PlaneClips", "LinkTraversals",
+       "SimplexDecompositions", "DistanceSolverIterations",
+       "LevenbergMarquardtIterations", "BFGSIterations",
+       "HalfEdgeTemplateRebuilds"}};
+  assert(static_cast<UnsignedIndex_t>(a_counter) < telemetry_counters);
+  return names[static_cast<UnsignedIndex_t>(a_counter)];
+}
+
+const char* getTelemetryName(const TelemetryTimer a_timer) {
+  static constexpr std::array<const char*, telemetry_timers> names{
+      {"Cutting", "DistanceSolver", "LevenbergMarquardt", "BFGS"}};
+  assert(static_cast<UnsignedIndex_t>(a_timer) < telemetry_timers);
+  return names[static_cast<UnsignedIndex_t>(a_timer)];
+}
+
+}  // namespace IRL
@@ -0,0 +1,129 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_HELPERS_TELEMETRY_H_
+#define IRL_HELPERS_TELEMETRY_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+#include "irl/parameters/defined_types.h"
+
+namespace IRL {
+/// \file telemetry.h
+///
+/// Counters and timers for the hot paths of IRL (cutting, distance
+/// finding and optimization). They are only compiled in when
+/// `IRL_ENABLE_TELEMETRY` is defined, which is done by configuring
+/// with `-DIRL_ENABLE_TELEMETRY=ON`. Otherwise `countTelemetry(...)` and
+/// `TelemetryScopedTimer` are empty and the report is always zero.
+///
+/// Each thread owns its own block of counters, so counting never takes a
+/// lock or a locked instruction. Blocks are only summed together when
+/// `getTelemetryReport()` is called, and the counts of threads that have
+/// exited are kept.
+
+/// \brief Events that are counted.
+enum class TelemetryCounter : UnsignedIndex_t {
+  HalfEdgePolytopeBuilds = 0,  ///< Half-edge structures set up for cutting.
+  PlaneClips,                  ///< Half-edge polytopes split or truncated.
+  LinkTraversals,              ///< Reconstruction links visited.
+  SimplexDecompositions,       ///< Polytopes decomposed into simplices.
+  DistanceSolverIterations,    ///< Iterations of plane-distance solvers.
+  LevenbergMarquardtIterations,
+  BFGSIterations,
+  HalfEdgeTemplateRebuilds,    ///< Invalidated half-edge templates rebuilt.
+  NumberOfCounters
+};
+
+/// \brief Regions that are timed. Timers are inclusive, so a region that
+/// calls another (such as an optimization that cuts) includes its time.
+enum class TelemetryTimer : UnsignedIndex_t {
+  Cutting = 0,  ///< Top-level `getVolumeMoments(...)` calls.
+  DistanceSolver,
+  LevenbergMarquardt,
+  BFGS,
+  NumberOfTimers
+};
+
+static constexpr UnsignedIndex_t telemetry_counters =
+    static_cast<UnsignedIndex_t>(TelemetryCounter::NumberOfCounters);
+static constexpr UnsignedIndex_t telemetry_timers =
+    static_cast<UnsignedIndex_t>(TelemetryTimer::NumberOfTimers);
+
+#ifdef IRL_ENABLE_TELEMETRY
+static constexpr bool telemetry_enabled = true;
+#else
+static constexpr bool telemetry_enabled = false;
+#endif
+
+/// \brief Sum of the counters and timers of all threads.
+///
+/// Timer ticks come from the time-stamp counter on x86 and from
+/// `std::chrono::steady_clock` (in nanoseconds) elsewhere.
+struct TelemetryReport {
+  std::array<std::uint64_t, telemetry_counters> counters = {};
+  std::array<std::uint64_t, telemetry_timers> timer_calls = {};
+  std::array<std::uint64_t, telemetry_timers> timer_ticks = {};
+  /// \brief Number of threads that have recorded anything.
+  UnsignedIndex_t number_of_threads = 0;
+
+  std::uint64_t count(const TelemetryCounter a_counter) const;
+  std::uint64_t calls(const TelemetryTimer a_timer) const;
+  std::uint64_t ticks(const TelemetryTimer a_timer) const;
+};
+
+/// \brief Sum the counters and timers of every thread.
+TelemetryReport getTelemetryReport(void);
+
+/// \brief Set all counters and timers to zero. Should not be called while
+/// other threads are running IRL, since their updates may be lost.
+void resetTelemetry(void);
+
+/// \brief Write one line per counter and timer to `out`.
+std::ostream& operator<<(std::ostream& out, const TelemetryReport& a_report);
+
+/// \brief Name of a counter, e.g. "PlaneClips".
+const char* getTelemetryName(const TelemetryCounter a_counter);
+
+/// \brief Name of a timer, e.g. "Cutting".
+const char* getTelemetryName(const TelemetryTimer a_timer);
+
+/// \brief Current value of the clock used by the timers.
+inline std::uint64_t readTelemetryClock(void);
+
+/// \brief Add `a_amount` to `a_counter` for the calling thread.
+inline void countTelemetry(const TelemetryCounter a_counter,
+                           const std::uint64_t a_amount = 1);
+
+/// \brief Times its own lifetime under `a_timer`.
+class TelemetryScopedTimer {
+ public:
+  TelemetryScopedTimer(void) = delete;
+  explicit TelemetryScopedTimer(const TelemetryTimer a_timer);
+
+  TelemetryScopedTimer(const TelemetryScopedTimer& other) = delete;
+  TelemetryScopedTimer& operator=(const TelemetryScopedTimer& other) = delete;
+
+  ~TelemetryScopedTimer(void);
+
+ private:
+#ifdef IRL_ENABLE_TELEMETRY
+  TelemetryTimer timer_m;
+  std::uint64_t start_m;
+#endif
+};
+
+}  // namespace IRL
+
+#include "irl/helpers/telemetry.tpp"
+
+#endif  // IRL_HELPERS_TELEMETRY_H_
@@ -0,0 +1,106 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_HELPERS_TELEMETRY_TPP_
+#define IRL_HELPERS_TELEMETRY_TPP_
+
+#if defined(IRL_ENABLE_TELEMETRY) && (defined(__x86_64__) || defined(__i386__))
+#define IRL_TELEMETRY_USE_RDTSC
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+namespace IRL {
+
+namespace telemetry_details {
+
+/// \brief Counters and timers owned by one thread. Only the owning thread
+/// writes them, so plain relaxed loads and stores are enough; they are
+/// atomic so that `getTelemetryReport()` can read them from another thread.
+struct alignas(64) ThreadRecord {
+  std::array<std::atomic<std::uint64_t>, telemetry_counters> counters;
+  std::array<std::atomic<std::uint64_t>, telemetry_timers> timer_calls;
+  std::array<std::atomic<std::uint64_t>, telemetry_timers> timer_ticks;
+};
+
+/// \brief Allocate a zeroed record and add it to the list summed by
+/// `getTelemetryReport()`. Called once per thread.
+ThreadRecord* registerThread(void);
+
+inline ThreadRecord& getThreadRecord(void) {
+  thread_local ThreadRecord* record = registerThread();
+  return *record;
+}
+
+inline void addTo(std::atomic<std::uint64_t>* a_value,
+                  const std::uint64_t a_amount) {
+  a_value->store(a_value->load(std::memory_order_relaxed) + a_amount,
+                 std::memory_order_relaxed);
+}
+
+}  // namespace telemetry_details
+
+inline std::uint64_t TelemetryReport::count(
+    const TelemetryCounter a_counter) const {
+  return counters[static_cast<UnsignedIndex_t>(a_counter)];
+}
+
+inline std::uint64_t TelemetryReport::calls(
+    const TelemetryTimer a_timer) const {
+  return timer_calls[static_cast<UnsignedIndex_t>(a_timer)];
+}
+
+inline std::uint64_t TelemetryReport::ticks(
+    const TelemetryTimer a_timer) const {
+  return timer_ticks[static_cast<UnsignedIndex_t>(a_timer)];
+}
+
+inline std::uint64_t readTelemetryClock(void) {
+#ifdef IRL_TELEMETRY_USE_RDTSC
+  return __rdtsc();
+#else
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+#endif
+}
+
+inline void countTelemetry([[maybe_unused]] const TelemetryCounter a_counter,
+                           [[maybe_unused]] const std::uint64_t a_amount) {
+#ifdef IRL_ENABLE_TELEMETRY
+  telemetry_details::addTo(&telemetry_details::getThreadRecord()
+                                .counters[static_cast<UnsignedIndex_t>(
+                                    a_counter)],
+                           a_amount);
+#endif
+}
+
+inline TelemetryScopedTimer::TelemetryScopedTimer(
+    [[maybe_unused]] const TelemetryTimer a_timer)
+#ifdef IRL_ENABLE_TELEMETRY
+    : timer_m(a_timer), start_m(readTelemetryClock())
+#endif
+{
+}
+
+inline TelemetryScopedTimer::~TelemetryScopedTimer(void) {
+#ifdef IRL_ENABLE_TELEMETRY
+  const std::uint64_t elapsed = readTelemetryClock() - start_m;
+  auto& record = telemetry_details::getThreadRecord();
+  const auto timer = static_cast<UnsignedIndex_t>(timer_m);
+  telemetry_details::addTo(&record.timer_calls[timer], 1);
+  telemetry_details::addTo(&record.timer_ticks[timer], elapsed);
+#endif
+}
+
+}  // namespace IRL
+
+#endif  // IRL_HELPERS_TELEMETRY_TPP_
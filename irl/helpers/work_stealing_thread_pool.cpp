@@ -0,0 +1,196 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/helpers/work_stealing_thread_pool.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace IRL {
+
+namespace work_stealing_thread_pool_details {
+static std::uint64_t packRange(const UnsignedIndex_t a_begin,
+                               const UnsignedIndex_t a_end) {
+  return (static_cast<std::uint64_t>(a_begin) << 32) |
+         static_cast<std::uint64_t>(a_end);
+}
+
+static UnsignedIndex_t rangeBegin(const std::uint64_t a_packed_range) {
+  return static_cast<UnsignedIndex_t>(a_packed_range >> 32);
+}
+
+static UnsignedIndex_t rangeEnd(const std::uint64_t a_packed_range) {
+  return static_cast<UnsignedIndex_t>(a_packed_range & 0xFFFFFFFFu);
+}
+}  // namespace work_stealing_thread_pool_details
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+    const UnsignedIndex_t a_number_of_threads)
+    : number_of_threads_m{std::max(static_cast<UnsignedIndex_t>(1),
+                                   a_number_of_threads)},
+      ranges_m{new WorkRange[number_of_threads_m]},
+      generation_m{0},
+      number_of_busy_workers_m{0},
+      shutdown_m{false},
+      body_m{nullptr},
+      grain_size_m{1},
+      tolerance_context_m{nullptr} {
+  for (UnsignedIndex_t t = 0; t < number_of_threads_m; ++t) {
+    ranges_m[t].packed_range.store(0, std::memory_order_relaxed);
+  }
+  workers_m.reserve(number_of_threads_m - 1);
+  for (UnsignedIndex_t t = 1; t < number_of_threads_m; ++t) {
+    workers_m.emplace_back(&WorkStealingThreadPool::workerLoop, this, t);
+  }
+}
+
+UnsignedIndex_t WorkStealingThreadPool::getNumberOfThreads(void) const {
+  return number_of_threads_m;
+}
+
+void WorkStealingThreadPool::parallelFor(const UnsignedIndex_t a_size,
+                                         const UnsignedIndex_t a_grain_size,
+                                         const BodyType& a_body) {
+  using namespace work_stealing_thread_pool_details;
+  if (a_size == 0) {
+    return;
+  }
+  const UnsignedIndex_t per_thread = a_size / number_of_threads_m;
+  const UnsignedIndex_t remainder = a_size % number_of_threads_m;
+  UnsignedIndex_t begin = 0;
+  for (UnsignedIndex_t t = 0; t < number_of_threads_m; ++t) {
+    const UnsignedIndex_t end = begin + per_thread + (t < remainder ? 1 : 0);
+    ranges_m[t].packed_range.store(packRange(begin, end),
+                                   std::memory_order_relaxed);
+    begin = end;
+  }
+  body_m = &a_body;
+  grain_size_m = std::max(static_cast<UnsignedIndex_t>(1), a_grain_size);
+  tolerance_context_m = getInstalledToleranceContext();
+
+  if (!workers_m.empty()) {
+    std::lock_guard<std::mutex> lock(mutex_m);
+    number_of_busy_workers_m = static_cast<UnsignedIndex_t>(workers_m.size());
+    ++generation_m;
+  }
+  start_condition_m.notify_all();
+
+  this->executeRanges(0);
+
+  if (!workers_m.empty()) {
+    std::unique_lock<std::mutex> lock(mutex_m);
+    finish_condition_m.wait(lock,
+                            [this]() { return number_of_busy_workers_m == 0; });
+  }
+  body_m = nullptr;
+  tolerance_context_m = nullptr;
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool(void) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_m);
+    shutdown_m = true;
+  }
+  start_condition_m.notify_all();
+  for (auto& worker : workers_m) {
+    worker.join();
+  }
+}
+
+void WorkStealingThreadPool::workerLoop(const UnsignedIndex_t a_thread) {
+  std::size_t last_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_m);
+      start_condition_m.wait(lock, [this, last_generation]() {
+        return shutdown_m || generation_m != last_generation;
+      });
+      if (shutdown_m) {
+        return;
+      }
+      last_generation = generation_m;
+    }
+    // Tolerances are read from thread-local storage, so the caller's
+    // context must be installed here as well.
+    if (tolerance_context_m != nullptr) {
+      ScopedToleranceContext scope(*tolerance_context_m);
+      this->executeRanges(a_thread);
+    } else {
+      this->executeRanges(a_thread);
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_m);
+      --number_of_busy_workers_m;
+    }
+    finish_condition_m.notify_one();
+  }
+}
+
+void WorkStealingThreadPool::executeRanges(const UnsignedIndex_t a_thread) {
+  UnsignedIndex_t begin, end;
+  do {
+    while (this->popFromOwnRange(a_thread, &begin, &end)) {
+      for (UnsignedIndex_t n = begin; n < end; ++n) {
+        (*body_m)(n, a_thread);
+      }
+    }
+  } while (this->stealIntoOwnRange(a_thread));
+}
+
+bool WorkStealingThreadPool::popFromOwnRange(const UnsignedIndex_t a_thread,
+                                             UnsignedIndex_t* a_begin,
+                                             UnsignedIndex_t* a_end) {
+  using namespace work_stealing_thread_pool_details;
+  auto& range = ranges_m[a_thread].packed_range;
+  std::uint64_t current = range.load(std::memory_order_acquire);
+  while (true) {
+    const UnsignedIndex_t begin = rangeBegin(current);
+    const UnsignedIndex_t end = rangeEnd(current);
+    if (begin >= end) {
+      return false;
+    }
+    const UnsignedIndex_t new_begin = std::min(end, begin + grain_size_m);
+    if (range.compare_exchange_weak(current, packRange(new_begin, end),
+                                    std::memory_order_acq_rel)) {
+      *a_begin = begin;
+      *a_end = new_begin;
+      return true;
+    }
+  }
+}
+
+bool WorkStealingThreadPool::stealIntoOwnRange(const UnsignedIndex_t a_thread) {
+  using namespace work_stealing_thread_pool_details;
+  // Every index is handed out exactly once and ranges only shrink until
+  // their owner replaces an empty range, so a packed value is never
+  // repeated and the compare-and-swap below cannot suffer from ABA.
+  for (UnsignedIndex_t offset = 1; offset < number_of_threads_m; ++offset) {
+    const UnsignedIndex_t victim = (a_thread + offset) % number_of_threads_m;
+    auto& range = ranges_m[victim].packed_range;
+    std::uint64_t current = range.load(std::memory_order_acquire);
+    while (true) {
+      const UnsignedIndex_t begin = rangeBegin(current);
+      const UnsignedIndex_t end = rangeEnd(current);
+      if (begin >= end) {
+        break;
+      }
+      // Leave the victim the front half, which it is working towards.
+      const UnsignedIndex_t middle = begin + (end - begin) / 2;
+      if (range.compare_exchange_weak(current, packRange(begin, middle),
+                                      std::memory_order_acq_rel)) {
+        ranges_m[a_thread].packed_range.store(packRange(middle, end),
+                                              std::memory_order_release);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace IRL
@@ -0,0 +1,101 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_HELPERS_WORK_STEALING_THREAD_POOL_H_
+#define IRL_HELPERS_WORK_STEALING_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "irl/parameters/defined_types.h"
+#include "irl/parameters/tolerance_context.h"
+
+namespace IRL {
+
+/// \brief Persistent pool of threads that execute index ranges with
+/// work stealing.
+///
+/// `parallelFor` splits [0, size) evenly between the threads. Each thread
+/// takes `grain size` indices at a time from the front of its own range, and
+/// once that is empty steals the back half of another thread's range. This
+/// keeps all threads busy when the cost per index varies by orders of
+/// magnitude, such as reconstructing a mesh where most cells are pure.
+///
+/// The calling thread takes part in the work as thread 0, so a pool of one
+/// thread runs everything inline without creating any threads.
+class WorkStealingThreadPool {
+ public:
+  using BodyType = std::function<void(const UnsignedIndex_t a_index,
+                                      const UnsignedIndex_t a_thread)>;
+
+  WorkStealingThreadPool(void) = delete;
+
+  /// \brief Create a pool of `a_number_of_threads` threads (at least one),
+  /// including the thread that will call `parallelFor`.
+  explicit WorkStealingThreadPool(const UnsignedIndex_t a_number_of_threads);
+
+  /// \brief Number of threads work is shared between.
+  UnsignedIndex_t getNumberOfThreads(void) const;
+
+  /// \brief Call `a_body(index, thread)` for every index in [0, a_size),
+  /// returning once all have completed. `thread` is in
+  /// [0, getNumberOfThreads()) and can be used to select per-thread
+  /// scratch storage. The ToleranceContext installed on the calling thread,
+  /// if any, is installed on every other thread while it runs `a_body`.
+  /// Must not be called concurrently or recursively.
+  void parallelFor(const UnsignedIndex_t a_size,
+                   const UnsignedIndex_t a_grain_size, const BodyType& a_body);
+
+  WorkStealingThreadPool(const WorkStealingThreadPool& other) = delete;
+  WorkStealingThreadPool& operator=(const WorkStealingThreadPool& other) =
+      delete;
+
+  ~WorkStealingThreadPool(void);
+
+ private:
+  // Range [begin, end) packed as (begin << 32 | end) so that both ends
+  // can be updated with a single compare-and-swap.
+  struct alignas(64) WorkRange {
+    std::atomic<std::uint64_t> packed_range;
+  };
+
+  void workerLoop(const UnsignedIndex_t a_thread);
+
+  void executeRanges(const UnsignedIndex_t a_thread);
+
+  bool popFromOwnRange(const UnsignedIndex_t a_thread, UnsignedIndex_t* a_begin,
+                       UnsignedIndex_t* a_end);
+
+  bool stealIntoOwnRange(const UnsignedIndex_t a_thread);
+
+  UnsignedIndex_t number_of_threads_m;
+  std::unique_ptr<WorkRange[]> ranges_m;
+  std::vector<std::thread> workers_m;
+
+  std::mutex mutex_m;
+  std::condition_variable start_condition_m;
+  std::condition_variable finish_condition_m;
+  std::size_t generation_m;
+  UnsignedIndex_t number_of_busy_workers_m;
+  bool shutdown_m;
+
+  const BodyType* body_m;
+  UnsignedIndex_t grain_size_m;
+  const ToleranceContext* tolerance_context_m;
+};
+
+}  // namespace IRL
+
+#endif  // IRL_HELPERS_WORK_STEALING_THREAD_POOL_H_
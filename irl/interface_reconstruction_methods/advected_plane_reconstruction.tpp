@@ -106,8 +106,7 @@ PlanarSeparator AdvectedPlaneReconstruction::constructSeparatorAttempt(
       Plane(a_normal_1, a_normal_1 * a_pt_1), a_flip_cut);
   // Find volume conserving distance
   IterativeSolverForDistance<ReconstructionDefaultCuttingMethod, CellType>
-      solver(a_cell, a_target_volume_fraction,
-             global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE,
+      solver(a_cell, a_target_volume_fraction, getVolumeFractionTolerance(),
              attempted_separator);
   attempted_separator.setDistances(solver.getDistances());
   // Clean the reconstruction
@@ -131,22 +130,22 @@ void AdvectedPlaneReconstruction::checkIfBest(
     auto cell_volume = cell_grouped_moments.getStoredMoments()[0].volume() +
                        cell_grouped_moments.getStoredMoments()[1].volume();
     auto cell_VF = svm[0].volume() / cell_volume;
-    if (cell_VF < global_constants::VF_LOW) {
+    if (cell_VF < getVolumeFractionLow()) {
       svm[0].centroid() =
           a_neighborhood.getCenterCellStoredMoments()[0].centroid();
     }
-    if (cell_VF > global_constants::VF_HIGH) {
+    if (cell_VF > getVolumeFractionHigh()) {
       svm[1].centroid() =
           a_neighborhood.getCenterCellStoredMoments()[1].centroid();
     }
 
     if (cell_grouped_moments.getStoredMoments()[0].volume() / cell_volume >
-        global_constants::VF_LOW) {
+        getVolumeFractionLow()) {
       err += magnitude(cell_grouped_moments.getStoredMoments()[0].centroid() -
                        svm[0].centroid()); // Liquid centroid contribution
     }
     if (cell_grouped_moments.getStoredMoments()[1].volume() / cell_volume >
-        global_constants::VF_LOW) {
+        getVolumeFractionLow()) {
       err += magnitude(cell_grouped_moments.getStoredMoments()[1].centroid() -
                        svm[1].centroid()); // Gas centroid contribution
     }
@@ -277,22 +276,22 @@ void AdvectedPlaneReconstructionDebug::checkIfBest(
     auto cell_volume = cell_grouped_moments.getStoredMoments()[0].volume() +
                        cell_grouped_moments.getStoredMoments()[1].volume();
     auto cell_VF = svm[0].volume() / cell_volume;
-    if (cell_VF < global_constants::VF_LOW) {
+    if (cell_VF < getVolumeFractionLow()) {
       svm[0].centroid() =
           a_neighborhood.getCenterCellStoredMoments()[0].centroid();
     }
-    if (cell_VF > global_constants::VF_HIGH) {
+    if (cell_VF > getVolumeFractionHigh()) {
       svm[1].centroid() =
           a_neighborhood.getCenterCellStoredMoments()[1].centroid();
     }
 
     if (cell_grouped_moments.getStoredMoments()[0].volume() / cell_volume >
-        global_constants::VF_LOW) {
+        getVolumeFractionLow()) {
       err += magnitude(cell_grouped_moments.getStoredMoments()[0].centroid() -
                        svm[0].centroid()); // Liquid centroid contribution
     }
     if (cell_grouped_moments.getStoredMoments()[1].volume() / cell_volume >
-        global_constants::VF_LOW) {
+        getVolumeFractionLow()) {
       err += magnitude(cell_grouped_moments.getStoredMoments()[1].centroid() -
                        svm[1].centroid()); // Gas centroid contribution
     }
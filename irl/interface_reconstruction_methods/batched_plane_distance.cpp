@@ -0,0 +1,121 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/interface_reconstruction_methods/batched_plane_distance.h"
+
+#include "irl/helpers/helper.h"
+
+namespace IRL {
+
+namespace batched_plane_distance_details {
+
+// Root of the cubic in the Scardovelli & Zaleski regimes that require one.
+static inline double getCubicRoot(const double a_a0, const double a_a1,
+                                  const double a_a2) {
+  const double p0 = std::max(-(a_a1 / 3.0 - a_a2 * a_a2 / 9.0), 0.0);
+  const double q0 =
+      (a_a1 * a_a2 - 3.0 * a_a0) / 6.0 - a_a2 * a_a2 * a_a2 / 27.0;
+  const double theta =
+      std::acos(clipBetween(-1.0, q0 / safelyTiny(std::sqrt(p0 * p0 * p0)),
+                            1.0)) /
+      3.0;
+  return std::sqrt(p0) *
+             (std::sqrt(3.0) * std::sin(theta) - std::cos(theta)) -
+         a_a2 / 3.0;
+}
+
+// Lane-wise version of the closed form used in findDistanceOnePlane for
+// RectangularCuboid. All regimes are evaluated and the matching one is
+// selected, so every lane follows the same instruction stream. The closed
+// form is exact, so the tolerance taken for the common signature is unused.
+void solveBatch(const CellLanes<RectangularCuboid>& a_cells,
+                const LaneArray& a_volume_fractions,
+                const NormalLanes& a_normals,
+                [[maybe_unused]] const double a_volume_fraction_tolerance,
+                LaneArray* a_distances) {
+  static constexpr UnsignedIndex_t lanes = batched_plane_distance_lanes;
+  // Gather the cell extents and normals as structures of arrays.
+  std::array<LaneArray, 3> mm;
+  LaneArray centroid_distance;
+  for (UnsignedIndex_t l = 0; l < lanes; ++l) {
+    const RectangularCuboid& cell = *a_cells[l];
+    const Normal& normal = *a_normals[l];
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      mm[d][l] = normal[d] * cell.calculateSideLength(d);
+    }
+    centroid_distance[l] = normal * cell.calculateCentroid();
+  }
+
+  auto& distance = *a_distances;
+  for (UnsignedIndex_t l = 0; l < lanes; ++l) {
+    const double norm =
+        std::fabs(mm[0][l]) + std::fabs(mm[1][l]) + std::fabs(mm[2][l]);
+    const double mm0 = mm[0][l] / norm;
+    const double mm1 = mm[1][l] / norm;
+    const double mm2 = mm[2][l] / norm;
+    const double factor =
+        std::min(mm0, 0.0) + std::min(mm1, 0.0) + std::min(mm2, 0.0);
+    const double volume_fraction = a_volume_fractions[l];
+    const double VOFo =
+        volume_fraction > 0.5 ? 1.0 - volume_fraction : volume_fraction;
+
+    // Sorted absolute values of mm.
+    const double abs0 = std::fabs(mm0);
+    const double abs1 = std::fabs(mm1);
+    const double abs2 = std::fabs(mm2);
+    const double m0 = std::min(std::min(abs0, abs1), abs2);
+    const double m2 = std::max(std::max(abs0, abs1), abs2);
+    const double m1 = abs0 + abs1 + abs2 - m0 - m2;
+
+    const double m12 = m0 + m1;
+    const double m012 = 6.0 * m0 * m1 * m2;
+    const double V1 = m0 * m0 / safelyEpsilon(6.0 * m1 * m2);
+    const double V2 = V1 + 0.5 * (m1 - m0) / m2;
+    const double V3 =
+        m12 <= m2 ? 0.5 * m12 / m2
+                  : (m2 * m2 * (3.0 * m12 - m2) + m0 * m0 * (m0 - 3.0 * m2) +
+                     m1 * m1 * (m1 - 3.0 * m2)) /
+                        safelyEpsilon(m012);
+
+    const double alpha_1 = std::cbrt(m012 * VOFo);
+    const double alpha_2 =
+        0.5 * (m0 + std::sqrt(std::max(
+                        m0 * m0 + 8.0 * m1 * m2 * (VOFo - V1), 0.0)));
+    const double alpha_3 = getCubicRoot(
+        -(m0 * m0 * m0 + m1 * m1 * m1 - m012 * VOFo),
+        3.0 * (m0 * m0 + m1 * m1), -3.0 * m12);
+    const double alpha_4 =
+        m2 >= m12 ? m2 * VOFo + 0.5 * m12
+                  : getCubicRoot(-0.5 * (m0 * m0 * m0 + m1 * m1 * m1 +
+                                         m2 * m2 * m2 - m012 * VOFo),
+                                 1.5 * (m0 * m0 + m1 * m1 + m2 * m2), -1.5);
+
+    double alpha = VOFo < V1   ? alpha_1
+                   : VOFo < V2 ? alpha_2
+                   : VOFo < V3 ? alpha_3
+                               : alpha_4;
+    alpha = volume_fraction > 0.5 ? 1.0 - alpha : alpha;
+    alpha += factor - 0.5 * (mm0 + mm1 + mm2);
+    distance[l] = alpha * norm + centroid_distance[l];
+  }
+}
+
+}  // namespace batched_plane_distance_details
+
+void findDistancesOnePlane(const RectangularCuboid* a_cells,
+                           const double* a_volume_fractions,
+                           const Normal* a_normals,
+                           const LargeOffsetIndex_t a_size,
+                           double* a_distances) {
+  // The closed form is exact, so no tolerance is needed.
+  batched_plane_distance_details::findDistancesOnePlane(
+      a_cells, a_volume_fractions, a_normals, a_size, a_distances, 0.0);
+}
+
+}  // namespace IRL
@@ -0,0 +1,94 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_INTERFACE_RECONSTRUCTION_METHODS_BATCHED_PLANE_DISTANCE_H_
+#define IRL_INTERFACE_RECONSTRUCTION_METHODS_BATCHED_PLANE_DISTANCE_H_
+
+#include <array>
+
+#include "irl/geometry/general/normal.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/helpers/telemetry.h"
+#include "irl/interface_reconstruction_methods/volume_fraction_matching.h"
+#include "irl/parameters/constants.h"
+#include "irl/parameters/defined_types.h"
+#include "irl/parameters/tolerance_context.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace IRL {
+/// \file batched_plane_distance.h
+///
+/// This file contains batched versions of the single-plane
+/// distance-finding routines in plane_distance.h. Cells are
+/// gathered into fixed-width lanes stored as structures of arrays
+/// and every lane of a batch is solved in lockstep, so that the
+/// inner loops are free of data-dependent branches and can be
+/// vectorized by the compiler.
+
+/// \brief Number of cells solved together in one batch.
+static constexpr UnsignedIndex_t batched_plane_distance_lanes = 8;
+
+/// \brief Batched version of `findDistanceOnePlane(...)` for
+/// RectangularCuboid cells.
+///
+/// The Scardovelli & Zaleski closed form is evaluated for all regimes
+/// of every lane and the correct one is selected per lane.
+///
+/// \param[in] a_cells Array of `a_size` cells.
+/// \param[in] a_volume_fractions Liquid volume fraction for each cell.
+/// \param[in] a_normals Plane normal for each cell.
+/// \param[in] a_size Number of cells.
+/// \param[out] a_distances Plane distance for each cell.
+void findDistancesOnePlane(const RectangularCuboid* a_cells,
+                           const double* a_volume_fractions,
+                           const Normal* a_normals,
+                           const LargeOffsetIndex_t a_size,
+                           double* a_distances);
+
+/// \brief Batched single-plane distance finding for any cell that
+/// provides a tet decomposition (Tet, Hexahedron, ...).
+///
+/// The volume below the plane is the sum of the closed-form volume
+/// fractions of each tet in the decomposition, which is monotone in the
+/// plane distance. Its root is found with Newton-Raphson safeguarded by a
+/// bisection bracket, with each lane masked off once it is within
+/// `a_volume_fraction_tolerance` of its volume fraction. For cells with
+/// non-planar faces, the volume is that of the tet decomposition.
+///
+/// \param[in] a_cells Array of `a_size` cells.
+/// \param[in] a_volume_fractions Liquid volume fraction for each cell.
+/// \param[in] a_normals Plane normal for each cell.
+/// \param[in] a_size Number of cells.
+/// \param[out] a_distances Plane distance for each cell.
+/// \param[in] a_volume_fraction_tolerance Tolerance to recreate each
+/// volume fraction within.
+template <class CellType>
+void findDistancesOnePlane(
+    const CellType* a_cells, const double* a_volume_fractions,
+    const Normal* a_normals, const LargeOffsetIndex_t a_size,
+    double* a_distances,
+    const double a_volume_fraction_tolerance = getVolumeFractionTolerance());
+
+/// \brief Batched version of `setDistanceToMatchVolumeFraction(...)`.
+///
+/// Single-plane reconstructions of partially filled cells are solved
+/// together with `findDistancesOnePlane(...)`. Pure cells are set to a
+/// pure-phase reconstruction and reconstructions with more than one plane
+/// fall back to `setDistanceToMatchVolumeFraction(...)`.
+template <class CellType>
+void setDistancesToMatchVolumeFraction(
+    const CellType* a_cells, const double* a_volume_fractions,
+    PlanarSeparator* a_reconstructions, const LargeOffsetIndex_t a_size,
+    const double a_volume_fraction_tolerance = getVolumeFractionTolerance());
+
+}  // namespace IRL
+
+#include "irl/interface_reconstruction_methods/batched_plane_distance.tpp"
+
+#endif  // IRL_INTERFACE_RECONSTRUCTION_METHODS_BATCHED_PLANE_DISTANCE_H_
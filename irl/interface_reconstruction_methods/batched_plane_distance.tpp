@@ -0,0 +1,293 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_INTERFACE_RECONSTRUCTION_METHODS_BATCHED_PLANE_DISTANCE_TPP_
+#define IRL_INTERFACE_RECONSTRUCTION_METHODS_BATCHED_PLANE_DISTANCE_TPP_
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace IRL {
+
+namespace batched_plane_distance_details {
+
+using LaneArray = std::array<double, batched_plane_distance_lanes>;
+template <class CellType>
+using CellLanes = std::array<const CellType*, batched_plane_distance_lanes>;
+using NormalLanes = std::array<const Normal*, batched_plane_distance_lanes>;
+
+/// \brief Max number of Newton-Raphson/bisection iterations per batch.
+static constexpr UnsignedIndex_t max_iter = {60};
+
+/// \brief Sort four values in ascending order with a branch-free
+/// sorting network.
+inline void sort4Ascending(std::array<double, 4>* a_values) {
+  auto& v = *a_values;
+  const auto swap = [&v](const UnsignedIndex_t a_i, const UnsignedIndex_t a_j) {
+    const double low = std::min(v[a_i], v[a_j]);
+    v[a_j] = std::max(v[a_i], v[a_j]);
+    v[a_i] = low;
+  };
+  swap(0, 1);
+  swap(2, 3);
+  swap(0, 2);
+  swap(1, 3);
+  swap(1, 2);
+}
+
+/// \brief Fraction of a tet below the plane at `a_distance` and its
+/// derivative with respect to `a_distance`, given the sorted
+/// distances of the tet vertices along the plane normal.
+///
+/// Each regime of Yang & James is evaluated and then selected, so that
+/// no branch depends on the data.
+inline void getTetFractionBelow(const std::array<double, 4>& a_heights,
+                                const double a_distance, double* a_fraction,
+                                double* a_derivative) {
+  const double h0 = a_heights[0];
+  const double h1 = a_heights[1];
+  const double h2 = a_heights[2];
+  const double h3 = a_heights[3];
+
+  // Regime 0, vertex 0 is below the plane.
+  const double below = a_distance - h0;
+  const double denominator_0 =
+      std::max((h1 - h0) * (h2 - h0) * (h3 - h0), DBL_MIN);
+  const double fraction_0 = below * below * below / denominator_0;
+  const double derivative_0 = 3.0 * below * below / denominator_0;
+
+  // Regime 2, only vertex 3 is above the plane.
+  const double above = h3 - a_distance;
+  const double denominator_2 =
+      std::max((h3 - h0) * (h3 - h1) * (h3 - h2), DBL_MIN);
+  const double fraction_2 = 1.0 - above * above * above / denominator_2;
+  const double derivative_2 = 3.0 * above * above / denominator_2;
+
+  // Regime 1, plane between vertices 1 and 2.
+  const double vd1 = h1 - h0;
+  const double vd2 = std::max(h2 - h0, DBL_MIN);
+  const double vd3 = std::max(h3 - h0, DBL_MIN);
+  const double pc_m_pb = std::max(h2 - h1, DBL_MIN);
+  const double pd_m_pb = std::max(h3 - h1, DBL_MIN);
+  const double past = a_distance - h1;
+  const double alpha = past / pc_m_pb;
+  const double cubic_weight = (1.0 / vd2 + 1.0 / pd_m_pb) / vd3;
+  const double fraction_1 =
+      (vd1 * vd1 + 3.0 * vd1 * past + 3.0 * past * past) / (vd2 * vd3) -
+      past * past * alpha * cubic_weight;
+  const double derivative_1 = (3.0 * vd1 + 6.0 * past) / (vd2 * vd3) -
+                              3.0 * past * alpha * cubic_weight;
+
+  *a_fraction = a_distance <= h0   ? 0.0
+                : a_distance >= h3 ? 1.0
+                : a_distance <= h1 ? fraction_0
+                : a_distance >= h2 ? fraction_2
+                                   : fraction_1;
+  *a_derivative = a_distance <= h0   ? 0.0
+                  : a_distance >= h3 ? 0.0
+                  : a_distance <= h1 ? derivative_0
+                  : a_distance >= h2 ? derivative_2
+                                     : derivative_1;
+}
+
+/// \brief Solve one batch of single-plane distances for the RectangularCuboid
+/// closed form, which is exact, so `a_volume_fraction_tolerance` is unused.
+/// Defined in batched_plane_distance.cpp.
+void solveBatch(const CellLanes<RectangularCuboid>& a_cells,
+                const LaneArray& a_volume_fractions,
+                const NormalLanes& a_normals,
+                const double a_volume_fraction_tolerance,
+                LaneArray* a_distances);
+
+/// \brief Solve one batch of single-plane distances on the tet
+/// decomposition of each cell.
+template <class CellType>
+void solveBatch(const CellLanes<CellType>& a_cells,
+                const LaneArray& a_volume_fractions,
+                const NormalLanes& a_normals,
+                const double a_volume_fraction_tolerance,
+                LaneArray* a_distances) {
+  static constexpr UnsignedIndex_t lanes = batched_plane_distance_lanes;
+  static constexpr UnsignedIndex_t number_of_tets =
+      CellType::getNumberOfSimplicesInDecomposition();
+
+  // Gather the sorted vertex distances and volume of every tet.
+  std::array<std::array<std::array<double, 4>, lanes>, number_of_tets>
+      heights;
+  std::array<LaneArray, number_of_tets> volumes;
+  LaneArray total_volume, lower, upper;
+  for (UnsignedIndex_t l = 0; l < lanes; ++l) {
+    const CellType& cell = *a_cells[l];
+    const Normal& normal = *a_normals[l];
+    total_volume[l] = 0.0;
+    lower[l] = DBL_MAX;
+    upper[l] = -DBL_MAX;
+    for (UnsignedIndex_t t = 0; t < number_of_tets; ++t) {
+      const auto tet = cell.getSimplexFromDecomposition(t);
+      for (UnsignedIndex_t v = 0; v < 4; ++v) {
+        heights[t][l][v] = normal * tet[v];
+        lower[l] = std::min(lower[l], heights[t][l][v]);
+        upper[l] = std::max(upper[l], heights[t][l][v]);
+      }
+      sort4Ascending(&heights[t][l]);
+      volumes[t][l] = tet.calculateVolume();
+      total_volume[l] += volumes[t][l];
+    }
+    // Orient all lanes so the volume below the plane increases with distance.
+    if (total_volume[l] < 0.0) {
+      total_volume[l] = -total_volume[l];
+      for (UnsignedIndex_t t = 0; t < number_of_tets; ++t) {
+        volumes[t][l] = -volumes[t][l];
+      }
+    }
+  }
+
+  LaneArray target, tolerance;
+  auto& distance = *a_distances;
+  std::array<bool, lanes> active;
+  for (UnsignedIndex_t l = 0; l < lanes; ++l) {
+    target[l] = a_volume_fractions[l] * total_volume[l];
+    tolerance[l] = a_volume_fraction_tolerance * total_volume[l];
+    distance[l] = lower[l] + a_volume_fractions[l] * (upper[l] - lower[l]);
+    active[l] = true;
+  }
+
+  LaneArray below, slope;
+  for (UnsignedIndex_t iter = 0; iter < max_iter; ++iter) {
+    countTelemetry(TelemetryCounter::DistanceSolverIterations);
+    below.fill(0.0);
+    slope.fill(0.0);
+    for (UnsignedIndex_t t = 0; t < number_of_tets; ++t) {
+      for (UnsignedIndex_t l = 0; l < lanes; ++l) {
+        double fraction, derivative;
+        getTetFractionBelow(heights[t][l], distance[l], &fraction,
+                            &derivative);
+        below[l] += volumes[t][l] * fraction;
+        slope[l] += volumes[t][l] * derivative;
+      }
+    }
+
+    bool any_active = false;
+    for (UnsignedIndex_t l = 0; l < lanes; ++l) {
+      const double residual = below[l] - target[l];
+      active[l] = active[l] && std::fabs(residual) > tolerance[l];
+      lower[l] = residual < 0.0 ? distance[l] : lower[l];
+      upper[l] = residual > 0.0 ? distance[l] : upper[l];
+      const double newton = distance[l] - residual / safelyTiny(slope[l]);
+      const double next = newton > lower[l] && newton < upper[l]
+                              ? newton
+                              : 0.5 * (lower[l] + upper[l]);
+      distance[l] = active[l] ? next : distance[l];
+      any_active = any_active || active[l];
+    }
+    if (!any_active) {
+      break;
+    }
+  }
+}
+
+template <class CellType>
+void findDistancesOnePlane(const CellType* a_cells,
+                           const double* a_volume_fractions,
+                           const Normal* a_normals,
+                           const LargeOffsetIndex_t a_size,
+                           double* a_distances,
+                           const double a_volume_fraction_tolerance) {
+  static constexpr UnsignedIndex_t lanes = batched_plane_distance_lanes;
+  CellLanes<CellType> cells;
+  NormalLanes normals;
+  LaneArray volume_fractions, distances;
+  for (LargeOffsetIndex_t first = 0; first < a_size; first += lanes) {
+    const auto count =
+        static_cast<UnsignedIndex_t>(std::min<LargeOffsetIndex_t>(
+            lanes, a_size - first));
+    // Unused lanes repeat the first cell so every lane stays well defined.
+    for (UnsignedIndex_t l = 0; l < lanes; ++l) {
+      const LargeOffsetIndex_t n = first + (l < count ? l : 0);
+      cells[l] = a_cells + n;
+      normals[l] = a_normals + n;
+      volume_fractions[l] = a_volume_fractions[n];
+    }
+    solveBatch(cells, volume_fractions, normals, a_volume_fraction_tolerance,
+               &distances);
+    std::copy(distances.begin(), distances.begin() + count,
+              a_distances + first);
+  }
+}
+
+}  // namespace batched_plane_distance_details
+
+template <class CellType>
+void findDistancesOnePlane(const CellType* a_cells,
+                           const double* a_volume_fractions,
+                           const Normal* a_normals,
+                           const LargeOffsetIndex_t a_size,
+                           double* a_distances,
+                           const double a_volume_fraction_tolerance) {
+  batched_plane_distance_details::findDistancesOnePlane(
+      a_cells, a_volume_fractions, a_normals, a_size, a_distances,
+      a_volume_fraction_tolerance);
+}
+
+template <class CellType>
+void setDistancesToMatchVolumeFraction(
+    const CellType* a_cells, const double* a_volume_fractions,
+    PlanarSeparator* a_reconstructions, const LargeOffsetIndex_t a_size,
+    const double a_volume_fraction_tolerance) {
+  static constexpr UnsignedIndex_t lanes = batched_plane_distance_lanes;
+  batched_plane_distance_details::CellLanes<CellType> cells;
+  batched_plane_distance_details::NormalLanes normals;
+  batched_plane_distance_details::LaneArray volume_fractions, distances;
+  std::array<LargeOffsetIndex_t, lanes> indices;
+  UnsignedIndex_t count = 0;
+
+  const auto flush = [&](void) {
+    for (UnsignedIndex_t l = count; l < lanes; ++l) {
+      cells[l] = cells[0];
+      normals[l] = normals[0];
+      volume_fractions[l] = volume_fractions[0];
+    }
+    batched_plane_distance_details::solveBatch(
+        cells, volume_fractions, normals, a_volume_fraction_tolerance,
+        &distances);
+    for (UnsignedIndex_t l = 0; l < count; ++l) {
+      a_reconstructions[indices[l]][0].distance() = distances[l];
+    }
+    count = 0;
+  };
+
+  for (LargeOffsetIndex_t n = 0; n < a_size; ++n) {
+    const double volume_fraction = a_volume_fractions[n];
+    if (wantPurelyInternal(volume_fraction) ||
+        wantPurelyExternal(volume_fraction)) {
+      setToPurePhaseReconstruction(volume_fraction, a_reconstructions + n);
+    } else if (a_reconstructions[n].getNumberOfPlanes() != 1) {
+      setDistanceToMatchVolumeFraction(a_cells[n], volume_fraction,
+                                       a_reconstructions + n,
+                                       a_volume_fraction_tolerance);
+    } else {
+      cells[count] = a_cells + n;
+      normals[count] = &a_reconstructions[n][0].normal();
+      volume_fractions[count] = volume_fraction;
+      indices[count] = n;
+      ++count;
+      if (count == lanes) {
+        flush();
+      }
+    }
+  }
+  if (count > 0) {
+    flush();
+  }
+}
+
+}  // namespace IRL
+
+#endif  // IRL_INTERFACE_RECONSTRUCTION_METHODS_BATCHED_PLANE_DISTANCE_TPP_
@@ -11,8 +11,11 @@
 
 #include <cmath>
 #include <iostream>
+#include <utility>
 
+#include "irl/generic_cutting/batched_cutting.h"
 #include "irl/geometry/polygons/polygon.h"
+#include "irl/interface_reconstruction_methods/batched_plane_distance.h"
 #include "irl/interface_reconstruction_methods/plane_distance.h"
 #include "irl/planar_reconstruction/planar_separator.h"
 
@@ -157,6 +160,7 @@ PlanarSeparator ELVIRA_3D::solve(
 
 PlanarSeparator ELVIRA_3D::solve(void) {
   minimum_error_m = DBL_MAX;
+  number_of_candidates_m = 0;
   guess_reconstruction_m =
       PlanarSeparator::fromOnePlane(Plane(Normal(0.0, 0.0, 0.0), 0.0));
   double tmp_normal_approximations[3][2];
@@ -171,9 +175,9 @@ PlanarSeparator ELVIRA_3D::solve(void) {
   // Try all normal combinations
   for (int z_normal = 0; z_normal < 3; ++z_normal) {
     for (int y_normal = 0; y_normal < 3; ++y_normal) {
-      this->tryNormal(Normal(assumed_normal,
-                             tmp_normal_approximations[y_normal][0],
-                             tmp_normal_approximations[z_normal][1]));
+      this->addCandidateNormal(Normal(assumed_normal,
+                                      tmp_normal_approximations[y_normal][0],
+                                      tmp_normal_approximations[z_normal][1]));
     }
   }
 
@@ -188,9 +192,9 @@ PlanarSeparator ELVIRA_3D::solve(void) {
   // Try all normal combinations
   for (int z_normal = 0; z_normal < 3; ++z_normal) {
     for (int x_normal = 0; x_normal < 3; ++x_normal) {
-      this->tryNormal(Normal(tmp_normal_approximations[x_normal][0],
-                             assumed_normal,
-                             tmp_normal_approximations[z_normal][1]));
+      this->addCandidateNormal(Normal(tmp_normal_approximations[x_normal][0],
+                                      assumed_normal,
+                                      tmp_normal_approximations[z_normal][1]));
     }
   }
 
@@ -205,11 +209,12 @@ PlanarSeparator ELVIRA_3D::solve(void) {
   // Try all normal combinations
   for (int y_normal = 0; y_normal < 3; ++y_normal) {
     for (int x_normal = 0; x_normal < 3; ++x_normal) {
-      this->tryNormal(Normal(tmp_normal_approximations[x_normal][0],
-                             tmp_normal_approximations[y_normal][1],
-                             assumed_normal));
+      this->addCandidateNormal(Normal(tmp_normal_approximations[x_normal][0],
+                                      tmp_normal_approximations[y_normal][1],
+                                      assumed_normal));
     }
   }
+  this->tryCandidateNormals();
   return best_reconstruction_m;
 }
 
@@ -367,6 +372,177 @@ void ELVIRA_3D::tryNormal(Normal a_normal) {
   }
 }
 
+void ELVIRA_3D::addCandidateNormal(Normal a_normal) {
+  assert(number_of_candidates_m < candidate_normals_m.size());
+  a_normal.normalize();
+  candidate_normals_m[number_of_candidates_m] = a_normal;
+  ++number_of_candidates_m;
+}
+
+namespace {
+
+// Squared error between the stored volume fraction of each cell and the
+// volume fraction below the plane of each candidate, for a list of
+// (candidate, cell) pairs. Cells use the linear index
+// (i + 1) + (j + 1) * 3 + (k + 1) * 9. Pairs are processed in blocks of
+// kBatchedCuttingLaneWidth with the analytic unit-cube kernel, and lanes
+// that kernel cannot handle accurately use getVolumeFraction instead.
+void calculateSquaredErrors(
+    const ELVIRANeighborhood& a_neighborhood,
+    const std::array<PlanarSeparator, 27>& a_candidates,
+    const std::pair<UnsignedIndex_t, UnsignedIndex_t>* a_pairs,
+    const UnsignedIndex_t a_number_of_pairs,
+    std::array<std::array<double, 27>, 27>* a_squared_errors) {
+  const auto cell = [&a_neighborhood](const UnsignedIndex_t a_index)
+      -> const RectangularCuboid& {
+    const int i = static_cast<int>(a_index % 3) - 1;
+    const int j = static_cast<int>((a_index / 3) % 3) - 1;
+    const int k = static_cast<int>(a_index / 9) - 1;
+    return a_neighborhood.getCell(i, j, k);
+  };
+  const auto stored_volume_fraction = [&a_neighborhood](
+                                          const UnsignedIndex_t a_index) {
+    const int i = static_cast<int>(a_index % 3) - 1;
+    const int j = static_cast<int>((a_index / 3) % 3) - 1;
+    const int k = static_cast<int>(a_index / 9) - 1;
+    return a_neighborhood.getStoredMoments(i, j, k);
+  };
+
+  batched_cutting_details::UnitCubeLanes lanes;
+  for (UnsignedIndex_t block_start = 0; block_start < a_number_of_pairs;
+       block_start += kBatchedCuttingLaneWidth) {
+    const UnsignedIndex_t lanes_in_block = std::min(
+        kBatchedCuttingLaneWidth, a_number_of_pairs - block_start);
+    lanes.m0.fill(1.0 / 3.0);
+    lanes.m1.fill(1.0 / 3.0);
+    lanes.m2.fill(1.0 / 3.0);
+    lanes.alpha.fill(0.0);
+    lanes.cell_volume.fill(0.0);
+    lanes.use_scalar.fill(false);
+    for (UnsignedIndex_t l = 0; l < lanes_in_block; ++l) {
+      const auto& pair = a_pairs[block_start + l];
+      batched_cutting_details::loadUnitCubeLane(
+          cell(pair.second), a_candidates[pair.first], l, &lanes);
+    }
+
+    batched_cutting_details::calculateUnitCubeFractions(&lanes);
+
+    for (UnsignedIndex_t l = 0; l < lanes_in_block; ++l) {
+      const auto& pair = a_pairs[block_start + l];
+      const double volume_fraction =
+          lanes.use_scalar[l]
+              ? getVolumeFraction<ReconstructionDefaultCuttingMethod>(
+                    cell(pair.second), a_candidates[pair.first])
+              : lanes.fraction[l];
+      const double difference =
+          volume_fraction - stored_volume_fraction(pair.second);
+      (*a_squared_errors)[pair.first][pair.second] = difference * difference;
+    }
+  }
+}
+
+// Sum of the squared errors of cells [a_first_cell, a_end_cell), in the
+// order tryNormal() sums them.
+double sumSquaredErrors(const std::array<double, 27>& a_squared_errors,
+                        const UnsignedIndex_t a_first_cell,
+                        const UnsignedIndex_t a_end_cell) {
+  double error = 0.0;
+  for (UnsignedIndex_t n = a_first_cell; n < a_end_cell; ++n) {
+    error += a_squared_errors[n];
+  }
+  return error;
+}
+
+}  // namespace
+
+void ELVIRA_3D::tryCandidateNormals(void) {
+  static constexpr UnsignedIndex_t number_of_cells = 27;
+  // Cells of the k = 0 layer, which sees the interface most directly.
+  static constexpr UnsignedIndex_t first_central_cell = 9;
+  static constexpr UnsignedIndex_t end_central_cell = 18;
+  const UnsignedIndex_t number_of_candidates = number_of_candidates_m;
+  if (number_of_candidates == 0) {
+    return;
+  }
+
+  std::array<RectangularCuboid, 27> center_cells;
+  std::array<double, 27> center_volume_fractions;
+  std::array<double, 27> distances;
+  center_cells.fill(neighborhood_VF_m->getCell(0, 0, 0));
+  center_volume_fractions.fill(neighborhood_VF_m->getStoredMoments(0, 0, 0));
+  findDistancesOnePlane(center_cells.data(), center_volume_fractions.data(),
+                        candidate_normals_m.data(), number_of_candidates,
+                        distances.data());
+  std::array<PlanarSeparator, 27> candidates;
+  for (UnsignedIndex_t c = 0; c < number_of_candidates; ++c) {
+    candidates[c] = PlanarSeparator::fromOnePlane(
+        Plane(candidate_normals_m[c], distances[c]));
+  }
+
+  std::array<std::array<double, 27>, 27> squared_errors;
+  std::array<std::pair<UnsignedIndex_t, UnsignedIndex_t>, 27 * 27> pairs;
+  UnsignedIndex_t number_of_pairs = 0;
+  const auto add_outer_cells = [&](const UnsignedIndex_t a_candidate) {
+    for (UnsignedIndex_t n = 0; n < number_of_cells; ++n) {
+      if (n < first_central_cell || n >= end_central_cell) {
+        pairs[number_of_pairs++] = std::make_pair(a_candidate, n);
+      }
+    }
+  };
+
+  // Score every candidate on the central layer.
+  for (UnsignedIndex_t c = 0; c < number_of_candidates; ++c) {
+    for (UnsignedIndex_t n = first_central_cell; n < end_central_cell; ++n) {
+      pairs[number_of_pairs++] = std::make_pair(c, n);
+    }
+  }
+  calculateSquaredErrors(*neighborhood_VF_m, candidates, pairs.data(),
+                         number_of_pairs, &squared_errors);
+  std::array<double, 27> central_errors;
+  UnsignedIndex_t most_promising = 0;
+  for (UnsignedIndex_t c = 0; c < number_of_candidates; ++c) {
+    central_errors[c] = sumSquaredErrors(squared_errors[c],
+                                         first_central_cell, end_central_cell);
+    if (central_errors[c] < central_errors[most_promising]) {
+      most_promising = c;
+    }
+  }
+
+  // The complete error of the most promising candidate bounds the
+  // minimum. Errors only grow as cells are added, so candidates already
+  // above it are rejected. The small margin covers the different
+  // summation order of the central errors.
+  number_of_pairs = 0;
+  add_outer_cells(most_promising);
+  calculateSquaredErrors(*neighborhood_VF_m, candidates, pairs.data(),
+                         number_of_pairs, &squared_errors);
+  const double error_bound =
+      sumSquaredErrors(squared_errors[most_promising], 0, number_of_cells) *
+      (1.0 + 64.0 * DBL_EPSILON);
+  std::array<bool, 27> is_rejected;
+  number_of_pairs = 0;
+  for (UnsignedIndex_t c = 0; c < number_of_candidates; ++c) {
+    is_rejected[c] = central_errors[c] > error_bound;
+    if (!is_rejected[c] && c != most_promising) {
+      add_outer_cells(c);
+    }
+  }
+  calculateSquaredErrors(*neighborhood_VF_m, candidates, pairs.data(),
+                         number_of_pairs, &squared_errors);
+
+  for (UnsignedIndex_t c = 0; c < number_of_candidates; ++c) {
+    if (is_rejected[c]) {
+      continue;
+    }
+    const double error =
+        sumSquaredErrors(squared_errors[c], 0, number_of_cells);
+    if (error < minimum_error_m) {
+      best_reconstruction_m = candidates[c];
+      minimum_error_m = error;
+    }
+  }
+}
+
 //******************************************************************* //
 //     Debug function implementations below this.
 //******************************************************************* //
@@ -381,6 +557,8 @@ PlanarSeparator ELVIRADebug<ELVIRA_2D>::solve(
 PlanarSeparator ELVIRADebug<ELVIRA_2D>::solve(void) {
   this->writeOutVolumeFractions();
   minimum_error_m = DBL_MAX;
+  guess_reconstruction_m =
+      PlanarSeparator::fromOnePlane(Plane(Normal(0.0, 0.0, 0.0), 0.0));
   double tmp_normal_approximations[3];
 
   // Assume x integration direction
@@ -474,6 +652,8 @@ PlanarSeparator ELVIRADebug<ELVIRA_3D>::solve(
 PlanarSeparator ELVIRADebug<ELVIRA_3D>::solve(void) {
   this->writeOutVolumeFractions();
   minimum_error_m = DBL_MAX;
+  guess_reconstruction_m =
+      PlanarSeparator::fromOnePlane(Plane(Normal(0.0, 0.0, 0.0), 0.0));
   double tmp_normal_approximations[3][2];
 
   // Assume x integration direction
@@ -159,8 +159,28 @@ class ELVIRA_3D {
   /// If lowest error yet, save as best_reconstruction_m.
   void tryNormal(Normal a_normal);
 
+  /// \brief Normalize and store a candidate normal, to be scored later
+  /// by tryCandidateNormals().
+  void addCandidateNormal(Normal a_normal);
+
+  /// \brief Calculate the error of every stored candidate normal at once,
+  /// saving the lowest as best_reconstruction_m.
+  ///
+  /// Gives the same result as calling tryNormal() for each candidate in
+  /// order. Plane distances are found together with
+  /// findDistancesOnePlane(), and volume fractions for all candidate and
+  /// cell pairs come from the analytic unit-cube kernel in lanes.
+  /// Candidates whose error over the central layer of cells already
+  /// exceeds the complete error of another candidate are not scored on
+  /// the remaining cells.
+  void tryCandidateNormals(void);
+
   /// \brief Storage of the stencil information
   const ELVIRANeighborhood* neighborhood_VF_m;
+  /// \brief Candidate normals gathered during solve().
+  std::array<Normal, 27> candidate_normals_m;
+  /// \brief Number of candidate normals stored.
+  UnsignedIndex_t number_of_candidates_m;
   /// \brief Array of column sums needed in ELVIRA
   std::array<double, 9> column_sums_m;
   /// \brief Array of points for centers of columns.
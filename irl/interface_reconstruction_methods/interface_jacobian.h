@@ -0,0 +1,118 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_INTERFACE_RECONSTRUCTION_METHODS_INTERFACE_JACOBIAN_H_
+#define IRL_INTERFACE_RECONSTRUCTION_METHODS_INTERFACE_JACOBIAN_H_
+
+#include <type_traits>
+
+#include <Eigen/Dense>  // Eigen header
+
+#include "irl/generic_cutting/cut_polygon.h"
+#include "irl/geometry/general/normal.h"
+#include "irl/geometry/polygons/polygon.h"
+#include "irl/geometry/polyhedrons/hexahedron.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/geometry/polyhedrons/tet.h"
+#include "irl/helpers/SFINAE_boiler_plate.h"
+#include "irl/parameters/defined_types.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+/// \file interface_jacobian.h
+///
+/// Helpers for the analytic Jacobians of the optimization-based
+/// reconstructions.
+///
+/// When plane p of a PlanarSeparator changes so that a point x on it moves
+/// along its normal at the rate `r.distance - r.normal * x`, the liquid
+/// below it grows by that rate over the part of the plane that bounds the
+/// liquid, the interface polygon. The rates of the liquid volume and first
+/// moment are therefore integrals over the interface polygons of 1 and x
+/// times that rate, which only need the area and the first and second
+/// moments of each polygon.
+
+namespace IRL {
+
+/// \brief Area, first moment (integral of x) and second moment (integral of
+/// x x^T) of the interface polygon of one plane of a PlanarSeparator.
+struct InterfacePlaneMoments {
+  double area;
+  Eigen::Vector3d first;
+  Eigen::Matrix3d second;
+};
+
+/// \brief Rate of change of one plane with one parameter being fit. The
+/// rate of the normal must be perpendicular to the normal.
+struct PlaneRate {
+  Eigen::Vector3d normal;
+  double distance;
+};
+
+/// \brief Whether interface polygons can be formed in cells of `CellType`,
+/// which must be convex.
+template <class CellType>
+struct has_interface_polygons : std::false_type {};
+
+template <>
+struct has_interface_polygons<RectangularCuboid> : std::true_type {};
+
+template <>
+struct has_interface_polygons<Hexahedron> : std::true_type {};
+
+template <>
+struct has_interface_polygons<Tet> : std::true_type {};
+
+/// \brief Fill `a_moments[p]` with the moments of the interface polygon of
+/// each plane p of `a_reconstruction` in `a_cell`. Returns false, leaving
+/// `a_moments` untouched, if `CellType` has no interface polygons.
+template <class CellType>
+enable_if_t<has_interface_polygons<CellType>::value, bool>
+calculateInterfacePlaneMoments(const CellType& a_cell,
+                               const PlanarSeparator& a_reconstruction,
+                               InterfacePlaneMoments* a_moments);
+
+template <class CellType>
+enable_if_t<!has_interface_polygons<CellType>::value, bool>
+calculateInterfacePlaneMoments(const CellType& a_cell,
+                               const PlanarSeparator& a_reconstruction,
+                               InterfacePlaneMoments* a_moments);
+
+/// \brief Rate of change of `a_normal` when it is rotated about `a_axis`.
+inline Eigen::Vector3d normalRateFromRotation(const Normal& a_axis,
+                                              const Normal& a_normal);
+
+/// \brief Rates of change of the liquid volume and first moment in a cell
+/// whose `a_number_of_planes` planes change at `a_rates`, with every
+/// distance also shifted at `a_shift_rate`.
+inline void calculateLiquidMomentsRate(
+    const UnsignedIndex_t a_number_of_planes,
+    const InterfacePlaneMoments* a_moments, const PlaneRate* a_rates,
+    const double a_shift_rate, double* a_volume_rate,
+    Eigen::Vector3d* a_first_moment_rate);
+
+/// \brief Rate at which every distance must shift for the liquid volume of
+/// a cell to stay constant while its planes change at `a_rates`, as when
+/// distances are reset to match a volume fraction. Returns false if the
+/// cell has no interface to shift.
+inline bool calculateVolumeConservingShiftRate(
+    const UnsignedIndex_t a_number_of_planes,
+    const InterfacePlaneMoments* a_moments, const PlaneRate* a_rates,
+    double* a_shift_rate);
+
+/// \brief Return `a_reconstruction` with its planes moved by `a_step`
+/// along `a_rates` and `a_shift_rate`, with the normals renormalized.
+inline PlanarSeparator stepReconstruction(
+    const PlanarSeparator& a_reconstruction, const PlaneRate* a_rates,
+    const double a_shift_rate, const double a_step);
+
+}  // namespace IRL
+
+#include "irl/interface_reconstruction_methods/interface_jacobian.tpp"
+
+#endif  // IRL_INTERFACE_RECONSTRUCTION_METHODS_INTERFACE_JACOBIAN_H_
@@ -0,0 +1,137 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_INTERFACE_RECONSTRUCTION_METHODS_INTERFACE_JACOBIAN_TPP_
+#define IRL_INTERFACE_RECONSTRUCTION_METHODS_INTERFACE_JACOBIAN_TPP_
+
+namespace IRL {
+
+namespace interface_jacobian_details {
+template <class VectorType>
+inline Eigen::Vector3d toVector(const VectorType& a_vector) {
+  return Eigen::Vector3d(a_vector[0], a_vector[1], a_vector[2]);
+}
+
+inline void calculatePolygonMoments(const Polygon& a_polygon,
+                                    InterfacePlaneMoments* a_moments) {
+  a_moments->area = 0.0;
+  a_moments->first.setZero();
+  a_moments->second.setZero();
+  const UnsignedIndex_t number_of_vertices = a_polygon.getNumberOfVertices();
+  if (number_of_vertices < 3) {
+    return;
+  }
+  // Fan of triangles from the first vertex, integrated relative to it.
+  const Eigen::Vector3d origin = toVector(a_polygon[0]);
+  double area = 0.0;
+  Eigen::Vector3d first = Eigen::Vector3d::Zero();
+  Eigen::Matrix3d second = Eigen::Matrix3d::Zero();
+  Eigen::Vector3d previous = toVector(a_polygon[1]) - origin;
+  for (UnsignedIndex_t v = 2; v < number_of_vertices; ++v) {
+    const Eigen::Vector3d next = toVector(a_polygon[v]) - origin;
+    const Eigen::Vector3d sum = previous + next;
+    const double triangle_area = 0.5 * previous.cross(next).norm();
+    area += triangle_area;
+    first += (triangle_area / 3.0) * sum;
+    second += (triangle_area / 12.0) *
+              (previous * previous.transpose() + next * next.transpose() +
+               sum * sum.transpose());
+    previous = next;
+  }
+  a_moments->area = area;
+  a_moments->first = first + area * origin;
+  a_moments->second = second + first * origin.transpose() +
+                      origin * first.transpose() +
+                      area * origin * origin.transpose();
+}
+}  // namespace interface_jacobian_details
+
+template <class CellType>
+enable_if_t<has_interface_polygons<CellType>::value, bool>
+calculateInterfacePlaneMoments(const CellType& a_cell,
+                               const PlanarSeparator& a_reconstruction,
+                               InterfacePlaneMoments* a_moments) {
+  for (UnsignedIndex_t p = 0; p < a_reconstruction.getNumberOfPlanes(); ++p) {
+    // The plane is passed by reference so it is not cut by itself.
+    const auto polygon = getPlanePolygonFromReconstruction<Polygon>(
+        a_cell, a_reconstruction, a_reconstruction[p]);
+    interface_jacobian_details::calculatePolygonMoments(polygon,
+                                                        &a_moments[p]);
+  }
+  return true;
+}
+
+template <class CellType>
+enable_if_t<!has_interface_polygons<CellType>::value, bool>
+calculateInterfacePlaneMoments(const CellType&, const PlanarSeparator&,
+                               InterfacePlaneMoments*) {
+  return false;
+}
+
+inline Eigen::Vector3d normalRateFromRotation(const Normal& a_axis,
+                                              const Normal& a_normal) {
+  return interface_jacobian_details::toVector(a_axis).cross(
+      interface_jacobian_details::toVector(a_normal));
+}
+
+inline void calculateLiquidMomentsRate(
+    const UnsignedIndex_t a_number_of_planes,
+    const InterfacePlaneMoments* a_moments, const PlaneRate* a_rates,
+    const double a_shift_rate, double* a_volume_rate,
+    Eigen::Vector3d* a_first_moment_rate) {
+  *a_volume_rate = 0.0;
+  a_first_moment_rate->setZero();
+  for (UnsignedIndex_t p = 0; p < a_number_of_planes; ++p) {
+    const double distance_rate = a_rates[p].distance + a_shift_rate;
+    *a_volume_rate += a_moments[p].area * distance_rate -
+                      a_rates[p].normal.dot(a_moments[p].first);
+    *a_first_moment_rate += distance_rate * a_moments[p].first -
+                            a_moments[p].second * a_rates[p].normal;
+  }
+}
+
+inline bool calculateVolumeConservingShiftRate(
+    const UnsignedIndex_t a_number_of_planes,
+    const InterfacePlaneMoments* a_moments, const PlaneRate* a_rates,
+    double* a_shift_rate) {
+  double area = 0.0;
+  for (UnsignedIndex_t p = 0; p < a_number_of_planes; ++p) {
+    area += a_moments[p].area;
+  }
+  if (area <= 0.0) {
+    return false;
+  }
+  double volume_rate;
+  Eigen::Vector3d first_moment_rate;
+  calculateLiquidMomentsRate(a_number_of_planes, a_moments, a_rates, 0.0,
+                             &volume_rate, &first_moment_rate);
+  *a_shift_rate = -volume_rate / area;
+  return true;
+}
+
+inline PlanarSeparator stepReconstruction(
+    const PlanarSeparator& a_reconstruction, const PlaneRate* a_rates,
+    const double a_shift_rate, const double a_step) {
+  PlanarSeparator stepped_reconstruction = a_reconstruction;
+  for (UnsignedIndex_t p = 0; p < a_reconstruction.getNumberOfPlanes(); ++p) {
+    const Normal& normal = a_reconstruction[p].normal();
+    stepped_reconstruction[p].normal() =
+        Normal::normalized(normal[0] + a_step * a_rates[p].normal[0],
+                           normal[1] + a_step * a_rates[p].normal[1],
+                           normal[2] + a_step * a_rates[p].normal[2]);
+    stepped_reconstruction[p].distance() =
+        a_reconstruction[p].distance() +
+        a_step * (a_rates[p].distance + a_shift_rate);
+  }
+  return stepped_reconstruction;
+}
+
+}  // namespace IRL
+
+#endif  // IRL_INTERFACE_RECONSTRUCTION_METHODS_INTERFACE_JACOBIAN_TPP_
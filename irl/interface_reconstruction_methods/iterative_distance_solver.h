@@ -16,10 +16,12 @@
 
 #include "irl/data_structures/stack_vector.h"
 #include "irl/generic_cutting/generic_cutting.h"
+#include "irl/generic_cutting/half_edge_cutting/distance_cut_session.h"
 #include "irl/geometry/general/normal.h"
 #include "irl/geometry/general/plane.h"
 #include "irl/geometry/polyhedrons/rectangular_cuboid.h"
 #include "irl/helpers/helper.h"
+#include "irl/helpers/telemetry.h"
 #include "irl/optimization/bisection.h"
 #include "irl/optimization/secant.h"
 #include "irl/parameters/constants.h"
@@ -47,6 +49,10 @@ namespace IRL {
 /// to find distances for.
 /// param[out] distances_m Correct distance to plane is stored
 /// in distances_m after construction of the object.
+///
+/// When cutting polyhedra with HalfEdgeCutting, volumes are obtained
+/// through the DistanceCutSession of the calling thread, so that the cell
+/// is only clipped again when a plane crosses one of its vertices.
 template <class CuttingMethod, class CellType,
           UnsignedIndex_t kMaxPlanes =
               global_constants::MAX_PLANAR_SEPARATOR_PLANES>
@@ -54,6 +60,9 @@ class IterativeSolverForDistance {
   /// \brief Max number of iterations for the Newton-Raphson Solver
   static constexpr UnsignedIndex_t max_iter_m = {15};
   static constexpr UnsignedIndex_t max_bisection_iter = {40};
+  /// \brief Whether volumes come from a DistanceCutSession.
+  static constexpr bool uses_cut_session_m =
+      isHalfEdgeCutting<CuttingMethod>::value && is_polyhedron<CellType>::value;
 
 public:
   /// \brief Constructor that initializes the class for optimization
@@ -128,6 +137,8 @@ private:
 
   /// \brief Cell distance is being calculated for.
   const CellType *cell_m;
+  /// \brief Volume of cell_m
+  double cell_volume_m;
   /// \brief Target volume fraction to match
   double target_volume_fraction_m;
   /// \brief Tolerance to match volume fraction within
@@ -62,9 +62,16 @@ template <class CuttingMethod, class CellType, UnsignedIndex_t kMaxPlanes>
 double
 IterativeSolverForDistance<CuttingMethod, CellType,
                            kMaxPlanes>::calculateSignedScalarError(void) {
+  countTelemetry(TelemetryCounter::DistanceSolverIterations);
   reconstruction_m.setDistances(distances_m);
-  return target_volume_fraction_m -
-         getVolumeFraction<CuttingMethod>(*cell_m, reconstruction_m);
+  if constexpr (uses_cut_session_m) {
+    return target_volume_fraction_m -
+           getDistanceCutSession<CellType>().calculateVolume(reconstruction_m) /
+               safelyTiny(cell_volume_m);
+  } else {
+    return target_volume_fraction_m -
+           getVolumeFraction<CuttingMethod>(*cell_m, reconstruction_m);
+  }
 }
 
 template <class CuttingMethod, class CellType, UnsignedIndex_t kMaxPlanes>
@@ -97,7 +104,11 @@ IterativeSolverForDistance<CuttingMethod, CellType, kMaxPlanes>::getDistances(
 template <class CuttingMethod, class CellType, UnsignedIndex_t kMaxPlanes>
 void IterativeSolverForDistance<CuttingMethod, CellType, kMaxPlanes>::setup(
     void) {
-  characteristic_length_m = std::cbrt(cell_m->calculateVolume());
+  cell_volume_m = cell_m->calculateVolume();
+  characteristic_length_m = std::cbrt(cell_volume_m);
+  if constexpr (uses_cut_session_m) {
+    getDistanceCutSession<CellType>().setCell(*cell_m);
+  }
   current_guess_m = 0.0;
   if (target_volume_fraction_m > 0.5) {
     flipped_solution_m = true;
@@ -186,6 +197,7 @@ void IterativeSolverForDistance<CuttingMethod, CellType,
 template <class CuttingMethod, class CellType, UnsignedIndex_t kMaxPlanes>
 void IterativeSolverForDistance<CuttingMethod, CellType,
                                 kMaxPlanes>::solveForDistance(void) {
+  TelemetryScopedTimer timer(TelemetryTimer::DistanceSolver);
   // Setup the system
   this->setup();
 
@@ -24,9 +24,11 @@
 #include "irl/geometry/general/rotations.h"
 #include "irl/geometry/general/unit_quaternion.h"
 #include "irl/geometry/polygons/polygon.h"
+#include "irl/interface_reconstruction_methods/interface_jacobian.h"
 #include "irl/interface_reconstruction_methods/lvira_neighborhood.h"
 #include "irl/interface_reconstruction_methods/optimization_behavior.h"
 #include "irl/interface_reconstruction_methods/reconstruction_cleaning.h"
+#include "irl/interface_reconstruction_methods/reconstruction_warm_start_cache.h"
 #include "irl/optimization/bfgs.h"
 #include "irl/optimization/levenberg_marquardt.h"
 #include "irl/parameters/compiler_type.h"
@@ -103,9 +105,18 @@ class LVIRACommon {
   /// \brief Set the optimization parameters.
   void setOptimizationBehavior(const OptimizationBehavior& a_parameters);
 
+  /// \brief Return the number of iterations taken by the last optimization.
+  UnsignedIndex_t getIterationCount(void) const;
+
+  /// \brief Warm-start each following optimization from, and save its final
+  /// state to, the entry for `a_cell_id` in `a_cache`. Passing a nullptr
+  /// cache turns warm-starting back off.
+  void setWarmStartCache(ReconstructionWarmStartCache* a_cache,
+                         const LargeOffsetIndex_t a_cell_id);
+
   /// \brief Calculate the vector error correct_values_m - guess_values_m
   /// where both vectors already have weight applied.
-  Eigen::Matrix<double, Eigen::Dynamic, 1> calculateVectorError(void);
+  const Eigen::Matrix<double, Eigen::Dynamic, 1>& calculateVectorError(void);
 
   /// \brief Return a boolean stating whether the value is too high or not.
   bool errorTooHigh(const double a_error);
@@ -152,7 +163,8 @@ class LVIRACommon {
 
   /// \brief Calculate and return vector of differences between `guess_values_m`
   /// and `best_values_m`. Used in Jacobian calculation.
-  Eigen::Matrix<double, Eigen::Dynamic, 1> calculateChangeInGuess(void);
+  const Eigen::Matrix<double, Eigen::Dynamic, 1>& calculateChangeInGuess(
+      void);
 
   /// \brief Return the best reconstruction found during the optimization
   /// procedure.
@@ -209,6 +221,10 @@ class LVIRACommon {
   PlanarSeparator guess_reconstruction_m;
   /// \brief Guess reference frame used when obtaining `guess_reconstruction_m`.
   ReferenceFrame guess_reference_frame_m;
+  /// \brief Storage returned by `calculateVectorError()`.
+  Eigen::Matrix<double, Eigen::Dynamic, 1> vector_error_m;
+  /// \brief Storage returned by `calculateChangeInGuess()`.
+  Eigen::Matrix<double, Eigen::Dynamic, 1> change_in_guess_m;
   //----------------------------------------------------------------------
 
   // Values saved throughout solution
@@ -219,6 +235,12 @@ class LVIRACommon {
   PlanarSeparator best_reconstruction_m;
   /// \brief Reference frame associated with the best reconstruction.
   ReferenceFrame best_reference_frame_m;
+  /// \brief Number of iterations taken by the last optimization.
+  UnsignedIndex_t iteration_count_m = 0;
+  /// \brief Cache used to warm-start the optimization, if any.
+  ReconstructionWarmStartCache* warm_start_cache_m = nullptr;
+  /// \brief Cell id of the entry in `warm_start_cache_m`.
+  LargeOffsetIndex_t warm_start_cell_id_m = 0;
   //----------------------------------------------------------------------
 };
 
@@ -284,6 +306,14 @@ class LVIRA_3D : public LVIRACommon<CellType, LVIRA_3D_columns> {
   /// stores weighted guess_value vector in `guess_values_m`.
   void updateGuess(const Eigen::Matrix<double, columns_m, 1>* const a_delta);
 
+  /// \brief Fill `a_jacobian_transpose` with the transpose of the analytic
+  /// Jacobian of the guess vector at the best guess, found from the
+  /// interface polygon in each cell. Returns false if it can not be found,
+  /// in which case finite differences are used.
+  bool calculateAnalyticJacobianTranspose(
+      Eigen::Matrix<double, static_cast<int>(columns_m), Eigen::Dynamic>*
+          a_jacobian_transpose);
+
  private:
   /// \brief Return rotation for LVIRA dictated by elements in `a_delta`.
   ///
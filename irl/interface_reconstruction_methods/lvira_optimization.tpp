@@ -19,13 +19,39 @@ PlanarSeparator LVIRACommon<CellType, kColumns>::runOptimization(
     const LVIRANeighborhood<CellType>& a_neighborhood_geometry,
     const PlanarSeparator& a_reconstruction) {
   neighborhood_m = &a_neighborhood_geometry;
-  a_ptr_to_LVIRA_object->setup(a_reconstruction);
-  LevenbergMarquardt<LVIRAType, -1, static_cast<int>(LVIRAType::columns_m)>
+  // Held per thread so their storage is reused by later solves.
+  thread_local static ReconstructionWarmStart warm_start;
+  thread_local static LevenbergMarquardt<
+      LVIRAType, -1, static_cast<int>(LVIRAType::columns_m)>
       lm_solver;
+  const bool is_warm_started =
+      warm_start_cache_m != nullptr &&
+      warm_start_cache_m->find(warm_start_cell_id_m, &warm_start) &&
+      warm_start.reconstruction.getNumberOfPlanes() ==
+          a_reconstruction.getNumberOfPlanes();
+  a_ptr_to_LVIRA_object->setup(is_warm_started ? warm_start.reconstruction
+                                               : a_reconstruction);
+  if (is_warm_started) {
+    lm_solver.setInitialLambda(warm_start.lambda);
+    if (warm_start.jacobian_transpose.rows() ==
+            static_cast<int>(LVIRAType::columns_m) &&
+        warm_start.jacobian_transpose.cols() == correct_values_m.rows()) {
+      lm_solver.setInitialJacobianTranspose(warm_start.jacobian_transpose);
+    }
+  }
   lm_solver.solve(a_ptr_to_LVIRA_object,
                   static_cast<int>(correct_values_m.rows()),
                   a_ptr_to_LVIRA_object->getJacobianStepSize());
-  return a_ptr_to_LVIRA_object->getFinalReconstruction();
+  iteration_count_m = lm_solver.getIterationCount();
+  PlanarSeparator final_reconstruction =
+      a_ptr_to_LVIRA_object->getFinalReconstruction();
+  if (warm_start_cache_m != nullptr) {
+    warm_start.reconstruction = final_reconstruction;
+    warm_start.lambda = lm_solver.getLambda();
+    warm_start.jacobian_transpose = lm_solver.getJacobianTranspose();
+    warm_start_cache_m->store(warm_start_cell_id_m, warm_start);
+  }
+  return final_reconstruction;
 }
 
 template <class CellType, UnsignedIndex_t kColumns>
@@ -40,9 +66,22 @@ void LVIRACommon<CellType, kColumns>::setOptimizationBehavior(
 }
 
 template <class CellType, UnsignedIndex_t kColumns>
-Eigen::Matrix<double, Eigen::Dynamic, 1>
+UnsignedIndex_t LVIRACommon<CellType, kColumns>::getIterationCount(void) const {
+  return iteration_count_m;
+}
+
+template <class CellType, UnsignedIndex_t kColumns>
+void LVIRACommon<CellType, kColumns>::setWarmStartCache(
+    ReconstructionWarmStartCache* a_cache, const LargeOffsetIndex_t a_cell_id) {
+  warm_start_cache_m = a_cache;
+  warm_start_cell_id_m = a_cell_id;
+}
+
+template <class CellType, UnsignedIndex_t kColumns>
+const Eigen::Matrix<double, Eigen::Dynamic, 1>&
 LVIRACommon<CellType, kColumns>::calculateVectorError(void) {
-  return (correct_values_m - guess_values_m);
+  vector_error_m = correct_values_m - guess_values_m;
+  return vector_error_m;
 }
 
 template <class CellType, UnsignedIndex_t kColumns>
@@ -122,9 +161,10 @@ void LVIRACommon<CellType, kColumns>::updateBestGuess(void) {
 }
 
 template <class CellType, UnsignedIndex_t kColumns>
-Eigen::Matrix<double, Eigen::Dynamic, 1>
+const Eigen::Matrix<double, Eigen::Dynamic, 1>&
 LVIRACommon<CellType, kColumns>::calculateChangeInGuess(void) {
-  return guess_values_m - best_values_m;
+  change_in_guess_m = guess_values_m - best_values_m;
+  return change_in_guess_m;
 }
 
 template <class CellType, UnsignedIndex_t kColumns>
@@ -154,11 +194,14 @@ const ReferenceFrame& LVIRACommon<CellType, kColumns>::getGuessReferenceFrame(
 template <class CellType, UnsignedIndex_t kColumns>
 void LVIRACommon<CellType, kColumns>::allocateMatrices(
     const UnsignedIndex_t a_neighborhood_size) {
+  // Resizing keeps the storage of earlier solves of the same size.
   const int rows = static_cast<int>(a_neighborhood_size);
-  this->weights_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->correct_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->guess_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->best_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
+  weights_m.resize(rows);
+  correct_values_m.resize(rows);
+  guess_values_m.resize(rows);
+  best_values_m.resize(rows);
+  vector_error_m.resize(rows);
+  change_in_guess_m.resize(rows);
 }
 
 template <class CellType, UnsignedIndex_t kColumns>
@@ -282,6 +325,48 @@ void LVIRA_3D<CellType>::updateGuess(
       this->guess_reconstruction_m);
 }
 
+template <class CellType>
+bool LVIRA_3D<CellType>::calculateAnalyticJacobianTranspose(
+    Eigen::Matrix<double, static_cast<int>(columns_m), Eigen::Dynamic>*
+        a_jacobian_transpose) {
+  if (!this->optimization_behavior_m.analytic_jacobian) {
+    return false;
+  }
+  const auto& reconstruction = this->best_reconstruction_m;
+  PlaneRate rates[columns_m];
+  for (UnsignedIndex_t p = 0; p < columns_m; ++p) {
+    rates[p].normal = normalRateFromRotation(
+        this->best_reference_frame_m[p], reconstruction[0].normal());
+    rates[p].distance = 0.0;
+  }
+  // The distance follows the rotation to keep the center cell's volume.
+  InterfacePlaneMoments moments;
+  double shift_rates[columns_m];
+  if (!calculateInterfacePlaneMoments(this->neighborhood_m->getCenterCell(),
+                                      reconstruction, &moments)) {
+    return false;
+  }
+  for (UnsignedIndex_t p = 0; p < columns_m; ++p) {
+    if (!calculateVolumeConservingShiftRate(1, &moments, &rates[p],
+                                            &shift_rates[p])) {
+      return false;
+    }
+  }
+  for (UnsignedIndex_t i = 0; i < this->neighborhood_m->size(); ++i) {
+    const auto& cell = this->neighborhood_m->getCell(i);
+    calculateInterfacePlaneMoments(cell, reconstruction, &moments);
+    const double scale = this->weights_m(i) / cell.calculateVolume();
+    for (UnsignedIndex_t p = 0; p < columns_m; ++p) {
+      double volume_rate;
+      Eigen::Vector3d first_moment_rate;
+      calculateLiquidMomentsRate(1, &moments, &rates[p], shift_rates[p],
+                                 &volume_rate, &first_moment_rate);
+      (*a_jacobian_transpose)(p, i) = scale * volume_rate;
+    }
+  }
+  return true;
+}
+
 template <class CellType>
 UnitQuaternion LVIRA_3D<CellType>::getDeltaRotationQuat(
     const ReferenceFrame& a_reference_frame,
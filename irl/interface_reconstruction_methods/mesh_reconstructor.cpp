@@ -0,0 +1,147 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/interface_reconstruction_methods/mesh_reconstructor.h"
+
+#include <algorithm>
+
+#include "irl/interface_reconstruction_methods/elvira.h"
+
+namespace IRL {
+
+MeshReconstructor::MeshReconstructor(const UnsignedIndex_t a_number_of_threads)
+    : pool_m(a_number_of_threads),
+      method_m(MeshReconstructionMethod::LVIRA3D),
+      grain_size_m(8),
+      warm_start_cache_m(nullptr),
+      cell_times_m(),
+      cell_iterations_m(),
+      number_of_mixed_cells_m(0) {}
+
+void MeshReconstructor::setMethod(const MeshReconstructionMethod a_method) {
+  method_m = a_method;
+}
+
+MeshReconstructionMethod MeshReconstructor::getMethod(void) const {
+  return method_m;
+}
+
+void MeshReconstructor::setGrainSize(const UnsignedIndex_t a_grain_size) {
+  grain_size_m = std::max(static_cast<UnsignedIndex_t>(1), a_grain_size);
+}
+
+UnsignedIndex_t MeshReconstructor::getNumberOfThreads(void) const {
+  return pool_m.getNumberOfThreads();
+}
+
+void MeshReconstructor::setWarmStartCache(
+    ReconstructionWarmStartCache* a_cache) {
+  warm_start_cache_m = a_cache;
+}
+
+void MeshReconstructor::reconstruct(
+    const UnsignedIndex_t a_nx, const UnsignedIndex_t a_ny,
+    const UnsignedIndex_t a_nz, const double* a_x, const double* a_y,
+    const double* a_z, const double* a_liquid_volume_fraction,
+    const Pt* a_liquid_centroid, const Pt* a_gas_centroid,
+    PlanarSeparator* a_reconstructions) {
+  using namespace mesh_reconstructor_details;
+  const UnsignedIndex_t number_of_cells = a_nx * a_ny * a_nz;
+  this->resetStatistics(number_of_cells);
+  if (a_nx < 3 || a_ny < 3 || a_nz < 3) {
+    return;
+  }
+  std::vector<Workspace<RectangularCuboid>> workspaces(
+      pool_m.getNumberOfThreads());
+  for (auto& workspace : workspaces) {
+    workspace.cell_storage.resize(27);
+    workspace.cells.resize(27);
+    workspace.members.resize(27);
+    workspace.elvira_neighborhood.resize(27);
+  }
+  std::atomic<UnsignedIndex_t> number_of_mixed_cells{0};
+  pool_m.parallelFor(
+      number_of_cells, grain_size_m,
+      [&](const UnsignedIndex_t a_cell, const UnsignedIndex_t a_thread) {
+        const UnsignedIndex_t i = a_cell % a_nx;
+        const UnsignedIndex_t j = (a_cell / a_nx) % a_ny;
+        const UnsignedIndex_t k = a_cell / (a_nx * a_ny);
+        if (i == 0 || j == 0 || k == 0 || i == a_nx - 1 || j == a_ny - 1 ||
+            k == a_nz - 1) {
+          return;
+        }
+        if (isPureCell(a_liquid_volume_fraction[a_cell])) {
+          a_reconstructions[a_cell] =
+              pureCellReconstruction(a_liquid_volume_fraction[a_cell]);
+          if (warm_start_cache_m != nullptr) {
+            warm_start_cache_m->evict(a_cell);
+          }
+          return;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        auto& workspace = workspaces[a_thread];
+        // Center cell first, followed by the 26 neighbors.
+        UnsignedIndex_t s = 1;
+        for (UnsignedIndex_t kk = k - 1; kk <= k + 1; ++kk) {
+          for (UnsignedIndex_t jj = j - 1; jj <= j + 1; ++jj) {
+            for (UnsignedIndex_t ii = i - 1; ii <= i + 1; ++ii) {
+              const UnsignedIndex_t local =
+                  (ii == i && jj == j && kk == k) ? 0 : s++;
+              workspace.cell_storage[local] =
+                  RectangularCuboid::fromBoundingPts(
+                      Pt(a_x[ii], a_y[jj], a_z[kk]),
+                      Pt(a_x[ii + 1], a_y[jj + 1], a_z[kk + 1]));
+              workspace.cells[local] = &workspace.cell_storage[local];
+              workspace.members[local] = ii + a_nx * (jj + a_ny * kk);
+              workspace.elvira_neighborhood.setMember(
+                  &workspace.cell_storage[local],
+                  a_liquid_volume_fraction + workspace.members[local],
+                  static_cast<int>(ii) - static_cast<int>(i),
+                  static_cast<int>(jj) - static_cast<int>(j),
+                  static_cast<int>(kk) - static_cast<int>(k));
+            }
+          }
+        }
+        if (method_m == MeshReconstructionMethod::ELVIRA3D) {
+          ELVIRA_3D elvira_system;
+          a_reconstructions[a_cell] =
+              elvira_system.solve(&workspace.elvira_neighborhood);
+          cell_iterations_m[a_cell] = 0;
+        } else {
+          cell_iterations_m[a_cell] = this->reconstructMixedCell(
+              method_m, a_liquid_volume_fraction, a_liquid_centroid,
+              a_gas_centroid, &workspace, a_reconstructions + a_cell);
+        }
+        cell_times_m[a_cell] = secondsSince(start);
+        number_of_mixed_cells.fetch_add(1, std::memory_order_relaxed);
+      });
+  number_of_mixed_cells_m = number_of_mixed_cells.load();
+}
+
+const std::vector<double>& MeshReconstructor::getCellTimes(void) const {
+  return cell_times_m;
+}
+
+const std::vector<UnsignedIndex_t>& MeshReconstructor::getCellIterations(
+    void) const {
+  return cell_iterations_m;
+}
+
+UnsignedIndex_t MeshReconstructor::getNumberOfMixedCells(void) const {
+  return number_of_mixed_cells_m;
+}
+
+void MeshReconstructor::resetStatistics(
+    const UnsignedIndex_t a_number_of_cells) {
+  cell_times_m.assign(a_number_of_cells, 0.0);
+  cell_iterations_m.assign(a_number_of_cells, 0);
+  number_of_mixed_cells_m = 0;
+}
+
+}  // namespace IRL
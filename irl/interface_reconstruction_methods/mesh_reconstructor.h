@@ -0,0 +1,163 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_INTERFACE_RECONSTRUCTION_METHODS_MESH_RECONSTRUCTOR_H_
+#define IRL_INTERFACE_RECONSTRUCTION_METHODS_MESH_RECONSTRUCTOR_H_
+
+#include <vector>
+
+#include "irl/geometry/general/pt.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/helpers/work_stealing_thread_pool.h"
+#include "irl/interface_reconstruction_methods/elvira_neighborhood.h"
+#include "irl/interface_reconstruction_methods/lvira_neighborhood.h"
+#include "irl/interface_reconstruction_methods/r2p_neighborhood.h"
+#include "irl/interface_reconstruction_methods/reconstruction_warm_start_cache.h"
+#include "irl/moments/separated_volume_moments.h"
+#include "irl/moments/volume_moments.h"
+#include "irl/parameters/defined_types.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace IRL {
+
+/// \brief Reconstruction methods available to MeshReconstructor.
+enum class MeshReconstructionMethod : int {
+  ELVIRA3D = 0,
+  LVIRA3D = 1,
+  R2P3D = 2,
+  MOF3D = 3
+};
+
+/// \brief Reconstructs the interface over an entire mesh.
+///
+/// The neighborhood of each cell is built on the fly from arrays of
+/// liquid volume fraction and liquid/gas centroids, and cells are handed out
+/// to a WorkStealingThreadPool so that threads which only meet pure cells
+/// help with the (10-100x more expensive) mixed cells elsewhere in the mesh.
+///
+/// Pure cells, with a volume fraction outside of
+/// [getVolumeFractionLow(), getVolumeFractionHigh()], are given a
+/// PlanarSeparator with a zero normal that marks them as full or empty,
+/// without building a neighborhood.
+///
+/// For mixed cells, LVIRA and R2P start from the plane normal to the
+/// liquid-to-gas centroid direction, with the distance set to match the
+/// volume fraction. After each call, the wall-clock time and the
+/// optimization iterations spent on every cell are available through
+/// `getCellTimes()` and `getCellIterations()`; both are zero for pure
+/// cells, and iterations are zero for ELVIRA, which is not iterative.
+class MeshReconstructor {
+ public:
+  /// \brief Construct with `a_number_of_threads` threads, including the
+  /// calling thread.
+  explicit MeshReconstructor(const UnsignedIndex_t a_number_of_threads);
+
+  /// \brief Set the method used for mixed cells. Defaults to LVIRA3D.
+  void setMethod(const MeshReconstructionMethod a_method);
+
+  /// \brief Return the method used for mixed cells.
+  MeshReconstructionMethod getMethod(void) const;
+
+  /// \brief Set the number of consecutive cells a thread takes at once.
+  void setGrainSize(const UnsignedIndex_t a_grain_size);
+
+  /// \brief Return the number of threads work is shared between.
+  UnsignedIndex_t getNumberOfThreads(void) const;
+
+  /// \brief Warm-start LVIRA and R2P from `a_cache`, keyed by cell index,
+  /// evicting entries for cells that are pure. Pass a nullptr to stop
+  /// using the cache.
+  void setWarmStartCache(ReconstructionWarmStartCache* a_cache);
+
+  /// \brief Reconstruct a rectilinear mesh of `a_nx` x `a_ny` x `a_nz`
+  /// cells.
+  ///
+  /// Cell (i, j, k) spans [a_x[i], a_x[i+1]] x [a_y[j], a_y[j+1]] x
+  /// [a_z[k], a_z[k+1]] and is stored at index i + a_nx * (j + a_ny * k) of
+  /// every cell array. The outermost layer of cells is treated as ghost
+  /// cells: it is used in the 3x3x3 neighborhoods, but its reconstructions
+  /// are left unchanged.
+  void reconstruct(const UnsignedIndex_t a_nx, const UnsignedIndex_t a_ny,
+                   const UnsignedIndex_t a_nz, const double* a_x,
+                   const double* a_y, const double* a_z,
+                   const double* a_liquid_volume_fraction,
+                   const Pt* a_liquid_centroid, const Pt* a_gas_centroid,
+                   PlanarSeparator* a_reconstructions);
+
+  /// \brief Reconstruct an unstructured mesh of `a_number_of_cells` cells.
+  ///
+  /// The neighbors of cell n, not including n itself, are
+  /// `a_neighbors[a_neighbor_offsets[n]]` to
+  /// `a_neighbors[a_neighbor_offsets[n+1] - 1]`. ELVIRA requires a
+  /// structured 3x3x3 stencil, so LVIRA3D is used in its place here.
+  template <class CellType>
+  void reconstruct(const UnsignedIndex_t a_number_of_cells,
+                   const CellType* a_cells,
+                   const UnsignedIndex_t* a_neighbor_offsets,
+                   const UnsignedIndex_t* a_neighbors,
+                   const double* a_liquid_volume_fraction,
+                   const Pt* a_liquid_centroid, const Pt* a_gas_centroid,
+                   PlanarSeparator* a_reconstructions);
+
+  /// \brief Seconds spent on each cell during the last reconstruction.
+  const std::vector<double>& getCellTimes(void) const;
+
+  /// \brief Optimization iterations taken for each cell during the last
+  /// reconstruction.
+  const std::vector<UnsignedIndex_t>& getCellIterations(void) const;
+
+  /// \brief Number of mixed cells met during the last reconstruction.
+  UnsignedIndex_t getNumberOfMixedCells(void) const;
+
+  ~MeshReconstructor(void) = default;
+
+ private:
+  template <class CellType>
+  struct Workspace {
+    std::vector<CellType> cell_storage;
+    std::vector<const CellType*> cells;
+    std::vector<UnsignedIndex_t> members;
+    std::vector<SeparatedMoments<VolumeMoments>> moments;
+    LVIRANeighborhood<CellType> lvira_neighborhood;
+    R2PNeighborhood<CellType> r2p_neighborhood;
+    ELVIRANeighborhood elvira_neighborhood;
+  };
+
+  void resetStatistics(const UnsignedIndex_t a_number_of_cells);
+
+  // Reconstruct the cell at a_workspace->members[0] from the stencil
+  // gathered in a_workspace->cells and a_workspace->members, returning
+  // the number of iterations taken.
+  template <class CellType>
+  UnsignedIndex_t reconstructMixedCell(
+      const MeshReconstructionMethod a_method,
+      const double* a_liquid_volume_fraction, const Pt* a_liquid_centroid,
+      const Pt* a_gas_centroid, Workspace<CellType>* a_workspace,
+      PlanarSeparator* a_reconstruction) const;
+
+  template <class CellType>
+  PlanarSeparator getInitialGuess(const double* a_liquid_volume_fraction,
+                                  const Pt* a_liquid_centroid,
+                                  const Pt* a_gas_centroid,
+                                  const Workspace<CellType>& a_workspace) const;
+
+  WorkStealingThreadPool pool_m;
+  MeshReconstructionMethod method_m;
+  UnsignedIndex_t grain_size_m;
+  ReconstructionWarmStartCache* warm_start_cache_m;
+  std::vector<double> cell_times_m;
+  std::vector<UnsignedIndex_t> cell_iterations_m;
+  UnsignedIndex_t number_of_mixed_cells_m;
+};
+
+}  // namespace IRL
+
+#include "irl/interface_reconstruction_methods/mesh_reconstructor.tpp"
+
+#endif  // IRL_INTERFACE_RECONSTRUCTION_METHODS_MESH_RECONSTRUCTOR_H_
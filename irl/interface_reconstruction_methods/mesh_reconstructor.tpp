@@ -0,0 +1,215 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_INTERFACE_RECONSTRUCTION_METHODS_MESH_RECONSTRUCTOR_TPP_
+#define IRL_INTERFACE_RECONSTRUCTION_METHODS_MESH_RECONSTRUCTOR_TPP_
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+
+#include "irl/generic_cutting/cut_polygon.h"
+#include "irl/helpers/mymath.h"
+#include "irl/interface_reconstruction_methods/lvira_optimization.h"
+#include "irl/interface_reconstruction_methods/mof.h"
+#include "irl/interface_reconstruction_methods/r2p_optimization.h"
+#include "irl/interface_reconstruction_methods/reconstruction_cleaning.h"
+#include "irl/interface_reconstruction_methods/volume_fraction_matching.h"
+#include "irl/moments/cell_grouped_moments.h"
+#include "irl/parameters/constants.h"
+#include "irl/parameters/tolerance_context.h"
+
+namespace IRL {
+
+namespace mesh_reconstructor_details {
+inline bool isPureCell(const double a_liquid_volume_fraction) {
+  return a_liquid_volume_fraction < getVolumeFractionLow() ||
+         a_liquid_volume_fraction > getVolumeFractionHigh();
+}
+
+inline PlanarSeparator pureCellReconstruction(
+    const double a_liquid_volume_fraction) {
+  return PlanarSeparator::fromOnePlane(
+      Plane(Normal(0.0, 0.0, 0.0),
+            std::copysign(1.0, a_liquid_volume_fraction - 0.5)));
+}
+
+inline double secondsSince(
+    const std::chrono::steady_clock::time_point& a_start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       a_start)
+      .count();
+}
+
+template <class CellType>
+SeparatedMoments<VolumeMoments> separatedMomentsForCell(
+    const CellType& a_cell, const double a_liquid_volume_fraction,
+    const Pt& a_liquid_centroid, const Pt& a_gas_centroid) {
+  const double cell_volume = a_cell.calculateVolume();
+  return SeparatedMoments<VolumeMoments>(
+      VolumeMoments(a_liquid_volume_fraction * cell_volume,
+                    a_liquid_centroid),
+      VolumeMoments((1.0 - a_liquid_volume_fraction) * cell_volume,
+                    a_gas_centroid));
+}
+}  // namespace mesh_reconstructor_details
+
+template <class CellType>
+void MeshReconstructor::reconstruct(const UnsignedIndex_t a_number_of_cells,
+                                    const CellType* a_cells,
+                                    const UnsignedIndex_t* a_neighbor_offsets,
+                                    const UnsignedIndex_t* a_neighbors,
+                                    const double* a_liquid_volume_fraction,
+                                    const Pt* a_liquid_centroid,
+                                    const Pt* a_gas_centroid,
+                                    PlanarSeparator* a_reconstructions) {
+  using namespace mesh_reconstructor_details;
+  this->resetStatistics(a_number_of_cells);
+  const MeshReconstructionMethod method =
+      method_m == MeshReconstructionMethod::ELVIRA3D
+          ? MeshReconstructionMethod::LVIRA3D
+          : method_m;
+  std::vector<Workspace<CellType>> workspaces(pool_m.getNumberOfThreads());
+  std::atomic<UnsignedIndex_t> number_of_mixed_cells{0};
+  pool_m.parallelFor(
+      a_number_of_cells, grain_size_m,
+      [&](const UnsignedIndex_t a_cell, const UnsignedIndex_t a_thread) {
+        if (isPureCell(a_liquid_volume_fraction[a_cell])) {
+          a_reconstructions[a_cell] =
+              pureCellReconstruction(a_liquid_volume_fraction[a_cell]);
+          if (warm_start_cache_m != nullptr) {
+            warm_start_cache_m->evict(a_cell);
+          }
+          return;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        auto& workspace = workspaces[a_thread];
+        const UnsignedIndex_t first_neighbor = a_neighbor_offsets[a_cell];
+        const UnsignedIndex_t stencil_size =
+            1 + a_neighbor_offsets[a_cell + 1] - first_neighbor;
+        workspace.cells.resize(stencil_size);
+        workspace.members.resize(stencil_size);
+        workspace.cells[0] = a_cells + a_cell;
+        workspace.members[0] = a_cell;
+        for (UnsignedIndex_t s = 1; s < stencil_size; ++s) {
+          const UnsignedIndex_t neighbor = a_neighbors[first_neighbor + s - 1];
+          workspace.cells[s] = a_cells + neighbor;
+          workspace.members[s] = neighbor;
+        }
+        cell_iterations_m[a_cell] = this->reconstructMixedCell(
+            method, a_liquid_volume_fraction, a_liquid_centroid,
+            a_gas_centroid, &workspace, a_reconstructions + a_cell);
+        cell_times_m[a_cell] = secondsSince(start);
+        number_of_mixed_cells.fetch_add(1, std::memory_order_relaxed);
+      });
+  number_of_mixed_cells_m = number_of_mixed_cells.load();
+}
+
+template <class CellType>
+UnsignedIndex_t MeshReconstructor::reconstructMixedCell(
+    const MeshReconstructionMethod a_method,
+    const double* a_liquid_volume_fraction, const Pt* a_liquid_centroid,
+    const Pt* a_gas_centroid, Workspace<CellType>* a_workspace,
+    PlanarSeparator* a_reconstruction) const {
+  using namespace mesh_reconstructor_details;
+  const UnsignedIndex_t stencil_size =
+      static_cast<UnsignedIndex_t>(a_workspace->members.size());
+  const CellType& center_cell = *(a_workspace->cells[0]);
+  const UnsignedIndex_t center = a_workspace->members[0];
+
+  switch (a_method) {
+    case MeshReconstructionMethod::MOF3D: {
+      const auto center_moments = separatedMomentsForCell(
+          center_cell, a_liquid_volume_fraction[center],
+          a_liquid_centroid[center], a_gas_centroid[center]);
+      MOF_3D<CellType> mof_system;
+      *a_reconstruction = mof_system.solve(
+          CellGroupedMoments<CellType, SeparatedMoments<VolumeMoments>>(
+              &center_cell, &center_moments),
+          0.5, 0.5);
+      return mof_system.getIterationCount();
+    }
+
+    case MeshReconstructionMethod::R2P3D: {
+      auto& neighborhood = a_workspace->r2p_neighborhood;
+      a_workspace->moments.resize(stencil_size);
+      neighborhood.resize(stencil_size);
+      neighborhood.setCenterOfStencil(0);
+      for (UnsignedIndex_t s = 0; s < stencil_size; ++s) {
+        const UnsignedIndex_t member = a_workspace->members[s];
+        a_workspace->moments[s] = separatedMomentsForCell(
+            *(a_workspace->cells[s]), a_liquid_volume_fraction[member],
+            a_liquid_centroid[member], a_gas_centroid[member]);
+        neighborhood.setMember(s, a_workspace->cells[s],
+                               &(a_workspace->moments[s]));
+      }
+      PlanarSeparator initial_guess =
+          this->getInitialGuess(a_liquid_volume_fraction, a_liquid_centroid,
+                                a_gas_centroid, *a_workspace);
+      neighborhood.setSurfaceArea(
+          getReconstructionSurfaceArea(center_cell, initial_guess));
+      cleanReconstruction(center_cell, a_liquid_volume_fraction[center],
+                          &initial_guess);
+      R2P_3D1P<CellType> r2p_system;
+      r2p_system.setWarmStartCache(warm_start_cache_m, center);
+      *a_reconstruction = r2p_system.solve(neighborhood, initial_guess);
+      return r2p_system.getIterationCount();
+    }
+
+    default: {
+      auto& neighborhood = a_workspace->lvira_neighborhood;
+      neighborhood.resize(stencil_size);
+      neighborhood.setCenterOfStencil(0);
+      for (UnsignedIndex_t s = 0; s < stencil_size; ++s) {
+        neighborhood.setMember(
+            s, a_workspace->cells[s],
+            a_liquid_volume_fraction + a_workspace->members[s]);
+      }
+      const PlanarSeparator initial_guess =
+          this->getInitialGuess(a_liquid_volume_fraction, a_liquid_centroid,
+                                a_gas_centroid, *a_workspace);
+      LVIRA_3D<CellType> lvira_system;
+      lvira_system.setWarmStartCache(warm_start_cache_m, center);
+      *a_reconstruction = lvira_system.solve(neighborhood, initial_guess);
+      return lvira_system.getIterationCount();
+    }
+  }
+}
+
+template <class CellType>
+PlanarSeparator MeshReconstructor::getInitialGuess(
+    const double* a_liquid_volume_fraction, const Pt* a_liquid_centroid,
+    const Pt* a_gas_centroid, const Workspace<CellType>& a_workspace) const {
+  const CellType& center_cell = *(a_workspace.cells[0]);
+  const UnsignedIndex_t center = a_workspace.members[0];
+  const Pt center_centroid = center_cell.calculateCentroid();
+
+  Pt direction = a_gas_centroid[center] - a_liquid_centroid[center];
+  if (squaredMagnitude(direction) < DBL_MIN) {
+    // Without usable centroids, point away from the liquid in the stencil.
+    direction = Pt(0.0, 0.0, 0.0);
+    for (std::size_t s = 1; s < a_workspace.members.size(); ++s) {
+      const Pt offset = a_workspace.cells[s]->calculateCentroid() -
+                        center_centroid;
+      direction -= a_liquid_volume_fraction[a_workspace.members[s]] * offset;
+    }
+  }
+  const Normal normal = squaredMagnitude(direction) < DBL_MIN
+                            ? Normal(0.0, 0.0, 1.0)
+                            : Normal::fromPtNormalized(direction);
+  PlanarSeparator initial_guess =
+      PlanarSeparator::fromOnePlane(Plane(normal, normal * center_centroid));
+  setDistanceToMatchVolumeFractionPartialFill(
+      center_cell, a_liquid_volume_fraction[center], &initial_guess);
+  return initial_guess;
+}
+
+}  // namespace IRL
+
+#endif  // IRL_INTERFACE_RECONSTRUCTION_METHODS_MESH_RECONSTRUCTOR_TPP_
@@ -19,6 +19,7 @@
 #include "irl/generic_cutting/cut_polygon.h"
 #include "irl/geometry/general/rotations.h"
 #include "irl/geometry/polygons/polygon.h"
+#include "irl/interface_reconstruction_methods/interface_jacobian.h"
 #include "irl/interface_reconstruction_methods/volume_fraction_matching.h"
 #include "irl/interface_reconstruction_methods/optimization_behavior.h"
 #include "irl/moments/cell_grouped_moments.h"
@@ -60,6 +61,9 @@ class MOFCommon {
   /// \brief Set the optimization parameters.
   void setOptimizationBehavior(const OptimizationBehavior &a_parameters);
 
+  /// \brief Return the number of iterations taken by the last optimization.
+  UnsignedIndex_t getIterationCount(void) const;
+
   /// \brief Calculate the error ||a_correct_vector - a_attempt_vector||^2
   /// where both vectors are weighted geometry vectors.
   double calculateScalarError(void);
@@ -164,6 +168,8 @@ class MOFCommon {
   PlanarSeparator best_reconstruction_m;
   /// \brief Reference frame associated with the best reconstruction.
   ReferenceFrame best_reference_frame_m;
+  /// \brief Number of iterations taken by the last optimization.
+  UnsignedIndex_t iteration_count_m = 0;
   //----------------------------------------------------------------------
 };
 
@@ -246,6 +252,13 @@ class MOF_3D : public MOFCommon<CellType> {
 
   bool minimumReached(const Eigen::Matrix<double, columns_m, 1> a_delta);
 
+  /// \brief Fill `a_jacobian_transpose` with the transpose of the analytic
+  /// Jacobian of the guess vector at the best guess, found from the
+  /// interface polygon. Returns false if it can not be found, in which case
+  /// finite differences are used.
+  bool calculateAnalyticJacobianTranspose(
+      Eigen::Matrix<double, columns_m, rows_m>* a_jacobian_transpose);
+
   /// \brief Default destructor
   ~MOF_3D(void) = default;
 
@@ -25,6 +25,7 @@ PlanarSeparator MOFCommon<CellType>::runOptimization(
   LevenbergMarquardt<MOFType, MOFType::rows_m, MOFType::columns_m> lm_solver;
   lm_solver.solve(a_ptr_to_MOF_object,
                   a_ptr_to_MOF_object->getDefaultInitialDelta());
+  iteration_count_m = lm_solver.getIterationCount();
   //  BFGS<MOFType, MOFType::columns_m> bfgs_solver;
   //  bfgs_solver.solve(a_ptr_to_MOF_object,
   //                    a_ptr_to_MOF_object->getDefaultInitialDelta());
@@ -42,6 +43,11 @@ void MOFCommon<CellType>::setOptimizationBehavior(
   optimization_behavior_m = a_parameters;
 }
 
+template <class CellType>
+UnsignedIndex_t MOFCommon<CellType>::getIterationCount(void) const {
+  return iteration_count_m;
+}
+
 template <class CellType>
 double MOFCommon<CellType>::calculateScalarError(void) {
   return (correct_values_m - guess_values_m).squaredNorm();
@@ -294,6 +300,48 @@ bool MOF_3D<CellType>::minimumReached(
           std::fabs(a_delta(1)) < MOFCommon<CellType>::optimization_behavior_m.minimum_angle_change);
 }
 
+template <class CellType>
+bool MOF_3D<CellType>::calculateAnalyticJacobianTranspose(
+    Eigen::Matrix<double, columns_m, rows_m>* a_jacobian_transpose) {
+  if (!this->optimization_behavior_m.analytic_jacobian) {
+    return false;
+  }
+  const auto& cell = this->cell_grouped_data_m->getCell();
+  const auto& reconstruction = this->best_reconstruction_m;
+  const double cell_volume = cell.calculateVolume();
+  const double liquid_volume = this->volume_fraction_m * cell_volume;
+  const double gas_volume = cell_volume - liquid_volume;
+  InterfacePlaneMoments moments;
+  if (liquid_volume <= 0.0 || gas_volume <= 0.0 ||
+      !calculateInterfacePlaneMoments(cell, reconstruction, &moments)) {
+    return false;
+  }
+  for (int p = 0; p < columns_m; ++p) {
+    PlaneRate rate;
+    rate.normal = normalRateFromRotation(this->best_reference_frame_m[p],
+                                         reconstruction[0].normal());
+    rate.distance = 0.0;
+    double shift_rate;
+    if (!calculateVolumeConservingShiftRate(1, &moments, &rate,
+                                            &shift_rate)) {
+      return false;
+    }
+    // The liquid volume is held constant, so the centroids only change
+    // with the first moment, which the gas loses as the liquid gains it.
+    double volume_rate;
+    Eigen::Vector3d first_moment_rate;
+    calculateLiquidMomentsRate(1, &moments, &rate, shift_rate, &volume_rate,
+                               &first_moment_rate);
+    for (int d = 0; d < 3; ++d) {
+      (*a_jacobian_transpose)(p, d) =
+          this->weights_m(d) * first_moment_rate(d) / liquid_volume;
+      (*a_jacobian_transpose)(p, 3 + d) =
+          -this->weights_m(3 + d) * first_moment_rate(d) / gas_volume;
+    }
+  }
+  return true;
+}
+
 template <class CellType>
 inline UnitQuaternion MOF_3D<CellType>::getDeltaRotationQuat(
     const ReferenceFrame& a_reference_frame,
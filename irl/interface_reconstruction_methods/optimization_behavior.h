@@ -39,6 +39,9 @@ struct OptimizationBehavior {
   double initial_distance = 0.001;
   /// \brief Angle change to use when calculating finite-difference Jacobian.
   double finite_difference_angle = 0.001 * 0.0174533;  // 1e-3 Deg in radians
+  /// \brief Whether to use the analytic Jacobian of methods that have one
+  /// instead of finite differences.
+  bool analytic_jacobian = true;
 };
 
 }  // namespace IRL
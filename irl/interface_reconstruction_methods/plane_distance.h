@@ -25,6 +25,7 @@
 #include "irl/optimization/bisection.h"
 #include "irl/optimization/secant.h"
 #include "irl/parameters/constants.h"
+#include "irl/parameters/tolerance_context.h"
 #include "irl/planar_reconstruction/planar_separator.h"
 
 namespace IRL {
@@ -61,22 +62,19 @@ template <class CellType, class ReconstructionType>
 inline void runIterativeSolverForDistance(
     const CellType& a_cell, const double a_volume_fraction,
     ReconstructionType* a_reconstruction,
-    const double a_volume_fraction_tolerance =
-        global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);
+    const double a_volume_fraction_tolerance = getVolumeFractionTolerance());
 
 template <class CellType, class VolumeFractionArrayType>
 inline void runIterativeSolverForDistance(
     const CellType& a_cell, const VolumeFractionArrayType& a_volume_fraction,
     PlanarSeparatorPathGroup* a_reconstruction,
-    const double a_volume_fraction_tolerance =
-        global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);
+    const double a_volume_fraction_tolerance = getVolumeFractionTolerance());
 
 template <class CellType, class ReconstructionType>
 inline void runProgressiveDistanceSolver(
     const CellType& a_cell, const double a_volume_fraction,
     ReconstructionType* a_reconstruction,
-    const double a_volume_fraction_tolerance =
-        global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);
+    const double a_volume_fraction_tolerance = getVolumeFractionTolerance());
 
 }  // namespace IRL
 
@@ -20,6 +20,7 @@
 #include "irl/geometry/general/normal.h"
 #include "irl/geometry/general/plane.h"
 #include "irl/helpers/helper.h"
+#include "irl/helpers/telemetry.h"
 #include "irl/parameters/constants.h"
 #include "irl/planar_reconstruction/planar_separator.h"
 
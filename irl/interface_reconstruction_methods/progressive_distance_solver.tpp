@@ -117,6 +117,7 @@ bool ProgressiveDistanceSolver<CellType>::isBoundsTrueBounds(
 template <class CellType>
 void ProgressiveDistanceSolver<CellType>::solveForDistance(
     const CellType& a_cell) {
+  TelemetryScopedTimer timer(TelemetryTimer::DistanceSolver);
   // Setup the system
   this->setup(a_cell);
 
@@ -134,6 +135,7 @@ void ProgressiveDistanceSolver<CellType>::solveForDistance(
   double found_vof_amount = 0.0;
   while (bounding_indices[2] - bounding_indices[1] > 1) {
     bounding_indices[1] = (bounding_indices[0] + bounding_indices[2]) / 2;
+    countTelemetry(TelemetryCounter::DistanceSolverIterations);
     reconstruction_m[0].distance() = sorted_distances_m[bounding_indices[1]];
     splitHalfEdgePolytope(&under_polytope, &over_polytope, &complete_polytope,
                           reconstruction_m[0]);
@@ -241,6 +243,7 @@ void ProgressiveDistanceSolver<CellType>::solveForDistance(
   double error = bounding_values[0] - target_volume_fraction_m;
 
   for (UnsignedIndex_t iter = 0; iter < max_iter_m; ++iter) {
+    countTelemetry(TelemetryCounter::DistanceSolverIterations);
     delta *= -error / safelyEpsilon(error - old_error);
     old_error = error;
     reconstruction_m[0].distance() += delta;
@@ -272,6 +275,7 @@ void ProgressiveDistanceSolver<CellType>::solveForDistance(
 
   // Perform bisection since secant failed to find answer within tolerance.
   for (UnsignedIndex_t iter = 0; iter < max_bisection_iter; ++iter) {
+    countTelemetry(TelemetryCounter::DistanceSolverIterations);
     bounding_values[1] = 0.5 * (bounding_values[0] + bounding_values[2]);
     reconstruction_m[0].distance() = bounding_values[1];
     splitHalfEdgePolytope(&under_polytope, &over_polytope, &complete_polytope,
@@ -10,6 +10,7 @@
 #ifndef IRL_INTERFACE_RECONSTRUCTION_METHODS_R2P_OPTIMIZATION_H_
 #define IRL_INTERFACE_RECONSTRUCTION_METHODS_R2P_OPTIMIZATION_H_
 
+#include <array>
 #include <cmath>
 #include <iostream>
 #include <string>
@@ -23,9 +24,12 @@
 #include "irl/geometry/general/plane.h"
 #include "irl/geometry/general/rotations.h"
 #include "irl/geometry/polygons/polygon.h"
+#include "irl/interface_reconstruction_methods/interface_jacobian.h"
 #include "irl/interface_reconstruction_methods/r2p_neighborhood.h"
 #include "irl/interface_reconstruction_methods/optimization_behavior.h"
 #include "irl/interface_reconstruction_methods/reconstruction_cleaning.h"
+#include "irl/interface_reconstruction_methods/reconstruction_warm_start_cache.h"
+#include "irl/interface_reconstruction_methods/volume_fraction_matching.h"
 #include "irl/optimization/bfgs.h"
 #include "irl/optimization/levenberg_marquardt.h"
 #include "irl/optimization/levenberg_marquardt_scaled.h"
@@ -147,12 +151,21 @@ public:
   /// \brief Set the optimization parameters.
   void setOptimizationBehavior(const OptimizationBehavior &a_parameters);
 
+  /// \brief Return the number of iterations taken by the last optimization.
+  UnsignedIndex_t getIterationCount(void) const;
+
+  /// \brief Warm-start each following optimization from, and save its final
+  /// state to, the entry for `a_cell_id` in `a_cache`. Passing a nullptr
+  /// cache turns warm-starting back off.
+  void setWarmStartCache(ReconstructionWarmStartCache* a_cache,
+                         const LargeOffsetIndex_t a_cell_id);
+
   /// \brief Set the cost function relative weights.
   void setCostFunctionBehavior(const R2PWeighting &a_parameters);
 
   /// \brief Calculate the vector error a_correct_vector - a_attempt_vector
   /// where both vectors are weighted geometry vectors.
-  Eigen::Matrix<double, Eigen::Dynamic, 1> calculateVectorError(void);
+  const Eigen::Matrix<double, Eigen::Dynamic, 1> &calculateVectorError(void);
 
   /// \brief Return a boolean stating whether the value is too high or not.
   bool errorTooHigh(const double a_error);
@@ -181,7 +194,8 @@ public:
 
   /// \brief Calculate and return vector of differences between `guess_values_m`
   /// and `best_values_m`. Used in Jacobian calculation.
-  Eigen::Matrix<double, Eigen::Dynamic, 1> calculateChangeInGuess(void);
+  const Eigen::Matrix<double, Eigen::Dynamic, 1> &calculateChangeInGuess(
+      void);
 
   /// \brief Return the best reconstruction found during the optimization
   /// procedure.
@@ -270,6 +284,10 @@ public:
       double a_importance_of_liquid_centroid_relative_to_gas,
       double a_importance_of_centroid, double a_importance_of_surface_area);
 
+  /// \brief Size every geometry vector to `a_rows` entries, reusing their
+  /// storage from earlier solves when the size is unchanged.
+  void resizeGeometryVectors(const int a_rows);
+
   /// \brief Use reconstruction to calculate weighted `guess_values_m vector`
   void setWeightedGeometryVectorFromReconstruction(
       const PlanarSeparator &a_reconstruction);
@@ -279,6 +297,22 @@ public:
   inline void setWeightedGeometryVectorFromSurfaceArea(
       const PlanarSeparator &a_reconstruction);
 
+  /// \brief Fill `a_jacobian_transpose` with the transpose of the Jacobian
+  /// of the guess vector at the best guess, when the planes of
+  /// `best_reconstruction_m` change with each parameter at `a_rates` and
+  /// are then shifted to keep the volume fraction of the center cell.
+  ///
+  /// Volume and centroid rows are found from the interface polygons in
+  /// each cell. The surface area row is differenced in the center cell
+  /// alone, which needs no volume fraction matching. The shift rate of each
+  /// parameter is stored in `a_shift_rates`. Returns false if the Jacobian
+  /// can not be found this way.
+  bool calculateJacobianTransposeFromPlaneRates(
+      const std::array<std::array<PlaneRate, 2>, kColumns> &a_rates,
+      Eigen::Matrix<double, static_cast<int>(kColumns), Eigen::Dynamic>
+          *a_jacobian_transpose,
+      std::array<double, kColumns> *a_shift_rates);
+
   // TODO Fix this and turn back to private. For some compilers, the R2P
   // functions complain they can't access the private members. Seen happen with
   // GNU 7.x.x compiler versions.
@@ -315,6 +349,10 @@ public:
   PlanarSeparator guess_reconstruction_m;
   /// \brief Guess reference frame used when obtaining `guess_reconstruction_m`.
   ReferenceFrame guess_reference_frame_m;
+  /// \brief Storage returned by `calculateVectorError()`.
+  Eigen::Matrix<double, Eigen::Dynamic, 1> vector_error_m;
+  /// \brief Storage returned by `calculateChangeInGuess()`.
+  Eigen::Matrix<double, Eigen::Dynamic, 1> change_in_guess_m;
   //----------------------------------------------------------------------
 
   // Values saved throughout solution
@@ -325,6 +363,12 @@ public:
   PlanarSeparator best_reconstruction_m;
   /// \brief Reference frame associated with the best reconstruction.
   ReferenceFrame best_reference_frame_m;
+  /// \brief Number of iterations taken by the last optimization.
+  UnsignedIndex_t iteration_count_m = 0;
+  /// \brief Cache used to warm-start the optimization, if any.
+  ReconstructionWarmStartCache* warm_start_cache_m = nullptr;
+  /// \brief Cell id of the entry in `warm_start_cache_m`.
+  LargeOffsetIndex_t warm_start_cell_id_m = 0;
   //----------------------------------------------------------------------
 };
 
@@ -436,6 +480,13 @@ public:
   auto getDefaultInitialDelta(void)
       -> const Eigen::Matrix<double, columns_m, 1> &;
 
+  /// \brief Fill `a_jacobian_transpose` with the transpose of the analytic
+  /// Jacobian of the guess vector at the best guess. Returns false if it
+  /// can not be found, in which case finite differences are used.
+  bool calculateAnalyticJacobianTranspose(
+      Eigen::Matrix<double, static_cast<int>(columns_m), Eigen::Dynamic>
+          *a_jacobian_transpose);
+
 private:
   /// \brief Return rotation for R2P dictated by elements in `a_delta`.
   ///
@@ -581,6 +632,13 @@ public:
   /// \brief Return best beta_m value
   const double &getBestBeta(void);
 
+  /// \brief Fill `a_jacobian_transpose` with the transpose of the analytic
+  /// Jacobian of the guess vector at the best guess. Returns false if it
+  /// can not be found, in which case finite differences are used.
+  bool calculateAnalyticJacobianTranspose(
+      Eigen::Matrix<double, static_cast<int>(columns_m), Eigen::Dynamic>
+          *a_jacobian_transpose);
+
 private:
   /// \brief Return rotation for R2P dictated by elements in `a_delta`.
   ///
@@ -18,18 +18,55 @@ PlanarSeparator R2PCommon<CellType, kColumns>::runOptimization(
     R2PType *a_ptr_to_R2P_object,
     const R2PNeighborhood<CellType> &a_neighborhood_geometry,
     const PlanarSeparator &a_reconstruction) {
-  a_ptr_to_R2P_object->setup(a_neighborhood_geometry, a_reconstruction);
+  // Held per thread so their storage is reused by later solves.
+  thread_local static ReconstructionWarmStart warm_start;
+  thread_local static LevenbergMarquardt<
+      R2PType, -1, static_cast<int>(R2PType::columns_m)>
+      lm_solver;
+  const bool is_warm_started =
+      warm_start_cache_m != nullptr &&
+      warm_start_cache_m->find(warm_start_cell_id_m, &warm_start) &&
+      warm_start.reconstruction.getNumberOfPlanes() ==
+          a_reconstruction.getNumberOfPlanes();
+  if (is_warm_started) {
+    // The interface has moved since the cached solve, so only the
+    // orientation is reused.
+    const auto &center_cell = a_neighborhood_geometry.getCenterCell();
+    setDistanceToMatchVolumeFraction(
+        center_cell,
+        a_neighborhood_geometry.getCenterCellStoredMoments()[0].volume() /
+            center_cell.calculateVolume(),
+        &warm_start.reconstruction);
+  }
+  a_ptr_to_R2P_object->setup(a_neighborhood_geometry,
+                             is_warm_started ? warm_start.reconstruction
+                                             : a_reconstruction);
   // LevenbergMarquardtScaled<R2PType, static_cast<int>(R2PType::columns_m)>
   //    lm_solver;
-  LevenbergMarquardt<R2PType, -1, static_cast<int>(R2PType::columns_m)>
-      lm_solver;
+  if (is_warm_started) {
+    lm_solver.setInitialLambda(warm_start.lambda);
+    if (warm_start.jacobian_transpose.rows() ==
+            static_cast<int>(R2PType::columns_m) &&
+        warm_start.jacobian_transpose.cols() == correct_values_m.rows()) {
+      lm_solver.setInitialJacobianTranspose(warm_start.jacobian_transpose);
+    }
+  }
   lm_solver.solve(a_ptr_to_R2P_object,
                   static_cast<int>(correct_values_m.rows()),
                   a_ptr_to_R2P_object->getDefaultInitialDelta());
+  iteration_count_m = lm_solver.getIterationCount();
   //  BFGS<R2PType, static_cast<int>(R2PType::columns_m)> bfgs_solver;
   //  bfgs_solver.solve(a_ptr_to_R2P_object,
   //                    a_ptr_to_R2P_object->getDefaultInitialDelta());
-  return a_ptr_to_R2P_object->getFinalReconstruction();
+  PlanarSeparator final_reconstruction =
+      a_ptr_to_R2P_object->getFinalReconstruction();
+  if (warm_start_cache_m != nullptr) {
+    warm_start.reconstruction = final_reconstruction;
+    warm_start.lambda = lm_solver.getLambda();
+    warm_start.jacobian_transpose = lm_solver.getJacobianTranspose();
+    warm_start_cache_m->store(warm_start_cell_id_m, warm_start);
+  }
+  return final_reconstruction;
 }
 
 template <class CellType, UnsignedIndex_t kColumns>
@@ -48,6 +85,18 @@ void R2PCommon<CellType, kColumns>::setOptimizationBehavior(
   optimization_behavior_m = a_parameters;
 }
 
+template <class CellType, UnsignedIndex_t kColumns>
+UnsignedIndex_t R2PCommon<CellType, kColumns>::getIterationCount(void) const {
+  return iteration_count_m;
+}
+
+template <class CellType, UnsignedIndex_t kColumns>
+void R2PCommon<CellType, kColumns>::setWarmStartCache(
+    ReconstructionWarmStartCache *a_cache, const LargeOffsetIndex_t a_cell_id) {
+  warm_start_cache_m = a_cache;
+  warm_start_cell_id_m = a_cell_id;
+}
+
 template <class CellType, UnsignedIndex_t kColumns>
 void R2PCommon<CellType, kColumns>::setCostFunctionBehavior(
     const R2PWeighting &a_parameters) {
@@ -55,9 +104,10 @@ void R2PCommon<CellType, kColumns>::setCostFunctionBehavior(
 }
 
 template <class CellType, UnsignedIndex_t kColumns>
-Eigen::Matrix<double, Eigen::Dynamic, 1>
+const Eigen::Matrix<double, Eigen::Dynamic, 1> &
 R2PCommon<CellType, kColumns>::calculateVectorError(void) {
-  return (correct_values_m - guess_values_m);
+  vector_error_m = correct_values_m - guess_values_m;
+  return vector_error_m;
 }
 
 template <class CellType, UnsignedIndex_t kColumns>
@@ -100,9 +150,10 @@ void R2PCommon<CellType, kColumns>::saveBestGuess(void) {
 }
 
 template <class CellType, UnsignedIndex_t kColumns>
-Eigen::Matrix<double, Eigen::Dynamic, 1>
+const Eigen::Matrix<double, Eigen::Dynamic, 1> &
 R2PCommon<CellType, kColumns>::calculateChangeInGuess(void) {
-  return guess_values_m - best_values_m;
+  change_in_guess_m = guess_values_m - best_values_m;
+  return change_in_guess_m;
 }
 
 template <class CellType, UnsignedIndex_t kColumns>
@@ -183,6 +234,16 @@ UnsignedIndex_t findCellPhase(const CellType &a_cell,
   return cell_phase;
 }
 
+template <class CellType, UnsignedIndex_t kColumns>
+void R2PCommon<CellType, kColumns>::resizeGeometryVectors(const int a_rows) {
+  weights_m.resize(a_rows);
+  correct_values_m.resize(a_rows);
+  guess_values_m.resize(a_rows);
+  best_values_m.resize(a_rows);
+  vector_error_m.resize(a_rows);
+  change_in_guess_m.resize(a_rows);
+}
+
 template <class CellType, UnsignedIndex_t kColumns>
 void R2PCommon<CellType, kColumns>::setWeightedGeometryVectorFromReconstruction(
     const PlanarSeparator &a_reconstruction) {
@@ -221,6 +282,98 @@ R2PCommon<CellType, kColumns>::setWeightedGeometryVectorFromSurfaceArea(
           getReconstructionSurfaceArea(system_center_cell_m, a_reconstruction));
 }
 
+template <class CellType, UnsignedIndex_t kColumns>
+bool R2PCommon<CellType, kColumns>::calculateJacobianTransposeFromPlaneRates(
+    const std::array<std::array<PlaneRate, 2>, kColumns> &a_rates,
+    Eigen::Matrix<double, static_cast<int>(kColumns), Eigen::Dynamic>
+        *a_jacobian_transpose,
+    std::array<double, kColumns> *a_shift_rates) {
+  if (!optimization_behavior_m.analytic_jacobian) {
+    return false;
+  }
+  const UnsignedIndex_t number_of_planes =
+      best_reconstruction_m.getNumberOfPlanes();
+  assert(number_of_planes <= 2);
+  InterfacePlaneMoments moments[2];
+  if (!calculateInterfacePlaneMoments(system_center_cell_m,
+                                      best_reconstruction_m, moments)) {
+    return false;
+  }
+  for (UnsignedIndex_t p = 0; p < kColumns; ++p) {
+    if (!calculateVolumeConservingShiftRate(number_of_planes, moments,
+                                            a_rates[p].data(),
+                                            &(*a_shift_rates)[p])) {
+      return false;
+    }
+  }
+
+  a_jacobian_transpose->setZero();
+  for (UnsignedIndex_t i = 0; i < cells_to_cut_m.size(); ++i) {
+    // Cells the interface does not cross do not change.
+    if (findCellPhase(cells_to_cut_m[i], best_reconstruction_m) != 2) {
+      continue;
+    }
+    calculateInterfacePlaneMoments(cells_to_cut_m[i], best_reconstruction_m,
+                                   moments);
+    const auto cell_moments =
+        getVolumeMoments<SeparatedMoments<VolumeMoments>,
+                         ReconstructionDefaultCuttingMethod>(
+            cells_to_cut_m[i], best_reconstruction_m);
+    const double liquid_volume = cell_moments[0].volume();
+    const double gas_volume = cell_moments[1].volume();
+    const Pt liquid_centroid = cell_moments[0].centroid() /
+                               safelyEpsilon(liquid_volume);
+    const Pt gas_centroid = cell_moments[1].centroid() /
+                            safelyEpsilon(gas_volume);
+    const int start_index = static_cast<int>(7 * i);
+    for (UnsignedIndex_t p = 0; p < kColumns; ++p) {
+      double volume_rate;
+      Eigen::Vector3d first_moment_rate;
+      calculateLiquidMomentsRate(number_of_planes, moments, a_rates[p].data(),
+                                 (*a_shift_rates)[p], &volume_rate,
+                                 &first_moment_rate);
+      const int column = static_cast<int>(p);
+      (*a_jacobian_transpose)(column, start_index) =
+          weights_m(start_index) * volume_rate;
+      // The gas loses the volume and first moment the liquid gains.
+      for (int d = 0; d < 3; ++d) {
+        const UnsignedIndex_t dimension = static_cast<UnsignedIndex_t>(d);
+        if (liquid_volume > 0.0) {
+          (*a_jacobian_transpose)(column, start_index + 1 + d) =
+              weights_m(start_index + 1 + d) *
+              (first_moment_rate(d) -
+               liquid_centroid[dimension] * volume_rate) /
+              liquid_volume;
+        }
+        if (gas_volume > 0.0) {
+          (*a_jacobian_transpose)(column, start_index + 4 + d) =
+              weights_m(start_index + 4 + d) *
+              (gas_centroid[dimension] * volume_rate -
+               first_moment_rate(d)) /
+              gas_volume;
+        }
+      }
+    }
+  }
+
+  const int last_row = static_cast<int>(weights_m.rows()) - 1;
+  if (weights_m(last_row) != 0.0) {
+    const double step = optimization_behavior_m.finite_difference_angle;
+    for (UnsignedIndex_t p = 0; p < kColumns; ++p) {
+      const double surface_area =
+          getReconstructionSurfaceArea(
+              system_center_cell_m,
+              stepReconstruction(best_reconstruction_m, a_rates[p].data(),
+                                 (*a_shift_rates)[p], step));
+      (*a_jacobian_transpose)(static_cast<int>(p), last_row) =
+          (weights_m(last_row) * std::sqrt(surface_area) -
+           best_values_m(last_row)) /
+          step;
+    }
+  }
+  return true;
+}
+
 // Turn off warnings about sign conversion because need to work
 // with Eigen which using long int, and vector which uses std::size_t
 #pragma GCC diagnostic push
@@ -301,7 +454,7 @@ void R2PCommon<CellType, kColumns>::fillGeometryAndWeightVectors(
     double cell_volume = cells_to_cut_m[n].calculateVolume();
 
     // Add weighting for liquid centroid if there is liquid
-    if (correct_values_m(7 * n) / cell_volume > global_constants::VF_LOW) {
+    if (correct_values_m(7 * n) / cell_volume > getVolumeFractionLow()) {
       double front_multiplier = {(1.0 - volume_weight_switch) +
                                  correct_values_m(7 * n) / cell_volume *
                                      volume_weight_switch};
@@ -314,7 +467,7 @@ void R2PCommon<CellType, kColumns>::fillGeometryAndWeightVectors(
     weights_m(7 * n + 2) = weights_m(7 * n + 1);
     weights_m(7 * n + 3) = weights_m(7 * n + 1);
     // Add weighting for gas centroid if there is gas
-    if (correct_values_m(7 * n) / cell_volume < global_constants::VF_HIGH) {
+    if (correct_values_m(7 * n) / cell_volume < getVolumeFractionHigh()) {
       double front_multiplier = {(1.0 - volume_weight_switch) +
                                  (1.0 - correct_values_m(7 * n) / cell_volume) *
                                      volume_weight_switch};
@@ -546,11 +699,7 @@ void R2P_2D1P<CellType>::setup(const R2PNeighborhood<CellType> &a_neighborhood,
 template <class CellType>
 void R2P_2D1P<CellType>::allocateMatrices(
     const UnsignedIndex_t a_neighborhood_size) {
-  const int rows = static_cast<int>(a_neighborhood_size * 7) + 1;
-  this->weights_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->correct_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->guess_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->best_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
+  this->resizeGeometryVectors(static_cast<int>(a_neighborhood_size * 7 + 1));
 }
 
 template <class CellType>
@@ -640,11 +789,7 @@ void R2P_3D1P<CellType>::setup(const R2PNeighborhood<CellType> &a_neighborhood,
 template <class CellType>
 void R2P_3D1P<CellType>::allocateMatrices(
     const UnsignedIndex_t a_neighborhood_size) {
-  const int rows = static_cast<int>(a_neighborhood_size * 7) + 1;
-  this->weights_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->correct_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->guess_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->best_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
+  this->resizeGeometryVectors(static_cast<int>(a_neighborhood_size * 7 + 1));
 }
 
 template <class CellType>
@@ -680,6 +825,21 @@ auto R2P_3D1P<CellType>::getDefaultInitialDelta(void)
   return initial_delta_m;
 }
 
+template <class CellType>
+bool R2P_3D1P<CellType>::calculateAnalyticJacobianTranspose(
+    Eigen::Matrix<double, static_cast<int>(columns_m), Eigen::Dynamic>
+        *a_jacobian_transpose) {
+  const Normal &normal = this->best_reconstruction_m[0].normal();
+  std::array<std::array<PlaneRate, 2>, columns_m> rates;
+  for (UnsignedIndex_t p = 0; p < columns_m; ++p) {
+    rates[p][0] = PlaneRate{
+        normalRateFromRotation(this->best_reference_frame_m[p], normal), 0.0};
+  }
+  std::array<double, columns_m> shift_rates;
+  return this->calculateJacobianTransposeFromPlaneRates(
+      rates, a_jacobian_transpose, &shift_rates);
+}
+
 template <class CellType>
 UnitQuaternion R2P_3D1P<CellType>::getDeltaRotationQuat(
     const ReferenceFrame &a_reference_frame,
@@ -760,11 +920,7 @@ void R2P_2D2P<CellType>::setup(const R2PNeighborhood<CellType> &a_neighborhood,
 template <class CellType>
 void R2P_2D2P<CellType>::allocateMatrices(
     const UnsignedIndex_t a_neighborhood_size) {
-  const int rows = static_cast<int>(a_neighborhood_size * 7 + 1);
-  this->weights_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->correct_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->guess_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->best_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
+  this->resizeGeometryVectors(static_cast<int>(a_neighborhood_size * 7 + 1));
 }
 
 template <class CellType>
@@ -918,11 +1074,7 @@ void R2P_3D2P<CellType>::setup(const R2PNeighborhood<CellType> &a_neighborhood,
 template <class CellType>
 void R2P_3D2P<CellType>::allocateMatrices(
     const UnsignedIndex_t a_neighborhood_size) {
-  const int rows = static_cast<int>(a_neighborhood_size * 7 + 1);
-  this->weights_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->correct_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->guess_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
-  this->best_values_m = Eigen::Matrix<double, Eigen::Dynamic, 1>(rows, 1);
+  this->resizeGeometryVectors(static_cast<int>(a_neighborhood_size * 7 + 1));
 }
 
 template <class CellType>
@@ -991,6 +1143,45 @@ template <class CellType> const double &R2P_3D2P<CellType>::getBestBeta(void) {
   return best_beta_m;
 }
 
+template <class CellType>
+bool R2P_3D2P<CellType>::calculateAnalyticJacobianTranspose(
+    Eigen::Matrix<double, static_cast<int>(columns_m), Eigen::Dynamic>
+        *a_jacobian_transpose) {
+  const Normal &normal_0 = this->best_reconstruction_m[0].normal();
+  const Normal &normal_1 = this->best_reconstruction_m[1].normal();
+  const ReferenceFrame &frame = this->best_reference_frame_m;
+  const double length = this->characteristic_length_m;
+  std::array<std::array<PlaneRate, 2>, columns_m> rates;
+  // Rotations of the whole reconstruction.
+  for (UnsignedIndex_t p = 0; p < 3; ++p) {
+    rates[p][0] = PlaneRate{normalRateFromRotation(frame[p], normal_0), 0.0};
+    rates[p][1] = PlaneRate{normalRateFromRotation(frame[p], normal_1), 0.0};
+  }
+  // Beta opens the planes in opposite directions about frame[0].
+  rates[3][0] = PlaneRate{normalRateFromRotation(frame[0], normal_0), 0.0};
+  rates[3][1] = PlaneRate{-normalRateFromRotation(frame[0], normal_1), 0.0};
+  rates[4][0] = PlaneRate{Eigen::Vector3d::Zero(), length};
+  rates[4][1] = PlaneRate{Eigen::Vector3d::Zero(), 0.0};
+  rates[5][0] = PlaneRate{Eigen::Vector3d::Zero(), 0.0};
+  rates[5][1] = PlaneRate{Eigen::Vector3d::Zero(), length};
+  std::array<double, columns_m> shift_rates;
+  if (!this->calculateJacobianTransposeFromPlaneRates(
+          rates, a_jacobian_transpose, &shift_rates)) {
+    return false;
+  }
+  // updateGuess measures the distance parameters after the shift that
+  // matches the volume fraction, as must the Jacobian.
+  for (int p = 4; p < 6; ++p) {
+    const double scale =
+        1.0 + shift_rates[static_cast<UnsignedIndex_t>(p)] / length;
+    if (std::fabs(scale) < 1.0e-10) {
+      return false;
+    }
+    a_jacobian_transpose->row(p) /= scale;
+  }
+  return true;
+}
+
 template <class CellType>
 UnitQuaternion R2P_3D2P<CellType>::getDeltaRotationQuat(
     const ReferenceFrame &a_reference_frame,
@@ -15,6 +15,7 @@
 #include "irl/interface_reconstruction_methods/volume_fraction_matching.h"
 #include "irl/parameters/constants.h"
 #include "irl/parameters/defined_types.h"
+#include "irl/parameters/tolerance_context.h"
 
 namespace IRL {
 
@@ -23,6 +24,14 @@ inline void cleanReconstruction(const CellType& a_cell,
                                 const double a_volume_fraction,
                                 ReconstructionTyoe* a_reconstruction);
 
+/// \brief Clean `a_reconstruction` using the tolerances in
+/// `a_tolerances` instead of those installed on the calling thread.
+template <class CellType, class ReconstructionType>
+inline void cleanReconstruction(const CellType& a_cell,
+                                const double a_volume_fraction,
+                                ReconstructionType* a_reconstruction,
+                                const ToleranceContext& a_tolerances);
+
 template <class CellType, class ReconstructionType>
 inline void cleanReconstructionOutOfCell(const CellType& a_cell,
                                          const double a_volume_fraction,
@@ -20,6 +20,15 @@ inline void cleanReconstruction(const CellType& a_cell,
   cleanReconstructionSameNormal(a_cell, a_volume_fraction, a_reconstruction);
 }
 
+template <class CellType, class ReconstructionType>
+inline void cleanReconstruction(const CellType& a_cell,
+                                const double a_volume_fraction,
+                                ReconstructionType* a_reconstruction,
+                                const ToleranceContext& a_tolerances) {
+  ScopedToleranceContext tolerance_scope(a_tolerances);
+  cleanReconstruction(a_cell, a_volume_fraction, a_reconstruction);
+}
+
 template <class CellType, class ReconstructionType>
 inline void cleanReconstructionOutOfCell(const CellType& a_cell,
                                          const double a_volume_fraction,
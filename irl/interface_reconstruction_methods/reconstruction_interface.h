@@ -18,6 +18,8 @@
 #include "irl/interface_reconstruction_methods/r2p_optimization.h"
 #include "irl/interface_reconstruction_methods/optimization_behavior.h"
 #include "irl/interface_reconstruction_methods/reconstruction_cleaning.h"
+#include "irl/interface_reconstruction_methods/reconstruction_warm_start_cache.h"
+#include "irl/parameters/tolerance_context.h"
 #include "irl/planar_reconstruction/planar_separator.h"
 
 namespace IRL {
@@ -51,6 +53,14 @@ inline PlanarSeparator reconstructionWithR2P3D(
     const OptimizationBehavior& a_optimization_behavior,
     const R2PWeighting& a_r2p_weighting);
 
+/// \brief Perform R2P reconstruction for a 3D problem, warm-started from
+/// and saving its final state to the entry for `a_cell_id` in `a_cache`.
+template <class CellType>
+inline PlanarSeparator reconstructionWithR2P3D(
+    const R2PNeighborhood<CellType>& a_neighborhood_geometry,
+    PlanarSeparator a_initial_reconstruction,
+    ReconstructionWarmStartCache* a_cache, const LargeOffsetIndex_t a_cell_id);
+
 /// \brief Perform ELVIRA Reconstruction for 2D.
 inline PlanarSeparator reconstructionWithELVIRA2D(
     const ELVIRANeighborhood& a_neighborhood_geometry);
@@ -71,6 +81,14 @@ inline PlanarSeparator reconstructionWithLVIRA3D(
     const LVIRANeighborhood<CellType>& a_neighborhood_geometry,
     PlanarSeparator a_initial_reconstruction);
 
+/// \brief Perform LVIRA Reconstruction for 3D, warm-started from and
+/// saving its final state to the entry for `a_cell_id` in `a_cache`.
+template <class CellType>
+inline PlanarSeparator reconstructionWithLVIRA3D(
+    const LVIRANeighborhood<CellType>& a_neighborhood_geometry,
+    PlanarSeparator a_initial_reconstruction,
+    ReconstructionWarmStartCache* a_cache, const LargeOffsetIndex_t a_cell_id);
+
 /// \brief Perform MOF Reconstruction for 2D with optional weights.
 /// Defaults to even weighting.
 template <class CellType>
@@ -94,6 +112,36 @@ PlanarSeparator reconstructionWithAdvectedNormals(
     const R2PNeighborhood<CellType>& a_neighborhood,
     const double a_two_plane_threshold = 0.95);
 
+/// \brief Perform R2P reconstruction for a 3D problem using the tolerances
+/// in `a_tolerances` instead of those installed on the calling thread.
+template <class CellType>
+inline PlanarSeparator reconstructionWithR2P3D(
+    const R2PNeighborhood<CellType>& a_neighborhood_geometry,
+    PlanarSeparator a_initial_reconstruction,
+    const ToleranceContext& a_tolerances);
+
+/// \brief Perform ELVIRA Reconstruction for 3D using the tolerances
+/// in `a_tolerances`.
+inline PlanarSeparator reconstructionWithELVIRA3D(
+    const ELVIRANeighborhood& a_neighborhood_geometry,
+    const ToleranceContext& a_tolerances);
+
+/// \brief Perform LVIRA Reconstruction for 3D using the tolerances
+/// in `a_tolerances`.
+template <class CellType>
+inline PlanarSeparator reconstructionWithLVIRA3D(
+    const LVIRANeighborhood<CellType>& a_neighborhood_geometry,
+    PlanarSeparator a_initial_reconstruction,
+    const ToleranceContext& a_tolerances);
+
+/// \brief Perform MOF Reconstruction for 3D using the tolerances
+/// in `a_tolerances`, with optional weights.
+template <class CellType>
+PlanarSeparator reconstructionWithMOF3D(
+    const CellType& a_cell, const SeparatedMoments<VolumeMoments>& a_svm,
+    const ToleranceContext& a_tolerances, const double a_internal_weight = 0.5,
+    const double a_external_weight = 0.5);
+
 //******************************************************************* //
 //     Debug versions below this, which export solution
 //      process to screen at end.
@@ -12,6 +12,29 @@
 
 namespace IRL {
 
+namespace reconstruction_interface_details {
+// Solvers are kept per thread and reset to default behavior on each use.
+// Their vectors keep their storage between calls, so after the first cell
+// a thread reconstructs, cells with neighborhoods of the same size are
+// reconstructed without allocating.
+template <class R2PType>
+R2PType& getThreadR2PSolver(void) {
+  thread_local static R2PType solver;
+  solver.setOptimizationBehavior(OptimizationBehavior());
+  solver.setCostFunctionBehavior(R2PWeighting());
+  solver.setWarmStartCache(nullptr, 0);
+  return solver;
+}
+
+template <class LVIRAType>
+LVIRAType& getThreadLVIRASolver(void) {
+  thread_local static LVIRAType solver;
+  solver.setOptimizationBehavior(OptimizationBehavior());
+  solver.setWarmStartCache(nullptr, 0);
+  return solver;
+}
+}  // namespace reconstruction_interface_details
+
 template <class CellType>
 PlanarSeparator reconstructionWithR2P2D(
     const R2PNeighborhood<CellType>& a_neighborhood_geometry,
@@ -22,10 +45,12 @@ PlanarSeparator reconstructionWithR2P2D(
           a_neighborhood_geometry.getCenterCell().calculateVolume(),
       &a_initial_reconstruction);
   if (a_initial_reconstruction.getNumberOfPlanes() == 1) {
-    R2P_2D1P<CellType> r2p_system;
+    auto& r2p_system = reconstruction_interface_details::getThreadR2PSolver<
+        R2P_2D1P<CellType>>();
     return r2p_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
   } else {
-    R2P_2D2P<CellType> r2p_system;
+    auto& r2p_system = reconstruction_interface_details::getThreadR2PSolver<
+        R2P_2D2P<CellType>>();
     return r2p_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
   }
 }
@@ -40,10 +65,12 @@ PlanarSeparator reconstructionWithR2P3D(
           a_neighborhood_geometry.getCenterCell().calculateVolume(),
       &a_initial_reconstruction);
   if (a_initial_reconstruction.getNumberOfPlanes() == 1) {
-    R2P_3D1P<CellType> r2p_system;
+    auto& r2p_system = reconstruction_interface_details::getThreadR2PSolver<
+        R2P_3D1P<CellType>>();
     return r2p_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
   } else {
-    R2P_3D2P<CellType> r2p_system;
+    auto& r2p_system = reconstruction_interface_details::getThreadR2PSolver<
+        R2P_3D2P<CellType>>();
     return r2p_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
   }
 }
@@ -59,11 +86,13 @@ PlanarSeparator reconstructionWithR2P3D(
           a_neighborhood_geometry.getCenterCell().calculateVolume(),
       &a_initial_reconstruction);
   if (a_initial_reconstruction.getNumberOfPlanes() == 1) {
-    R2P_3D1P<CellType> r2p_system;
+    auto& r2p_system = reconstruction_interface_details::getThreadR2PSolver<
+        R2P_3D1P<CellType>>();
     r2p_system.setCostFunctionBehavior(a_r2p_weighting);
     return r2p_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
   } else {
-    R2P_3D2P<CellType> r2p_system;
+    auto& r2p_system = reconstruction_interface_details::getThreadR2PSolver<
+        R2P_3D2P<CellType>>();
     r2p_system.setCostFunctionBehavior(a_r2p_weighting);
     return r2p_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
   }
@@ -81,18 +110,43 @@ PlanarSeparator reconstructionWithR2P3D(
           a_neighborhood_geometry.getCenterCell().calculateVolume(),
       &a_initial_reconstruction);
   if (a_initial_reconstruction.getNumberOfPlanes() == 1) {
-    R2P_3D1P<CellType> r2p_system;
+    auto& r2p_system = reconstruction_interface_details::getThreadR2PSolver<
+        R2P_3D1P<CellType>>();
     r2p_system.setOptimizationBehavior(a_optimization_behavior);
     r2p_system.setCostFunctionBehavior(a_r2p_weighting);
     return r2p_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
   } else {
-    R2P_3D2P<CellType> r2p_system;
+    auto& r2p_system = reconstruction_interface_details::getThreadR2PSolver<
+        R2P_3D2P<CellType>>();
     r2p_system.setOptimizationBehavior(a_optimization_behavior);
     r2p_system.setCostFunctionBehavior(a_r2p_weighting);
     return r2p_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
   }
 }
 
+template <class CellType>
+PlanarSeparator reconstructionWithR2P3D(
+    const R2PNeighborhood<CellType>& a_neighborhood_geometry,
+    PlanarSeparator a_initial_reconstruction,
+    ReconstructionWarmStartCache* a_cache, const LargeOffsetIndex_t a_cell_id) {
+  cleanReconstruction(
+      a_neighborhood_geometry.getCenterCell(),
+      (a_neighborhood_geometry.getCenterCellStoredMoments())[0].volume() /
+          a_neighborhood_geometry.getCenterCell().calculateVolume(),
+      &a_initial_reconstruction);
+  if (a_initial_reconstruction.getNumberOfPlanes() == 1) {
+    auto& r2p_system = reconstruction_interface_details::getThreadR2PSolver<
+        R2P_3D1P<CellType>>();
+    r2p_system.setWarmStartCache(a_cache, a_cell_id);
+    return r2p_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
+  } else {
+    auto& r2p_system = reconstruction_interface_details::getThreadR2PSolver<
+        R2P_3D2P<CellType>>();
+    r2p_system.setWarmStartCache(a_cache, a_cell_id);
+    return r2p_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
+  }
+}
+
 PlanarSeparator reconstructionWithELVIRA2D(
     const ELVIRANeighborhood& a_neighborhood_geometry) {
   ELVIRA_2D elvira_system;
@@ -109,7 +163,9 @@ template <class CellType>
 PlanarSeparator reconstructionWithLVIRA2D(
     const LVIRANeighborhood<CellType>& a_neighborhood_geometry,
     PlanarSeparator a_initial_reconstruction) {
-  LVIRA_2D<CellType> lvira_system;
+  auto& lvira_system =
+      reconstruction_interface_details::getThreadLVIRASolver<
+          LVIRA_2D<CellType>>();
   return lvira_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
 }
 
@@ -117,7 +173,21 @@ template <class CellType>
 PlanarSeparator reconstructionWithLVIRA3D(
     const LVIRANeighborhood<CellType>& a_neighborhood_geometry,
     PlanarSeparator a_initial_reconstruction) {
-  LVIRA_3D<CellType> lvira_system;
+  auto& lvira_system =
+      reconstruction_interface_details::getThreadLVIRASolver<
+          LVIRA_3D<CellType>>();
+  return lvira_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
+}
+
+template <class CellType>
+PlanarSeparator reconstructionWithLVIRA3D(
+    const LVIRANeighborhood<CellType>& a_neighborhood_geometry,
+    PlanarSeparator a_initial_reconstruction,
+    ReconstructionWarmStartCache* a_cache, const LargeOffsetIndex_t a_cell_id) {
+  auto& lvira_system =
+      reconstruction_interface_details::getThreadLVIRASolver<
+          LVIRA_3D<CellType>>();
+  lvira_system.setWarmStartCache(a_cache, a_cell_id);
   return lvira_system.solve(a_neighborhood_geometry, a_initial_reconstruction);
 }
 
@@ -143,6 +213,43 @@ PlanarSeparator reconstructionWithMOF3D(
       a_internal_weight, a_external_weight);
 }
 
+template <class CellType>
+PlanarSeparator reconstructionWithR2P3D(
+    const R2PNeighborhood<CellType>& a_neighborhood_geometry,
+    PlanarSeparator a_initial_reconstruction,
+    const ToleranceContext& a_tolerances) {
+  ScopedToleranceContext tolerance_scope(a_tolerances);
+  return reconstructionWithR2P3D(a_neighborhood_geometry,
+                                 a_initial_reconstruction);
+}
+
+PlanarSeparator reconstructionWithELVIRA3D(
+    const ELVIRANeighborhood& a_neighborhood_geometry,
+    const ToleranceContext& a_tolerances) {
+  ScopedToleranceContext tolerance_scope(a_tolerances);
+  return reconstructionWithELVIRA3D(a_neighborhood_geometry);
+}
+
+template <class CellType>
+PlanarSeparator reconstructionWithLVIRA3D(
+    const LVIRANeighborhood<CellType>& a_neighborhood_geometry,
+    PlanarSeparator a_initial_reconstruction,
+    const ToleranceContext& a_tolerances) {
+  ScopedToleranceContext tolerance_scope(a_tolerances);
+  return reconstructionWithLVIRA3D(a_neighborhood_geometry,
+                                   a_initial_reconstruction);
+}
+
+template <class CellType>
+PlanarSeparator reconstructionWithMOF3D(
+    const CellType& a_cell, const SeparatedMoments<VolumeMoments>& a_svm,
+    const ToleranceContext& a_tolerances, const double a_internal_weight,
+    const double a_external_weight) {
+  ScopedToleranceContext tolerance_scope(a_tolerances);
+  return reconstructionWithMOF3D(a_cell, a_svm, a_internal_weight,
+                                 a_external_weight);
+}
+
 template <class MomentsContainerType, class CellType>
 PlanarSeparator reconstructionWithAdvectedNormals(
     const MomentsContainerType& a_volume_moments_list,
@@ -0,0 +1,81 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/interface_reconstruction_methods/reconstruction_warm_start_cache.h"
+
+#include "irl/parameters/constants.h"
+#include "irl/parameters/tolerance_context.h"
+
+namespace IRL {
+
+bool ReconstructionWarmStartCache::find(
+    const LargeOffsetIndex_t a_cell_id,
+    ReconstructionWarmStart* a_warm_start) const {
+  const Shard& shard = this->getShard(a_cell_id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto entry = shard.entries.find(a_cell_id);
+  if (entry == shard.entries.end()) {
+    return false;
+  }
+  *a_warm_start = entry->second;
+  return true;
+}
+
+void ReconstructionWarmStartCache::store(
+    const LargeOffsetIndex_t a_cell_id,
+    const ReconstructionWarmStart& a_warm_start) {
+  Shard& shard = this->getShard(a_cell_id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.entries[a_cell_id] = a_warm_start;
+}
+
+void ReconstructionWarmStartCache::evict(const LargeOffsetIndex_t a_cell_id) {
+  Shard& shard = this->getShard(a_cell_id);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.entries.erase(a_cell_id);
+}
+
+bool ReconstructionWarmStartCache::evictIfPure(
+    const LargeOffsetIndex_t a_cell_id, const double a_liquid_volume_fraction) {
+  if (a_liquid_volume_fraction < getVolumeFractionLow() ||
+      a_liquid_volume_fraction > getVolumeFractionHigh()) {
+    this->evict(a_cell_id);
+    return true;
+  }
+  return false;
+}
+
+void ReconstructionWarmStartCache::clear(void) {
+  for (auto& shard : shards_m) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.entries.clear();
+  }
+}
+
+LargeOffsetIndex_t ReconstructionWarmStartCache::size(void) const {
+  LargeOffsetIndex_t number_of_entries = 0;
+  for (const auto& shard : shards_m) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    number_of_entries += shard.entries.size();
+  }
+  return number_of_entries;
+}
+
+ReconstructionWarmStartCache::Shard& ReconstructionWarmStartCache::getShard(
+    const LargeOffsetIndex_t a_cell_id) {
+  return shards_m[a_cell_id % number_of_shards_m];
+}
+
+const ReconstructionWarmStartCache::Shard&
+ReconstructionWarmStartCache::getShard(
+    const LargeOffsetIndex_t a_cell_id) const {
+  return shards_m[a_cell_id % number_of_shards_m];
+}
+
+}  // namespace IRL
@@ -0,0 +1,104 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_INTERFACE_RECONSTRUCTION_METHODS_RECONSTRUCTION_WARM_START_CACHE_H_
+#define IRL_INTERFACE_RECONSTRUCTION_METHODS_RECONSTRUCTION_WARM_START_CACHE_H_
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+
+#include <Eigen/Dense>  // Eigen header
+
+#include "irl/parameters/defined_types.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace IRL {
+
+/// \brief State saved at the end of a Levenberg-Marquardt reconstruction
+/// that the next reconstruction of the same cell can start from.
+struct ReconstructionWarmStart {
+  /// \brief Converged reconstruction.
+  PlanarSeparator reconstruction;
+  /// \brief Damping factor at exit.
+  double lambda = 1.0;
+  /// \brief Transpose of the last Jacobian calculated, with one row per
+  /// optimization parameter and one column per error entry.
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> jacobian_transpose;
+};
+
+/// \brief Per-cell store of ReconstructionWarmStart entries, keyed by a
+/// user-chosen cell id, used to warm-start LVIRA and R2P across time steps.
+///
+/// When attached to an LVIRA or R2P solver through `setWarmStartCache()`,
+/// a solve for a cell with an entry starts from the cached reconstruction
+/// (with the distance re-matched to the current volume fraction), the
+/// cached damping factor, and the cached Jacobian, and then replaces the
+/// entry with its own final state. Since interfaces move less than a cell
+/// per time step, this starts the optimization close to the minimum.
+/// Entries should be evicted when a cell becomes pure.
+///
+/// All methods are safe to call concurrently. Entries are spread over
+/// independently locked shards, so threads working on different cells
+/// rarely contend.
+class ReconstructionWarmStartCache {
+ public:
+  /// \brief Construct an empty cache.
+  ReconstructionWarmStartCache(void) = default;
+
+  /// \brief Copy the entry for `a_cell_id` into `a_warm_start` if one
+  /// exists, returning whether it did.
+  bool find(const LargeOffsetIndex_t a_cell_id,
+            ReconstructionWarmStart* a_warm_start) const;
+
+  /// \brief Store `a_warm_start` as the entry for `a_cell_id`, replacing
+  /// any existing entry.
+  void store(const LargeOffsetIndex_t a_cell_id,
+             const ReconstructionWarmStart& a_warm_start);
+
+  /// \brief Remove the entry for `a_cell_id`, if any.
+  void evict(const LargeOffsetIndex_t a_cell_id);
+
+  /// \brief Remove the entry for `a_cell_id` if `a_liquid_volume_fraction`
+  /// is outside of [getVolumeFractionLow(), getVolumeFractionHigh()],
+  /// returning whether the cell was pure.
+  bool evictIfPure(const LargeOffsetIndex_t a_cell_id,
+                   const double a_liquid_volume_fraction);
+
+  /// \brief Remove all entries.
+  void clear(void);
+
+  /// \brief Return the number of cells with an entry.
+  LargeOffsetIndex_t size(void) const;
+
+  ReconstructionWarmStartCache(const ReconstructionWarmStartCache& other) =
+      delete;
+  ReconstructionWarmStartCache& operator=(
+      const ReconstructionWarmStartCache& other) = delete;
+
+  /// \brief Default destructor.
+  ~ReconstructionWarmStartCache(void) = default;
+
+ private:
+  static constexpr UnsignedIndex_t number_of_shards_m = 64;
+
+  struct alignas(64) Shard {
+    mutable std::mutex mutex;
+    std::unordered_map<LargeOffsetIndex_t, ReconstructionWarmStart> entries;
+  };
+
+  Shard& getShard(const LargeOffsetIndex_t a_cell_id);
+  const Shard& getShard(const LargeOffsetIndex_t a_cell_id) const;
+
+  std::array<Shard, number_of_shards_m> shards_m;
+};
+
+}  // namespace IRL
+
+#endif  // IRL_INTERFACE_RECONSTRUCTION_METHODS_RECONSTRUCTION_WARM_START_CACHE_H_
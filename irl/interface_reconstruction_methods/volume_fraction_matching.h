@@ -16,6 +16,7 @@
 #include "irl/interface_reconstruction_methods/reconstruction_cleaning.h"
 #include "irl/planar_reconstruction/planar_separator_path_group.h"
 #include "irl/parameters/constants.h"
+#include "irl/parameters/tolerance_context.h"
 
 namespace IRL {
 
@@ -23,15 +24,21 @@ template <class CellType, class PlanarType>
 inline void setDistanceToMatchVolumeFraction(
     const CellType& a_cell, const double a_volume_fraction,
     PlanarType* a_reconstruction,
-    const double a_volume_fraction_tolerance =
-        global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);
+    const double a_volume_fraction_tolerance = getVolumeFractionTolerance());
 
 template <class CellType, class VolumeFractionArrayType>
 inline void setGroupDistanceToMatchVolumeFraction(
     const CellType& a_cell, const VolumeFractionArrayType& a_volume_fraction,
     PlanarSeparatorPathGroup* a_reconstruction,
-    const double a_volume_fraction_tolerance =
-        global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);
+    const double a_volume_fraction_tolerance = getVolumeFractionTolerance());
+
+/// \brief Sets distance in `a_reconstruction` to result in the given
+/// liquid volume fraction, using the volume fraction bounds and tolerance
+/// in `a_tolerances` instead of those installed on the calling thread.
+template <class CellType, class PlanarType>
+inline void setDistanceToMatchVolumeFraction(
+    const CellType& a_cell, const double a_volume_fraction,
+    PlanarType* a_reconstruction, const ToleranceContext& a_tolerances);
 
 /// \brief Sets distance in `a_reconstruction` to
 /// result in given liquid volume fraction.
@@ -63,8 +70,7 @@ template <class CellType, class PlanarType>
 inline void setDistanceToMatchVolumeFractionPartialFill(
     const CellType& a_cell, const double a_volume_fraction,
     PlanarType* a_reconstruction,
-    const double a_volume_fraction_tolerance =
-        global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);
+    const double a_volume_fraction_tolerance = getVolumeFractionTolerance());
 
 /// \brief Specialization for RectangularCuboids that calls Analytical distance
 /// finding if a single plane.
@@ -72,8 +78,7 @@ template <class PlanarType>
 inline void setDistanceToMatchVolumeFractionPartialFill(
     const RectangularCuboid& a_cell, const double a_volume_fraction,
     PlanarType* a_reconstruction,
-    const double a_volume_fraction_tolerance =
-        global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);
+    const double a_volume_fraction_tolerance = getVolumeFractionTolerance());
 
 /// \brief Specialization for Tet  that calls Analytical distance
 /// finding if a single plane.
@@ -81,15 +86,13 @@ template <class PlanarType>
 inline void setDistanceToMatchVolumeFractionPartialFill(
     const Tet& a_cell, const double a_volume_fraction,
     PlanarType* a_reconstruction,
-    const double a_volume_fraction_tolerance =
-        global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);  
+    const double a_volume_fraction_tolerance = getVolumeFractionTolerance());
 
 template <class CellType, class VolumeFractionArrayType>
 inline void setGroupDistanceToMatchVolumeFractionPartialFill(
     const CellType& a_cell, const VolumeFractionArrayType& a_volume_fraction,
     PlanarSeparatorPathGroup* a_reconstruction,
-    const double a_volume_fraction_tolerance =
-        global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);
+    const double a_volume_fraction_tolerance = getVolumeFractionTolerance());
 }  // namespace IRL
 
 #include "irl/interface_reconstruction_methods/volume_fraction_matching.tpp"
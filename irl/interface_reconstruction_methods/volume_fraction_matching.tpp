@@ -26,6 +26,16 @@ inline void setDistanceToMatchVolumeFraction(
   }
 }
 
+template <class CellType, class PlanarType>
+inline void setDistanceToMatchVolumeFraction(
+    const CellType& a_cell, const double a_volume_fraction,
+    PlanarType* a_reconstruction, const ToleranceContext& a_tolerances) {
+  ScopedToleranceContext tolerance_scope(a_tolerances);
+  setDistanceToMatchVolumeFraction(a_cell, a_volume_fraction,
+                                   a_reconstruction,
+                                   a_tolerances.volumeFractionTolerance());
+}
+
 template <class CellType, class VolumeFractionArrayType>
 inline void setGroupDistanceToMatchVolumeFraction(
     const CellType& a_cell, const VolumeFractionArrayType& a_volume_fraction,
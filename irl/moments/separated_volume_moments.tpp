@@ -367,18 +367,18 @@ inline std::ostream& operator<<(
   return out;
 }
 
-template <class Derived, class MomentsType>
-inline SeparatedMomentsCommon<Derived, MomentsType> operator*(
-    const SeparatedMomentsCommon<Derived, MomentsType>& a_svm,
-    const double a_multiplier) {
+template <class MomentsType>
+inline SeparatedMoments<MomentsType> operator*(
+    const SeparatedMoments<MomentsType>& a_svm, const double a_multiplier) {
   return a_multiplier * a_svm;
 }
 
-template <class Derived, class MomentsType>
-inline SeparatedMomentsCommon<Derived, MomentsType> operator*(
-    const double a_multiplier,
-    const SeparatedMomentsCommon<Derived, MomentsType>& a_svm) {
-  return Derived(a_multiplier * a_svm[0], a_multiplier * a_svm[1]);
+template <class MomentsType>
+inline SeparatedMoments<MomentsType> operator*(
+    const double a_multiplier, const SeparatedMoments<MomentsType>& a_svm) {
+  SeparatedMoments<MomentsType> product(a_svm);
+  product *= a_multiplier;
+  return product;
 }
 
 }  // namespace IRL
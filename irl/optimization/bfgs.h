@@ -12,6 +12,7 @@
 
 #include <Eigen/Dense>  // Eigen header
 
+#include "irl/helpers/telemetry.h"
 #include "irl/parameters/defined_types.h"
 namespace IRL {
 
@@ -46,6 +46,7 @@ template <class OptimizingClass, int kParameters>
 void BFGS<OptimizingClass, kParameters>::solve(
     const Eigen::Matrix<double, kParameters, 1>& a_gradient_delta) {
   assert(otype_m != nullptr);
+  TelemetryScopedTimer timer(TelemetryTimer::BFGS);
 
   // Calculate initial error and save initial state
   Eigen::Matrix<double, kParameters, 1> step_in_params =
@@ -136,6 +137,7 @@ void BFGS<OptimizingClass, kParameters>::solve(
 
     old_gradient_of_cost_function = gradient_of_cost_function;
     iteration_m++;
+    countTelemetry(TelemetryCounter::BFGSIterations);
   }
 
   // If exiting because error low enough, give number of iterations
@@ -16,15 +16,34 @@
 #include <Eigen/Dense>  // Eigen header
 
 #include "irl/helpers/helper.h"
+#include "irl/helpers/telemetry.h"
 
 namespace IRL {
+
+namespace levenberg_marquardt_details {
+/// \brief Call `a_otype->calculateAnalyticJacobianTranspose(...)` if
+/// OptimizingClass has it, returning whether the Jacobian was filled.
+template <class OptimizingClass, class JacobianTransposeType>
+auto calculateAnalyticJacobianTranspose(
+    OptimizingClass* a_otype, JacobianTransposeType* a_jacobian_transpose,
+    int) -> decltype(a_otype->calculateAnalyticJacobianTranspose(
+    a_jacobian_transpose));
+
+/// \brief Fallback for an OptimizingClass without an analytic Jacobian.
+template <class OptimizingClass, class JacobianTransposeType>
+bool calculateAnalyticJacobianTranspose(
+    OptimizingClass* a_otype, JacobianTransposeType* a_jacobian_transpose,
+    long);
+}  // namespace levenberg_marquardt_details
+
 /// \brief Levenberg-Marquardt optimization routine.
 ///
 /// Requirements for OptimizingClass:
 /// - `double calculateScalarError(void)` : A method to calculate a scalar error
 /// that we are trying to minimize.
 /// - `Eigen::Matrix<double,kRows,1>calculateVectorError(void)` : A method that
-/// returns the vector return (correct_values - guess_values) by value
+/// returns the vector (correct_values - guess_values), by value or by
+/// reference to storage it owns
 /// - `void updateGuess(Eigen::Matrix<double,kColumns,1>)` : A method that takes
 /// in the delta change and computes a new guess vector (which it is storing
 /// itself)
@@ -51,6 +70,11 @@ namespace IRL {
 /// const int)` : A method that returns a bool for whether or not a jacobian
 /// should be computed when given the current iteration and the last iteration
 /// the Jacobian was computed for.
+/// - (Optional) `bool calculateAnalyticJacobianTranspose(
+/// Eigen::Matrix<double,kColumns,kRows>*)` : A method that fills the
+/// transpose of the Jacobian of the guess vector at the best guess without
+/// changing the guess. If it is missing or returns false, the Jacobian is
+/// calculated by finite differences instead.
 ///
 /// kRows is the number of rows involved in the error vector of the
 ///  Levenberg-Marquardt system [y-f].
@@ -74,6 +98,21 @@ class LevenbergMarquardt {
   /// \brief Return the number of iterations it took until exit.
   UnsignedIndex_t getIterationCount(void);
 
+  /// \brief Start the next solve with damping `a_lambda` instead of 1.
+  void setInitialLambda(const double a_lambda);
+
+  /// \brief Start the next solve from a previously computed Jacobian
+  /// (stored as its transpose) instead of calculating a new one.
+  void setInitialJacobianTranspose(
+      const Eigen::Matrix<double, kColumns, kRows>& a_jacobian_transpose);
+
+  /// \brief Return the damping factor at exit.
+  double getLambda(void) const;
+
+  /// \brief Return the transpose of the last Jacobian calculated.
+  const Eigen::Matrix<double, kColumns, kRows>& getJacobianTranspose(
+      void) const;
+
   /// \brief Default dedstructor
   ~LevenbergMarquardt(void) = default;
 
@@ -81,7 +120,8 @@ class LevenbergMarquardt {
   /// \brief Perform non-linear optimization.
   void solve(const Eigen::Matrix<double, kColumns, 1>& a_jacobian_delta);
 
-  /// \brief Calculate jacobian using first-order finite difference.
+  /// \brief Calculate jacobian analytically if `OptimizingClass` can,
+  /// otherwise using first-order finite difference.
   void calculateJacobian(
       const Eigen::Matrix<double, kColumns, 1>& a_delta,
       Eigen::Matrix<double, kColumns, kRows>* a_jacobian_tranpose,
@@ -117,6 +157,12 @@ class LevenbergMarquardt {
   Eigen::Matrix<double, kColumns, 1> rhs_m;
   /// \brief `rhs_m` with Jacobi preconditioner applied.
   Eigen::Matrix<double, kColumns, 1> rhs_precond_m;
+  /// \brief Damping factor used in (JacTJac_m + lambda*I).
+  double lambda_m;
+  /// \brief Damping factor the next solve starts from.
+  double initial_lambda_m;
+  /// \brief Whether `jacobian_transpose_m` was provided for the next solve.
+  bool use_initial_jacobian_m;
 };
 
 // Overload of LevenbergMarquardt class that requires run time setting of matrix
@@ -137,6 +183,22 @@ class LevenbergMarquardt<OptimizingClass, -1, kColumns> {
   /// \brief Return the number of iterations it took until exit.
   UnsignedIndex_t getIterationCount(void);
 
+  /// \brief Start the next solve with damping `a_lambda` instead of 1.
+  void setInitialLambda(const double a_lambda);
+
+  /// \brief Start the next solve from a previously computed Jacobian
+  /// (stored as its transpose) instead of calculating a new one. Any
+  /// column-major matrix with kColumns rows is taken without a temporary.
+  void setInitialJacobianTranspose(
+      const Eigen::Ref<const Eigen::MatrixXd>& a_jacobian_transpose);
+
+  /// \brief Return the damping factor at exit.
+  double getLambda(void) const;
+
+  /// \brief Return the transpose of the last Jacobian calculated.
+  const Eigen::Matrix<double, kColumns, Eigen::Dynamic>& getJacobianTranspose(
+      void) const;
+
   /// \brief Default dedstructor
   ~LevenbergMarquardt(void) = default;
 
@@ -146,7 +208,8 @@ class LevenbergMarquardt<OptimizingClass, -1, kColumns> {
   void solve(const int a_number_of_rows,
              const Eigen::Matrix<double, kColumns, 1>& a_jacobian_delta);
 
-  /// \brief Calculate jacobian using first-order finite difference.
+  /// \brief Calculate jacobian analytically if `OptimizingClass` can,
+  /// otherwise using first-order finite difference.
   void calculateJacobian(
       const Eigen::Matrix<double, kColumns, 1>& a_delta,
       Eigen::Matrix<double, kColumns, Eigen::Dynamic>* a_jacobian_tranpose,
@@ -182,6 +245,12 @@ class LevenbergMarquardt<OptimizingClass, -1, kColumns> {
   Eigen::Matrix<double, kColumns, 1> rhs_m;
   /// \brief `rhs_m` with Jacobi preconditioner applied.
   Eigen::Matrix<double, kColumns, 1> rhs_precond_m;
+  /// \brief Damping factor used in (JacTJac_m + lambda*I).
+  double lambda_m;
+  /// \brief Damping factor the next solve starts from.
+  double initial_lambda_m;
+  /// \brief Whether `jacobian_transpose_m` was provided for the next solve.
+  bool use_initial_jacobian_m;
 };
 
 }  // namespace IRL
@@ -12,9 +12,28 @@
 
 namespace IRL {
 
+namespace levenberg_marquardt_details {
+template <class OptimizingClass, class JacobianTransposeType>
+auto calculateAnalyticJacobianTranspose(
+    OptimizingClass* a_otype, JacobianTransposeType* a_jacobian_transpose,
+    int) -> decltype(a_otype->calculateAnalyticJacobianTranspose(
+    a_jacobian_transpose)) {
+  return a_otype->calculateAnalyticJacobianTranspose(a_jacobian_transpose);
+}
+
+template <class OptimizingClass, class JacobianTransposeType>
+bool calculateAnalyticJacobianTranspose(OptimizingClass*,
+                                        JacobianTransposeType*, long) {
+  return false;
+}
+}  // namespace levenberg_marquardt_details
+
 template <class OptimizingClass, int kRows, int kColumns>
 LevenbergMarquardt<OptimizingClass, kRows, kColumns>::LevenbergMarquardt(void)
-    : otype_m(nullptr) {}
+    : otype_m(nullptr),
+      lambda_m(1.0),
+      initial_lambda_m(1.0),
+      use_initial_jacobian_m(false) {}
 
 template <class OptimizingClass, int kRows, int kColumns>
 void LevenbergMarquardt<OptimizingClass, kRows, kColumns>::solve(
@@ -35,10 +54,38 @@ LevenbergMarquardt<OptimizingClass, kRows, kColumns>::getIterationCount(void) {
   return iteration_m;
 }
 
+template <class OptimizingClass, int kRows, int kColumns>
+void LevenbergMarquardt<OptimizingClass, kRows, kColumns>::setInitialLambda(
+    const double a_lambda) {
+  initial_lambda_m = a_lambda;
+}
+
+template <class OptimizingClass, int kRows, int kColumns>
+void LevenbergMarquardt<OptimizingClass, kRows, kColumns>::
+    setInitialJacobianTranspose(
+        const Eigen::Matrix<double, kColumns, kRows>& a_jacobian_transpose) {
+  jacobian_transpose_m = a_jacobian_transpose;
+  use_initial_jacobian_m = true;
+}
+
+template <class OptimizingClass, int kRows, int kColumns>
+double LevenbergMarquardt<OptimizingClass, kRows, kColumns>::getLambda(
+    void) const {
+  return lambda_m;
+}
+
+template <class OptimizingClass, int kRows, int kColumns>
+const Eigen::Matrix<double, kColumns, kRows>&
+LevenbergMarquardt<OptimizingClass, kRows, kColumns>::getJacobianTranspose(
+    void) const {
+  return jacobian_transpose_m;
+}
+
 template <class OptimizingClass, int kRows, int kColumns>
 void LevenbergMarquardt<OptimizingClass, kRows, kColumns>::solve(
     const Eigen::Matrix<double, kColumns, 1>& a_jacobian_delta) {
   assert(otype_m != nullptr);
+  TelemetryScopedTimer timer(TelemetryTimer::LevenbergMarquardt);
   // Calcualte initial error and save initial state
   delta_m = Eigen::Matrix<double, kColumns, 1>::Zero();
   otype_m->updateGuess(&delta_m);
@@ -51,17 +98,25 @@ void LevenbergMarquardt<OptimizingClass, kRows, kColumns>::solve(
   // This will change whatever guess variables the `OptimizingClass`
   // has, which is why calculateVectorError() is called before this.
   vector_error_m = otype_m->calculateVectorError();
-  this->calculateJacobian(a_jacobian_delta, &jacobian_transpose_m, &jacTjac_m);
+  if (use_initial_jacobian_m) {
+    jacTjac_m = jacobian_transpose_m * jacobian_transpose_m.transpose();
+    use_initial_jacobian_m = false;
+  } else {
+    this->calculateJacobian(a_jacobian_delta, &jacobian_transpose_m,
+                            &jacTjac_m);
+  }
 
   // Calculate initial right hand side
   rhs_m = jacobian_transpose_m * vector_error_m;
 
   // Enter optimization loop
-  double lambda = 1.0;
+  lambda_m = initial_lambda_m;
+  initial_lambda_m = 1.0;
   iteration_m = 0;
   UnsignedIndex_t last_jacobian_iteration = 0;
   while (otype_m->errorTooHigh(error)) {
     iteration_m++;
+    countTelemetry(TelemetryCounter::LevenbergMarquardtIterations);
     if (otype_m->iterationTooHigh(iteration_m)) {
       // Exiting because exceeding max iterations
       reason_for_exit_m = -1;
@@ -70,7 +125,7 @@ void LevenbergMarquardt<OptimizingClass, kRows, kColumns>::solve(
     // Calculate A in A*delta = rhs
     A_m = jacTjac_m;
     for (int i = 0; i < kColumns; ++i) {
-      A_m(i, i) += lambda;
+      A_m(i, i) += lambda_m;
       double jacobi_preconditioner = 1.0 / safelyEpsilon(A_m(i, i));
       for (int j = 0; j < kColumns; ++j) {
         A_m(i, j) *= jacobi_preconditioner;
@@ -94,12 +149,12 @@ void LevenbergMarquardt<OptimizingClass, kRows, kColumns>::solve(
     // If reconstruction is not an improvement, increase lambda and try again
     // Otherwise, accept solution and take another step
     if (guess_error > error) {
-      otype_m->increaseLambda(&lambda);
+      otype_m->increaseLambda(&lambda_m);
       continue;
     }
 
     // If accepted, decrease lambda to take a bigger step next time
-    otype_m->decreaseLambda(&lambda);
+    otype_m->decreaseLambda(&lambda_m);
 
     error = guess_error;
     otype_m->updateBestGuess();
@@ -126,6 +181,11 @@ void LevenbergMarquardt<OptimizingClass, kRows, kColumns>::calculateJacobian(
     const Eigen::Matrix<double, kColumns, 1>& a_delta,
     Eigen::Matrix<double, kColumns, kRows>* a_jacobian_transpose,
     Eigen::Matrix<double, kColumns, kColumns>* a_jacTjac) {
+  if (levenberg_marquardt_details::calculateAnalyticJacobianTranspose(
+          otype_m, a_jacobian_transpose, 0)) {
+    *a_jacTjac = (*a_jacobian_transpose) * (a_jacobian_transpose->transpose());
+    return;
+  }
   // Set up temporary delta
   Eigen::Matrix<double, kColumns, 1> solo_delta;
   // Calculate tranpose of Jacobian
@@ -133,8 +193,7 @@ void LevenbergMarquardt<OptimizingClass, kRows, kColumns>::calculateJacobian(
     solo_delta = Eigen::Matrix<double, kColumns, 1>::Zero();
     solo_delta(parameter) = a_delta(parameter);
     otype_m->updateGuess(&solo_delta);
-    Eigen::Matrix<double, kRows, 1> change_in_guess =
-        otype_m->calculateChangeInGuess();
+    const auto& change_in_guess = otype_m->calculateChangeInGuess();
     for (int elem = 0; elem < kRows; ++elem) {
       (*a_jacobian_transpose)(parameter, elem) =
           change_in_guess(elem) / safelyEpsilon(solo_delta(parameter));
@@ -146,7 +205,10 @@ void LevenbergMarquardt<OptimizingClass, kRows, kColumns>::calculateJacobian(
 
 template <class OptimizingClass, int kColumns>
 LevenbergMarquardt<OptimizingClass, -1, kColumns>::LevenbergMarquardt(void)
-    : otype_m(nullptr) {}
+    : otype_m(nullptr),
+      lambda_m(1.0),
+      initial_lambda_m(1.0),
+      use_initial_jacobian_m(false) {}
 
 template <class OptimizingClass, int kColumns>
 void LevenbergMarquardt<OptimizingClass, -1, kColumns>::solve(
@@ -167,17 +229,48 @@ LevenbergMarquardt<OptimizingClass, -1, kColumns>::getIterationCount(void) {
   return iteration_m;
 }
 
+template <class OptimizingClass, int kColumns>
+void LevenbergMarquardt<OptimizingClass, -1, kColumns>::setInitialLambda(
+    const double a_lambda) {
+  initial_lambda_m = a_lambda;
+}
+
+template <class OptimizingClass, int kColumns>
+void LevenbergMarquardt<OptimizingClass, -1, kColumns>::
+    setInitialJacobianTranspose(
+        const Eigen::Ref<const Eigen::MatrixXd>& a_jacobian_transpose) {
+  assert(a_jacobian_transpose.rows() == kColumns);
+  jacobian_transpose_m = a_jacobian_transpose;
+  use_initial_jacobian_m = true;
+}
+
+template <class OptimizingClass, int kColumns>
+double LevenbergMarquardt<OptimizingClass, -1, kColumns>::getLambda(
+    void) const {
+  return lambda_m;
+}
+
+template <class OptimizingClass, int kColumns>
+const Eigen::Matrix<double, kColumns, Eigen::Dynamic>&
+LevenbergMarquardt<OptimizingClass, -1, kColumns>::getJacobianTranspose(
+    void) const {
+  return jacobian_transpose_m;
+}
+
 template <class OptimizingClass, int kColumns>
 void LevenbergMarquardt<OptimizingClass, -1, kColumns>::solve(
     const int a_number_of_rows,
     const Eigen::Matrix<double, kColumns, 1>& a_jacobian_delta) {
   assert(otype_m != nullptr);
+  TelemetryScopedTimer timer(TelemetryTimer::LevenbergMarquardt);
 
   // Construct actual matrices that are using Dynamic allocation
-  jacobian_transpose_m = Eigen::Matrix<double, kColumns, Eigen::Dynamic>(
-      kColumns, a_number_of_rows);
-  vector_error_m =
-      Eigen::Matrix<double, Eigen::Dynamic, 1>(a_number_of_rows, 1);
+  if (jacobian_transpose_m.cols() != a_number_of_rows) {
+    jacobian_transpose_m = Eigen::Matrix<double, kColumns, Eigen::Dynamic>(
+        kColumns, a_number_of_rows);
+    use_initial_jacobian_m = false;
+  }
+  vector_error_m.resize(a_number_of_rows);
 
   // Calcualte initial error and save initial state
   delta_m = Eigen::Matrix<double, kColumns, 1>::Zero();
@@ -191,17 +284,25 @@ void LevenbergMarquardt<OptimizingClass, -1, kColumns>::solve(
   // This will change whatever guess variables the `OptimizingClass`
   // has, which is why calculateVectorError() is called before this.
   vector_error_m = otype_m->calculateVectorError();
-  this->calculateJacobian(a_jacobian_delta, &jacobian_transpose_m, &jacTjac_m);
+  if (use_initial_jacobian_m) {
+    jacTjac_m = jacobian_transpose_m * jacobian_transpose_m.transpose();
+    use_initial_jacobian_m = false;
+  } else {
+    this->calculateJacobian(a_jacobian_delta, &jacobian_transpose_m,
+                            &jacTjac_m);
+  }
 
   // Calculate initial right hand side
   rhs_m = jacobian_transpose_m * vector_error_m;
 
   // Enter optimization loop
-  double lambda = 1.0;
+  lambda_m = initial_lambda_m;
+  initial_lambda_m = 1.0;
   iteration_m = 0;
   UnsignedIndex_t last_jacobian_iteration = 0;
   while (otype_m->errorTooHigh(error)) {
     iteration_m++;
+    countTelemetry(TelemetryCounter::LevenbergMarquardtIterations);
     if (otype_m->iterationTooHigh(iteration_m)) {
       // Exiting because exceeding max iterations
       reason_for_exit_m = -1;
@@ -210,7 +311,7 @@ void LevenbergMarquardt<OptimizingClass, -1, kColumns>::solve(
     // Calculate A in A*delta = rhs
     A_m = jacTjac_m;
     for (int i = 0; i < kColumns; ++i) {
-      A_m(i, i) += lambda;
+      A_m(i, i) += lambda_m;
       double jacobi_preconditioner = 1.0 / safelyEpsilon(A_m(i, i));
       for (int j = 0; j < kColumns; ++j) {
         A_m(i, j) *= jacobi_preconditioner;
@@ -234,12 +335,12 @@ void LevenbergMarquardt<OptimizingClass, -1, kColumns>::solve(
     // If reconstruction is not an improvement, increase lambda and try again
     // Otherwise, accept solution and take another step
     if (guess_error > error) {
-      otype_m->increaseLambda(&lambda);
+      otype_m->increaseLambda(&lambda_m);
       continue;
     }
 
     // If accepted, decrease lambda to take a bigger step next time
-    otype_m->decreaseLambda(&lambda);
+    otype_m->decreaseLambda(&lambda_m);
 
     error = guess_error;
     otype_m->updateBestGuess();
@@ -266,6 +367,11 @@ void LevenbergMarquardt<OptimizingClass, -1, kColumns>::calculateJacobian(
     const Eigen::Matrix<double, kColumns, 1>& a_delta,
     Eigen::Matrix<double, kColumns, Eigen::Dynamic>* a_jacobian_transpose,
     Eigen::Matrix<double, kColumns, kColumns>* a_jacTjac) {
+  if (levenberg_marquardt_details::calculateAnalyticJacobianTranspose(
+          otype_m, a_jacobian_transpose, 0)) {
+    *a_jacTjac = (*a_jacobian_transpose) * (a_jacobian_transpose->transpose());
+    return;
+  }
   // Set up temporary delta
   Eigen::Matrix<double, kColumns, 1> solo_delta;
   // Calculate tranpose of Jacobian
@@ -273,8 +379,7 @@ void LevenbergMarquardt<OptimizingClass, -1, kColumns>::calculateJacobian(
     solo_delta = Eigen::Matrix<double, kColumns, 1>::Zero();
     solo_delta(parameter) = a_delta(parameter);
     otype_m->updateGuess(&solo_delta);
-    Eigen::Matrix<double, Eigen::Dynamic, 1> change_in_guess =
-        otype_m->calculateChangeInGuess();
+    const auto& change_in_guess = otype_m->calculateChangeInGuess();
     for (int elem = 0; elem < change_in_guess.rows(); ++elem) {
       (*a_jacobian_transpose)(parameter, elem) =
           change_in_guess(elem) / safelyEpsilon(solo_delta(parameter));
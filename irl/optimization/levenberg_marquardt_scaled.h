@@ -16,6 +16,8 @@
 #include <Eigen/Dense> // Eigen header
 
 #include "irl/helpers/helper.h"
+#include "irl/helpers/telemetry.h"
+#include "irl/optimization/levenberg_marquardt.h"
 
 namespace IRL {
 /// \brief Levenberg-Marquardt optimization routine.
@@ -24,7 +26,8 @@ namespace IRL {
 /// - `double calculateScalarError(void)` : A method to calculate a scalar error
 /// that we are trying to minimize.
 /// - `Eigen::Matrix<double,kRows,1>calculateVectorError(void)` : A method that
-/// returns the vector return (correct_values - guess_values) by value
+/// returns the vector (correct_values - guess_values), by value or by
+/// reference to storage it owns
 /// - `void updateGuess(Eigen::Matrix<double,kColumns,1>)` : A method that takes
 /// in the delta change and computes a new guess vector (which it is storing
 /// itself)
@@ -85,7 +88,8 @@ private:
   void solve(const int a_number_of_rows,
              const Eigen::Matrix<double, kColumns, 1> &a_jacobian_delta);
 
-  /// \brief Calculate jacobian using first-order finite difference.
+  /// \brief Calculate jacobian analytically if `OptimizingClass` can,
+  /// otherwise using first-order finite difference.
   void calculateJacobian(
       const Eigen::Matrix<double, kColumns, 1> &a_delta,
       Eigen::Matrix<double, kColumns, Eigen::Dynamic> *a_jacobian_tranpose,
@@ -116,6 +120,8 @@ private:
   Eigen::Matrix<double, kColumns, kColumns> A_m;
   /// \brief Error vector of correct - guess
   Eigen::Matrix<double, Eigen::Dynamic, 1> vector_error_m;
+  /// \brief Predicted change in the guess vector from `delta_m`.
+  Eigen::Matrix<double, Eigen::Dynamic, 1> reduction_step_m;
   /// \brief RHS of (JacTJac_m + lambda*I)*delta =
   /// `jacobian_transpose_m`*(`vector_error_m`)
   Eigen::Matrix<double, kColumns, 1> rhs_m;
@@ -41,12 +41,13 @@ void LevenbergMarquardtScaled<OptimizingClass, kColumns>::solve(
     const int a_number_of_rows,
     const Eigen::Matrix<double, kColumns, 1> &a_jacobian_delta) {
   assert(otype_m != nullptr);
+  TelemetryScopedTimer timer(TelemetryTimer::LevenbergMarquardt);
 
   // Construct actual matrices that are using Dynamic allocation
-  jacobian_transpose_m = Eigen::Matrix<double, kColumns, Eigen::Dynamic>(
-      kColumns, a_number_of_rows);
-  vector_error_m =
-      Eigen::Matrix<double, Eigen::Dynamic, 1>(a_number_of_rows, 1);
+  // Resizing keeps the storage of earlier solves of the same size.
+  jacobian_transpose_m.resize(kColumns, a_number_of_rows);
+  vector_error_m.resize(a_number_of_rows);
+  reduction_step_m.resize(a_number_of_rows);
 
   // Calcualte initial error and save initial state
   delta_m = Eigen::Matrix<double, kColumns, 1>::Zero();
@@ -69,9 +70,9 @@ void LevenbergMarquardtScaled<OptimizingClass, kColumns>::solve(
   double lambda = 1.0;
   iteration_m = 0;
   UnsignedIndex_t last_jacobian_iteration = 0;
-  Eigen::Matrix<double, Eigen::Dynamic, 1> reduction_step;
   while (otype_m->errorTooHigh(error)) {
     iteration_m++;
+    countTelemetry(TelemetryCounter::LevenbergMarquardtIterations);
     if (otype_m->iterationTooHigh(iteration_m)) {
       // Exiting because exceeding max iterations
       reason_for_exit_m = -1;
@@ -106,9 +107,9 @@ void LevenbergMarquardtScaled<OptimizingClass, kColumns>::solve(
     }
 
     // Predicted error reduction
-    reduction_step = jacobian_transpose_m.transpose() * delta_m;
+    reduction_step_m.noalias() = jacobian_transpose_m.transpose() * delta_m;
 
-    const double temp1 = std::pow(reduction_step.stableNorm() / error, 2.0);
+    const double temp1 = std::pow(reduction_step_m.stableNorm() / error, 2.0);
     // const double temp2 = lambda * std::pow(delta_m.stableNorm() /
     // error, 2.0);
     const double predicted_reduction = temp1; // + 2.0 * temp2;
@@ -176,6 +177,11 @@ void LevenbergMarquardtScaled<OptimizingClass, kColumns>::calculateJacobian(
     const Eigen::Matrix<double, kColumns, 1> &a_delta,
     Eigen::Matrix<double, kColumns, Eigen::Dynamic> *a_jacobian_transpose,
     Eigen::Matrix<double, kColumns, kColumns> *a_jacTjac) {
+  if (levenberg_marquardt_details::calculateAnalyticJacobianTranspose(
+          otype_m, a_jacobian_transpose, 0)) {
+    *a_jacTjac = (*a_jacobian_transpose) * (a_jacobian_transpose->transpose());
+    return;
+  }
   // Set up temporary delta
   Eigen::Matrix<double, kColumns, 1> solo_delta;
   // Calculate tranpose of Jacobian
@@ -183,8 +189,7 @@ void LevenbergMarquardtScaled<OptimizingClass, kColumns>::calculateJacobian(
     solo_delta = Eigen::Matrix<double, kColumns, 1>::Zero();
     solo_delta(parameter) = a_delta(parameter);
     otype_m->updateGuess(&solo_delta);
-    Eigen::Matrix<double, Eigen::Dynamic, 1> change_in_guess =
-        otype_m->calculateChangeInGuess();
+    const auto &change_in_guess = otype_m->calculateChangeInGuess();
     for (int elem = 0; elem < change_in_guess.rows(); ++elem) {
       (*a_jacobian_transpose)(parameter, elem) =
           change_in_guess(elem) / safelyEpsilon(solo_delta(parameter));
@@ -0,0 +1,63 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/parameters/tolerance_context.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace IRL {
+
+namespace tolerance_context_details {
+thread_local const ToleranceContext* installed_context = nullptr;
+}  // namespace tolerance_context_details
+
+ToleranceContext::ToleranceContext(void)
+    : VF_low_m(global_constants::VF_LOW),
+      VF_high_m(global_constants::VF_HIGH),
+      volume_fraction_tolerance_m(
+          global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE),
+      minimum_volume_to_track_m(global_constants::MINIMUM_VOLUME_TO_TRACK),
+      minimum_surface_area_to_track_m(
+          global_constants::MINIMUM_SURFACE_AREA_TO_TRACK) {}
+
+void ToleranceContext::setVolumeFractionBounds(const double a_VF_low) {
+  assert(a_VF_low > 0.0 && a_VF_low < 1.0);
+  VF_low_m = a_VF_low;
+  VF_high_m = 1.0 - a_VF_low;
+  volume_fraction_tolerance_m =
+      std::min(volume_fraction_tolerance_m, VF_low_m);
+}
+
+void ToleranceContext::setVolumeFractionTolerance(const double a_tolerance) {
+  assert(a_tolerance > 0.0 && a_tolerance < 1.0);
+  volume_fraction_tolerance_m = std::min(VF_low_m, a_tolerance);
+}
+
+void ToleranceContext::setMinimumVolumeToTrack(
+    const double a_minimum_volume_to_track) {
+  minimum_volume_to_track_m = a_minimum_volume_to_track;
+}
+
+void ToleranceContext::setMinimumSurfaceAreaToTrack(
+    const double a_minimum_surface_area_to_track) {
+  minimum_surface_area_to_track_m = a_minimum_surface_area_to_track;
+}
+
+ScopedToleranceContext::ScopedToleranceContext(
+    const ToleranceContext& a_context)
+    : previous_context_m(tolerance_context_details::installed_context) {
+  tolerance_context_details::installed_context = &a_context;
+}
+
+ScopedToleranceContext::~ScopedToleranceContext(void) {
+  tolerance_context_details::installed_context = previous_context_m;
+}
+
+}  // namespace IRL
@@ -0,0 +1,120 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_PARAMETERS_TOLERANCE_CONTEXT_H_
+#define IRL_PARAMETERS_TOLERANCE_CONTEXT_H_
+
+#include "irl/parameters/constants.h"
+
+namespace IRL {
+
+/// \file tolerance_context.h
+///
+/// This file contains a set of the tolerances otherwise held in
+/// `global_constants`, which can be installed on a single thread so that
+/// threads may reconstruct with different accuracies at the same time.
+///
+/// The library reads tolerances through the `get...()` functions
+/// below. These return the values of the context installed on the
+/// calling thread, or the `global_constants` if none is installed.
+
+/// \brief Tolerances used by the reconstruction, distance-finding and
+/// cutting routines.
+class ToleranceContext {
+ public:
+  /// \brief Constructs a context holding the current `global_constants`.
+  ToleranceContext(void);
+
+  /// \brief Set the volume fraction bounds, with the same behavior as
+  /// `IRL::setVolumeFractionBounds`.
+  void setVolumeFractionBounds(const double a_VF_low);
+
+  /// \brief Set the volume fraction tolerance for iterative distance
+  /// finding, with the same behavior as `IRL::setVolumeFractionTolerance`.
+  void setVolumeFractionTolerance(const double a_tolerance);
+
+  /// \brief Set the minimum volume to track.
+  void setMinimumVolumeToTrack(const double a_minimum_volume_to_track);
+
+  /// \brief Set the minimum surface area to track.
+  void setMinimumSurfaceAreaToTrack(
+      const double a_minimum_surface_area_to_track);
+
+  /// \brief Volume fraction below which a cell is treated as empty.
+  double volumeFractionLow(void) const;
+
+  /// \brief Volume fraction above which a cell is treated as full.
+  double volumeFractionHigh(void) const;
+
+  /// \brief Tolerance in matching volume fraction during iterative
+  /// distance finding.
+  double volumeFractionTolerance(void) const;
+
+  /// \brief Minimum volume kept during cutting.
+  double minimumVolumeToTrack(void) const;
+
+  /// \brief Minimum surface area kept during cutting.
+  double minimumSurfaceAreaToTrack(void) const;
+
+ private:
+  double VF_low_m;
+  double VF_high_m;
+  double volume_fraction_tolerance_m;
+  double minimum_volume_to_track_m;
+  double minimum_surface_area_to_track_m;
+};
+
+/// \brief Installs a ToleranceContext on the calling thread for the
+/// lifetime of this object, restoring the previously installed one on
+/// destruction.
+///
+/// The context is referenced, not copied, and must outlive this object.
+/// Scopes must be destroyed in the reverse order of their construction.
+class ScopedToleranceContext {
+ public:
+  explicit ScopedToleranceContext(const ToleranceContext& a_context);
+
+  ScopedToleranceContext(const ScopedToleranceContext&) = delete;
+  ScopedToleranceContext& operator=(const ScopedToleranceContext&) = delete;
+
+  ~ScopedToleranceContext(void);
+
+ private:
+  const ToleranceContext* previous_context_m;
+};
+
+/// \brief Return the context installed on the calling thread, or nullptr
+/// if the `global_constants` are in use.
+inline const ToleranceContext* getInstalledToleranceContext(void);
+
+/// \brief `VF_LOW` for the calling thread.
+inline double getVolumeFractionLow(void);
+
+/// \brief `VF_HIGH` for the calling thread.
+inline double getVolumeFractionHigh(void);
+
+/// \brief `TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE` for the calling
+/// thread.
+inline double getVolumeFractionTolerance(void);
+
+/// \brief `MINIMUM_VOLUME_TO_TRACK` for the calling thread.
+inline double getMinimumVolumeToTrack(void);
+
+/// \brief `MINIMUM_SURFACE_AREA_TO_TRACK` for the calling thread.
+inline double getMinimumSurfaceAreaToTrack(void);
+
+namespace tolerance_context_details {
+extern thread_local const ToleranceContext* installed_context;
+}  // namespace tolerance_context_details
+
+}  // namespace IRL
+
+#include "irl/parameters/tolerance_context.tpp"
+
+#endif  // IRL_PARAMETERS_TOLERANCE_CONTEXT_H_
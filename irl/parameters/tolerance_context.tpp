@@ -0,0 +1,72 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_PARAMETERS_TOLERANCE_CONTEXT_TPP_
+#define IRL_PARAMETERS_TOLERANCE_CONTEXT_TPP_
+
+namespace IRL {
+
+inline double ToleranceContext::volumeFractionLow(void) const {
+  return VF_low_m;
+}
+
+inline double ToleranceContext::volumeFractionHigh(void) const {
+  return VF_high_m;
+}
+
+inline double ToleranceContext::volumeFractionTolerance(void) const {
+  return volume_fraction_tolerance_m;
+}
+
+inline double ToleranceContext::minimumVolumeToTrack(void) const {
+  return minimum_volume_to_track_m;
+}
+
+inline double ToleranceContext::minimumSurfaceAreaToTrack(void) const {
+  return minimum_surface_area_to_track_m;
+}
+
+inline const ToleranceContext* getInstalledToleranceContext(void) {
+  return tolerance_context_details::installed_context;
+}
+
+inline double getVolumeFractionLow(void) {
+  const ToleranceContext* context = getInstalledToleranceContext();
+  return context == nullptr ? global_constants::VF_LOW
+                            : context->volumeFractionLow();
+}
+
+inline double getVolumeFractionHigh(void) {
+  const ToleranceContext* context = getInstalledToleranceContext();
+  return context == nullptr ? global_constants::VF_HIGH
+                            : context->volumeFractionHigh();
+}
+
+inline double getVolumeFractionTolerance(void) {
+  const ToleranceContext* context = getInstalledToleranceContext();
+  return context == nullptr
+             ? global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE
+             : context->volumeFractionTolerance();
+}
+
+inline double getMinimumVolumeToTrack(void) {
+  const ToleranceContext* context = getInstalledToleranceContext();
+  return context == nullptr ? global_constants::MINIMUM_VOLUME_TO_TRACK
+                            : context->minimumVolumeToTrack();
+}
+
+inline double getMinimumSurfaceAreaToTrack(void) {
+  const ToleranceContext* context = getInstalledToleranceContext();
+  return context == nullptr ? global_constants::MINIMUM_SURFACE_AREA_TO_TRACK
+                            : context->minimumSurfaceAreaToTrack();
+}
+
+}  // namespace IRL
+
+#endif  // IRL_PARAMETERS_TOLERANCE_CONTEXT_TPP_
@@ -10,6 +10,7 @@
 #ifndef IRL_PLANAR_RECONSTRUCTION_LOCALIZED_SEPARATOR_LINK_H_
 #define IRL_PLANAR_RECONSTRUCTION_LOCALIZED_SEPARATOR_LINK_H_
 
+#include "irl/graphs/compact_graph.h"
 #include "irl/graphs/un_directed_graph_node.h"
 #include "irl/planar_reconstruction/localized_separator.h"
 #include "irl/planar_reconstruction/reconstruction_link.h"
@@ -18,6 +19,11 @@ namespace IRL {
 
 using LocalizedSeparatorLink =
     ReconstructionLink<LocalizedSeparator, UnDirectedGraphNode>;
+
+/// \brief LocalizedSeparatorLink whose edges are stored for the whole mesh in
+/// a CompactGraph<CompactLocalizedSeparatorLink>.
+using CompactLocalizedSeparatorLink =
+    ReconstructionLink<LocalizedSeparator, CompactGraphNode>;
 }  // namespace IRL
 
 #endif // IRL_PLANAR_RECONSTRUCTION_LOCALIZED_SEPARATOR_LINK_H_
@@ -0,0 +1,103 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/planar_reconstruction/packed_planar_separator_array.h"
+
+namespace IRL {
+
+PackedPlanarSeparatorArray::PackedPlanarSeparatorArray(
+    const UnsignedIndex_t a_size)
+    : separators_m(a_size, PackedSeparator{{0.0, 0.0, 0.0}, 0.0, no_planes}),
+      overflow_m(),
+      free_overflow_m() {}
+
+void PackedPlanarSeparatorArray::resize(const UnsignedIndex_t a_size) {
+  for (UnsignedIndex_t n = a_size; n < this->size(); ++n) {
+    this->releaseOverflow(n);
+  }
+  separators_m.resize(a_size, PackedSeparator{{0.0, 0.0, 0.0}, 0.0, no_planes});
+}
+
+UnsignedIndex_t PackedPlanarSeparatorArray::getNumberOfOverflowSeparators(
+    void) const {
+  return static_cast<UnsignedIndex_t>(overflow_m.size() -
+                                      free_overflow_m.size());
+}
+
+LargeOffsetIndex_t PackedPlanarSeparatorArray::getMemoryUsage(void) const {
+  return separators_m.capacity() * sizeof(PackedSeparator) +
+         overflow_m.capacity() * sizeof(PlanarSeparator) +
+         free_overflow_m.capacity() * sizeof(UnsignedIndex_t);
+}
+
+LargeOffsetIndex_t PackedPlanarSeparatorArray::getSerializedSize(void) const {
+  LargeOffsetIndex_t size = 2 * sizeof(UnsignedIndex_t) +
+                            separators_m.size() * serialized_record_size;
+  for (UnsignedIndex_t n = 0; n < this->size(); ++n) {
+    if (!this->isPacked(n)) {
+      size += overflow_m[separators_m[n].state - overflow].getSerializedSize();
+    }
+  }
+  return size;
+}
+
+void PackedPlanarSeparatorArray::serialize(ByteBuffer* a_buffer) const {
+  assert(a_buffer != nullptr);
+  // Records are written field by field, so padding is never written.
+  // Overflow separators are written in cell order and renumbered to match,
+  // so that free slots are not written.
+  const UnsignedIndex_t number_of_cells = this->size();
+  const UnsignedIndex_t number_of_overflow =
+      this->getNumberOfOverflowSeparators();
+  a_buffer->pack(&number_of_cells, 1);
+  a_buffer->pack(&number_of_overflow, 1);
+  std::uint32_t next_overflow = overflow;
+  for (const auto& record : separators_m) {
+    const std::uint32_t state =
+        record.state < overflow ? record.state : next_overflow++;
+    a_buffer->pack(record.normal, 3);
+    a_buffer->pack(&record.distance, 1);
+    a_buffer->pack(&state, 1);
+  }
+  for (const auto& record : separators_m) {
+    if (record.state >= overflow) {
+      overflow_m[record.state - overflow].serialize(a_buffer);
+    }
+  }
+}
+
+void PackedPlanarSeparatorArray::unpackSerialized(ByteBuffer* a_buffer) {
+  assert(a_buffer != nullptr);
+  UnsignedIndex_t number_of_cells;
+  UnsignedIndex_t number_of_overflow;
+  a_buffer->unpack(&number_of_cells, 1);
+  a_buffer->unpack(&number_of_overflow, 1);
+  separators_m.resize(number_of_cells);
+  for (auto& record : separators_m) {
+    a_buffer->unpack(record.normal, 3);
+    a_buffer->unpack(&record.distance, 1);
+    a_buffer->unpack(&record.state, 1);
+  }
+  overflow_m.resize(number_of_overflow);
+  for (auto& separator : overflow_m) {
+    separator.unpackSerialized(a_buffer);
+  }
+  free_overflow_m.clear();
+}
+
+void PackedPlanarSeparatorArray::releaseOverflow(
+    const UnsignedIndex_t a_index) {
+  PackedSeparator& record = separators_m[a_index];
+  if (record.state >= overflow) {
+    free_overflow_m.push_back(record.state - overflow);
+    record.state = no_planes;
+  }
+}
+
+}  // namespace IRL
@@ -0,0 +1,121 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_PLANAR_RECONSTRUCTION_PACKED_PLANAR_SEPARATOR_ARRAY_H_
+#define IRL_PLANAR_RECONSTRUCTION_PACKED_PLANAR_SEPARATOR_ARRAY_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "irl/geometry/general/normal.h"
+#include "irl/helpers/byte_buffer.h"
+#include "irl/parameters/defined_types.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace IRL {
+
+/// \brief Compact storage for one PlanarSeparator per cell of a mesh.
+///
+/// A PlanarSeparator always reserves room for
+/// `global_constants::MAX_PLANAR_LOCALIZER_PLANES` planes, even though
+/// most cells hold a single plane or none. This array stores those common
+/// cells in a 40 byte record: the three components of the normal, the
+/// distance and a small state word. Any other separator (two or more
+/// planes, or a flipped separator without planes) is kept in full in a
+/// separate overflow list that the record points to.
+///
+/// Separators are decoded on access with `get(...)`, and are bit-for-bit
+/// identical to those that were stored.
+class PackedPlanarSeparatorArray {
+ public:
+  /// \brief Default constructor, an array of no cells.
+  PackedPlanarSeparatorArray(void) = default;
+
+  /// \brief Construct with `a_size` cells, each holding a default
+  /// PlanarSeparator (no planes).
+  explicit PackedPlanarSeparatorArray(const UnsignedIndex_t a_size);
+
+  /// \brief Number of cells in the array.
+  UnsignedIndex_t size(void) const;
+
+  /// \brief Resize the array. Added cells hold a separator with no
+  /// planes.
+  void resize(const UnsignedIndex_t a_size);
+
+  /// \brief Store `a_separator` for cell `a_index`.
+  void set(const UnsignedIndex_t a_index, const PlanarSeparator& a_separator);
+
+  /// \brief Decode the separator of cell `a_index`.
+  PlanarSeparator get(const UnsignedIndex_t a_index) const;
+
+  /// \brief Decode the separator of cell `a_index` into `a_separator`.
+  void get(const UnsignedIndex_t a_index, PlanarSeparator* a_separator) const;
+
+  /// \brief Number of planes in the separator of cell `a_index`.
+  UnsignedIndex_t getNumberOfPlanes(const UnsignedIndex_t a_index) const;
+
+  /// \brief Whether cell `a_index` is stored in a packed record, as opposed
+  /// to the overflow list.
+  bool isPacked(const UnsignedIndex_t a_index) const;
+
+  /// \brief Number of cells stored in the overflow list.
+  UnsignedIndex_t getNumberOfOverflowSeparators(void) const;
+
+  /// \brief Bytes of memory held by the array.
+  LargeOffsetIndex_t getMemoryUsage(void) const;
+
+  /// \brief Return size of the serialized array.
+  LargeOffsetIndex_t getSerializedSize(void) const;
+
+  /// \brief Serialize and pack the array.
+  void serialize(ByteBuffer* a_buffer) const;
+
+  /// \brief Unpack a serialized array and store.
+  void unpackSerialized(ByteBuffer* a_buffer);
+
+  /// \brief Default destructor.
+  ~PackedPlanarSeparatorArray(void) = default;
+
+ private:
+  /// \brief States of a record. Values of `overflow` and above index the
+  /// overflow list.
+  static constexpr std::uint32_t no_planes = 0;
+  static constexpr std::uint32_t one_plane = 1;
+  static constexpr std::uint32_t one_plane_flipped = 2;
+  static constexpr std::uint32_t overflow = 3;
+
+  struct PackedSeparator {
+    double normal[3];
+    double distance;
+    std::uint32_t state;
+  };
+
+  /// \brief Bytes written by `serialize(...)` for each record, which
+  /// excludes the padding of PackedSeparator.
+  static constexpr LargeOffsetIndex_t serialized_record_size =
+      4 * sizeof(double) + sizeof(std::uint32_t);
+
+  /// \brief Pack a separator with at most one plane. Returns a record
+  /// with state `overflow` if it cannot be packed.
+  static PackedSeparator packSeparator(const PlanarSeparator& a_separator);
+
+  /// \brief Release the overflow slot used by cell `a_index`, if any.
+  void releaseOverflow(const UnsignedIndex_t a_index);
+
+  std::vector<PackedSeparator> separators_m;
+  std::vector<PlanarSeparator> overflow_m;
+  /// \brief Slots of `overflow_m` not referenced by any cell.
+  std::vector<UnsignedIndex_t> free_overflow_m;
+};
+
+}  // namespace IRL
+
+#include "irl/planar_reconstruction/packed_planar_separator_array.tpp"
+
+#endif  // IRL_PLANAR_RECONSTRUCTION_PACKED_PLANAR_SEPARATOR_ARRAY_H_
@@ -0,0 +1,112 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef IRL_PLANAR_RECONSTRUCTION_PACKED_PLANAR_SEPARATOR_ARRAY_TPP_
+#define IRL_PLANAR_RECONSTRUCTION_PACKED_PLANAR_SEPARATOR_ARRAY_TPP_
+
+#include <cassert>
+
+namespace IRL {
+
+inline UnsignedIndex_t PackedPlanarSeparatorArray::size(void) const {
+  return static_cast<UnsignedIndex_t>(separators_m.size());
+}
+
+inline void PackedPlanarSeparatorArray::set(
+    const UnsignedIndex_t a_index, const PlanarSeparator& a_separator) {
+  assert(a_index < this->size());
+  const PackedSeparator packed = packSeparator(a_separator);
+  if (packed.state != overflow) {
+    this->releaseOverflow(a_index);
+    separators_m[a_index] = packed;
+    return;
+  }
+  PackedSeparator& record = separators_m[a_index];
+  if (record.state < overflow) {
+    if (free_overflow_m.empty()) {
+      record.state = overflow + static_cast<std::uint32_t>(overflow_m.size());
+      overflow_m.push_back(a_separator);
+      return;
+    }
+    record.state = overflow + free_overflow_m.back();
+    free_overflow_m.pop_back();
+  }
+  overflow_m[record.state - overflow] = a_separator;
+}
+
+inline PlanarSeparator PackedPlanarSeparatorArray::get(
+    const UnsignedIndex_t a_index) const {
+  PlanarSeparator separator;
+  this->get(a_index, &separator);
+  return separator;
+}
+
+inline void PackedPlanarSeparatorArray::get(
+    const UnsignedIndex_t a_index, PlanarSeparator* a_separator) const {
+  assert(a_index < this->size());
+  assert(a_separator != nullptr);
+  const PackedSeparator& record = separators_m[a_index];
+  switch (record.state) {
+    case no_planes:
+      a_separator->zeroPlanes();
+      return;
+    case one_plane:
+    case one_plane_flipped:
+      a_separator->setNumberOfPlanes(1);
+      (*a_separator)[0] =
+          Plane(Normal(record.normal[0], record.normal[1], record.normal[2]),
+                record.distance);
+      a_separator->setFlip(record.state == one_plane ? 1.0 : -1.0);
+      return;
+    default:
+      *a_separator = overflow_m[record.state - overflow];
+  }
+}
+
+inline UnsignedIndex_t PackedPlanarSeparatorArray::getNumberOfPlanes(
+    const UnsignedIndex_t a_index) const {
+  assert(a_index < this->size());
+  const std::uint32_t state = separators_m[a_index].state;
+  if (state >= overflow) {
+    return overflow_m[state - overflow].getNumberOfPlanes();
+  }
+  return state == no_planes ? 0 : 1;
+}
+
+inline bool PackedPlanarSeparatorArray::isPacked(
+    const UnsignedIndex_t a_index) const {
+  assert(a_index < this->size());
+  return separators_m[a_index].state < overflow;
+}
+
+inline PackedPlanarSeparatorArray::PackedSeparator
+PackedPlanarSeparatorArray::packSeparator(const PlanarSeparator& a_separator) {
+  PackedSeparator packed{{0.0, 0.0, 0.0}, 0.0, overflow};
+  const UnsignedIndex_t number_of_planes = a_separator.getNumberOfPlanes();
+  if (number_of_planes == 0) {
+    if (a_separator.isNotFlipped()) {
+      packed.state = no_planes;
+    }
+    return packed;
+  }
+  if (number_of_planes > 1) {
+    return packed;
+  }
+  const Normal& normal = a_separator[0].normal();
+  for (UnsignedIndex_t d = 0; d < 3; ++d) {
+    packed.normal[d] = normal[d];
+  }
+  packed.distance = a_separator[0].distance();
+  packed.state = a_separator.isFlipped() ? one_plane_flipped : one_plane;
+  return packed;
+}
+
+}  // namespace IRL
+
+#endif  // IRL_PLANAR_RECONSTRUCTION_PACKED_PLANAR_SEPARATOR_ARRAY_TPP_
@@ -83,6 +83,9 @@ struct has_localizer<LocalizerLink> : std::true_type {};
 template <>
 struct has_localizer<LocalizedSeparatorLink> : std::true_type {};
 
+template <>
+struct has_localizer<CompactLocalizedSeparatorLink> : std::true_type {};
+
 template <>
 struct has_localizer<MaskedLocalizedSeparatorLink> : std::true_type {};
 
@@ -122,6 +125,9 @@ struct has_separator<LocalizedSeparator> : std::true_type {};
 template <>
 struct has_separator<LocalizedSeparatorLink> : std::true_type {};
 
+template <>
+struct has_separator<CompactLocalizedSeparatorLink> : std::true_type {};
+
 template <>
 struct has_separator<MaskedLocalizedSeparatorLink> : std::true_type {};
 
@@ -154,6 +160,9 @@ struct is_reconstruction_link<LocalizerLink> : std::true_type {};
 template <>
 struct is_reconstruction_link<LocalizedSeparatorLink> : std::true_type {};
 
+template <>
+struct is_reconstruction_link<CompactLocalizedSeparatorLink> : std::true_type {};
+
 template <>
 struct is_reconstruction_link<MaskedLocalizedSeparatorLink> : std::true_type {};
 
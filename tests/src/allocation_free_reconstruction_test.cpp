@@ -0,0 +1,372 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/cut_polygon.h"
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/general/normal.h"
+#include "irl/geometry/general/plane.h"
+#include "irl/interface_reconstruction_methods/plane_distance.h"
+#include "irl/interface_reconstruction_methods/reconstruction_interface.h"
+#include "irl/moments/volume_moments_and_normal.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+// Every allocation made by this thread while `counting_allocations` is set
+// is counted, by replacing glibc's malloc family with versions that count
+// and then forward to glibc. operator new calls malloc, so it is counted
+// too. Builds without NDEBUG are skipped, since their consistency checks
+// of half-edge structures allocate.
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && defined(NDEBUG)
+#define IRL_TEST_COUNT_ALLOCATIONS
+
+namespace {
+thread_local bool counting_allocations = false;
+thread_local std::size_t number_of_allocations = 0;
+
+inline void countAllocation(void) {
+  if (counting_allocations) {
+    ++number_of_allocations;
+  }
+}
+}  // namespace
+
+extern "C" {
+void* __libc_malloc(std::size_t a_size);
+void* __libc_calloc(std::size_t a_number, std::size_t a_size);
+void* __libc_realloc(void* a_pointer, std::size_t a_size);
+void* __libc_memalign(std::size_t a_alignment, std::size_t a_size);
+
+void* malloc(std::size_t a_size) {
+  countAllocation();
+  return __libc_malloc(a_size);
+}
+
+void* calloc(std::size_t a_number, std::size_t a_size) {
+  countAllocation();
+  return __libc_calloc(a_number, a_size);
+}
+
+void* realloc(void* a_pointer, std::size_t a_size) {
+  countAllocation();
+  return __libc_realloc(a_pointer, a_size);
+}
+
+void* memalign(std::size_t a_alignment, std::size_t a_size) {
+  countAllocation();
+  return __libc_memalign(a_alignment, a_size);
+}
+
+void* aligned_alloc(std::size_t a_alignment, std::size_t a_size) {
+  countAllocation();
+  return __libc_memalign(a_alignment, a_size);
+}
+
+int posix_memalign(void** a_pointer, std::size_t a_alignment,
+                   std::size_t a_size) {
+  countAllocation();
+  *a_pointer = __libc_memalign(a_alignment, a_size);
+  return *a_pointer == nullptr ? 12 : 0;  // ENOMEM
+}
+}
+#endif
+
+namespace {
+
+using namespace IRL;
+
+// Number of allocations made while calling `a_function`.
+template <class FunctionType>
+std::size_t countAllocations(const FunctionType& a_function) {
+#ifdef IRL_TEST_COUNT_ALLOCATIONS
+  number_of_allocations = 0;
+  counting_allocations = true;
+  a_function();
+  counting_allocations = false;
+  return number_of_allocations;
+#else
+  a_function();
+  return 0;
+#endif
+}
+
+// Reconstruct once to warm up, then expect each following reconstruction
+// of a cell to not allocate.
+template <class FunctionType>
+void expectAllocationFree(const FunctionType& a_reconstruct,
+                          const char* a_name) {
+  a_reconstruct(0);
+  for (int cell = 1; cell < 4; ++cell) {
+    EXPECT_EQ(countAllocations([&]() { a_reconstruct(cell); }), 0u)
+        << a_name << ", cell " << cell;
+  }
+}
+
+// Normal of the interface in each test cell.
+Normal cellNormal(const int a_cell, const bool a_two_dimensional) {
+  const double z = a_two_dimensional ? 0.0 : 0.5 - 0.1 * a_cell;
+  return Normal::normalized(0.3 + 0.1 * a_cell, 0.8 - 0.05 * a_cell, z);
+}
+
+PlanarSeparator onePlane(const int a_cell, const bool a_two_dimensional) {
+  const Normal normal = cellNormal(a_cell, a_two_dimensional);
+  return PlanarSeparator::fromOnePlane(Plane(
+      normal,
+      findDistanceOnePlane(unit_cell, 0.3 + 0.05 * a_cell, normal)));
+}
+
+PlanarSeparator twoPlanes(const int a_cell) {
+  return PlanarSeparator::fromTwoPlanes(
+      Plane(Normal::normalized(-1.0, 1.0, 0.0), 0.05 + 0.01 * a_cell),
+      Plane(Normal::normalized(1.0, 1.0, 0.0), 0.1), 1.0);
+}
+
+// Stencil of unit cells around the origin, 3 x 3 x 1 in 2D and 3 x 3 x 3
+// in 3D, with the moments of a reconstruction.
+class Stencil {
+ public:
+  explicit Stencil(const bool a_two_dimensional)
+      : size_m(a_two_dimensional ? 9 : 27) {
+    r2p_m.resize(size_m);
+    lvira_m.resize(size_m);
+    elvira_m.resize(size_m);
+    for (UnsignedIndex_t n = 0; n < size_m; ++n) {
+      const int i = static_cast<int>(n % 3) - 1;
+      const int j = static_cast<int>((n / 3) % 3) - 1;
+      const int k = static_cast<int>(n / 9) - 1 + (a_two_dimensional ? 1 : 0);
+      cells_m[n] = unit_cell;
+      cells_m[n].shift(i, j, k);
+      r2p_m.setMember(n, &cells_m[n], &moments_m[n]);
+      lvira_m.setMember(n, &cells_m[n], &volume_fractions_m[n]);
+      // ELVIRA indexes a 2D stencil with k = -1.
+      elvira_m.setMember(&cells_m[n], &volume_fractions_m[n], i, j,
+                         a_two_dimensional ? -1 : k);
+    }
+    const UnsignedIndex_t center = size_m / 2;
+    r2p_m.setCenterOfStencil(center);
+    lvira_m.setCenterOfStencil(center);
+  }
+
+  void setMoments(const PlanarSeparator& a_reconstruction) {
+    for (UnsignedIndex_t n = 0; n < size_m; ++n) {
+      moments_m[n] =
+          getNormalizedVolumeMoments<SeparatedMoments<VolumeMoments>>(
+              cells_m[n], a_reconstruction);
+      volume_fractions_m[n] = moments_m[n][0].volume();
+    }
+    r2p_m.setSurfaceArea(
+        getReconstructionSurfaceArea(unit_cell, a_reconstruction));
+  }
+
+  const SeparatedMoments<VolumeMoments>& getCenterMoments(void) const {
+    return moments_m[size_m / 2];
+  }
+
+  const R2PNeighborhood<RectangularCuboid>& r2p(void) const { return r2p_m; }
+  const LVIRANeighborhood<RectangularCuboid>& lvira(void) const {
+    return lvira_m;
+  }
+  const ELVIRANeighborhood& elvira(void) const { return elvira_m; }
+
+ private:
+  UnsignedIndex_t size_m;
+  RectangularCuboid cells_m[27];
+  SeparatedMoments<VolumeMoments> moments_m[27];
+  double volume_fractions_m[27];
+  R2PNeighborhood<RectangularCuboid> r2p_m;
+  LVIRANeighborhood<RectangularCuboid> lvira_m;
+  ELVIRANeighborhood elvira_m;
+};
+
+// Reconstruction to start optimizations from, `a_reconstruction` with its
+// normals rotated. The optimizations reset the distances themselves.
+PlanarSeparator perturb(PlanarSeparator a_reconstruction) {
+  const UnitQuaternion rotation(0.1, Normal(0.0, 0.0, 1.0));
+  for (auto& plane : a_reconstruction) {
+    plane.normal() = rotation * plane.normal();
+  }
+  return a_reconstruction;
+}
+
+TEST(AllocationFreeReconstruction, CountsAllocations) {
+#ifndef IRL_TEST_COUNT_ALLOCATIONS
+  GTEST_SKIP() << "allocations are only counted in NDEBUG builds with glibc";
+#endif
+  EXPECT_EQ(countAllocations([]() {}), 0u);
+  EXPECT_GT(countAllocations([]() {
+              volatile auto* vector = new std::vector<double>(100);
+              delete vector;
+            }),
+            0u);
+}
+
+TEST(AllocationFreeReconstruction, R2P) {
+  Stencil stencil_2d(true);
+  Stencil stencil_3d(false);
+  const auto r2p_2d = [&](const int a_cell, const bool a_two_planes) {
+    const auto correct =
+        a_two_planes ? twoPlanes(a_cell) : onePlane(a_cell, true);
+    stencil_2d.setMoments(correct);
+    reconstructionWithR2P2D(stencil_2d.r2p(), perturb(correct));
+  };
+  expectAllocationFree([&](const int a_cell) { r2p_2d(a_cell, false); },
+                       "reconstructionWithR2P2D, one plane");
+  expectAllocationFree([&](const int a_cell) { r2p_2d(a_cell, true); },
+                       "reconstructionWithR2P2D, two planes");
+
+  ReconstructionWarmStartCache cache;
+  ToleranceContext tolerances;
+  OptimizationBehavior behavior;
+  R2PWeighting weighting;
+  for (const bool two_planes : {false, true}) {
+    const auto initial = [&](const int a_cell) {
+      const auto correct =
+          two_planes ? twoPlanes(a_cell) : onePlane(a_cell, false);
+      stencil_3d.setMoments(correct);
+      return perturb(correct);
+    };
+    expectAllocationFree(
+        [&](const int a_cell) {
+          reconstructionWithR2P3D(stencil_3d.r2p(), initial(a_cell));
+        },
+        "reconstructionWithR2P3D");
+    expectAllocationFree(
+        [&](const int a_cell) {
+          reconstructionWithR2P3D(stencil_3d.r2p(), initial(a_cell),
+                                  weighting);
+        },
+        "reconstructionWithR2P3D with weighting");
+    expectAllocationFree(
+        [&](const int a_cell) {
+          reconstructionWithR2P3D(stencil_3d.r2p(), initial(a_cell), behavior,
+                                  weighting);
+        },
+        "reconstructionWithR2P3D with behavior");
+    expectAllocationFree(
+        [&](const int a_cell) {
+          reconstructionWithR2P3D(stencil_3d.r2p(), initial(a_cell), &cache,
+                                  two_planes ? 1 : 0);
+        },
+        "reconstructionWithR2P3D with warm start");
+    expectAllocationFree(
+        [&](const int a_cell) {
+          reconstructionWithR2P3D(stencil_3d.r2p(), initial(a_cell),
+                                  tolerances);
+        },
+        "reconstructionWithR2P3D with tolerances");
+  }
+}
+
+TEST(AllocationFreeReconstruction, LVIRAAndELVIRA) {
+  Stencil stencil_2d(true);
+  Stencil stencil_3d(false);
+  ReconstructionWarmStartCache cache;
+  ToleranceContext tolerances;
+  const auto initial = [](Stencil* a_stencil, const int a_cell,
+                          const bool a_two_dimensional) {
+    const auto correct = onePlane(a_cell, a_two_dimensional);
+    a_stencil->setMoments(correct);
+    return perturb(correct);
+  };
+  expectAllocationFree(
+      [&](const int a_cell) {
+        reconstructionWithLVIRA2D(stencil_2d.lvira(),
+                                  initial(&stencil_2d, a_cell, true));
+      },
+      "reconstructionWithLVIRA2D");
+  expectAllocationFree(
+      [&](const int a_cell) {
+        reconstructionWithLVIRA3D(stencil_3d.lvira(),
+                                  initial(&stencil_3d, a_cell, false));
+      },
+      "reconstructionWithLVIRA3D");
+  expectAllocationFree(
+      [&](const int a_cell) {
+        reconstructionWithLVIRA3D(stencil_3d.lvira(),
+                                  initial(&stencil_3d, a_cell, false), &cache,
+                                  0);
+      },
+      "reconstructionWithLVIRA3D with warm start");
+  expectAllocationFree(
+      [&](const int a_cell) {
+        reconstructionWithLVIRA3D(stencil_3d.lvira(),
+                                  initial(&stencil_3d, a_cell, false),
+                                  tolerances);
+      },
+      "reconstructionWithLVIRA3D with tolerances");
+  expectAllocationFree(
+      [&](const int a_cell) {
+        initial(&stencil_2d, a_cell, true);
+        reconstructionWithELVIRA2D(stencil_2d.elvira());
+      },
+      "reconstructionWithELVIRA2D");
+  expectAllocationFree(
+      [&](const int a_cell) {
+        initial(&stencil_3d, a_cell, false);
+        reconstructionWithELVIRA3D(stencil_3d.elvira());
+      },
+      "reconstructionWithELVIRA3D");
+  expectAllocationFree(
+      [&](const int a_cell) {
+        initial(&stencil_3d, a_cell, false);
+        reconstructionWithELVIRA3D(stencil_3d.elvira(), tolerances);
+      },
+      "reconstructionWithELVIRA3D with tolerances");
+}
+
+TEST(AllocationFreeReconstruction, MOFAndAdvectedNormals) {
+  ToleranceContext tolerances;
+  const auto moments = [](const int a_cell, const bool a_two_dimensional) {
+    return getNormalizedVolumeMoments<SeparatedMoments<VolumeMoments>>(
+        unit_cell, onePlane(a_cell, a_two_dimensional));
+  };
+  expectAllocationFree(
+      [&](const int a_cell) {
+        reconstructionWithMOF2D(unit_cell, moments(a_cell, true));
+      },
+      "reconstructionWithMOF2D");
+  expectAllocationFree(
+      [&](const int a_cell) {
+        reconstructionWithMOF3D(unit_cell, moments(a_cell, false));
+      },
+      "reconstructionWithMOF3D");
+  expectAllocationFree(
+      [&](const int a_cell) {
+        reconstructionWithMOF3D(unit_cell, moments(a_cell, false),
+                                tolerances);
+      },
+      "reconstructionWithMOF3D with tolerances");
+
+  // Two sheets of liquid, whose normals need two planes.
+  ListedVolumeMoments<VolumeMomentsAndNormal> list;
+  list += VolumeMomentsAndNormal(VolumeMoments(0.5, Pt(-0.2, 0.18, 0.0)),
+                                 Normal::normalized(-0.2, 1.0, 0.0));
+  list += VolumeMomentsAndNormal(VolumeMoments(0.5, Pt(0.2, -0.18, 0.0)),
+                                 Normal::normalized(0.2, -1.0, 0.0));
+  list += VolumeMomentsAndNormal(VolumeMoments(0.5, Pt(0.2, 0.18, 0.0)),
+                                 Normal::normalized(0.2, 1.0, 0.0));
+  list += VolumeMomentsAndNormal(VolumeMoments(0.5, Pt(-0.2, -0.18, 0.0)),
+                                 Normal::normalized(-0.2, -1.0, 0.0));
+  list.multiplyByVolume();
+  Stencil stencil(false);
+  expectAllocationFree(
+      [&](const int a_cell) {
+        stencil.setMoments(PlanarSeparator::fromTwoPlanes(
+            Plane(Normal(0.0, 1.0, 0.0), -0.2 - 0.01 * a_cell),
+            Plane(Normal(0.0, -1.0, 0.0), -0.25), -1.0));
+        reconstructionWithAdvectedNormals(list, stencil.r2p());
+      },
+      "reconstructionWithAdvectedNormals");
+}
+
+}  // namespace
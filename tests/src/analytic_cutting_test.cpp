@@ -16,7 +16,9 @@
 #include "irl/geometry/polyhedrons/rectangular_cuboid.h"
 #include "irl/geometry/polyhedrons/tet.h"
 #include "irl/interface_reconstruction_methods/plane_distance.h"
+#include "irl/moments/separated_volume_moments.h"
 #include "irl/moments/volume.h"
+#include "irl/moments/volume_moments.h"
 
 #include "gtest/gtest.h"
 
@@ -90,4 +92,129 @@ TEST(AnalyticCutting, TetForVolume) {
   }
 }
 
+TEST(AnalyticCutting, RectangularCuboidForVolumeMoments) {
+  std::mt19937_64 eng(2019);
+  std::uniform_real_distribution<double> random_normal(-1.0, 1.0);
+  std::uniform_real_distribution<double> random_VF(-0.05, 1.05);
+
+  static const int ncycles = 10000;
+
+  RectangularCuboid cuboid =
+      RectangularCuboid::fromBoundingPts(Pt(0.0, 0.0, 0.0), Pt(4.0, 16.0, 2.5));
+  for (auto& vertex : cuboid) {
+    vertex += Pt(-10.0, 5.0, 1.5);
+  }
+  const double cell_volume = cuboid.calculateVolume();
+
+  for (int cycle = 0; cycle < ncycles; ++cycle) {
+    Normal normal = Normal::normalized(random_normal(eng), random_normal(eng),
+                                       random_normal(eng));
+    // Planes aligned with a face or an edge have zero slopes.
+    if (cycle % 7 == 0) {
+      normal[cycle % 3] = 0.0;
+      normal.normalize();
+    } else if (cycle % 11 == 0) {
+      normal = Normal(0.0, 0.0, 0.0);
+      normal[cycle % 3] = random_normal(eng) > 0.0 ? 1.0 : -1.0;
+    }
+    const double distance = normal * cuboid.calculateCentroid() +
+                            (random_VF(eng) - 0.5) * 10.0;
+    const Plane plane(normal, distance);
+    const auto analytic_moments = getAnalyticVolumeMoments(cuboid, plane);
+    const auto cut_moments = getVolumeMoments<VolumeMoments, HalfEdgeCutting>(
+        cuboid, PlanarSeparator::fromOnePlane(plane));
+    EXPECT_NEAR(analytic_moments.volume() / cell_volume,
+                cut_moments.volume() / cell_volume, 1.0e-13)
+        << plane;
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      EXPECT_NEAR(analytic_moments.centroid()[d] / cell_volume,
+                  cut_moments.centroid()[d] / cell_volume, 1.0e-11)
+          << plane;
+    }
+  }
+}
+
+TEST(AnalyticCutting, TetForVolumeMoments) {
+  std::mt19937_64 eng(2019);
+  std::uniform_real_distribution<double> random_normal(-1.0, 1.0);
+
+  static const int ncycles = 10000;
+
+  Tet tet({Pt(1.0, 0.0, -0.5), Pt(1.0, 1.0, 0.0), Pt(1.0, 0.0, 0.5),
+           Pt(0.5, 0.0, 0.0)});
+  for (auto& vertex : tet) {
+    vertex += Pt(-10.0, 5.0, 1.5);
+  }
+  // Both orientations must agree with the cut.
+  Tet inverted_tet({tet[1], tet[0], tet[2], tet[3]});
+  const double tet_volume = tet.calculateAbsoluteVolume();
+
+  for (int cycle = 0; cycle < ncycles; ++cycle) {
+    const Normal normal = Normal::normalized(
+        random_normal(eng), random_normal(eng), random_normal(eng));
+    const Plane plane(
+        normal, normal * tet.calculateCentroid() + 0.6 * random_normal(eng));
+    const Tet& cut_tet = cycle % 2 == 0 ? tet : inverted_tet;
+    const auto analytic_moments = getAnalyticVolumeMoments(cut_tet, plane);
+    const auto cut_moments = getVolumeMoments<VolumeMoments, HalfEdgeCutting>(
+        cut_tet, PlanarSeparator::fromOnePlane(plane));
+    EXPECT_NEAR(analytic_moments.volume() / tet_volume,
+                cut_moments.volume() / tet_volume, 1.0e-13)
+        << plane;
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      EXPECT_NEAR(analytic_moments.centroid()[d] / tet_volume,
+                  cut_moments.centroid()[d] / tet_volume, 1.0e-12)
+          << plane;
+    }
+  }
+}
+
+TEST(AnalyticCutting, SelectedThroughCuttingMethod) {
+  std::mt19937_64 eng(42);
+  std::uniform_real_distribution<double> random_normal(-1.0, 1.0);
+
+  RectangularCuboid cuboid = RectangularCuboid::fromBoundingPts(
+      Pt(-0.5, 0.25, 1.0), Pt(1.0, 1.0, 1.5));
+  Tet tet({Pt(1.0, 0.0, -0.5), Pt(1.0, 1.0, 0.0), Pt(1.0, 0.0, 0.5),
+           Pt(0.5, 0.0, 0.0)});
+
+  for (int cycle = 0; cycle < 100; ++cycle) {
+    const Normal normal = Normal::normalized(
+        random_normal(eng), random_normal(eng), random_normal(eng));
+    const double distance =
+        normal * cuboid.calculateCentroid() + 0.2 * random_normal(eng);
+    PlanarSeparator separator =
+        PlanarSeparator::fromOnePlane(Plane(normal, distance));
+    if (cycle % 2 == 0) {
+      separator.setFlip(1.0);
+    }
+    // Two planes are not handled analytically and fall back to cutting.
+    if (cycle % 5 == 0) {
+      separator = PlanarSeparator::fromTwoPlanes(
+          separator[0], Plane(-normal, -separator[0].distance() + 0.1), 1.0);
+    }
+
+    const auto analytic_cuboid = getNormalizedVolumeMoments<
+        SeparatedMoments<VolumeMoments>, AnalyticCutting>(cuboid, separator);
+    const auto cut_cuboid = getNormalizedVolumeMoments<
+        SeparatedMoments<VolumeMoments>, HalfEdgeCutting>(cuboid, separator);
+    const auto analytic_tet = getNormalizedVolumeMoments<
+        SeparatedMoments<VolumeMoments>, AnalyticCutting>(tet, separator);
+    const auto cut_tet = getNormalizedVolumeMoments<
+        SeparatedMoments<VolumeMoments>, HalfEdgeCutting>(tet, separator);
+    for (UnsignedIndex_t phase = 0; phase < 2; ++phase) {
+      EXPECT_NEAR(analytic_cuboid[phase].volume(), cut_cuboid[phase].volume(),
+                  1.0e-13);
+      EXPECT_NEAR(analytic_tet[phase].volume(), cut_tet[phase].volume(),
+                  1.0e-13);
+      for (UnsignedIndex_t d = 0; d < 3; ++d) {
+        EXPECT_NEAR(analytic_cuboid[phase].centroid()[d],
+                    cut_cuboid[phase].centroid()[d], 1.0e-10);
+        EXPECT_NEAR(analytic_tet[phase].centroid()[d],
+                    cut_tet[phase].centroid()[d], 1.0e-10);
+      }
+    }
+  }
+}
+
 }  // namespace
@@ -0,0 +1,257 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/interface_reconstruction_methods/interface_jacobian.h"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/general/normal.h"
+#include "irl/geometry/general/plane.h"
+#include "irl/geometry/general/unit_quaternion.h"
+#include "irl/interface_reconstruction_methods/lvira_optimization.h"
+#include "irl/interface_reconstruction_methods/mof.h"
+#include "irl/interface_reconstruction_methods/plane_distance.h"
+#include "irl/interface_reconstruction_methods/r2p_optimization.h"
+
+namespace {
+
+using namespace IRL;
+
+// Behavior that stops the optimization right after the first Jacobian, so
+// the best guess stays at the initial reconstruction.
+OptimizationBehavior singleJacobian(const bool a_analytic_jacobian) {
+  OptimizationBehavior behavior;
+  behavior.maximum_iterations = 0;
+  behavior.acceptable_error = -1.0;
+  behavior.analytic_jacobian = a_analytic_jacobian;
+  return behavior;
+}
+
+// Compare the analytic Jacobian of `a_solver` at its best guess against
+// forward differences, measured the way LevenbergMarquardt measures them.
+template <class JacobianType, class SolverType>
+void expectMatchesFiniteDifference(SolverType* a_solver,
+                                   JacobianType* a_analytic) {
+  constexpr int columns = static_cast<int>(SolverType::columns_m);
+  ASSERT_TRUE(a_solver->calculateAnalyticJacobianTranspose(a_analytic));
+  for (int p = 0; p < columns; ++p) {
+    Eigen::Matrix<double, columns, 1> delta =
+        Eigen::Matrix<double, columns, 1>::Zero();
+    delta(p) = 1.0e-7;
+    a_solver->updateGuess(&delta);
+    const auto change = a_solver->calculateChangeInGuess();
+    ASSERT_EQ(change.rows(), a_analytic->cols());
+    const Eigen::Matrix<double, Eigen::Dynamic, 1> difference =
+        change / delta(p);
+    const Eigen::Matrix<double, Eigen::Dynamic, 1> analytic =
+        a_analytic->row(p).transpose();
+    EXPECT_GT(difference.norm(), 0.0);
+    EXPECT_LT((analytic - difference).norm(), 1.0e-4 * difference.norm())
+        << "Parameter " << p << "\nAnalytic:   " << analytic.transpose()
+        << "\nDifference: " << difference.transpose();
+  }
+}
+
+TEST(AnalyticJacobian, InterfacePlaneMoments) {
+  // Plane z = 0.25 through the unit cell, rotated about the x axis.
+  const Normal normal(0.0, 0.0, 1.0);
+  const auto reconstruction =
+      PlanarSeparator::fromOnePlane(Plane(normal, 0.25));
+  InterfacePlaneMoments moments;
+  ASSERT_TRUE(calculateInterfacePlaneMoments(unit_cell, reconstruction,
+                                             &moments));
+  EXPECT_NEAR(moments.area, 1.0, 1.0e-14);
+  EXPECT_NEAR(moments.first(2), 0.25, 1.0e-14);
+  EXPECT_NEAR(moments.second(0, 0), 1.0 / 12.0, 1.0e-14);
+  EXPECT_NEAR(moments.second(0, 1), 0.0, 1.0e-14);
+
+  PlaneRate rate{normalRateFromRotation(Normal(1.0, 0.0, 0.0), normal), 0.0};
+  EXPECT_NEAR(rate.normal(1), -1.0, 1.0e-14);
+  double shift_rate;
+  ASSERT_TRUE(
+      calculateVolumeConservingShiftRate(1, &moments, &rate, &shift_rate));
+  double volume_rate;
+  Eigen::Vector3d first_moment_rate;
+  calculateLiquidMomentsRate(1, &moments, &rate, shift_rate, &volume_rate,
+                             &first_moment_rate);
+  EXPECT_NEAR(volume_rate, 0.0, 1.0e-14);
+  // Tilting the plane toward +y moves liquid from -y to +y.
+  EXPECT_NEAR(first_moment_rate(1), 1.0 / 12.0, 1.0e-14);
+
+  const auto full = PlanarSeparator::fromOnePlane(Plane(normal, 2.0));
+  ASSERT_TRUE(calculateInterfacePlaneMoments(unit_cell, full, &moments));
+  EXPECT_EQ(moments.area, 0.0);
+  EXPECT_FALSE(
+      calculateVolumeConservingShiftRate(1, &moments, &rate, &shift_rate));
+}
+
+TEST(AnalyticJacobian, LVIRA_3D) {
+  const Normal correct_normal = Normal::normalized(0.3, -0.5, 0.8);
+  const auto correct_reconstruction = PlanarSeparator::fromOnePlane(
+      Plane(correct_normal, findDistanceOnePlane(unit_cell, 0.35,
+                                                 correct_normal)));
+  RectangularCuboid cells[27];
+  double volume_fractions[27];
+  LVIRANeighborhood<RectangularCuboid> neighborhood;
+  neighborhood.resize(27);
+  neighborhood.setCenterOfStencil(13);
+  for (UnsignedIndex_t n = 0; n < 27; ++n) {
+    cells[n] = unit_cell;
+    cells[n].shift(static_cast<double>(n % 3) - 1.0,
+                   static_cast<double>((n / 3) % 3) - 1.0,
+                   static_cast<double>(n / 9) - 1.0);
+    volume_fractions[n] =
+        getVolumeFraction(cells[n], correct_reconstruction);
+    neighborhood.setMember(n, &cells[n], &volume_fractions[n]);
+  }
+  const Normal initial_normal = Normal::normalized(0.5, -0.3, 0.7);
+  const auto initial_reconstruction = PlanarSeparator::fromOnePlane(
+      Plane(initial_normal, findDistanceOnePlane(unit_cell, 0.35,
+                                                 initial_normal)));
+
+  LVIRA_3D<RectangularCuboid> solver;
+  solver.setOptimizationBehavior(singleJacobian(true));
+  solver.solve(neighborhood, initial_reconstruction);
+  Eigen::Matrix<double, 2, Eigen::Dynamic> jacobian_transpose(2, 27);
+  expectMatchesFiniteDifference(&solver, &jacobian_transpose);
+
+  solver.setOptimizationBehavior(singleJacobian(false));
+  EXPECT_FALSE(solver.calculateAnalyticJacobianTranspose(&jacobian_transpose));
+
+  // Both Jacobians find the same interface.
+  OptimizationBehavior behavior;
+  solver.setOptimizationBehavior(behavior);
+  const auto analytic = solver.solve(neighborhood, initial_reconstruction);
+  behavior.analytic_jacobian = false;
+  solver.setOptimizationBehavior(behavior);
+  const auto differenced = solver.solve(neighborhood, initial_reconstruction);
+  EXPECT_NEAR(magnitude(analytic[0].normal() - correct_normal), 0.0, 1.0e-3);
+  EXPECT_NEAR(magnitude(differenced[0].normal() - correct_normal), 0.0,
+              1.0e-3);
+}
+
+TEST(AnalyticJacobian, MOF_3D) {
+  const Normal correct_normal = Normal::normalized(-0.2, 0.6, 0.4);
+  const auto correct_reconstruction = PlanarSeparator::fromOnePlane(
+      Plane(correct_normal, findDistanceOnePlane(unit_cell, 0.6,
+                                                 correct_normal)));
+  const auto moments =
+      getNormalizedVolumeMoments<SeparatedMoments<VolumeMoments>>(
+          unit_cell, correct_reconstruction);
+  const CellGroupedMoments<RectangularCuboid, SeparatedMoments<VolumeMoments>>
+      grouped_moments(&unit_cell, &moments);
+
+  MOF_3D<RectangularCuboid> solver;
+  solver.setOptimizationBehavior(singleJacobian(true));
+  solver.solve(grouped_moments, 0.5, 0.5);
+  Eigen::Matrix<double, 2, 6> jacobian_transpose;
+  expectMatchesFiniteDifference(&solver, &jacobian_transpose);
+
+  OptimizationBehavior behavior;
+  solver.setOptimizationBehavior(behavior);
+  const auto analytic = solver.solve(grouped_moments, 0.5, 0.5);
+  behavior.analytic_jacobian = false;
+  solver.setOptimizationBehavior(behavior);
+  const auto differenced = solver.solve(grouped_moments, 0.5, 0.5);
+  EXPECT_NEAR(magnitude(analytic[0].normal() - differenced[0].normal()), 0.0,
+              1.0e-4);
+}
+
+// Neighborhood of 27 unit cells around the origin holding the moments of
+// `a_correct_reconstruction`.
+struct R2PTestNeighborhood {
+  explicit R2PTestNeighborhood(
+      const PlanarSeparator& a_correct_reconstruction) {
+    neighborhood.resize(27);
+    for (UnsignedIndex_t n = 0; n < 27; ++n) {
+      cells[n] = unit_cell;
+      cells[n].shift(static_cast<double>(n % 3) - 1.0,
+                     static_cast<double>((n / 3) % 3) - 1.0,
+                     static_cast<double>(n / 9) - 1.0);
+      moments[n] = getNormalizedVolumeMoments<SeparatedMoments<VolumeMoments>>(
+          cells[n], a_correct_reconstruction);
+      neighborhood.setMember(n, &cells[n], &moments[n]);
+    }
+    neighborhood.setSurfaceArea(
+        getReconstructionSurfaceArea(unit_cell, a_correct_reconstruction));
+    neighborhood.setCenterOfStencil(13);
+  }
+
+  RectangularCuboid cells[27];
+  SeparatedMoments<VolumeMoments> moments[27];
+  R2PNeighborhood<RectangularCuboid> neighborhood;
+};
+
+TEST(AnalyticJacobian, R2P_3D1P) {
+  const Normal correct_normal = Normal::normalized(0.4, 0.1, -0.9);
+  const auto correct_reconstruction = PlanarSeparator::fromOnePlane(
+      Plane(correct_normal, findDistanceOnePlane(unit_cell, 0.45,
+                                                 correct_normal)));
+  const R2PTestNeighborhood stencil(correct_reconstruction);
+  const Normal initial_normal = Normal::normalized(0.6, 0.3, -0.7);
+  auto initial_reconstruction =
+      PlanarSeparator::fromOnePlane(Plane(initial_normal, 0.0));
+  setDistanceToMatchVolumeFractionPartialFill(unit_cell, 0.45,
+                                              &initial_reconstruction);
+
+  R2P_3D1P<RectangularCuboid> solver;
+  solver.setOptimizationBehavior(singleJacobian(true));
+  solver.solve(stencil.neighborhood, initial_reconstruction);
+  Eigen::Matrix<double, 2, Eigen::Dynamic> jacobian_transpose(2, 27 * 7 + 1);
+  expectMatchesFiniteDifference(&solver, &jacobian_transpose);
+
+  OptimizationBehavior behavior;
+  solver.setOptimizationBehavior(behavior);
+  const auto analytic =
+      solver.solve(stencil.neighborhood, initial_reconstruction);
+  EXPECT_NEAR(magnitude(analytic[0].normal() - correct_normal), 0.0, 1.0e-3);
+}
+
+TEST(AnalyticJacobian, R2P_3D2P) {
+  const Plane correct_plane_0(Normal::normalized(-1.0, 1.0, 1.0), 0.05);
+  const Plane correct_plane_1(Normal::normalized(1.0, 1.0, 1.0), 0.1);
+  const auto correct_reconstruction =
+      PlanarSeparator::fromTwoPlanes(correct_plane_0, correct_plane_1, 1.0);
+  const R2PTestNeighborhood stencil(correct_reconstruction);
+  const UnitQuaternion perturbation =
+      UnitQuaternion(0.2, Normal(0.0, 0.0, 1.0)) *
+      UnitQuaternion(0.15, Normal(1.0, 0.0, 0.0));
+  auto initial_reconstruction = PlanarSeparator::fromTwoPlanes(
+      Plane(perturbation * correct_plane_0.normal(), 0.0),
+      Plane(perturbation * correct_plane_1.normal(), 0.1), 1.0);
+  setDistanceToMatchVolumeFractionPartialFill(
+      unit_cell, stencil.moments[13][0].volume(), &initial_reconstruction);
+
+  R2P_3D2P<RectangularCuboid> solver;
+  solver.setOptimizationBehavior(singleJacobian(true));
+  solver.solve(stencil.neighborhood, initial_reconstruction);
+  Eigen::Matrix<double, 6, Eigen::Dynamic> jacobian_transpose(6, 27 * 7 + 1);
+  expectMatchesFiniteDifference(&solver, &jacobian_transpose);
+
+  OptimizationBehavior behavior;
+  solver.setOptimizationBehavior(behavior);
+  const auto analytic =
+      solver.solve(stencil.neighborhood, initial_reconstruction);
+  behavior.analytic_jacobian = false;
+  solver.setOptimizationBehavior(behavior);
+  const auto differenced =
+      solver.solve(stencil.neighborhood, initial_reconstruction);
+  EXPECT_EQ(analytic.getNumberOfPlanes(), 2);
+  EXPECT_NEAR(getVolumeFraction(unit_cell, analytic),
+              stencil.moments[13][0].volume(),
+              global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);
+  EXPECT_NEAR(getVolumeFraction(unit_cell, differenced),
+              stencil.moments[13][0].volume(),
+              global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);
+}
+
+}  // namespace
@@ -0,0 +1,107 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/generic_cutting/batched_cutting.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/geometry/polyhedrons/tet.h"
+#include "irl/interface_reconstruction_methods/plane_distance.h"
+#include "irl/moments/volume.h"
+#include "irl/moments/volume_moments.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+TEST(BatchedCutting, RectangularCuboidVolumeOnePlane) {
+  std::mt19937_64 eng(42);
+  std::uniform_real_distribution<double> random_normal(-1.0, 1.0);
+  std::uniform_real_distribution<double> random_VF(-0.1, 1.1);
+  std::uniform_real_distribution<double> random_length(0.5, 2.0);
+
+  // Odd size to exercise a partial final block.
+  static const UnsignedIndex_t ncells = 1003;
+  std::vector<RectangularCuboid> cuboids(ncells);
+  std::vector<PlanarSeparator> separators(ncells);
+  for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+    const Pt lower(random_normal(eng), random_normal(eng), random_normal(eng));
+    cuboids[n] = RectangularCuboid::fromBoundingPts(
+        lower, lower + Pt(random_length(eng), random_length(eng),
+                          random_length(eng)));
+    Normal normal;
+    // Include some axis-aligned normals that are handled by the scalar path.
+    if (n % 17 == 0) {
+      normal = Normal(0.0, 0.0, 1.0);
+    } else {
+      normal = Normal::normalized(random_normal(eng), random_normal(eng),
+                                  random_normal(eng));
+    }
+    const double distance =
+        normal * cuboids[n].calculateCentroid() +
+        (random_VF(eng) - 0.5) * cuboids[n].calculateSideLength(0);
+    separators[n] = PlanarSeparator::fromOnePlane(Plane(normal, distance));
+  }
+  // Two-plane reconstructions mixed in also go to the scalar path.
+  separators[5] = PlanarSeparator::fromTwoPlanes(
+      Plane(Normal(1.0, 0.0, 0.0), cuboids[5].calculateCentroid()[0]),
+      Plane(Normal(-1.0, 0.0, 0.0), -cuboids[5].calculateCentroid()[0] + 0.1),
+      1.0);
+
+  std::vector<Volume> batched_volumes(ncells);
+  getNormalizedVolumeMoments<Volume>(cuboids.data(), separators.data(), ncells,
+                                     batched_volumes.data());
+  for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+    const Volume scalar_volume =
+        getNormalizedVolumeMoments<Volume>(cuboids[n], separators[n]);
+    EXPECT_NEAR(batched_volumes[n] / cuboids[n].calculateVolume(),
+                scalar_volume / cuboids[n].calculateVolume(), 1.0e-12)
+        << n << " " << separators[n];
+  }
+}
+
+TEST(BatchedCutting, GenericFallback) {
+  std::mt19937_64 eng(7);
+  std::uniform_real_distribution<double> random_normal(-1.0, 1.0);
+
+  static const UnsignedIndex_t ncells = 37;
+  const Tet base_tet({Pt(1.0, 0.0, -0.5), Pt(1.0, 1.0, 0.0), Pt(1.0, 0.0, 0.5),
+                      Pt(0.5, 0.0, 0.0)});
+  std::vector<Tet> tets(ncells, base_tet);
+  std::vector<PlanarSeparator> separators(ncells);
+  for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+    const Normal normal = Normal::normalized(
+        random_normal(eng), random_normal(eng), random_normal(eng));
+    separators[n] = PlanarSeparator::fromOnePlane(
+        Plane(normal, normal * base_tet.calculateCentroid() +
+                          0.1 * random_normal(eng)));
+  }
+
+  std::vector<VolumeMoments> batched_moments(ncells);
+  getNormalizedVolumeMoments<VolumeMoments>(tets.data(), separators.data(),
+                                            ncells, batched_moments.data());
+  for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+    const auto scalar_moments =
+        getNormalizedVolumeMoments<VolumeMoments>(tets[n], separators[n]);
+    EXPECT_DOUBLE_EQ(batched_moments[n].volume(), scalar_moments.volume());
+    EXPECT_DOUBLE_EQ(batched_moments[n].centroid()[0],
+                     scalar_moments.centroid()[0]);
+    EXPECT_DOUBLE_EQ(batched_moments[n].centroid()[1],
+                     scalar_moments.centroid()[1]);
+    EXPECT_DOUBLE_EQ(batched_moments[n].centroid()[2],
+                     scalar_moments.centroid()[2]);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,171 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/interface_reconstruction_methods/batched_plane_distance.h"
+
+#include <float.h>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/general/plane.h"
+#include "irl/geometry/polyhedrons/hexahedron.h"
+#include "irl/geometry/polyhedrons/tet.h"
+#include "irl/interface_reconstruction_methods/plane_distance.h"
+#include "irl/parameters/constants.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+// Not a multiple of the number of lanes, so a partial batch is exercised.
+static constexpr UnsignedIndex_t ncells = 203;
+
+class BatchedPlaneDistance : public ::testing::Test {
+ protected:
+  BatchedPlaneDistance(void)
+      : eng(42),
+        random_normal(-1.0, 1.0),
+        random_VF(global_constants::VF_LOW + DBL_EPSILON,
+                  global_constants::VF_HIGH - DBL_EPSILON) {
+    for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+      normals.push_back(Normal::normalized(
+          random_normal(eng), random_normal(eng), random_normal(eng)));
+      volume_fractions.push_back(random_VF(eng));
+    }
+  }
+
+  Pt randomPt(const double a_scale) {
+    return Pt(a_scale * random_normal(eng), a_scale * random_normal(eng),
+              a_scale * random_normal(eng));
+  }
+
+  std::mt19937_64 eng;
+  std::uniform_real_distribution<double> random_normal;
+  std::uniform_real_distribution<double> random_VF;
+  std::vector<Normal> normals;
+  std::vector<double> volume_fractions;
+};
+
+TEST_F(BatchedPlaneDistance, RectangularCuboid) {
+  std::vector<RectangularCuboid> cells;
+  for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+    const Pt lower = randomPt(10.0);
+    const Pt extent(1.0 + random_VF(eng), 0.5 + random_VF(eng),
+                    2.0 * random_VF(eng));
+    cells.push_back(RectangularCuboid::fromBoundingPts(lower, lower + extent));
+  }
+  // Axis-aligned normals put the closed form in its degenerate regimes.
+  normals[0] = Normal(1.0, 0.0, 0.0);
+  normals[1] = Normal(0.0, -1.0, 0.0);
+  normals[2] = Normal::normalized(1.0, 1.0, 0.0);
+  std::vector<double> distances(ncells);
+  findDistancesOnePlane(cells.data(), volume_fractions.data(), normals.data(),
+                        ncells, distances.data());
+  for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+    EXPECT_NEAR(distances[n],
+                findDistanceOnePlane(cells[n], volume_fractions[n],
+                                     normals[n]),
+                1.0e-12);
+    const auto reconstruction =
+        PlanarSeparator::fromOnePlane(Plane(normals[n], distances[n]));
+    EXPECT_NEAR(getVolumeFraction(cells[n], reconstruction),
+                volume_fractions[n], 1.0e-12);
+  }
+}
+
+TEST_F(BatchedPlaneDistance, Tet) {
+  std::vector<Tet> cells;
+  for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+    const Pt base = randomPt(5.0);
+    cells.push_back(Tet({base + randomPt(1.0), base + randomPt(1.0),
+                         base + randomPt(1.0), base + randomPt(1.0)}));
+  }
+  std::vector<double> distances(ncells);
+  findDistancesOnePlane(cells.data(), volume_fractions.data(), normals.data(),
+                        ncells, distances.data(), 1.0e-13);
+  for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+    const auto reconstruction =
+        PlanarSeparator::fromOnePlane(Plane(normals[n], distances[n]));
+    EXPECT_NEAR(getVolumeFraction(cells[n], reconstruction),
+                volume_fractions[n], 1.0e-12);
+    EXPECT_NEAR(distances[n],
+                findDistanceOnePlane(cells[n], volume_fractions[n],
+                                     normals[n]),
+                1.0e-8);
+  }
+}
+
+TEST_F(BatchedPlaneDistance, Hexahedron) {
+  std::vector<Hexahedron> cells;
+  for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+    // Sheared and stretched unit cubes.
+    Hexahedron hex({Pt(0.5, -0.5, -0.5), Pt(0.5, 0.5, -0.5),
+                    Pt(0.5, 0.5, 0.5), Pt(0.5, -0.5, 0.5),
+                    Pt(-0.5, -0.5, -0.5), Pt(-0.5, 0.5, -0.5),
+                    Pt(-0.5, 0.5, 0.5), Pt(-0.5, -0.5, 0.5)});
+    const Pt shift = randomPt(3.0);
+    const Pt row_0 = Pt(1.0, 0.0, 0.0) + randomPt(0.3);
+    const Pt row_1 = Pt(0.0, 1.0, 0.0) + randomPt(0.3);
+    const Pt row_2 = Pt(0.0, 0.0, 1.0) + randomPt(0.3);
+    const auto dot = [](const Pt& a_x, const Pt& a_y) {
+      return a_x[0] * a_y[0] + a_x[1] * a_y[1] + a_x[2] * a_y[2];
+    };
+    for (auto& vertex : hex) {
+      const Pt original = vertex;
+      vertex = shift + Pt(dot(row_0, original), dot(row_1, original),
+                          dot(row_2, original));
+    }
+    cells.push_back(hex);
+  }
+  std::vector<double> distances(ncells);
+  findDistancesOnePlane(cells.data(), volume_fractions.data(), normals.data(),
+                        ncells, distances.data(), 1.0e-13);
+  for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+    const auto reconstruction =
+        PlanarSeparator::fromOnePlane(Plane(normals[n], distances[n]));
+    EXPECT_NEAR(getVolumeFraction(cells[n], reconstruction),
+                volume_fractions[n], 1.0e-12);
+  }
+}
+
+TEST_F(BatchedPlaneDistance, setDistancesToMatchVolumeFraction) {
+  std::vector<RectangularCuboid> cells(ncells, unit_cell);
+  std::vector<PlanarSeparator> reconstructions;
+  for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+    if (n % 5 == 0) {
+      volume_fractions[n] = n % 2 == 0 ? 0.0 : 1.0;
+    }
+    const Plane plane(normals[n], 0.0);
+    reconstructions.push_back(
+        n % 7 == 3 ? PlanarSeparator::fromTwoPlanes(
+                         plane, Plane(-normals[n], 0.1), 1.0)
+                   : PlanarSeparator::fromOnePlane(plane));
+  }
+  auto expected = reconstructions;
+  setDistancesToMatchVolumeFraction(cells.data(), volume_fractions.data(),
+                                    reconstructions.data(), ncells, 1.0e-13);
+  for (UnsignedIndex_t n = 0; n < ncells; ++n) {
+    setDistanceToMatchVolumeFraction(cells[n], volume_fractions[n],
+                                     &expected[n], 1.0e-13);
+    ASSERT_EQ(reconstructions[n].getNumberOfPlanes(),
+              expected[n].getNumberOfPlanes());
+    for (UnsignedIndex_t p = 0; p < expected[n].getNumberOfPlanes(); ++p) {
+      EXPECT_NEAR(reconstructions[n][p].distance(),
+                  expected[n][p].distance(), 1.0e-12);
+    }
+    EXPECT_NEAR(getVolumeFraction(cells[n], reconstructions[n]),
+                volume_fractions[n], 1.0e-12);
+  }
+}
+
+}  // namespace
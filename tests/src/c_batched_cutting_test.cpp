@@ -0,0 +1,256 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/c_interface/generic_cutting/c_generic_cutting.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/general/normal.h"
+#include "irl/geometry/general/plane.h"
+#include "irl/geometry/polyhedrons/dodecahedron.h"
+#include "irl/geometry/polyhedrons/hexahedron.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/geometry/polyhedrons/tet.h"
+#include "irl/planar_reconstruction/localized_separator_link.h"
+#include "irl/planar_reconstruction/planar_localizer.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+// Not a multiple of the cells a thread takes at a time, so the last block
+// is partial.
+constexpr int kNumberOfCells = 150;
+constexpr int kMaxPlanes = 2;
+
+// Batch of cells and their separators, stored both as IRL objects and in
+// the flat layout of the c_getNormMomentsBatch functions.
+template <class CellType>
+struct Batch {
+  Batch(void)
+      : number_of_planes(kNumberOfCells),
+        planes(4 * kMaxPlanes * kNumberOfCells, 0.0) {
+    for (int n = 0; n < kNumberOfCells; ++n) {
+      const double shift = 0.01 * static_cast<double>(n);
+      const Normal normal_0 =
+          Normal::normalized(1.0 - shift, 0.2 + shift, 0.5 - 0.5 * shift);
+      const Normal normal_1 = Normal::normalized(-0.3, 1.0, shift);
+      PlanarSeparator separator;
+      number_of_planes[n] = n % (kMaxPlanes + 1);
+      if (number_of_planes[n] > 0) {
+        separator.addPlane(Plane(normal_0, 0.1 - 0.2 * shift));
+      }
+      if (number_of_planes[n] > 1) {
+        separator.addPlane(Plane(normal_1, 0.05));
+      }
+      for (UnsignedIndex_t p = 0; p < separator.getNumberOfPlanes(); ++p) {
+        double* plane = &planes[4 * (kMaxPlanes * n + p)];
+        for (UnsignedIndex_t d = 0; d < 3; ++d) {
+          plane[d] = separator[p].normal()[d];
+        }
+        plane[3] = separator[p].distance();
+      }
+      separators.push_back(separator);
+
+      CellType cell = makeCell(n);
+      for (UnsignedIndex_t v = 0; v < cell.getNumberOfVertices(); ++v) {
+        for (UnsignedIndex_t d = 0; d < 3; ++d) {
+          vertices.push_back(cell[v][d]);
+        }
+      }
+      cells.push_back(cell);
+    }
+  }
+
+  static CellType makeCell(const int a_n);
+
+  std::vector<CellType> cells;
+  std::vector<PlanarSeparator> separators;
+  std::vector<double> vertices;
+  std::vector<int> number_of_planes;
+  std::vector<double> planes;
+};
+
+template <>
+RectangularCuboid Batch<RectangularCuboid>::makeCell(const int a_n) {
+  const double size = 0.5 + 0.01 * static_cast<double>(a_n);
+  return RectangularCuboid::fromBoundingPts(Pt(-0.5, -0.5, -0.5),
+                                            Pt(size, 0.5, 0.5));
+}
+
+template <>
+Hexahedron Batch<Hexahedron>::makeCell(const int a_n) {
+  Hexahedron cell = Hexahedron::fromRawPtPointer(8, &unit_cell[0]);
+  cell[0][0] -= 0.002 * static_cast<double>(a_n);
+  cell[6][2] += 0.1;
+  return cell;
+}
+
+template <>
+Dodecahedron Batch<Dodecahedron>::makeCell(const int a_n) {
+  Dodecahedron cell = Dodecahedron::fromRawPtPointer(8, &unit_cell[0]);
+  cell[0][0] -= 0.002 * static_cast<double>(a_n);
+  cell[6][2] += 0.1;
+  return cell;
+}
+
+template <>
+Tet Batch<Tet>::makeCell(const int a_n) {
+  return Tet({Pt(1.0, 0.0, -0.5), Pt(0.0, 1.0, -0.5),
+              Pt(0.0, 0.0, 0.5 + 0.005 * static_cast<double>(a_n)),
+              Pt(-0.5, -0.5, -0.5)});
+}
+
+void expectSeparatedMoments(const SeparatedMoments<VolumeMoments>& a_correct,
+                            const double* a_moments) {
+  for (UnsignedIndex_t phase = 0; phase < 2; ++phase) {
+    EXPECT_DOUBLE_EQ(a_moments[4 * phase], a_correct[phase].volume());
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      EXPECT_DOUBLE_EQ(a_moments[4 * phase + d + 1],
+                       a_correct[phase].centroid()[d]);
+    }
+  }
+}
+
+TEST(CBatchedCutting, PlanarSepVolumes) {
+  const int number_of_cells = kNumberOfCells;
+  const int max_planes = kMaxPlanes;
+  std::vector<double> volumes(kNumberOfCells);
+
+  Batch<RectangularCuboid> cuboids;
+  c_getNormMomentsBatch_RectCub_PlanarSep_Vol(
+      &number_of_cells, cuboids.vertices.data(), &max_planes,
+      cuboids.number_of_planes.data(), cuboids.planes.data(), volumes.data());
+  for (int n = 0; n < kNumberOfCells; ++n) {
+    // Single planes go through the vectorized kernel.
+    EXPECT_NEAR(volumes[n],
+                getNormalizedVolumeMoments<Volume>(cuboids.cells[n],
+                                                   cuboids.separators[n]),
+                1.0e-14);
+  }
+
+  Batch<Tet> tets;
+  c_getNormMomentsBatch_Tet_PlanarSep_Vol(
+      &number_of_cells, tets.vertices.data(), &max_planes,
+      tets.number_of_planes.data(), tets.planes.data(), volumes.data());
+  for (int n = 0; n < kNumberOfCells; ++n) {
+    EXPECT_DOUBLE_EQ(volumes[n], getNormalizedVolumeMoments<Volume>(
+                                     tets.cells[n], tets.separators[n]));
+  }
+
+  Batch<Hexahedron> hexahedra;
+  c_getNormMomentsBatch_Hex_PlanarSep_Vol(
+      &number_of_cells, hexahedra.vertices.data(), &max_planes,
+      hexahedra.number_of_planes.data(), hexahedra.planes.data(),
+      volumes.data());
+  for (int n = 0; n < kNumberOfCells; ++n) {
+    EXPECT_DOUBLE_EQ(volumes[n],
+                     getNormalizedVolumeMoments<Volume>(
+                         hexahedra.cells[n], hexahedra.separators[n]));
+  }
+}
+
+TEST(CBatchedCutting, PlanarSepSeparatedMoments) {
+  const int number_of_cells = kNumberOfCells;
+  const int max_planes = kMaxPlanes;
+  std::vector<double> moments(8 * kNumberOfCells);
+
+  Batch<Hexahedron> hexahedra;
+  c_getNormMomentsBatch_Hex_PlanarSep_SepVM(
+      &number_of_cells, hexahedra.vertices.data(), &max_planes,
+      hexahedra.number_of_planes.data(), hexahedra.planes.data(),
+      moments.data());
+  for (int n = 0; n < kNumberOfCells; ++n) {
+    expectSeparatedMoments(
+        getNormalizedVolumeMoments<SeparatedMoments<VolumeMoments>>(
+            hexahedra.cells[n], hexahedra.separators[n]),
+        &moments[8 * n]);
+  }
+
+  Batch<Dodecahedron> dodecahedra;
+  c_getNormMomentsBatch_Dod_PlanarSep_SepVM(
+      &number_of_cells, dodecahedra.vertices.data(), &max_planes,
+      dodecahedra.number_of_planes.data(), dodecahedra.planes.data(),
+      moments.data());
+  for (int n = 0; n < kNumberOfCells; ++n) {
+    expectSeparatedMoments(
+        getNormalizedVolumeMoments<SeparatedMoments<VolumeMoments>>(
+            dodecahedra.cells[n], dodecahedra.separators[n]),
+        &moments[8 * n]);
+  }
+}
+
+TEST(CBatchedCutting, LocSepLink) {
+  const int number_of_cells = kNumberOfCells;
+  Batch<Dodecahedron> dodecahedra;
+  // Each cell is cut by its own link, whose localizer keeps x < 0.3.
+  PlanarLocalizer localizer;
+  localizer.addPlane(Plane(Normal(1.0, 0.0, 0.0), 0.3));
+  std::vector<LocalizedSeparatorLink> links(kNumberOfCells);
+  std::vector<c_LocSepLink> c_links(kNumberOfCells);
+  for (int n = 0; n < kNumberOfCells; ++n) {
+    links[n] = LocalizedSeparatorLink(&localizer, &dodecahedra.separators[n]);
+    c_links[n].obj_ptr = &links[n];
+  }
+
+  std::vector<double> volumes(kNumberOfCells);
+  c_getNormMomentsBatch_Dod_LocSepLink_Vol(&number_of_cells,
+                                           dodecahedra.vertices.data(),
+                                           c_links.data(), volumes.data());
+  std::vector<double> moments(8 * kNumberOfCells);
+  c_getNormMomentsBatch_Dod_LocSepLink_SepVM(&number_of_cells,
+                                             dodecahedra.vertices.data(),
+                                             c_links.data(), moments.data());
+  for (int n = 0; n < kNumberOfCells; ++n) {
+    EXPECT_DOUBLE_EQ(volumes[n], getNormalizedVolumeMoments<Volume>(
+                                     dodecahedra.cells[n], links[n]));
+    expectSeparatedMoments(
+        getNormalizedVolumeMoments<SeparatedMoments<VolumeMoments>>(
+            dodecahedra.cells[n], links[n]),
+        &moments[8 * n]);
+  }
+}
+
+TEST(CBatchedCutting, IndependentOfThreads) {
+  const int number_of_cells = kNumberOfCells;
+  const int max_planes = kMaxPlanes;
+  Batch<Hexahedron> hexahedra;
+  std::vector<double> serial(8 * kNumberOfCells);
+  std::vector<double> parallel(8 * kNumberOfCells);
+
+  EXPECT_EQ(c_getMoments_getNumberOfThreads(), 1);
+  c_getNormMomentsBatch_Hex_PlanarSep_SepVM(
+      &number_of_cells, hexahedra.vertices.data(), &max_planes,
+      hexahedra.number_of_planes.data(), hexahedra.planes.data(),
+      serial.data());
+
+  const int four_threads = 4;
+  c_getMoments_setNumberOfThreads(&four_threads);
+  EXPECT_EQ(c_getMoments_getNumberOfThreads(), 4);
+  c_getNormMomentsBatch_Hex_PlanarSep_SepVM(
+      &number_of_cells, hexahedra.vertices.data(), &max_planes,
+      hexahedra.number_of_planes.data(), hexahedra.planes.data(),
+      parallel.data());
+  EXPECT_TRUE(serial == parallel);
+
+  // An empty batch does nothing.
+  const int no_cells = 0;
+  c_getNormMomentsBatch_Hex_PlanarSep_SepVM(&no_cells, nullptr, &max_planes,
+                                            nullptr, nullptr, nullptr);
+
+  const int one_thread = 1;
+  c_getMoments_setNumberOfThreads(&one_thread);
+  EXPECT_EQ(c_getMoments_getNumberOfThreads(), 1);
+}
+
+}  // namespace
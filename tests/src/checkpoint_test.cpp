@@ -0,0 +1,238 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/helpers/checkpoint.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/geometry/general/normal.h"
+#include "irl/geometry/general/plane.h"
+#include "irl/geometry/general/pt.h"
+#include "irl/planar_reconstruction/localized_separator_link.h"
+
+namespace {
+
+using namespace IRL;
+
+std::vector<PlanarSeparator> makeSeparators(const UnsignedIndex_t a_size) {
+  std::vector<PlanarSeparator> separators(a_size);
+  for (UnsignedIndex_t n = 0; n < a_size; ++n) {
+    const Plane plane_0(Normal::normalized(1.0, 0.1 * n, -0.5), 0.01 * n);
+    if (n % 3 == 0) {
+      const Plane plane_1(Normal::normalized(-0.3, 1.0, 0.2 * n), -0.02 * n);
+      separators[n] =
+          PlanarSeparator::fromTwoPlanes(plane_0, plane_1, n % 2 ? 1.0 : -1.0);
+    } else {
+      separators[n] = PlanarSeparator::fromOnePlane(plane_0);
+    }
+  }
+  return separators;
+}
+
+TEST(Checkpoint, WriteAndRead) {
+  static constexpr UnsignedIndex_t size = 1000;
+  const auto separators = makeSeparators(size);
+  std::vector<PlanarLocalizer> localizers(size);
+  std::vector<SeparatedMoments<VolumeMoments>> moments(size);
+  std::vector<double> volume_fractions(size);
+  for (UnsignedIndex_t n = 0; n < size; ++n) {
+    localizers[n] = PlanarLocalizer::fromOnePlane(
+        Plane(Normal(0.0, 0.0, 1.0), static_cast<double>(n)));
+    localizers[n].addPlane(Plane(Normal(0.0, 0.0, -1.0), -1.0 * n + 1.0));
+    moments[n] = SeparatedMoments<VolumeMoments>(
+        VolumeMoments(0.5 * n, Pt(1.0 * n, 2.0, 3.0)),
+        VolumeMoments(1.0, Pt(-1.0, -2.0 * n, -3.0)));
+    volume_fractions[n] = 1.0 / (n + 1.0);
+  }
+
+  const std::string file_name = "checkpoint_test_write_and_read.irl";
+  CheckpointWriter writer;
+  writer.addSection("separators", separators.data(), size);
+  writer.addSection("localizers", localizers.data(), size);
+  writer.addSection("moments", moments.data(), size);
+  writer.addSection("volume_fraction", volume_fractions.data(), size);
+  EXPECT_EQ(writer.getNumberOfSections(), 4u);
+  ASSERT_TRUE(writer.write(file_name));
+
+  CheckpointReader reader;
+  ASSERT_TRUE(reader.open(file_name));
+  EXPECT_TRUE(reader.isOpen());
+  EXPECT_TRUE(reader.hasSection("separators"));
+  EXPECT_FALSE(reader.hasSection("velocity"));
+  EXPECT_EQ(reader.getNumberOfRecords("moments"), size);
+  EXPECT_EQ(reader.getNumberOfRecords("velocity"), 0u);
+
+  // Records are read in place and aligned.
+  const double* mapped_volume_fractions =
+      reader.getRecords<double>("volume_fraction");
+  ASSERT_NE(mapped_volume_fractions, nullptr);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped_volume_fractions) %
+                checkpoint_alignment,
+            0u);
+  EXPECT_EQ(reader.getRecords<VolumeMoments>("volume_fraction"), nullptr);
+  EXPECT_EQ(reader.getRecords<PlanarLocalizer>("separators"), nullptr);
+  const auto mapped_separators =
+      reader.getRecords<PlanarSeparator>("separators");
+  ASSERT_NE(mapped_separators, nullptr);
+  EXPECT_EQ(mapped_separators[3].number_of_planes, 2u);
+
+  std::vector<PlanarSeparator> read_separators(size);
+  std::vector<PlanarLocalizer> read_localizers(size);
+  std::vector<SeparatedMoments<VolumeMoments>> read_moments(size);
+  ASSERT_TRUE(reader.read("separators", read_separators.data(), size));
+  ASSERT_TRUE(reader.read("localizers", read_localizers.data(), size));
+  ASSERT_TRUE(reader.read("moments", read_moments.data(), size));
+  EXPECT_FALSE(reader.read("moments", read_moments.data(), size - 1));
+  EXPECT_FALSE(reader.read("separators", read_localizers.data(), size));
+
+  for (UnsignedIndex_t n = 0; n < size; ++n) {
+    EXPECT_EQ(mapped_volume_fractions[n], volume_fractions[n]);
+    ASSERT_EQ(read_separators[n].getNumberOfPlanes(),
+              separators[n].getNumberOfPlanes());
+    EXPECT_EQ(read_separators[n].flip(), separators[n].flip());
+    for (UnsignedIndex_t p = 0; p < separators[n].getNumberOfPlanes(); ++p) {
+      EXPECT_TRUE(read_separators[n][p] == separators[n][p]);
+    }
+    ASSERT_EQ(read_localizers[n].getNumberOfPlanes(), 2u);
+    EXPECT_TRUE(read_localizers[n][1] == localizers[n][1]);
+    for (UnsignedIndex_t phase = 0; phase < 2; ++phase) {
+      EXPECT_EQ(read_moments[n][phase].volume(), moments[n][phase].volume());
+      for (UnsignedIndex_t d = 0; d < 3; ++d) {
+        EXPECT_EQ(read_moments[n][phase].centroid()[d],
+                  moments[n][phase].centroid()[d]);
+      }
+    }
+  }
+  reader.close();
+  EXPECT_FALSE(reader.isOpen());
+  std::remove(file_name.c_str());
+}
+
+TEST(Checkpoint, LinkConnectivity) {
+  static constexpr UnsignedIndex_t size = 8;
+  std::vector<PlanarLocalizer> localizers(size);
+  std::vector<PlanarSeparator> separators = makeSeparators(size);
+  std::vector<LocalizedSeparatorLink> links;
+  links.reserve(size);
+  for (UnsignedIndex_t n = 0; n < size; ++n) {
+    links.emplace_back(&localizers[n], &separators[n]);
+    links[n].setId(100 + n);
+  }
+  // A ring, with one edge to nowhere on each link.
+  for (UnsignedIndex_t n = 0; n < size; ++n) {
+    links[n].setEdgeConnectivity(0, &links[(n + 1) % size]);
+    links[n].setEdgeConnectivity(2, &links[(n + size - 1) % size]);
+  }
+
+  const std::string file_name = "checkpoint_test_links.irl";
+  CheckpointWriter writer;
+  writer.addLinkConnectivity("links", links.data(), size);
+  ASSERT_TRUE(writer.write(file_name));
+
+  std::vector<LocalizedSeparatorLink> read_links;
+  read_links.reserve(size);
+  for (UnsignedIndex_t n = 0; n < size; ++n) {
+    read_links.emplace_back(&localizers[n], &separators[n]);
+  }
+  CheckpointReader reader;
+  ASSERT_TRUE(reader.open(file_name));
+  EXPECT_FALSE(reader.readLinkConnectivity("links", read_links.data(), 4));
+  ASSERT_TRUE(reader.readLinkConnectivity("links", read_links.data(), size));
+  for (UnsignedIndex_t n = 0; n < size; ++n) {
+    EXPECT_EQ(read_links[n].getId(), 100 + n);
+    ASSERT_EQ(read_links[n].getNumberOfEdges(), 3u);
+    EXPECT_EQ(read_links[n].getNeighborAddress(0),
+              &read_links[(n + 1) % size]);
+    EXPECT_FALSE(read_links[n].hasNeighbor(1));
+    EXPECT_EQ(read_links[n].getNeighborAddress(2),
+              &read_links[(n + size - 1) % size]);
+  }
+  std::remove(file_name.c_str());
+}
+
+TEST(Checkpoint, RejectsInvalidFiles) {
+  CheckpointReader reader;
+  EXPECT_FALSE(reader.open("checkpoint_test_missing.irl"));
+
+  const std::string file_name = "checkpoint_test_invalid.irl";
+  {
+    std::ofstream file(file_name, std::ios::binary);
+    file << "This is not a checkpoint file at all.";
+  }
+  EXPECT_FALSE(reader.open(file_name));
+  EXPECT_FALSE(reader.isOpen());
+
+  // A truncated file must be rejected rather than read past its end.
+  std::vector<double> values(100, 1.0);
+  CheckpointWriter writer;
+  writer.addSection("values", values.data(), values.size());
+  ASSERT_TRUE(writer.write(file_name));
+  ASSERT_TRUE(reader.open(file_name));
+  reader.close();
+  std::string contents;
+  {
+    std::ifstream file(file_name, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(file),
+                    std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream file(file_name, std::ios::binary);
+    file.write(contents.data(),
+               static_cast<std::streamsize>(contents.size() - 8));
+  }
+  EXPECT_FALSE(reader.open(file_name));
+  std::remove(file_name.c_str());
+}
+
+TEST(Checkpoint, RejectsInvalidRecords) {
+  const auto separators = makeSeparators(10);
+  const std::string file_name = "checkpoint_test_invalid_records.irl";
+  CheckpointWriter writer;
+  writer.addSection("separators", separators.data(), separators.size());
+  ASSERT_TRUE(writer.write(file_name));
+
+  // Give the record of one separator more planes than it can hold.
+  std::string contents;
+  {
+    std::ifstream file(file_name, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(file),
+                    std::istreambuf_iterator<char>());
+  }
+  PlanarReconstructionRecord record;
+  CheckpointRecord<PlanarSeparator>::pack(separators[4], &record);
+  const auto location = contents.find(
+      std::string(reinterpret_cast<const char*>(&record), sizeof(record)));
+  ASSERT_NE(location, std::string::npos);
+  record.number_of_planes = 1000;
+  contents.replace(location, sizeof(record),
+                   reinterpret_cast<const char*>(&record), sizeof(record));
+  {
+    std::ofstream file(file_name, std::ios::binary);
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+  }
+
+  CheckpointReader reader;
+  ASSERT_TRUE(reader.open(file_name));
+  std::vector<PlanarSeparator> read_separators(separators.size());
+  EXPECT_FALSE(reader.read("separators", read_separators.data(),
+                           read_separators.size()));
+  // Nothing is unpacked from a section with a malformed record.
+  EXPECT_EQ(read_separators[0].getNumberOfPlanes(),
+            PlanarSeparator().getNumberOfPlanes());
+  reader.close();
+  std::remove(file_name.c_str());
+}
+
+}  // namespace
@@ -0,0 +1,160 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/graphs/compact_graph.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/moments/volume_moments.h"
+#include "irl/planar_reconstruction/localized_separator_link.h"
+
+namespace {
+
+using namespace IRL;
+
+struct TestNode : public CompactGraphNode<TestNode> {
+  double value = 0.0;
+};
+
+TEST(CompactGraph, buildStructured) {
+  static constexpr UnsignedIndex_t nx = 4, ny = 3, nz = 2;
+  std::vector<TestNode> nodes(nx * ny * nz);
+  CompactGraph<TestNode> graph;
+  graph.buildStructured(nodes.data(), nx, ny, nz);
+  EXPECT_EQ(graph.getNumberOfNodes(), nx * ny * nz);
+  EXPECT_EQ(graph.getNumberOfEdges(), 6u * nx * ny * nz);
+
+  const auto index = [](const UnsignedIndex_t i, const UnsignedIndex_t j,
+                        const UnsignedIndex_t k) {
+    return i + nx * (j + ny * k);
+  };
+  for (UnsignedIndex_t k = 0; k < nz; ++k) {
+    for (UnsignedIndex_t j = 0; j < ny; ++j) {
+      for (UnsignedIndex_t i = 0; i < nx; ++i) {
+        const TestNode& node = nodes[index(i, j, k)];
+        EXPECT_EQ(node.getId(), index(i, j, k));
+        ASSERT_EQ(node.getNumberOfEdges(), 6u);
+        EXPECT_EQ(node.getNeighborAddress(0),
+                  i > 0 ? &nodes[index(i - 1, j, k)] : nullptr);
+        EXPECT_EQ(node.getNeighborAddress(1),
+                  i + 1 < nx ? &nodes[index(i + 1, j, k)] : nullptr);
+        EXPECT_EQ(node.getNeighborAddress(2),
+                  j > 0 ? &nodes[index(i, j - 1, k)] : nullptr);
+        EXPECT_EQ(node.getNeighborAddress(3),
+                  j + 1 < ny ? &nodes[index(i, j + 1, k)] : nullptr);
+        EXPECT_EQ(node.getNeighborAddress(4),
+                  k > 0 ? &nodes[index(i, j, k - 1)] : nullptr);
+        EXPECT_EQ(node.getNeighborAddress(5),
+                  k + 1 < nz ? &nodes[index(i, j, k + 1)] : nullptr);
+        EXPECT_EQ(node.hasNeighbor(1), i + 1 < nx);
+        EXPECT_FALSE(node.hasNeighbor(6));
+      }
+    }
+  }
+}
+
+TEST(CompactGraph, buildUnstructured) {
+  // A triangle of nodes plus one isolated node, with varying edge counts.
+  std::vector<TestNode> nodes(4);
+  EXPECT_EQ(nodes[0].getNumberOfEdges(), 0u);
+  EXPECT_FALSE(nodes[0].isIdSet());
+  static constexpr UnsignedIndex_t none = CompactGraph<TestNode>::no_neighbor;
+  const std::vector<LargeOffsetIndex_t> offsets{0, 2, 5, 7, 8};
+  const std::vector<UnsignedIndex_t> neighbors{1, 2, 0, none, 2, 1, 0, none};
+  CompactGraph<TestNode> graph;
+  graph.buildUnstructured(nodes.data(), 4, offsets.data(), neighbors.data());
+
+  EXPECT_EQ(nodes[0].getNumberOfEdges(), 2u);
+  EXPECT_EQ(nodes[1].getNumberOfEdges(), 3u);
+  EXPECT_EQ(nodes[3].getNumberOfEdges(), 1u);
+  EXPECT_EQ(&nodes[0].getNeighbor(1), &nodes[2]);
+  EXPECT_FALSE(nodes[1].hasNeighbor(1));
+  EXPECT_EQ(&nodes[1].getNeighbor(2), &nodes[2]);
+  EXPECT_FALSE(nodes[3].hasNeighbor(0));
+
+  nodes[3].setEdgeConnectivity(0, &nodes[1]);
+  nodes[1].setEdgeConnectivity(1, &nodes[3]);
+  EXPECT_EQ(nodes[3].getNeighborAddress(0), &nodes[1]);
+  EXPECT_EQ(nodes[1].getNeighborAddress(1), &nodes[3]);
+  nodes[0].setEdgeConnectivity(0, nullptr);
+  EXPECT_FALSE(nodes[0].hasNeighbor(0));
+  nodes[2].setId(100);
+  EXPECT_EQ(nodes[2].getId(), 100u);
+}
+
+TEST(CompactGraph, CuttingMatchesLocalizedSeparatorLink) {
+  static constexpr UnsignedIndex_t n = 3;
+  std::vector<PlanarLocalizer> localizers(n * n * n);
+  std::vector<PlanarSeparator> separators(n * n * n);
+  std::vector<LocalizedSeparatorLink> links;
+  std::vector<CompactLocalizedSeparatorLink> compact_links;
+  for (UnsignedIndex_t k = 0; k < n; ++k) {
+    for (UnsignedIndex_t j = 0; j < n; ++j) {
+      for (UnsignedIndex_t i = 0; i < n; ++i) {
+        const UnsignedIndex_t index = i + n * (j + n * k);
+        auto cell = unit_cell;
+        cell.shift(static_cast<double>(i) - 1.0, static_cast<double>(j) - 1.0,
+                   static_cast<double>(k) - 1.0);
+        localizers[index] = cell.getLocalizer();
+        separators[index] = PlanarSeparator::fromOnePlane(
+            Plane(Normal::normalized(1.0, 0.5 * i, -0.25 * j),
+                  0.1 * k - 0.2));
+        links.emplace_back(&localizers[index], &separators[index]);
+        compact_links.emplace_back(&localizers[index], &separators[index]);
+      }
+    }
+  }
+  for (UnsignedIndex_t k = 0; k < n; ++k) {
+    for (UnsignedIndex_t j = 0; j < n; ++j) {
+      for (UnsignedIndex_t i = 0; i < n; ++i) {
+        const UnsignedIndex_t index = i + n * (j + n * k);
+        auto& link = links[index];
+        link.setId(index);
+        link.setEdgeConnectivity(0, i > 0 ? &links[index - 1] : nullptr);
+        link.setEdgeConnectivity(1, i + 1 < n ? &links[index + 1] : nullptr);
+        link.setEdgeConnectivity(2, j > 0 ? &links[index - n] : nullptr);
+        link.setEdgeConnectivity(3,
+                                 j + 1 < n ? &links[index + n] : nullptr);
+        link.setEdgeConnectivity(4,
+                                 k > 0 ? &links[index - n * n] : nullptr);
+        link.setEdgeConnectivity(
+            5, k + 1 < n ? &links[index + n * n] : nullptr);
+      }
+    }
+  }
+  CompactGraph<CompactLocalizedSeparatorLink> graph;
+  graph.buildStructured(compact_links.data(), n, n, n);
+
+  const auto flux_volume = RectangularCuboid::fromBoundingPts(
+      Pt(-0.9, -0.2, -0.6), Pt(0.3, 0.6, 0.3));
+  const UnsignedIndex_t start = 1 + n * (1 + n * 1);
+  const auto expected =
+      getVolumeMoments<TaggedAccumulatedVolumeMoments<
+          SeparatedMoments<VolumeMoments>>>(flux_volume, links[start]);
+  const auto compact =
+      getVolumeMoments<TaggedAccumulatedVolumeMoments<
+          SeparatedMoments<VolumeMoments>>>(flux_volume, compact_links[start]);
+  EXPECT_EQ(expected.size(), 8u);
+  ASSERT_EQ(compact.size(), expected.size());
+  for (UnsignedIndex_t tag = 0; tag < n * n * n; ++tag) {
+    ASSERT_EQ(compact.isTagKnown(tag), expected.isTagKnown(tag));
+    if (expected.isTagKnown(tag)) {
+      for (UnsignedIndex_t phase = 0; phase < 2; ++phase) {
+        EXPECT_NEAR(compact[tag][phase].volume(),
+                    expected[tag][phase].volume(), 1.0e-14);
+      }
+    }
+  }
+}
+
+}  // namespace
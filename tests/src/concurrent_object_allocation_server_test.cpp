@@ -0,0 +1,147 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/data_structures/concurrent_object_allocation_server.h"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/planar_reconstruction/localized_separator_link.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+TEST(ConcurrentObjectAllocationServer, SingleThreadIsContiguous) {
+  ConcurrentObjectAllocationServer<PlanarSeparator> server(100, 16);
+  EXPECT_EQ(server.capacity(), 100);
+  EXPECT_EQ(server.slabSize(), 16);
+  PlanarSeparator* first = server.getNewObject();
+  for (int n = 1; n < 100; ++n) {
+    EXPECT_EQ(server.getNewObject(), first + n);
+  }
+  EXPECT_EQ(server.getNumberOfClaimedSlabs(), 7);
+}
+
+TEST(ConcurrentObjectAllocationServer, ReturnsNullptrWhenExhausted) {
+  ConcurrentObjectAllocationServer<PlanarSeparator> server(5, 4);
+  for (int n = 0; n < 5; ++n) {
+    EXPECT_NE(server.getNewObject(), nullptr);
+  }
+  EXPECT_EQ(server.getNewObject(), nullptr);
+  EXPECT_EQ(server.getNewObject(), nullptr);
+}
+
+TEST(ConcurrentObjectAllocationServer, ManyServersOnOneThread) {
+  // More servers than the per-thread cursor cache holds, used in turn.
+  static constexpr int number_of_servers = 20;
+  using ServerType = ConcurrentObjectAllocationServer<PlanarSeparator>;
+  std::vector<std::unique_ptr<ServerType>> servers;
+  std::vector<PlanarSeparator*> first_objects;
+  for (int s = 0; s < number_of_servers; ++s) {
+    servers.emplace_back(new ServerType(64, 64));
+    first_objects.push_back(servers.back()->getNewObject());
+  }
+  for (int n = 1; n < 64; ++n) {
+    for (int s = 0; s < number_of_servers; ++s) {
+      EXPECT_EQ(servers[s]->getNewObject(), first_objects[s] + n);
+    }
+  }
+  for (int s = 0; s < number_of_servers; ++s) {
+    EXPECT_EQ(servers[s]->getNumberOfClaimedSlabs(), 1);
+  }
+}
+
+TEST(ConcurrentObjectAllocationServer, ThreadsReceiveUniqueObjects) {
+  static constexpr int number_of_threads = 4;
+  static constexpr int objects_per_thread = 1000;
+  ConcurrentObjectAllocationServer<LocalizedSeparatorLink> server(
+      number_of_threads * (objects_per_thread + 32), 32);
+
+  std::vector<std::vector<LocalizedSeparatorLink*>> served(number_of_threads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < number_of_threads; ++t) {
+    threads.emplace_back([&server, &served, t]() {
+      for (int n = 0; n < objects_per_thread; ++n) {
+        served[t].push_back(server.getNewObject());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<LocalizedSeparatorLink*> all_served;
+  for (const auto& list : served) {
+    all_served.insert(all_served.end(), list.begin(), list.end());
+  }
+  EXPECT_EQ(std::count(all_served.begin(), all_served.end(), nullptr), 0);
+  std::sort(all_served.begin(), all_served.end());
+  EXPECT_EQ(std::adjacent_find(all_served.begin(), all_served.end()),
+            all_served.end());
+}
+
+TEST(ConcurrentObjectAllocationServer, CapacityWithSlackServesAllThreads) {
+  // Without slack, each thread would claim 8 slabs of 32 for its 250
+  // objects, more than the 1000 objects requested.
+  static constexpr int number_of_threads = 4;
+  static constexpr int objects_per_thread = 250;
+  using ServerType = ConcurrentObjectAllocationServer<PlanarSeparator>;
+  ServerType server(ServerType::capacityWithSlack(
+                        number_of_threads * objects_per_thread,
+                        number_of_threads, 32),
+                    32);
+  EXPECT_EQ(server.capacity(),
+            number_of_threads * objects_per_thread + number_of_threads * 31);
+
+  std::vector<int> number_of_nullptr(number_of_threads, 0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < number_of_threads; ++t) {
+    threads.emplace_back([&server, &number_of_nullptr, t]() {
+      for (int n = 0; n < objects_per_thread; ++n) {
+        if (server.getNewObject() == nullptr) {
+          ++number_of_nullptr[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (int t = 0; t < number_of_threads; ++t) {
+    EXPECT_EQ(number_of_nullptr[t], 0);
+  }
+}
+
+TEST(ConcurrentObjectAllocationServer, ResetReusesAndReinitializes) {
+  ConcurrentObjectAllocationServer<PlanarSeparator> server(10, 4);
+  std::vector<PlanarSeparator*> first_pass;
+  for (int n = 0; n < 10; ++n) {
+    first_pass.push_back(server.getNewObject());
+    *first_pass.back() = PlanarSeparator::fromOnePlane(
+        Plane(Normal(1.0, 0.0, 0.0), static_cast<double>(n)));
+  }
+
+  server.reset();
+  EXPECT_EQ(server.getNumberOfClaimedSlabs(), 0);
+  const PlanarSeparator default_separator;
+  for (int n = 0; n < 10; ++n) {
+    PlanarSeparator* object = server.getNewObject();
+    EXPECT_EQ(object, first_pass[n]);
+    EXPECT_EQ(object->getNumberOfPlanes(),
+              default_separator.getNumberOfPlanes());
+  }
+}
+
+}  // namespace
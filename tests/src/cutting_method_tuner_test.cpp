@@ -0,0 +1,161 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/generic_cutting/cutting_method_tuner.h"
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/cutting_method_table.h"
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/geometry/polyhedrons/tet.h"
+#include "irl/moments/separated_volume_moments.h"
+#include "irl/moments/volume.h"
+#include "irl/moments/volume_moments.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+std::vector<PlanarSeparator> randomSeparators(const UnsignedIndex_t a_size) {
+  std::mt19937_64 eng(42);
+  std::uniform_real_distribution<double> random_normal(-1.0, 1.0);
+  std::uniform_real_distribution<double> random_offset(-0.3, 0.3);
+  std::uniform_int_distribution<int> random_choice(0, 3);
+  auto random_plane = [&]() {
+    return Plane(Normal::normalized(random_normal(eng), random_normal(eng),
+                                    random_normal(eng)),
+                 random_offset(eng));
+  };
+  std::vector<PlanarSeparator> separators(a_size);
+  for (auto& separator : separators) {
+    if (random_choice(eng) != 0) {
+      separator = PlanarSeparator::fromOnePlane(random_plane());
+    } else {
+      const Plane plane_0 = random_plane();
+      const Plane plane_1 = random_plane();
+      separator = PlanarSeparator::fromTwoPlanes(
+          plane_0, plane_1, random_choice(eng) < 2 ? -1.0 : 1.0);
+    }
+  }
+  return separators;
+}
+
+TEST(CuttingMethodTuner, CalibrateAndDispatch) {
+  CuttingMethodTable& table = CuttingMethodTable::getTable();
+  table.reset();
+  const std::string key =
+      getCuttingMethodKey<VolumeMoments, RectangularCuboid, PlanarSeparator>();
+  EXPECT_FALSE(table.isCalibrated(key));
+
+  static constexpr UnsignedIndex_t size = 64;
+  const std::vector<RectangularCuboid> cells(size, unit_cell);
+  const auto separators = randomSeparators(size);
+  const CuttingMethodId method = calibrateCuttingMethod<VolumeMoments>(
+      cells.data(), separators.data(), size);
+  EXPECT_TRUE(table.isCalibrated(key));
+  EXPECT_EQ(table.getMethod(key), method);
+  EXPECT_EQ((getTunedCuttingMethod<VolumeMoments, RectangularCuboid,
+                                   PlanarSeparator>()),
+            method);
+
+  for (UnsignedIndex_t n = 0; n < size; ++n) {
+    const auto tuned = getVolumeMoments<VolumeMoments, AutoTunedCutting>(
+        cells[n], separators[n]);
+    const auto reference = getVolumeMoments<VolumeMoments, HalfEdgeCutting>(
+        cells[n], separators[n]);
+    EXPECT_NEAR(tuned.volume(), reference.volume(), 1.0e-14);
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      EXPECT_NEAR(tuned.centroid()[d], reference.centroid()[d], 1.0e-14);
+    }
+    const auto separated =
+        getVolumeMoments<SeparatedMoments<VolumeMoments>, AutoTunedCutting>(
+            cells[n], separators[n]);
+    EXPECT_NEAR(separated[0].volume(), reference.volume(), 1.0e-14);
+  }
+}
+
+TEST(CuttingMethodTuner, EveryMethodIsDispatched) {
+  CuttingMethodTable& table = CuttingMethodTable::getTable();
+  const std::string key = getCuttingMethodKey<Volume, Tet, PlanarSeparator>();
+  const Tet tet({Pt(1.0, 0.0, 0.0), Pt(0.0, 1.0, 0.0), Pt(0.0, 0.0, 1.0),
+                 Pt(0.0, 0.0, 0.0)});
+  const auto separator = PlanarSeparator::fromOnePlane(
+      Plane(Normal::normalized(1.0, 2.0, 3.0), 0.3));
+  const double reference =
+      getVolumeMoments<Volume, HalfEdgeCutting>(tet, separator);
+  for (const auto method : {CuttingMethodId::RecursiveSimplexCutting,
+                            CuttingMethodId::HalfEdgeCutting,
+                            CuttingMethodId::SimplexCutting}) {
+    table.setMethod(key, method);
+    EXPECT_EQ((getTunedCuttingMethod<Volume, Tet, PlanarSeparator>()),
+              method);
+    const double volume =
+        getVolumeMoments<Volume, AutoTunedCutting>(tet, separator);
+    EXPECT_NEAR(volume, reference, 1.0e-15);
+  }
+  table.reset();
+  EXPECT_FALSE(table.isCalibrated(key));
+  EXPECT_EQ((getTunedCuttingMethod<Volume, Tet, PlanarSeparator>()),
+            CuttingMethodId::HalfEdgeCutting);
+}
+
+TEST(CuttingMethodTuner, SaveAndLoad) {
+  CuttingMethodTable& table = CuttingMethodTable::getTable();
+  table.reset();
+  calibrateCuttingMethods();
+  // Volume and VolumeMoments for each of the nine polyhedra.
+  EXPECT_EQ(table.getNumberOfCalibratedEntries(), 18u);
+  const std::string key =
+      getCuttingMethodKey<Volume, RectangularCuboid, PlanarSeparator>();
+  const CuttingMethodId method = table.getMethod(key);
+
+  const std::string file_name = "cutting_method_tuner_test_table.txt";
+  ASSERT_TRUE(table.save(file_name));
+  table.reset();
+  EXPECT_EQ(table.getNumberOfCalibratedEntries(), 0u);
+  ASSERT_TRUE(table.load(file_name));
+  EXPECT_EQ(table.getNumberOfCalibratedEntries(), 18u);
+  EXPECT_EQ(table.getMethod(key), method);
+  std::remove(file_name.c_str());
+  table.reset();
+}
+
+TEST(CuttingMethodTuner, LoadRejectsInvalidFile) {
+  CuttingMethodTable& table = CuttingMethodTable::getTable();
+  table.reset();
+  EXPECT_FALSE(table.load("cutting_method_tuner_test_missing.txt"));
+
+  const std::string file_name = "cutting_method_tuner_test_invalid.txt";
+  {
+    std::ofstream file(file_name);
+    file << "IRL_CuttingMethodTable 1\n";
+    file << "0 " << getCuttingMethodKey<Volume, Tet, PlanarSeparator>()
+         << '\n';
+    file << "7 " << getCuttingMethodKey<Volume, Tet, PlanarSeparator>()
+         << '\n';
+  }
+  EXPECT_FALSE(table.load(file_name));
+  EXPECT_EQ(table.getNumberOfCalibratedEntries(), 0u);
+  {
+    std::ofstream file(file_name);
+    file << "Not a table\n";
+  }
+  EXPECT_FALSE(table.load(file_name));
+  std::remove(file_name.c_str());
+}
+
+}  // namespace
@@ -0,0 +1,209 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/generic_cutting/half_edge_cutting/distance_cut_session.h"
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/general/normal.h"
+#include "irl/geometry/general/plane.h"
+#include "irl/geometry/polyhedrons/dodecahedron.h"
+#include "irl/geometry/polyhedrons/general_polyhedron.h"
+#include "irl/geometry/polyhedrons/hexahedron.h"
+#include "irl/geometry/polyhedrons/polyhedron_connectivity.h"
+#include "irl/helpers/geometric_cutting_helpers.h"
+#include "irl/interface_reconstruction_methods/volume_fraction_matching.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+Hexahedron warpedHexahedron(void) {
+  Hexahedron hexahedron = Hexahedron::fromRawPtPointer(8, &unit_cell[0]);
+  hexahedron[0] = hexahedron[0] + Pt(0.1, -0.05, 0.2);
+  hexahedron[6] = hexahedron[6] + Pt(0.3, 0.2, 0.1);
+  return hexahedron;
+}
+
+// Sheared hexahedron, whose faces remain planar.
+Hexahedron shearedHexahedron(void) {
+  Hexahedron hexahedron = Hexahedron::fromRawPtPointer(8, &unit_cell[0]);
+  for (UnsignedIndex_t v = 0; v < 8; ++v) {
+    const Pt pt = hexahedron[v];
+    hexahedron[v] = Pt(pt[0] + 0.2 * pt[1] + 0.1,
+                       0.1 * pt[0] + 0.9 * pt[1] + 0.3 * pt[2],
+                       -0.2 * pt[1] + 1.1 * pt[2] - 0.05);
+  }
+  return hexahedron;
+}
+
+// Prism over a regular polygon, with more vertices than the
+// default-sized polyhedra.
+constexpr UnsignedIndex_t prism_sides = 24;
+using PrismType = StoredGeneralPolyhedron<Pt, 2 * prism_sides>;
+
+PolyhedronConnectivity prismConnectivity(void) {
+  std::vector<std::vector<UnsignedIndex_t>> faces;
+  std::vector<UnsignedIndex_t> bottom, top;
+  for (UnsignedIndex_t n = 0; n < prism_sides; ++n) {
+    bottom.push_back(prism_sides - 1 - n);
+    top.push_back(prism_sides + n);
+  }
+  faces.push_back(bottom);
+  faces.push_back(top);
+  for (UnsignedIndex_t n = 0; n < prism_sides; ++n) {
+    const UnsignedIndex_t next = (n + 1) % prism_sides;
+    faces.push_back({n, next, prism_sides + next, prism_sides + n});
+  }
+  return PolyhedronConnectivity(faces);
+}
+
+PrismType prism(const PolyhedronConnectivity* a_connectivity) {
+  std::array<Pt, 2 * prism_sides> pts;
+  for (UnsignedIndex_t n = 0; n < prism_sides; ++n) {
+    const double angle = 2.0 * M_PI * static_cast<double>(n) /
+                         static_cast<double>(prism_sides);
+    const double x = 0.5 + 0.5 * std::cos(angle);
+    const double y = 0.5 + 0.5 * std::sin(angle);
+    pts[n] = Pt(x, y, 0.0);
+    pts[prism_sides + n] = Pt(x, y, 1.0);
+  }
+  return PrismType(pts, a_connectivity);
+}
+
+PlanarSeparator shiftedSeparator(const Plane& a_plane_0, const Plane& a_plane_1,
+                                 const double a_flip, const double a_shift) {
+  return PlanarSeparator::fromTwoPlanes(
+      Plane(a_plane_0.normal(), a_plane_0.distance() + a_shift),
+      Plane(a_plane_1.normal(), a_plane_1.distance() + a_shift), a_flip);
+}
+
+// Sweep both planes across the whole cell, as a distance solve would,
+// expecting at most one clip per `a_samples_per_clip` samples.
+template <class CellType>
+void expectSweepMatchesCutting(const CellType& a_cell, const double a_flip,
+                               const int a_samples_per_clip = 4) {
+  const Plane plane_0(Normal::normalized(1.0, 0.3, -0.2), 0.05);
+  const Plane plane_1(Normal::normalized(-0.4, 1.0, 0.5), -0.02);
+  auto& session = getDistanceCutSession<CellType>();
+  session.setCell(a_cell);
+  constexpr int samples = 241;
+  for (int n = 0; n < samples; ++n) {
+    const double shift = -1.2 + 2.4 * static_cast<double>(n) /
+                                    static_cast<double>(samples - 1);
+    const auto separator = shiftedSeparator(plane_0, plane_1, a_flip, shift);
+    EXPECT_DOUBLE_EQ(session.calculateVolume(separator),
+                     (getVolumeMoments<Volume, HalfEdgeCutting>(a_cell,
+                                                                separator)))
+        << "shift " << shift;
+  }
+  EXPECT_LT(session.getNumberOfClips(), samples / a_samples_per_clip);
+}
+
+TEST(DistanceCutSession, MatchesHalfEdgeCutting) {
+  expectSweepMatchesCutting(warpedHexahedron(), 1.0);
+  expectSweepMatchesCutting(warpedHexahedron(), -1.0);
+  expectSweepMatchesCutting(shearedHexahedron(), 1.0);
+
+  Dodecahedron dodecahedron = Dodecahedron::fromRawPtPointer(8, &unit_cell[0]);
+  dodecahedron[3] = dodecahedron[3] + Pt(-0.2, 0.1, 0.3);
+  expectSweepMatchesCutting(dodecahedron, 1.0);
+  expectSweepMatchesCutting(dodecahedron, -1.0);
+}
+
+TEST(DistanceCutSession, LargeCell) {
+  const PolyhedronConnectivity connectivity = prismConnectivity();
+  const auto cell = prism(&connectivity);
+  EXPECT_GT(cell.calculateVolume(), 0.0);
+  // Each plane crosses up to 48 vertices during the sweep.
+  expectSweepMatchesCutting(cell, 1.0, 2);
+  expectSweepMatchesCutting(cell, -1.0, 2);
+
+  for (const double volume_fraction : {0.05, 0.5, 0.97}) {
+    auto one_plane = PlanarSeparator::fromOnePlane(
+        Plane(Normal::normalized(1.0, 0.3, -0.2), 0.0));
+    setDistanceToMatchVolumeFraction(cell, volume_fraction, &one_plane,
+                                     1.0e-13);
+    EXPECT_NEAR(getVolumeFraction<HalfEdgeCutting>(cell, one_plane),
+                volume_fraction, 1.0e-13);
+  }
+}
+
+TEST(DistanceCutSession, ClipsOnlyWhenCrossingVertex) {
+  const auto hexahedron = warpedHexahedron();
+  const Plane plane_0(Normal::normalized(1.0, 0.3, -0.2), 0.05);
+  const Plane plane_1(Normal::normalized(-0.4, 1.0, 0.5), -0.02);
+  auto& session = getDistanceCutSession<Hexahedron>();
+  session.setCell(hexahedron);
+
+  // The same planes never need a new clip.
+  const auto unchanged = shiftedSeparator(plane_0, plane_1, 1.0, 0.0);
+  for (int n = 0; n < 5; ++n) {
+    EXPECT_DOUBLE_EQ(session.calculateVolume(unchanged),
+                     (getVolumeMoments<Volume, HalfEdgeCutting>(hexahedron,
+                                                                unchanged)));
+  }
+  EXPECT_EQ(session.getNumberOfClips(), 1);
+
+  // Small changes in distance keep every vertex on the same side.
+  for (int n = 0; n < 20; ++n) {
+    const double shift = 1.0e-4 * static_cast<double>(n);
+    const auto separator = shiftedSeparator(plane_0, plane_1, 1.0, shift);
+    EXPECT_DOUBLE_EQ(session.calculateVolume(separator),
+                     (getVolumeMoments<Volume, HalfEdgeCutting>(hexahedron,
+                                                                separator)));
+  }
+  EXPECT_EQ(session.getNumberOfClips(), 1);
+
+  // Moving both planes past every vertex changes the topology.
+  const auto empty = shiftedSeparator(plane_0, plane_1, 1.0, -2.0);
+  EXPECT_DOUBLE_EQ(session.calculateVolume(empty), 0.0);
+  EXPECT_EQ(session.getNumberOfClips(), 2);
+
+  // As does a change in normal.
+  const auto rotated = PlanarSeparator::fromOnePlane(
+      Plane(Normal::normalized(0.0, 0.0, 1.0), 0.0));
+  EXPECT_NEAR(session.calculateVolume(rotated),
+              (getVolumeMoments<Volume, HalfEdgeCutting>(hexahedron, rotated)),
+              1.0e-15);
+  EXPECT_EQ(session.getNumberOfClips(), 3);
+
+  session.setCell(hexahedron);
+  EXPECT_EQ(session.getNumberOfClips(), 0);
+}
+
+TEST(DistanceCutSession, DistanceSolve) {
+  const auto hexahedron = shearedHexahedron();
+  for (const double flip : {1.0, -1.0}) {
+    for (const double volume_fraction : {0.05, 0.3, 0.6, 0.97}) {
+      auto two_planes = PlanarSeparator::fromTwoPlanes(
+          Plane(Normal::normalized(1.0, 0.3, -0.2), 0.0),
+          Plane(Normal::normalized(-0.4, 1.0, 0.5), 0.1), flip);
+      setDistanceToMatchVolumeFraction(hexahedron, volume_fraction,
+                                       &two_planes, 1.0e-13);
+      EXPECT_NEAR(getVolumeFraction<HalfEdgeCutting>(hexahedron, two_planes),
+                  volume_fraction, 1.0e-13);
+
+      auto one_plane = PlanarSeparator::fromOnePlane(
+          Plane(Normal::normalized(flip, 0.3, -0.2), 0.0));
+      setDistanceToMatchVolumeFraction(hexahedron, volume_fraction,
+                                       &one_plane, 1.0e-13);
+      EXPECT_NEAR(getVolumeFraction<HalfEdgeCutting>(hexahedron, one_plane),
+                  volume_fraction, 1.0e-13);
+    }
+  }
+}
+
+}  // namespace
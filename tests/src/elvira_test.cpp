@@ -0,0 +1,93 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/interface_reconstruction_methods/elvira.h"
+
+#include <algorithm>
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/interface_reconstruction_methods/plane_distance.h"
+#include "irl/interface_reconstruction_methods/reconstruction_interface.h"
+
+namespace {
+
+using namespace IRL;
+
+// The batched candidate evaluation in ELVIRA_3D must pick the same
+// candidate as scoring each normal in turn, which ELVIRADebug still does.
+TEST(ELVIRA, BatchedCandidatesMatchSequential) {
+  std::mt19937_64 eng(31);
+  std::uniform_real_distribution<double> random_normal(-1.0, 1.0);
+  std::uniform_real_distribution<double> random_VF(0.05, 0.95);
+  std::uniform_real_distribution<double> random_noise(-0.05, 0.05);
+  std::uniform_real_distribution<double> random_spacing(0.5, 2.0);
+
+  RectangularCuboid stencil_cells[27];
+  double cell_VF[27];
+  ELVIRANeighborhood neighborhood;
+  neighborhood.resize(27);
+  for (int k = 0; k < 3; ++k) {
+    for (int j = 0; j < 3; ++j) {
+      for (int i = 0; i < 3; ++i) {
+        neighborhood.setMember(&stencil_cells[i + j * 3 + k * 9],
+                               &cell_VF[i + j * 3 + k * 9], i - 1, j - 1,
+                               k - 1);
+      }
+    }
+  }
+
+  UnsignedIndex_t number_of_cycles = 100;
+  for (UnsignedIndex_t cycle = 0; cycle < number_of_cycles; ++cycle) {
+    // Stretched mesh, so that the analytic kernel sees unequal sides.
+    const Pt spacing(random_spacing(eng), random_spacing(eng),
+                     random_spacing(eng));
+    for (int k = 0; k < 3; ++k) {
+      for (int j = 0; j < 3; ++j) {
+        for (int i = 0; i < 3; ++i) {
+          const Pt lower(spacing[0] * static_cast<double>(i - 1),
+                         spacing[1] * static_cast<double>(j - 1),
+                         spacing[2] * static_cast<double>(k - 1));
+          stencil_cells[i + j * 3 + k * 9] =
+              RectangularCuboid::fromBoundingPts(lower, lower + spacing);
+        }
+      }
+    }
+    const Normal normal = Normal::normalized(
+        random_normal(eng), random_normal(eng), random_normal(eng));
+    const PlanarSeparator plane = PlanarSeparator::fromOnePlane(Plane(
+        normal,
+        findDistanceOnePlane(stencil_cells[13], random_VF(eng), normal)));
+    // Noise on the neighbors keeps the candidates from fitting exactly.
+    for (UnsignedIndex_t n = 0; n < 27; ++n) {
+      cell_VF[n] = getVolumeFraction(stencil_cells[n], plane);
+      if (n != 13) {
+        cell_VF[n] = std::max(0.0, std::min(1.0, cell_VF[n] +
+                                                     random_noise(eng)));
+      }
+    }
+
+    const auto batched = reconstructionWithELVIRA3D(neighborhood);
+    testing::internal::CaptureStdout();
+    const auto sequential = reconstructionWithELVIRA3DDebug(neighborhood);
+    testing::internal::GetCapturedStdout();
+    ASSERT_EQ(batched.getNumberOfPlanes(), 1u);
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      EXPECT_DOUBLE_EQ(batched[0].normal()[d], sequential[0].normal()[d]);
+    }
+    EXPECT_NEAR(batched[0].distance(), sequential[0].distance(), 1.0e-12);
+    EXPECT_NEAR(getVolumeFraction(stencil_cells[13], batched),
+                cell_VF[13], 1.0e-13);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,273 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/generic_cutting/flux_volume_computer.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/polyhedrons/capped_dodecahedron.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/planar_reconstruction/localized_separator_link.h"
+#include "irl/planar_reconstruction/planar_localizer.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+// Linked mesh of n^3 unit cells cut by one plane, with the faces of the
+// interior cells, whose flux volumes stay inside the mesh.
+class FluxMesh {
+ public:
+  static constexpr int n = 5;
+
+  explicit FluxMesh(const Plane& a_plane)
+      : separator(PlanarSeparator::fromOnePlane(a_plane)),
+        localizers(n * n * n),
+        links(n * n * n) {
+    for (int k = 0; k < n; ++k) {
+      for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+          const UnsignedIndex_t c = index(i, j, k);
+          localizers[c] =
+              RectangularCuboid::fromBoundingPts(Pt(i, j, k),
+                                                 Pt(i + 1, j + 1, k + 1))
+                  .getLocalizer();
+          links[c] = LocalizedSeparatorLink(&localizers[c], &separator);
+          links[c].setId(c);
+        }
+      }
+    }
+    for (int k = 0; k < n; ++k) {
+      for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+          auto& link = links[index(i, j, k)];
+          link.setEdgeConnectivity(0, i > 0 ? &links[index(i - 1, j, k)]
+                                            : nullptr);
+          link.setEdgeConnectivity(1, i < n - 1 ? &links[index(i + 1, j, k)]
+                                                : nullptr);
+          link.setEdgeConnectivity(2, j > 0 ? &links[index(i, j - 1, k)]
+                                            : nullptr);
+          link.setEdgeConnectivity(3, j < n - 1 ? &links[index(i, j + 1, k)]
+                                                : nullptr);
+          link.setEdgeConnectivity(4, k > 0 ? &links[index(i, j, k - 1)]
+                                            : nullptr);
+          link.setEdgeConnectivity(5, k < n - 1 ? &links[index(i, j, k + 1)]
+                                                : nullptr);
+        }
+      }
+    }
+    // Lower and upper face of every interior cell in each direction.
+    for (int k = 1; k < n - 1; ++k) {
+      for (int j = 1; j < n - 1; ++j) {
+        for (int i = 1; i < n - 1; ++i) {
+          const int ijk[3] = {i, j, k};
+          for (int d = 0; d < 3; ++d) {
+            for (int side = 0; side < 2; ++side) {
+              int upper[3] = {i, j, k};
+              upper[d] += side;
+              if (side == 1 && upper[d] < n - 1) {
+                continue;  // Added as the lower face of the next cell.
+              }
+              int lower[3] = {upper[0], upper[1], upper[2]};
+              lower[d] -= 1;
+              addFace(d, ijk, upper, lower);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  static UnsignedIndex_t index(const int i, const int j, const int k) {
+    return static_cast<UnsignedIndex_t>(i + n * (j + n * k));
+  }
+
+  PlanarSeparator separator;
+  std::vector<PlanarLocalizer> localizers;
+  std::vector<LocalizedSeparatorLink> links;
+  std::vector<Pt> face_vertices;
+  std::vector<UnsignedIndex_t> face_cells;
+  std::vector<const LocalizedSeparatorLink*> starting_links;
+
+ private:
+  static bool isInterior(const int* a_ijk) {
+    for (int d = 0; d < 3; ++d) {
+      if (a_ijk[d] < 1 || a_ijk[d] > n - 2) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Face with normal direction a_d at the lower side of cell a_upper.
+  void addFace(const int a_d, const int* a_cell, const int* a_upper,
+               const int* a_lower) {
+    const int e1 = (a_d + 1) % 3;
+    const int e2 = (a_d + 2) % 3;
+    double base[3] = {static_cast<double>(a_upper[0]),
+                      static_cast<double>(a_upper[1]),
+                      static_cast<double>(a_upper[2])};
+    Pt vertices[4] = {Pt(base[0], base[1], base[2]),
+                      Pt(base[0], base[1], base[2]),
+                      Pt(base[0], base[1], base[2]),
+                      Pt(base[0], base[1], base[2])};
+    vertices[1][e1] += 1.0;
+    vertices[2][e1] += 1.0;
+    vertices[2][e2] += 1.0;
+    vertices[3][e2] += 1.0;
+    face_vertices.insert(face_vertices.end(), vertices, vertices + 4);
+    face_cells.push_back(isInterior(a_lower)
+                             ? index(a_lower[0], a_lower[1], a_lower[2])
+                             : FluxVolumeComputer::no_cell);
+    face_cells.push_back(isInterior(a_upper)
+                             ? index(a_upper[0], a_upper[1], a_upper[2])
+                             : FluxVolumeComputer::no_cell);
+    starting_links.push_back(&links[index(a_cell[0], a_cell[1], a_cell[2])]);
+  }
+};
+
+const Pt velocity(0.2, 0.1, -0.15);
+
+Plane planeThroughCenter(const Normal& a_normal) {
+  const double center = 0.5 * static_cast<double>(FluxMesh::n);
+  return Plane(a_normal, a_normal * Normal(center, center, center));
+}
+
+Pt backProject(const Pt& a_pt) { return a_pt - velocity; }
+
+TEST(FluxVolumeComputer, MatchesDirectCutting) {
+  const FluxMesh mesh(planeThroughCenter(Normal::normalized(1.0, 2.0, 3.0)));
+  const auto number_of_faces =
+      static_cast<UnsignedIndex_t>(mesh.starting_links.size());
+  ASSERT_EQ(number_of_faces, 108u);
+
+  FluxVolumeComputer computer(4);
+  computer.setGrainSize(4);
+  computer.setStoreTaggedFluxes(true);
+  computer.computeFluxes(number_of_faces, mesh.face_vertices.data(),
+                         backProject, nullptr, mesh.starting_links.data());
+  const auto& fluxes = computer.getFaceFluxes();
+  const auto& tagged_fluxes = computer.getTaggedFaceFluxes();
+  ASSERT_EQ(fluxes.size(), number_of_faces);
+  ASSERT_EQ(tagged_fluxes.size(), number_of_faces);
+
+  for (UnsignedIndex_t f = 0; f < number_of_faces; ++f) {
+    const Pt* vertices = &mesh.face_vertices[4 * f];
+    const Normal face_normal = crossProduct(vertices[1] - vertices[0],
+                                            vertices[2] - vertices[1]);
+    CappedDodecahedron flux_volume;
+    for (UnsignedIndex_t v = 0; v < 4; ++v) {
+      flux_volume[v] = vertices[v];
+      flux_volume[v + 4] = backProject(vertices[v]);
+    }
+    flux_volume[8] = backProject(
+        0.25 * (vertices[0] + vertices[1] + vertices[2] + vertices[3]));
+    const auto direct =
+        getVolumeMoments<SeparatedMoments<VolumeMoments>>(flux_volume,
+                                                          mesh.separator);
+
+    EXPECT_NEAR(fluxes[f][0].volume() + fluxes[f][1].volume(),
+                face_normal * velocity, 1.0e-14);
+    for (UnsignedIndex_t phase = 0; phase < 2; ++phase) {
+      EXPECT_NEAR(fluxes[f][phase].volume(), direct[phase].volume(),
+                  1.0e-14);
+      for (UnsignedIndex_t d = 0; d < 3; ++d) {
+        EXPECT_NEAR(fluxes[f][phase].centroid()[d],
+                    direct[phase].centroid()[d], 1.0e-13);
+      }
+    }
+    double tagged_volume = 0.0;
+    for (UnsignedIndex_t t = 0; t < tagged_fluxes[f].size(); ++t) {
+      EXPECT_LT(tagged_fluxes[f].getTagForIndex(t), mesh.links.size());
+      tagged_volume += tagged_fluxes[f].getMomentsForIndex(t)[0].volume();
+    }
+    EXPECT_NEAR(tagged_volume, fluxes[f][0].volume(), 1.0e-14);
+  }
+}
+
+TEST(FluxVolumeComputer, ScatterFluxes) {
+  const FluxMesh mesh(planeThroughCenter(Normal::normalized(-1.0, 0.5, 2.0)));
+  const auto number_of_faces =
+      static_cast<UnsignedIndex_t>(mesh.starting_links.size());
+  const auto number_of_cells = static_cast<UnsignedIndex_t>(
+      FluxMesh::n * FluxMesh::n * FluxMesh::n);
+
+  FluxVolumeComputer serial(1);
+  serial.computeFluxes(number_of_faces, mesh.face_vertices.data(),
+                       backProject, nullptr, mesh.starting_links.data());
+  std::vector<SeparatedMoments<VolumeMoments>> serial_cell_fluxes(
+      number_of_cells);
+  serial.scatterFluxes(number_of_cells, mesh.face_cells.data(),
+                       serial_cell_fluxes.data());
+
+  FluxVolumeComputer parallel(4);
+  parallel.setGrainSize(1);
+  parallel.computeFluxes(number_of_faces, mesh.face_vertices.data(),
+                         backProject, nullptr, mesh.starting_links.data());
+  EXPECT_TRUE(parallel.getTaggedFaceFluxes().empty());
+  std::vector<SeparatedMoments<VolumeMoments>> cell_fluxes(number_of_cells);
+  parallel.scatterFluxes(number_of_cells, mesh.face_cells.data(),
+                         cell_fluxes.data());
+
+  // Sum the faces directly, cell by cell.
+  const auto& face_fluxes = parallel.getFaceFluxes();
+  std::vector<SeparatedMoments<VolumeMoments>> expected(number_of_cells);
+  for (UnsignedIndex_t f = 0; f < number_of_faces; ++f) {
+    if (mesh.face_cells[2 * f] != FluxVolumeComputer::no_cell) {
+      expected[mesh.face_cells[2 * f]] += -1.0 * face_fluxes[f];
+    }
+    if (mesh.face_cells[2 * f + 1] != FluxVolumeComputer::no_cell) {
+      expected[mesh.face_cells[2 * f + 1]] += face_fluxes[f];
+    }
+  }
+  for (UnsignedIndex_t c = 0; c < number_of_cells; ++c) {
+    // A uniform velocity neither adds nor removes volume.
+    EXPECT_NEAR(cell_fluxes[c][0].volume() + cell_fluxes[c][1].volume(), 0.0,
+                1.0e-14);
+    for (UnsignedIndex_t phase = 0; phase < 2; ++phase) {
+      EXPECT_NEAR(cell_fluxes[c][phase].volume(),
+                  expected[c][phase].volume(), 1.0e-14);
+      EXPECT_DOUBLE_EQ(cell_fluxes[c][phase].volume(),
+                       serial_cell_fluxes[c][phase].volume());
+      for (UnsignedIndex_t d = 0; d < 3; ++d) {
+        EXPECT_NEAR(cell_fluxes[c][phase].centroid()[d],
+                    expected[c][phase].centroid()[d], 1.0e-13);
+      }
+    }
+  }
+}
+
+TEST(FluxVolumeComputer, CorrectedFluxVolumes) {
+  const FluxMesh mesh(Plane(Normal(0.0, 0.0, 1.0), 2.4));
+  const auto number_of_faces =
+      static_cast<UnsignedIndex_t>(mesh.starting_links.size());
+  std::vector<double> flux_volumes(number_of_faces);
+  for (UnsignedIndex_t f = 0; f < number_of_faces; ++f) {
+    const Pt* vertices = &mesh.face_vertices[4 * f];
+    const Normal face_normal = crossProduct(vertices[1] - vertices[0],
+                                            vertices[2] - vertices[1]);
+    flux_volumes[f] = 1.05 * (face_normal * velocity);
+  }
+
+  FluxVolumeComputer computer(2);
+  computer.computeFluxes(number_of_faces, mesh.face_vertices.data(),
+                         backProject, flux_volumes.data(),
+                         mesh.starting_links.data());
+  const auto& fluxes = computer.getFaceFluxes();
+  for (UnsignedIndex_t f = 0; f < number_of_faces; ++f) {
+    EXPECT_NEAR(fluxes[f][0].volume() + fluxes[f][1].volume(),
+                flux_volumes[f], 1.0e-13);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,139 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/generic_cutting/half_edge_cutting/half_edge_cutting_initializer.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/polyhedrons/capped_dodecahedron.h"
+#include "irl/geometry/polyhedrons/capped_dodecahedron_variations/capped_dodecahedron_LLLL.h"
+#include "irl/geometry/polyhedrons/capped_dodecahedron_variations/capped_dodecahedron_TTTT.h"
+#include "irl/geometry/polyhedrons/dodecahedron.h"
+#include "irl/geometry/polyhedrons/hexahedron.h"
+#include "irl/geometry/polyhedrons/polyhedron_24.h"
+#include "irl/geometry/polyhedrons/triangular_prism.h"
+#include "irl/moments/volume_moments.h"
+#include "irl/planar_reconstruction/localized_separator_link.h"
+
+namespace {
+
+using namespace IRL;
+
+// Cube corners, with the cap vertex above the x = 0.5 face.
+template <class GeometryType>
+GeometryType shiftedCube(const double a_shift) {
+  static const std::vector<Pt> corners{
+      Pt(0.5, -0.5, -0.5),  Pt(0.5, 0.5, -0.5),  Pt(0.5, 0.5, 0.5),
+      Pt(0.5, -0.5, 0.5),   Pt(-0.5, -0.5, -0.5), Pt(-0.5, 0.5, -0.5),
+      Pt(-0.5, 0.5, 0.5),   Pt(-0.5, -0.5, 0.5),  Pt(0.5, 0.0, 0.0)};
+  GeometryType geometry;
+  for (UnsignedIndex_t v = 0; v < geometry.getNumberOfVertices(); ++v) {
+    geometry[v] = corners[v] + Pt(a_shift, 0.1, -0.2);
+  }
+  return geometry;
+}
+
+// Cut each type through a pair of linked cells, as semi-Lagrangian
+// advection does with its flux volumes, and return the sum of volumes.
+double cutAllTypes(void) {
+  PlanarLocalizer left_localizer = unit_cell.getLocalizer();
+  PlanarLocalizer right_localizer = unit_cell.getLocalizer();
+  left_localizer[0] = Plane(Normal(1.0, 0.0, 0.0), 0.0);
+  right_localizer[1] = Plane(Normal(-1.0, 0.0, 0.0), 0.0);
+  const PlanarSeparator separator = PlanarSeparator::fromOnePlane(
+      Plane(Normal::normalized(0.2, 0.1, 1.0), 0.05));
+  LocalizedSeparatorLink left(&left_localizer, &separator);
+  LocalizedSeparatorLink right(&right_localizer, &separator);
+  left.setId(0);
+  right.setId(1);
+  left.setEdgeConnectivity(0, &right);
+  right.setEdgeConnectivity(1, &left);
+
+  double volume = 0.0;
+  for (UnsignedIndex_t n = 0; n < 4; ++n) {
+    const double shift = 0.1 * static_cast<double>(n);
+    volume += getVolumeMoments<Volume, HalfEdgeCutting>(
+        shiftedCube<Hexahedron>(shift), left);
+    volume += getVolumeMoments<Volume, HalfEdgeCutting>(
+        shiftedCube<CappedDodecahedron>(shift), left);
+    volume += getVolumeMoments<Volume, HalfEdgeCutting>(
+        shiftedCube<CappedDodecahedron_LLLL>(shift), left);
+    volume += getVolumeMoments<Volume, HalfEdgeCutting>(
+        shiftedCube<CappedDodecahedron_TTTT>(shift), left);
+    volume += getVolumeMoments<Volume, HalfEdgeCutting>(
+        shiftedCube<Dodecahedron>(shift), left);
+  }
+  return volume;
+}
+
+// Runs on a new thread, so that it starts from empty thread-local
+// templates.
+template <class FunctionType>
+void runOnNewThread(const FunctionType& a_function) {
+  std::thread thread(a_function);
+  thread.join();
+}
+
+// Must run before any types are preregistered in this process.
+TEST(HalfEdgeCuttingInitializer, LazyRegistration) {
+  HalfEdgeGeometryStatistics statistics;
+  double volume = 0.0;
+  runOnNewThread([&]() {
+    volume = cutAllTypes();
+    statistics = getHalfEdgeGeometryStatistics();
+  });
+  EXPECT_GT(volume, 0.0);
+  EXPECT_EQ(statistics.registered_types, 5u);
+  EXPECT_GT(statistics.invalidations, 0u);
+}
+
+TEST(HalfEdgeCuttingInitializer, PreregisteredTypesAreNotRebuilt) {
+  double lazy_volume = 0.0;
+  runOnNewThread([&]() { lazy_volume = cutAllTypes(); });
+
+  // The calling thread is registered immediately. A new thread is used
+  // since earlier tests may already have cut on this one.
+  HalfEdgeGeometryStatistics statistics;
+  runOnNewThread([&]() {
+    preregisterHalfEdgeGeometries<Hexahedron, CappedDodecahedron,
+                                  CappedDodecahedron_LLLL,
+                                  CappedDodecahedron_TTTT, Dodecahedron,
+                                  Polyhedron24, TriangularPrism>();
+    statistics = getHalfEdgeGeometryStatistics();
+  });
+  EXPECT_EQ(statistics.registered_types, 7u);
+  EXPECT_EQ(statistics.rebuilds, 0u);
+
+  // Other threads register everything on their first cut, including
+  // the types they never use.
+  HalfEdgeGeometryStatistics before, after;
+  double volume = 0.0;
+  runOnNewThread([&]() {
+    before = getHalfEdgeGeometryStatistics();
+    volume = cutAllTypes();
+    after = getHalfEdgeGeometryStatistics();
+  });
+  EXPECT_EQ(before.registered_types, 0u);
+  EXPECT_EQ(after.registered_types, 7u);
+  EXPECT_EQ(after.rebuilds, 0u);
+  EXPECT_EQ(volume, lazy_volume);
+
+  // Registering a type twice does nothing.
+  runOnNewThread([&]() {
+    preregisterHalfEdgeGeometries<Hexahedron>();
+    after = getHalfEdgeGeometryStatistics();
+  });
+  EXPECT_EQ(after.registered_types, 7u);
+}
+
+}  // namespace
@@ -0,0 +1,217 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/helpers/interface_surface_writer.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/geometry/general/normal.h"
+#include "irl/geometry/general/plane.h"
+#include "irl/helpers/mymath.h"
+
+namespace {
+
+using namespace IRL;
+
+struct Surface {
+  std::vector<double> points;
+  std::vector<std::int64_t> connectivity;
+  std::vector<std::int64_t> offsets;
+  std::vector<std::uint8_t> types;
+};
+
+std::vector<char> readFile(const std::string& a_file_name) {
+  std::ifstream file(a_file_name, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file),
+                           std::istreambuf_iterator<char>());
+}
+
+std::uint64_t attribute(const std::string& a_header, const std::string& a_key,
+                        const std::size_t a_start = 0) {
+  const std::size_t position = a_header.find(a_key + "=\"", a_start);
+  EXPECT_NE(position, std::string::npos);
+  return std::stoull(a_header.substr(position + a_key.size() + 2));
+}
+
+template <class DataType>
+std::vector<DataType> readArray(const std::vector<char>& a_file,
+                                const std::size_t a_start,
+                                const std::uint64_t a_offset,
+                                const std::uint64_t a_length) {
+  std::uint64_t size;
+  std::memcpy(&size, a_file.data() + a_start + a_offset, sizeof(size));
+  EXPECT_EQ(size, a_length * sizeof(DataType));
+  std::vector<DataType> data(a_length);
+  std::memcpy(data.data(), a_file.data() + a_start + a_offset + sizeof(size),
+              size);
+  return data;
+}
+
+Surface readSurface(const std::vector<char>& a_file) {
+  const std::string text(a_file.begin(), a_file.end());
+  const std::size_t start = text.find("encoding=\"raw\">\n_") + 17;
+  const std::string header = text.substr(0, start);
+  const std::uint64_t number_of_points = attribute(header, "NumberOfPoints");
+  const std::uint64_t number_of_cells = attribute(header, "NumberOfCells");
+  const std::size_t cells = header.find("<Cells>");
+  const std::size_t offsets = header.find("Name=\"offsets\"");
+  const std::size_t types = header.find("Name=\"types\"");
+  Surface surface;
+  surface.points = readArray<double>(a_file, start, 0, 3 * number_of_points);
+  surface.offsets = readArray<std::int64_t>(
+      a_file, start, attribute(header, "offset", offsets), number_of_cells);
+  const std::uint64_t connectivity_length =
+      surface.offsets.empty() ? 0 : surface.offsets.back();
+  surface.connectivity = readArray<std::int64_t>(
+      a_file, start, attribute(header, "offset", cells), connectivity_length);
+  surface.types = readArray<std::uint8_t>(
+      a_file, start, attribute(header, "offset", types), number_of_cells);
+  EXPECT_NE(text.find("</AppendedData>\n</VTKFile>\n", start),
+            std::string::npos);
+  return surface;
+}
+
+double surfaceArea(const Surface& a_surface) {
+  double area = 0.0;
+  std::int64_t first = 0;
+  for (const auto last : a_surface.offsets) {
+    const double* p0 = &a_surface.points[3 * a_surface.connectivity[first]];
+    for (std::int64_t n = first + 1; n + 1 < last; ++n) {
+      const double* p1 = &a_surface.points[3 * a_surface.connectivity[n]];
+      const double* p2 = &a_surface.points[3 * a_surface.connectivity[n + 1]];
+      const Pt cross = crossProduct(Pt(p1[0] - p0[0], p1[1] - p0[1],
+                                       p1[2] - p0[2]),
+                                    Pt(p2[0] - p0[0], p2[1] - p0[1],
+                                       p2[2] - p0[2]));
+      area += 0.5 * magnitude(cross);
+    }
+    first = last;
+  }
+  return area;
+}
+
+// Mesh of 8^3 cells spanning [-0.25, 1.25]^3, whose interior spans
+// [-0.0625, 1.0625]^3, cut by `a_plane` in every cell except those whose
+// center lies above z = a_pure_above.
+struct TestMesh {
+  TestMesh(const Plane& a_plane, const double a_pure_above)
+      : n(8), x(n + 1), reconstructions(n * n * n) {
+    for (UnsignedIndex_t i = 0; i <= n; ++i) {
+      x[i] = -0.25 + 0.1875 * static_cast<double>(i);
+    }
+    for (UnsignedIndex_t k = 0; k < n; ++k) {
+      for (UnsignedIndex_t j = 0; j < n; ++j) {
+        for (UnsignedIndex_t i = 0; i < n; ++i) {
+          auto& reconstruction = reconstructions[i + n * (j + n * k)];
+          if (0.5 * (x[k] + x[k + 1]) > a_pure_above) {
+            reconstruction = PlanarSeparator::fromOnePlane(
+                Plane(Normal(0.0, 0.0, 0.0), -1.0));
+          } else {
+            reconstruction = PlanarSeparator::fromOnePlane(a_plane);
+          }
+        }
+      }
+    }
+  }
+
+  bool write(InterfaceSurfaceWriter* a_writer, const std::string& a_name) {
+    return a_writer->write(a_name, n, n, n, x.data(), x.data(), x.data(),
+                           reconstructions.data());
+  }
+
+  UnsignedIndex_t n;
+  std::vector<double> x;
+  std::vector<PlanarSeparator> reconstructions;
+};
+
+TEST(InterfaceSurfaceWriter, WeldsFlatInterface) {
+  TestMesh mesh(Plane(Normal(0.0, 0.0, 1.0), 0.4), 2.0);
+  InterfaceSurfaceWriter writer(2);
+  ASSERT_TRUE(mesh.write(&writer, "interface_surface_writer_flat.vtu"));
+  // z = 0.4 falls inside one layer of 6 x 6 interior cells, whose corners
+  // are shared by up to four cells.
+  EXPECT_EQ(writer.getNumberOfPolygons(), 36u);
+  EXPECT_EQ(writer.getNumberOfPoints(), 49u);
+
+  const Surface surface =
+      readSurface(readFile("interface_surface_writer_flat.vtu"));
+  ASSERT_EQ(surface.points.size(), 3u * 49u);
+  ASSERT_EQ(surface.offsets.size(), 36u);
+  for (UnsignedIndex_t n = 0; n < 36; ++n) {
+    EXPECT_EQ(surface.offsets[n], 4 * static_cast<std::int64_t>(n + 1));
+    EXPECT_EQ(surface.types[n], 7u);
+  }
+  for (const auto index : surface.connectivity) {
+    EXPECT_GE(index, 0);
+    EXPECT_LT(index, 49);
+  }
+  for (UnsignedIndex_t n = 0; n < 49; ++n) {
+    EXPECT_DOUBLE_EQ(surface.points[3 * n + 2], 0.4);
+  }
+  EXPECT_NEAR(surfaceArea(surface), 1.125 * 1.125, 1.0e-14);
+  std::remove("interface_surface_writer_flat.vtu");
+}
+
+TEST(InterfaceSurfaceWriter, IndependentOfThreadsAndBudget) {
+  TestMesh mesh(Plane(Normal::normalized(0.3, -0.2, 1.0), 0.45), 0.7);
+  InterfaceSurfaceWriter serial(1);
+  ASSERT_TRUE(mesh.write(&serial, "interface_surface_writer_serial.vtu"));
+  EXPECT_EQ(serial.getNumberOfBlocks(), 6u);
+  EXPECT_GT(serial.getNumberOfPolygons(), 0u);
+
+  InterfaceSurfaceWriter parallel(4);
+  parallel.setMemoryBudget(1);
+  ASSERT_TRUE(mesh.write(&parallel, "interface_surface_writer_parallel.vtu"));
+  EXPECT_EQ(parallel.getNumberOfBlocks(), 36u);
+  EXPECT_EQ(parallel.getNumberOfPolygons(), serial.getNumberOfPolygons());
+  EXPECT_EQ(parallel.getNumberOfPoints(), serial.getNumberOfPoints());
+  const auto serial_file = readFile("interface_surface_writer_serial.vtu");
+  EXPECT_TRUE(serial_file ==
+              readFile("interface_surface_writer_parallel.vtu"));
+
+  // Every point is used, and most by more than one polygon.
+  const Surface surface = readSurface(serial_file);
+  std::vector<UnsignedIndex_t> uses(serial.getNumberOfPoints(), 0);
+  for (const auto index : surface.connectivity) {
+    ++uses[static_cast<std::size_t>(index)];
+  }
+  for (const auto use : uses) {
+    EXPECT_GT(use, 0u);
+  }
+  EXPECT_LT(2 * serial.getNumberOfPoints(), surface.connectivity.size());
+  EXPECT_GT(surfaceArea(surface), 0.0);
+  std::remove("interface_surface_writer_serial.vtu");
+  std::remove("interface_surface_writer_parallel.vtu");
+}
+
+TEST(InterfaceSurfaceWriter, EmptyInterface) {
+  TestMesh mesh(Plane(Normal(0.0, 0.0, 1.0), 0.4), -1.0);
+  InterfaceSurfaceWriter writer(2);
+  ASSERT_TRUE(mesh.write(&writer, "interface_surface_writer_empty.vtu"));
+  EXPECT_EQ(writer.getNumberOfPolygons(), 0u);
+  EXPECT_EQ(writer.getNumberOfPoints(), 0u);
+  const Surface surface =
+      readSurface(readFile("interface_surface_writer_empty.vtu"));
+  EXPECT_TRUE(surface.points.empty());
+  EXPECT_TRUE(surface.connectivity.empty());
+  std::remove("interface_surface_writer_empty.vtu");
+
+  EXPECT_FALSE(mesh.write(&writer, "no_such_directory/interface.vtu"));
+}
+
+}  // namespace
@@ -0,0 +1,252 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/interface_reconstruction_methods/mesh_reconstructor.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/interface_reconstruction_methods/mof.h"
+#include "irl/moments/cell_grouped_moments.h"
+#include "irl/moments/separated_volume_moments.h"
+#include "irl/parameters/tolerance_context.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+// Rectilinear mesh of n^3 unit cells cut by a single plane.
+struct PlanarInterfaceMesh {
+  explicit PlanarInterfaceMesh(const UnsignedIndex_t a_n,
+                               const Plane& a_plane)
+      : n(a_n),
+        nodes(a_n + 1),
+        cells(a_n * a_n * a_n),
+        liquid_volume_fraction(cells.size()),
+        liquid_centroid(cells.size()),
+        gas_centroid(cells.size()) {
+    for (UnsignedIndex_t i = 0; i <= n; ++i) {
+      nodes[i] = static_cast<double>(i);
+    }
+    const auto separator = PlanarSeparator::fromOnePlane(a_plane);
+    for (UnsignedIndex_t k = 0; k < n; ++k) {
+      for (UnsignedIndex_t j = 0; j < n; ++j) {
+        for (UnsignedIndex_t i = 0; i < n; ++i) {
+          const UnsignedIndex_t index = this->index(i, j, k);
+          cells[index] = RectangularCuboid::fromBoundingPts(
+              Pt(nodes[i], nodes[j], nodes[k]),
+              Pt(nodes[i + 1], nodes[j + 1], nodes[k + 1]));
+          const auto moments =
+              getNormalizedVolumeMoments<SeparatedMoments<VolumeMoments>>(
+                  cells[index], separator);
+          liquid_volume_fraction[index] =
+              moments[0].volume() / cells[index].calculateVolume();
+          liquid_centroid[index] = moments[0].centroid();
+          gas_centroid[index] = moments[1].centroid();
+        }
+      }
+    }
+  }
+
+  UnsignedIndex_t index(const UnsignedIndex_t i, const UnsignedIndex_t j,
+                        const UnsignedIndex_t k) const {
+    return i + n * (j + n * k);
+  }
+
+  bool isGhost(const UnsignedIndex_t a_index) const {
+    const UnsignedIndex_t i = a_index % n;
+    const UnsignedIndex_t j = (a_index / n) % n;
+    const UnsignedIndex_t k = a_index / (n * n);
+    return i == 0 || j == 0 || k == 0 || i == n - 1 || j == n - 1 ||
+           k == n - 1;
+  }
+
+  UnsignedIndex_t n;
+  std::vector<double> nodes;
+  std::vector<RectangularCuboid> cells;
+  std::vector<double> liquid_volume_fraction;
+  std::vector<Pt> liquid_centroid;
+  std::vector<Pt> gas_centroid;
+};
+
+std::vector<Normal> mofNormals(const PlanarInterfaceMesh& a_mesh) {
+  std::vector<Normal> normals(a_mesh.cells.size());
+  for (UnsignedIndex_t n = 0; n < a_mesh.cells.size(); ++n) {
+    const double volume = a_mesh.cells[n].calculateVolume();
+    const double volume_fraction = a_mesh.liquid_volume_fraction[n];
+    const SeparatedMoments<VolumeMoments> moments(
+        VolumeMoments(volume_fraction * volume, a_mesh.liquid_centroid[n]),
+        VolumeMoments((1.0 - volume_fraction) * volume,
+                      a_mesh.gas_centroid[n]));
+    MOF_3D<RectangularCuboid> mof_system;
+    normals[n] = mof_system.solve(
+        CellGroupedMoments<RectangularCuboid, SeparatedMoments<VolumeMoments>>(
+            &a_mesh.cells[n], &moments),
+        0.5, 0.5)[0].normal();
+  }
+  return normals;
+}
+
+// Checks mixed cells are reconstructed with a_expected_normals[n].
+void checkReconstruction(const PlanarInterfaceMesh& a_mesh,
+                         const MeshReconstructor& a_reconstructor,
+                         const std::vector<Normal>& a_expected_normals,
+                         const std::vector<PlanarSeparator>& a_reconstructions,
+                         const bool a_skip_ghosts, const double a_tolerance) {
+  UnsignedIndex_t number_of_mixed_cells = 0;
+  for (UnsignedIndex_t n = 0; n < a_mesh.cells.size(); ++n) {
+    if (a_skip_ghosts && a_mesh.isGhost(n)) {
+      EXPECT_EQ(a_reconstructions[n].getNumberOfPlanes(), 0);
+      continue;
+    }
+    const double volume_fraction = a_mesh.liquid_volume_fraction[n];
+    if (volume_fraction < global_constants::VF_LOW ||
+        volume_fraction > global_constants::VF_HIGH) {
+      ASSERT_EQ(a_reconstructions[n].getNumberOfPlanes(), 1);
+      EXPECT_DOUBLE_EQ(magnitude(a_reconstructions[n][0].normal()), 0.0);
+      EXPECT_EQ(a_reconstructor.getCellIterations()[n], 0);
+      continue;
+    }
+    ++number_of_mixed_cells;
+    ASSERT_EQ(a_reconstructions[n].getNumberOfPlanes(), 1);
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      EXPECT_NEAR(a_reconstructions[n][0].normal()[d],
+                  a_expected_normals[n][d], a_tolerance);
+    }
+    EXPECT_GT(a_reconstructor.getCellTimes()[n], 0.0);
+  }
+  EXPECT_EQ(a_reconstructor.getNumberOfMixedCells(), number_of_mixed_cells);
+  EXPECT_GT(number_of_mixed_cells, 0);
+}
+
+TEST(MeshReconstructor, StructuredMethods) {
+  const Normal normal = Normal::normalized(0.3, 0.5, 0.8);
+  const Plane plane(normal, normal * Pt(4.1, 3.9, 4.2));
+  const PlanarInterfaceMesh mesh(8, plane);
+
+  const std::vector<Normal> exact_normals(mesh.cells.size(), normal);
+
+  MeshReconstructor reconstructor(4);
+  EXPECT_EQ(reconstructor.getNumberOfThreads(), 4);
+  for (const auto method :
+       {MeshReconstructionMethod::ELVIRA3D, MeshReconstructionMethod::LVIRA3D,
+        MeshReconstructionMethod::R2P3D, MeshReconstructionMethod::MOF3D}) {
+    reconstructor.setMethod(method);
+    std::vector<PlanarSeparator> reconstructions(mesh.cells.size());
+    reconstructor.reconstruct(
+        mesh.n, mesh.n, mesh.n, mesh.nodes.data(), mesh.nodes.data(),
+        mesh.nodes.data(), mesh.liquid_volume_fraction.data(),
+        mesh.liquid_centroid.data(), mesh.gas_centroid.data(),
+        reconstructions.data());
+    if (method == MeshReconstructionMethod::MOF3D) {
+      // MOF only converges loosely for nearly pure cells, so compare
+      // against solving each cell directly.
+      checkReconstruction(mesh, reconstructor, mofNormals(mesh),
+                          reconstructions, true, 1.0e-12);
+    } else {
+      checkReconstruction(mesh, reconstructor, exact_normals,
+                          reconstructions, true, 1.0e-3);
+    }
+  }
+}
+
+TEST(MeshReconstructor, UnstructuredLVIRA) {
+  const Normal normal = Normal::normalized(-0.6, 0.2, 0.4);
+  const Plane plane(normal, normal * Pt(3.0, 3.3, 2.8));
+  const PlanarInterfaceMesh mesh(6, plane);
+
+  // Face, edge, and corner neighbors present in the mesh.
+  std::vector<UnsignedIndex_t> offsets(1, 0);
+  std::vector<UnsignedIndex_t> neighbors;
+  for (UnsignedIndex_t k = 0; k < mesh.n; ++k) {
+    for (UnsignedIndex_t j = 0; j < mesh.n; ++j) {
+      for (UnsignedIndex_t i = 0; i < mesh.n; ++i) {
+        for (int kk = -1; kk <= 1; ++kk) {
+          for (int jj = -1; jj <= 1; ++jj) {
+            for (int ii = -1; ii <= 1; ++ii) {
+              const int ni = static_cast<int>(i) + ii;
+              const int nj = static_cast<int>(j) + jj;
+              const int nk = static_cast<int>(k) + kk;
+              const int n = static_cast<int>(mesh.n);
+              if ((ii == 0 && jj == 0 && kk == 0) || ni < 0 || nj < 0 ||
+                  nk < 0 || ni >= n || nj >= n || nk >= n) {
+                continue;
+              }
+              neighbors.push_back(mesh.index(static_cast<UnsignedIndex_t>(ni),
+                                             static_cast<UnsignedIndex_t>(nj),
+                                             static_cast<UnsignedIndex_t>(nk)));
+            }
+          }
+        }
+        offsets.push_back(static_cast<UnsignedIndex_t>(neighbors.size()));
+      }
+    }
+  }
+
+  MeshReconstructor reconstructor(3);
+  reconstructor.setGrainSize(1);
+  std::vector<PlanarSeparator> reconstructions(mesh.cells.size());
+  reconstructor.reconstruct(
+      static_cast<UnsignedIndex_t>(mesh.cells.size()), mesh.cells.data(),
+      offsets.data(), neighbors.data(), mesh.liquid_volume_fraction.data(),
+      mesh.liquid_centroid.data(), mesh.gas_centroid.data(),
+      reconstructions.data());
+  checkReconstruction(mesh, reconstructor,
+                      std::vector<Normal>(mesh.cells.size(), normal),
+                      reconstructions, false, 1.0e-3);
+  for (UnsignedIndex_t n = 0; n < mesh.cells.size(); ++n) {
+    if (reconstructor.getCellTimes()[n] > 0.0) {
+      EXPECT_GT(reconstructor.getCellIterations()[n], 0);
+    }
+  }
+}
+
+TEST(MeshReconstructor, UsesCallersToleranceContext) {
+  const Normal normal = Normal::normalized(0.3, 0.5, 0.8);
+  const Plane plane(normal, normal * Pt(4.1, 3.9, 4.2));
+  const PlanarInterfaceMesh mesh(8, plane);
+
+  // Cells of every thread are judged pure with the caller's bounds.
+  ToleranceContext context;
+  context.setVolumeFractionBounds(0.2);
+  MeshReconstructor reconstructor(4);
+  reconstructor.setGrainSize(1);
+  reconstructor.setMethod(MeshReconstructionMethod::ELVIRA3D);
+  std::vector<PlanarSeparator> reconstructions(mesh.cells.size());
+  {
+    ScopedToleranceContext scope(context);
+    reconstructor.reconstruct(
+        mesh.n, mesh.n, mesh.n, mesh.nodes.data(), mesh.nodes.data(),
+        mesh.nodes.data(), mesh.liquid_volume_fraction.data(),
+        mesh.liquid_centroid.data(), mesh.gas_centroid.data(),
+        reconstructions.data());
+  }
+  UnsignedIndex_t number_of_mixed_cells = 0;
+  for (UnsignedIndex_t n = 0; n < mesh.cells.size(); ++n) {
+    if (mesh.isGhost(n)) {
+      continue;
+    }
+    const double volume_fraction = mesh.liquid_volume_fraction[n];
+    ASSERT_EQ(reconstructions[n].getNumberOfPlanes(), 1);
+    if (volume_fraction < 0.2 || volume_fraction > 0.8) {
+      EXPECT_DOUBLE_EQ(magnitude(reconstructions[n][0].normal()), 0.0);
+    } else {
+      ++number_of_mixed_cells;
+      EXPECT_NEAR(magnitude(reconstructions[n][0].normal()), 1.0, 1.0e-12);
+    }
+  }
+  EXPECT_EQ(reconstructor.getNumberOfMixedCells(), number_of_mixed_cells);
+  EXPECT_GT(number_of_mixed_cells, 0);
+}
+
+}  // namespace
@@ -0,0 +1,123 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/geometry/general/moment_calculation_through_faces.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/generic_cutting/half_edge_cutting/half_edge_cutting.h"
+#include "irl/geometry/general/moment_calculation_through_simplices.h"
+#include "irl/geometry/polyhedrons/dodecahedron.h"
+#include "irl/geometry/polyhedrons/hexahedron.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/geometry/polyhedrons/tet.h"
+#include "irl/helpers/geometric_cutting_helpers.h"
+#include "irl/planar_reconstruction/planar_localizer.h"
+
+namespace {
+
+using namespace IRL;
+
+// Moments from the faces should match those of the tet decomposition of the
+// same half-edge structure.
+template <UnsignedIndex_t ORDER, class SegmentedType>
+void expectMatchesTetDecomposition(SegmentedType* a_polyhedron) {
+  const auto from_faces =
+      a_polyhedron->template calculateGeneralMoments<ORDER>();
+  const auto from_tets =
+      segmented_half_edge_polyhedron_detail::calculateMoments(
+          a_polyhedron, GeneralMoments3D_Functor<ORDER>());
+  ASSERT_EQ(from_faces.size(), from_tets.size());
+  for (UnsignedIndex_t m = 0; m < from_faces.size(); ++m) {
+    EXPECT_NEAR(from_faces[m], from_tets[m],
+                1.0e-12 * std::max(1.0, std::fabs(from_tets[m])))
+        << "ORDER " << ORDER << " moment " << m;
+  }
+}
+
+template <class SegmentedType>
+void expectMatchesTetDecompositionUpToOrder4(SegmentedType* a_polyhedron) {
+  expectMatchesTetDecomposition<0>(a_polyhedron);
+  expectMatchesTetDecomposition<1>(a_polyhedron);
+  expectMatchesTetDecomposition<2>(a_polyhedron);
+  expectMatchesTetDecomposition<3>(a_polyhedron);
+  expectMatchesTetDecomposition<4>(a_polyhedron);
+}
+
+TEST(MomentCalculationThroughFaces, Tet) {
+  Tet tet({Pt(2.0, 0.0, 0.0), Pt(10.0, 3.0, 2.0), Pt(10.0, 5.0, 0.0),
+           Pt(10.0, 4.0, -3.0)});
+  auto half_edge = tet.generateHalfEdgeVersion();
+  auto segmented = half_edge.generateSegmentedPolyhedron();
+  // Correct generated using mathematica to do the integrations
+  const std::array<double, 10> correct{
+      {10.6666666666666, 85.3333333333333, 32.0, -2.666666666666667,
+       708.2666666666666, 268.8, -22.4, 103.4666666666667, -9.6,
+       7.466666666666666}};
+  const auto mom = segmented.calculateGeneralMoments<2>();
+  for (UnsignedIndex_t m = 0; m < mom.size(); ++m) {
+    EXPECT_NEAR(mom[m], correct[m], 1.0e-12);
+  }
+  expectMatchesTetDecompositionUpToOrder4(&segmented);
+}
+
+TEST(MomentCalculationThroughFaces, Polyhedra) {
+  auto cube = RectangularCuboid::fromBoundingPts(Pt(0.5, 1.0, -2.0),
+                                                 Pt(1.5, 1.25, -1.0));
+  auto cube_half_edge = cube.generateHalfEdgeVersion();
+  auto cube_segmented = cube_half_edge.generateSegmentedPolyhedron();
+  expectMatchesTetDecompositionUpToOrder4(&cube_segmented);
+
+  // Hexahedron with non-planar faces.
+  Hexahedron hexahedron = Hexahedron::fromRawPtPointer(8, &unit_cell[0]);
+  hexahedron[0] = hexahedron[0] + Pt(0.1, -0.05, 0.2);
+  hexahedron[6] = hexahedron[6] + Pt(0.3, 0.2, 0.1);
+  auto hexahedron_half_edge = hexahedron.generateHalfEdgeVersion();
+  auto hexahedron_segmented =
+      hexahedron_half_edge.generateSegmentedPolyhedron();
+  expectMatchesTetDecompositionUpToOrder4(&hexahedron_segmented);
+
+  Dodecahedron dodecahedron = Dodecahedron::fromRawPtPointer(8, &unit_cell[0]);
+  dodecahedron[3] = dodecahedron[3] + Pt(-0.2, 0.1, 0.3);
+  auto dodecahedron_half_edge = dodecahedron.generateHalfEdgeVersion();
+  auto dodecahedron_segmented =
+      dodecahedron_half_edge.generateSegmentedPolyhedron();
+  expectMatchesTetDecompositionUpToOrder4(&dodecahedron_segmented);
+}
+
+TEST(MomentCalculationThroughFaces, ClippedPolyhedron) {
+  Hexahedron hexahedron = Hexahedron::fromRawPtPointer(8, &unit_cell[0]);
+  hexahedron[6] = hexahedron[6] + Pt(0.3, 0.2, 0.1);
+  auto half_edge = hexahedron.generateHalfEdgeVersion();
+  auto segmented = half_edge.generateSegmentedPolyhedron();
+  decltype(segmented) clipped;
+  splitHalfEdgePolytope(&segmented, &clipped, &half_edge,
+                        Plane(Normal::normalized(1.0, 0.5, -0.2), 0.1));
+  expectMatchesTetDecompositionUpToOrder4(&segmented);
+  expectMatchesTetDecompositionUpToOrder4(&clipped);
+
+  // Moments of a clipped cube are those of the remaining box.
+  auto cube =
+      RectangularCuboid::fromBoundingPts(Pt(0.0, 0.0, 0.0), Pt(1.0, 1.0, 1.0));
+  const auto clipped_moments = getVolumeMoments<GeneralMoments3D<3>>(
+      cube, PlanarLocalizer::fromOnePlane(Plane(Normal(1.0, 0.0, 0.0), 0.3)));
+  const auto correct =
+      RectangularCuboid::fromBoundingPts(Pt(0.0, 0.0, 0.0), Pt(0.3, 1.0, 1.0))
+          .calculateGeneralMoments<3>();
+  for (UnsignedIndex_t m = 0; m < correct.size(); ++m) {
+    EXPECT_NEAR(clipped_moments[m], correct[m], 1.0e-14);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,157 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/planar_reconstruction/packed_planar_separator_array.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/helpers/byte_buffer.h"
+#include "irl/helpers/serializer.h"
+
+namespace {
+
+using namespace IRL;
+
+void expectSameSeparator(const PlanarSeparator& a_decoded,
+                         const PlanarSeparator& a_original) {
+  ASSERT_EQ(a_decoded.getNumberOfPlanes(), a_original.getNumberOfPlanes());
+  EXPECT_EQ(a_decoded.isFlipped(), a_original.isFlipped());
+  for (UnsignedIndex_t p = 0; p < a_original.getNumberOfPlanes(); ++p) {
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      EXPECT_EQ(a_decoded[p].normal()[d], a_original[p].normal()[d]);
+    }
+    EXPECT_EQ(a_decoded[p].distance(), a_original[p].distance());
+  }
+}
+
+TEST(PackedPlanarSeparatorArray, NormalsAreStoredExactly) {
+  std::mt19937_64 eng(11);
+  std::uniform_real_distribution<double> component(-1.0, 1.0);
+  std::vector<Normal> normals{Normal(1.0, 0.0, 0.0),  Normal(0.0, -1.0, 0.0),
+                              Normal(0.0, 0.0, 1.0),  Normal(0.0, 0.0, -1.0),
+                              Normal(-1.0, 0.0, 0.0), Normal(0.0, 1.0, 0.0),
+                              Normal(0.0, 0.0, 0.0),
+                              Normal::normalized(0.3, 0.2, 0.1)};
+  for (UnsignedIndex_t n = 0; n < 1000; ++n) {
+    normals.push_back(
+        Normal::normalized(component(eng), component(eng), component(eng)));
+  }
+  PackedPlanarSeparatorArray separators(
+      static_cast<UnsignedIndex_t>(normals.size()));
+  for (UnsignedIndex_t n = 0; n < normals.size(); ++n) {
+    const auto separator = PlanarSeparator::fromOnePlane(
+        Plane(normals[n], component(eng)));
+    separators.set(n, separator);
+    EXPECT_TRUE(separators.isPacked(n));
+    expectSameSeparator(separators.get(n), separator);
+  }
+}
+
+TEST(PackedPlanarSeparatorArray, SetAndGet) {
+  PackedPlanarSeparatorArray separators(5);
+  EXPECT_EQ(separators.size(), 5u);
+  EXPECT_EQ(separators.getNumberOfPlanes(3), 0u);
+  EXPECT_TRUE(separators.isPacked(3));
+
+  const auto one_plane = PlanarSeparator::fromOnePlane(
+      Plane(Normal::normalized(0.3, -0.4, -0.8), 0.125));
+  auto flipped = one_plane;
+  flipped.flipCutting();
+  const auto two_planes = PlanarSeparator::fromTwoPlanes(
+      Plane(Normal::normalized(1.0, 0.2, 0.0), 0.1),
+      Plane(Normal::normalized(-1.0, 0.1, 0.0), 0.1), -1.0);
+  PlanarSeparator empty_flipped;
+  empty_flipped.flipCutting();
+
+  separators.set(0, one_plane);
+  separators.set(1, flipped);
+  separators.set(2, two_planes);
+  separators.set(4, empty_flipped);
+  EXPECT_TRUE(separators.isPacked(0));
+  EXPECT_TRUE(separators.isPacked(1));
+  EXPECT_FALSE(separators.isPacked(2));
+  EXPECT_FALSE(separators.isPacked(4));
+  EXPECT_EQ(separators.getNumberOfOverflowSeparators(), 2u);
+  EXPECT_EQ(separators.getNumberOfPlanes(2), 2u);
+  expectSameSeparator(separators.get(0), one_plane);
+  expectSameSeparator(separators.get(1), flipped);
+  expectSameSeparator(separators.get(2), two_planes);
+  expectSameSeparator(separators.get(3), PlanarSeparator());
+  expectSameSeparator(separators.get(4), empty_flipped);
+
+  // Overflow slots are reused once a cell no longer needs them.
+  separators.set(2, one_plane);
+  EXPECT_EQ(separators.getNumberOfOverflowSeparators(), 1u);
+  separators.set(3, two_planes);
+  EXPECT_EQ(separators.getNumberOfOverflowSeparators(), 2u);
+  expectSameSeparator(separators.get(3), two_planes);
+  expectSameSeparator(separators.get(4), empty_flipped);
+
+  // Decoding into an existing separator overwrites all of it.
+  PlanarSeparator decoded = two_planes;
+  separators.get(1, &decoded);
+  expectSameSeparator(decoded, flipped);
+
+  separators.resize(3);
+  EXPECT_EQ(separators.getNumberOfOverflowSeparators(), 0u);
+  separators.resize(4);
+  expectSameSeparator(separators.get(3), PlanarSeparator());
+}
+
+TEST(PackedPlanarSeparatorArray, SmallerThanPlanarSeparator) {
+  static constexpr UnsignedIndex_t number_of_cells = 1000;
+  PackedPlanarSeparatorArray separators(number_of_cells);
+  for (UnsignedIndex_t n = 0; n < number_of_cells; ++n) {
+    separators.set(n, PlanarSeparator::fromOnePlane(Plane(
+                          Normal::normalized(1.0, 0.001 * n, 0.0), 0.0)));
+  }
+  EXPECT_LE(4 * separators.getMemoryUsage(),
+            number_of_cells * sizeof(PlanarSeparator));
+}
+
+TEST(PackedPlanarSeparatorArray, Serialization) {
+  std::mt19937_64 eng(3);
+  std::uniform_real_distribution<double> component(-1.0, 1.0);
+  static constexpr UnsignedIndex_t number_of_cells = 50;
+  std::vector<PlanarSeparator> originals(number_of_cells);
+  PackedPlanarSeparatorArray separators(number_of_cells);
+  for (UnsignedIndex_t n = 0; n < number_of_cells; ++n) {
+    const Plane plane(
+        Normal::normalized(component(eng), component(eng), component(eng)),
+        component(eng));
+    if (n % 7 == 0) {
+      originals[n] = PlanarSeparator::fromTwoPlanes(
+          plane, Plane(-plane.normal(), 0.5 - plane.distance()), 1.0);
+    } else if (n % 5 != 0) {
+      originals[n] = PlanarSeparator::fromOnePlane(plane);
+    }
+    separators.set(n, originals[n]);
+  }
+  // Leave a free overflow slot behind.
+  separators.set(0, originals[1]);
+  originals[0] = originals[1];
+
+  ByteBuffer buffer;
+  serializeAndPack(separators, &buffer);
+  EXPECT_EQ(buffer.size(), separators.getSerializedSize());
+  buffer.resetBufferPointer();
+  PackedPlanarSeparatorArray unpacked;
+  unpackAndStore(&unpacked, &buffer);
+  ASSERT_EQ(unpacked.size(), number_of_cells);
+  EXPECT_EQ(unpacked.getNumberOfOverflowSeparators(),
+            separators.getNumberOfOverflowSeparators());
+  for (UnsignedIndex_t n = 0; n < number_of_cells; ++n) {
+    expectSameSeparator(unpacked.get(n), originals[n]);
+  }
+}
+
+}  // namespace
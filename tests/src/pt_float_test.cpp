@@ -0,0 +1,182 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/geometry/general/pt_float.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/polyhedrons/capped_dodecahedron.h"
+#include "irl/geometry/polyhedrons/dodecahedron.h"
+#include "irl/moments/volume_moments.h"
+#include "irl/planar_reconstruction/localized_separator_link.h"
+
+namespace {
+
+using namespace IRL;
+
+TEST(PtFloat, Construction) {
+  EXPECT_EQ(sizeof(PtFloat), 3 * sizeof(float));
+  const PtFloat pt(Pt(0.1, -2.0, 3.5));
+  EXPECT_EQ(pt[0], 0.1f);
+  EXPECT_EQ(pt[1], -2.0f);
+  EXPECT_EQ(pt[2], 3.5f);
+  EXPECT_EQ(pt.getPt()[0], static_cast<double>(0.1f));
+
+  PtFloat sum(1.0f, 2.0f, 3.0f);
+  sum += PtFloat(1.0f, 2.0f, 3.0f);
+  sum /= 4.0;
+  EXPECT_EQ(sum[0], 0.5f);
+  EXPECT_EQ(sum[1], 1.0f);
+  EXPECT_EQ(sum[2], 1.5f);
+}
+
+TEST(PtFloat, fromEdgeIntersection) {
+  const PtFloat pt_0(0.0f, 0.0f, 0.0f);
+  const PtFloat pt_1(1.0f, 2.0f, -4.0f);
+  const auto intersection = PtFloat::fromEdgeIntersection(pt_0, -0.25, pt_1,
+                                                          0.75);
+  EXPECT_FLOAT_EQ(intersection[0], 0.25f);
+  EXPECT_FLOAT_EQ(intersection[1], 0.5f);
+  EXPECT_FLOAT_EQ(intersection[2], -1.0f);
+}
+
+// Corners of a randomly perturbed unit cube, with the cap vertex above the
+// x = 0.5 face for capped dodecahedra.
+std::vector<Pt> perturbedCube(std::mt19937_64* a_eng) {
+  std::uniform_real_distribution<double> perturbation(-0.1, 0.1);
+  std::vector<Pt> vertices{Pt(0.5, -0.5, -0.5),  Pt(0.5, 0.5, -0.5),
+                           Pt(0.5, 0.5, 0.5),    Pt(0.5, -0.5, 0.5),
+                           Pt(-0.5, -0.5, -0.5), Pt(-0.5, 0.5, -0.5),
+                           Pt(-0.5, 0.5, 0.5),   Pt(-0.5, -0.5, 0.5),
+                           Pt(0.7, 0.0, 0.0)};
+  for (auto& vertex : vertices) {
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      vertex[d] += perturbation(*a_eng);
+    }
+  }
+  return vertices;
+}
+
+TEST(PtFloat, MixedPrecisionCutting) {
+  std::mt19937_64 eng(42);
+  std::uniform_real_distribution<double> normal_component(-1.0, 1.0);
+  std::uniform_real_distribution<double> distance(-0.3, 0.3);
+  for (UnsignedIndex_t n = 0; n < 50; ++n) {
+    const auto vertices = perturbedCube(&eng);
+    Dodecahedron dodecahedron;
+    StoredDodecahedron<PtFloat> dodecahedron_float;
+    for (UnsignedIndex_t v = 0; v < 8; ++v) {
+      dodecahedron_float[v] = PtFloat(vertices[v]);
+      // Compare against the same (rounded) vertices in double.
+      dodecahedron[v] = dodecahedron_float[v].getPt();
+    }
+    const auto separator = PlanarSeparator::fromOnePlane(
+        Plane(Normal::normalized(normal_component(eng), normal_component(eng),
+                                 normal_component(eng)),
+              distance(eng)));
+
+    const auto exact =
+        getVolumeMoments<SeparatedMoments<VolumeMoments>, HalfEdgeCutting>(
+            dodecahedron, separator);
+    const auto mixed =
+        getVolumeMoments<SeparatedMoments<VolumeMoments>, HalfEdgeCutting>(
+            dodecahedron_float, separator);
+    const double total = exact[0].volume() + exact[1].volume();
+    for (UnsignedIndex_t phase = 0; phase < 2; ++phase) {
+      EXPECT_NEAR(mixed[phase].volume(), exact[phase].volume(),
+                  1.0e-6 * total);
+      for (UnsignedIndex_t d = 0; d < 3; ++d) {
+        EXPECT_NEAR(mixed[phase].centroid()[d], exact[phase].centroid()[d],
+                    1.0e-6 * total);
+      }
+    }
+    EXPECT_NEAR((getVolumeMoments<Volume, SimplexCutting>(dodecahedron_float,
+                                                          separator)),
+                exact[0].volume(), 1.0e-6 * total);
+  }
+}
+
+TEST(PtFloat, MixedPrecisionLinkCutting) {
+  static constexpr UnsignedIndex_t n = 3;
+  std::vector<PlanarLocalizer> localizers(n * n * n);
+  std::vector<PlanarSeparator> separators(n * n * n);
+  std::vector<LocalizedSeparatorLink> links;
+  links.reserve(n * n * n);
+  for (UnsignedIndex_t k = 0; k < n; ++k) {
+    for (UnsignedIndex_t j = 0; j < n; ++j) {
+      for (UnsignedIndex_t i = 0; i < n; ++i) {
+        const UnsignedIndex_t index = i + n * (j + n * k);
+        auto cell = unit_cell;
+        cell.shift(static_cast<double>(i) - 1.0, static_cast<double>(j) - 1.0,
+                   static_cast<double>(k) - 1.0);
+        localizers[index] = cell.getLocalizer();
+        separators[index] = PlanarSeparator::fromOnePlane(
+            Plane(Normal::normalized(1.0, 0.5 * i, -0.25 * j),
+                  0.1 * k - 0.2));
+        links.emplace_back(&localizers[index], &separators[index]);
+      }
+    }
+  }
+  for (UnsignedIndex_t k = 0; k < n; ++k) {
+    for (UnsignedIndex_t j = 0; j < n; ++j) {
+      for (UnsignedIndex_t i = 0; i < n; ++i) {
+        const UnsignedIndex_t index = i + n * (j + n * k);
+        auto& link = links[index];
+        link.setId(index);
+        link.setEdgeConnectivity(0, i > 0 ? &links[index - 1] : nullptr);
+        link.setEdgeConnectivity(1, i + 1 < n ? &links[index + 1] : nullptr);
+        link.setEdgeConnectivity(2, j > 0 ? &links[index - n] : nullptr);
+        link.setEdgeConnectivity(3,
+                                 j + 1 < n ? &links[index + n] : nullptr);
+        link.setEdgeConnectivity(4,
+                                 k > 0 ? &links[index - n * n] : nullptr);
+        link.setEdgeConnectivity(
+            5, k + 1 < n ? &links[index + n * n] : nullptr);
+      }
+    }
+  }
+
+  std::mt19937_64 eng(7);
+  const UnsignedIndex_t start = 1 + n * (1 + n * 1);
+  for (UnsignedIndex_t sample = 0; sample < 20; ++sample) {
+    // Shrunk and shifted to overlap at most eight cells.
+    auto vertices = perturbedCube(&eng);
+    for (auto& vertex : vertices) {
+      vertex = 0.5 * vertex + Pt(0.3, 0.3, 0.3);
+    }
+    CappedDodecahedron flux_volume;
+    StoredCappedDodecahedron<PtFloat> flux_volume_float;
+    for (UnsignedIndex_t v = 0; v < 9; ++v) {
+      flux_volume_float[v] = PtFloat(vertices[v]);
+      flux_volume[v] = flux_volume_float[v].getPt();
+    }
+    const auto exact =
+        getVolumeMoments<TaggedAccumulatedVolumeMoments<
+            SeparatedMoments<VolumeMoments>>>(flux_volume, links[start]);
+    const auto mixed =
+        getVolumeMoments<TaggedAccumulatedVolumeMoments<
+            SeparatedMoments<VolumeMoments>>>(flux_volume_float, links[start]);
+    ASSERT_EQ(mixed.size(), exact.size());
+    for (UnsignedIndex_t tag = 0; tag < n * n * n; ++tag) {
+      ASSERT_EQ(mixed.isTagKnown(tag), exact.isTagKnown(tag));
+      if (exact.isTagKnown(tag)) {
+        for (UnsignedIndex_t phase = 0; phase < 2; ++phase) {
+          EXPECT_NEAR(mixed[tag][phase].volume(), exact[tag][phase].volume(),
+                      1.0e-6);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
@@ -0,0 +1,187 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/interface_reconstruction_methods/reconstruction_warm_start_cache.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/interface_reconstruction_methods/lvira_neighborhood.h"
+#include "irl/interface_reconstruction_methods/lvira_optimization.h"
+#include "irl/interface_reconstruction_methods/r2p_neighborhood.h"
+#include "irl/interface_reconstruction_methods/r2p_optimization.h"
+#include "irl/interface_reconstruction_methods/reconstruction_interface.h"
+#include "irl/moments/separated_volume_moments.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+// 3x3x3 unit-cell stencil, center cell first, cut by a given plane.
+struct Stencil {
+  explicit Stencil(const Plane& a_plane) {
+    const auto separator = PlanarSeparator::fromOnePlane(a_plane);
+    UnsignedIndex_t n = 1;
+    for (int k = -1; k <= 1; ++k) {
+      for (int j = -1; j <= 1; ++j) {
+        for (int i = -1; i <= 1; ++i) {
+          const UnsignedIndex_t index =
+              (i == 0 && j == 0 && k == 0) ? 0 : n++;
+          cells[index] = RectangularCuboid::fromBoundingPts(
+              Pt(i - 0.5, j - 0.5, k - 0.5), Pt(i + 0.5, j + 0.5, k + 0.5));
+          moments[index] =
+              getNormalizedVolumeMoments<SeparatedMoments<VolumeMoments>>(
+                  cells[index], separator);
+          volume_fractions[index] = moments[index][0].volume();
+        }
+      }
+    }
+    lvira_neighborhood.resize(27);
+    r2p_neighborhood.resize(27);
+    for (UnsignedIndex_t s = 0; s < 27; ++s) {
+      lvira_neighborhood.setMember(s, &cells[s], &volume_fractions[s]);
+      r2p_neighborhood.setMember(s, &cells[s], &moments[s]);
+    }
+    lvira_neighborhood.setCenterOfStencil(0);
+    r2p_neighborhood.setCenterOfStencil(0);
+    initial_guess = PlanarSeparator::fromOnePlane(
+        Plane(Normal(0.0, 0.0, 1.0), 0.0));
+    setDistanceToMatchVolumeFraction(cells[0], volume_fractions[0],
+                                     &initial_guess);
+    r2p_neighborhood.setSurfaceArea(
+        getReconstructionSurfaceArea(cells[0], initial_guess));
+  }
+
+  RectangularCuboid cells[27];
+  SeparatedMoments<VolumeMoments> moments[27];
+  double volume_fractions[27];
+  LVIRANeighborhood<RectangularCuboid> lvira_neighborhood;
+  R2PNeighborhood<RectangularCuboid> r2p_neighborhood;
+  PlanarSeparator initial_guess;
+};
+
+// Plane through the center cell that translates and slowly rotates.
+Plane movingPlane(const UnsignedIndex_t a_step) {
+  const Normal normal = Normal::normalized(
+      0.3 + 0.01 * static_cast<double>(a_step), 0.5, 0.8);
+  return Plane(normal, 0.1 + 0.02 * static_cast<double>(a_step));
+}
+
+TEST(ReconstructionWarmStartCache, LVIRAAcrossTimeSteps) {
+  static constexpr UnsignedIndex_t number_of_steps = 10;
+  ReconstructionWarmStartCache cache;
+  UnsignedIndex_t cold_iterations = 0;
+  UnsignedIndex_t warm_iterations = 0;
+  for (UnsignedIndex_t step = 0; step < number_of_steps; ++step) {
+    const Plane plane = movingPlane(step);
+    const Stencil stencil(plane);
+
+    LVIRA_3D<RectangularCuboid> cold_system;
+    cold_system.solve(stencil.lvira_neighborhood, stencil.initial_guess);
+    LVIRA_3D<RectangularCuboid> warm_system;
+    warm_system.setWarmStartCache(&cache, 42);
+    const PlanarSeparator reconstruction =
+        warm_system.solve(stencil.lvira_neighborhood, stencil.initial_guess);
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      EXPECT_NEAR(reconstruction[0].normal()[d], plane.normal()[d], 1.0e-4);
+    }
+    if (step > 0) {
+      cold_iterations += cold_system.getIterationCount();
+      warm_iterations += warm_system.getIterationCount();
+    }
+  }
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_LT(warm_iterations, cold_iterations);
+}
+
+TEST(ReconstructionWarmStartCache, R2PAcrossTimeSteps) {
+  static constexpr UnsignedIndex_t number_of_steps = 10;
+  ReconstructionWarmStartCache cache;
+  UnsignedIndex_t cold_iterations = 0;
+  UnsignedIndex_t warm_iterations = 0;
+  for (UnsignedIndex_t step = 0; step < number_of_steps; ++step) {
+    const Plane plane = movingPlane(step);
+    const Stencil stencil(plane);
+
+    R2P_3D1P<RectangularCuboid> cold_system;
+    cold_system.solve(stencil.r2p_neighborhood, stencil.initial_guess);
+    R2P_3D1P<RectangularCuboid> warm_system;
+    warm_system.setWarmStartCache(&cache, 7);
+    const PlanarSeparator reconstruction =
+        warm_system.solve(stencil.r2p_neighborhood, stencil.initial_guess);
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      EXPECT_NEAR(reconstruction[0].normal()[d], plane.normal()[d], 1.0e-3);
+    }
+    if (step > 0) {
+      cold_iterations += cold_system.getIterationCount();
+      warm_iterations += warm_system.getIterationCount();
+    }
+  }
+  EXPECT_LT(warm_iterations, cold_iterations);
+}
+
+TEST(ReconstructionWarmStartCache, Eviction) {
+  ReconstructionWarmStartCache cache;
+  const Stencil stencil(movingPlane(0));
+  reconstructionWithLVIRA3D(stencil.lvira_neighborhood, stencil.initial_guess,
+                            &cache, 3);
+  ReconstructionWarmStart warm_start;
+  EXPECT_TRUE(cache.find(3, &warm_start));
+  EXPECT_EQ(warm_start.reconstruction.getNumberOfPlanes(), 1);
+  EXPECT_EQ(warm_start.jacobian_transpose.rows(),
+            static_cast<int>(LVIRA_3D_columns));
+
+  EXPECT_FALSE(cache.evictIfPure(3, 0.5));
+  EXPECT_TRUE(cache.find(3, &warm_start));
+  EXPECT_TRUE(cache.evictIfPure(3, 0.0));
+  EXPECT_FALSE(cache.find(3, &warm_start));
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(ReconstructionWarmStartCache, ConcurrentAccess) {
+  ReconstructionWarmStartCache cache;
+  static constexpr UnsignedIndex_t number_of_threads = 4;
+  static constexpr UnsignedIndex_t cells_per_thread = 500;
+  std::vector<std::thread> threads;
+  for (UnsignedIndex_t t = 0; t < number_of_threads; ++t) {
+    threads.emplace_back([&cache, t]() {
+      for (UnsignedIndex_t n = 0; n < cells_per_thread; ++n) {
+        const LargeOffsetIndex_t cell = t * cells_per_thread + n;
+        ReconstructionWarmStart warm_start;
+        warm_start.reconstruction = PlanarSeparator::fromOnePlane(
+            Plane(Normal(1.0, 0.0, 0.0), static_cast<double>(cell)));
+        warm_start.lambda = static_cast<double>(cell);
+        cache.store(cell, warm_start);
+        // Read a cell another thread may be writing.
+        cache.find((cell + cells_per_thread) %
+                       (number_of_threads * cells_per_thread),
+                   &warm_start);
+        if (n % 2 == 1) {
+          cache.evict(cell);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(cache.size(), number_of_threads * cells_per_thread / 2);
+  ReconstructionWarmStart warm_start;
+  ASSERT_TRUE(cache.find(2, &warm_start));
+  EXPECT_DOUBLE_EQ(warm_start.lambda, 2.0);
+  EXPECT_DOUBLE_EQ(warm_start.reconstruction[0].distance(), 2.0);
+  EXPECT_FALSE(cache.find(3, &warm_start));
+}
+
+}  // namespace
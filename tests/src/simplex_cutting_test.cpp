@@ -12,8 +12,13 @@
 #include "gtest/gtest.h"
 
 #include <algorithm>
+#include <random>
 
+#include "irl/generic_cutting/analytic/tet.h"
+#include "irl/geometry/polyhedrons/polyhedron_24.h"
 #include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/geometry/polyhedrons/tet.h"
+#include "irl/planar_reconstruction/localized_separator.h"
 
 namespace {
 
@@ -33,4 +38,101 @@ TEST(SimplexCutting, SplitTest) {
   EXPECT_NEAR(volume_moments.centroid()[2], -10.25, 1.0e-15);
 }
 
+// Every cutting case of a single tet, in both orientations and with
+// planes passing exactly through vertices.
+TEST(SimplexCutting, MultiTetKernelCases) {
+  const std::array<Pt, 4> vertices{{Pt(0.1, -0.2, 0.0), Pt(1.0, 0.1, 0.2),
+                                    Pt(0.2, 0.9, -0.1), Pt(0.3, 0.2, 1.1)}};
+  const std::array<Tet, 2> tets{{Tet({vertices[0], vertices[1], vertices[2],
+                                      vertices[3]}),
+                                  Tet({vertices[1], vertices[0], vertices[2],
+                                       vertices[3]})}};
+  std::mt19937_64 eng(7);
+  std::uniform_real_distribution<double> random_normal(-1.0, 1.0);
+  std::uniform_real_distribution<double> random_offset(-0.6, 0.6);
+  for (const auto& tet : tets) {
+    for (UnsignedIndex_t n = 0; n < 500; ++n) {
+      const Normal normal = Normal::normalized(
+          random_normal(eng), random_normal(eng), random_normal(eng));
+      const double distance = n % 5 == 0
+                                  ? normal * vertices[n % 4]
+                                  : normal * tet.calculateCentroid() +
+                                        random_offset(eng);
+      const Plane plane(normal, distance);
+      const auto simplex_moments =
+          getVolumeMoments<VolumeMoments, SimplexCutting>(
+              tet, PlanarSeparator::fromOnePlane(plane));
+      const auto analytic_moments = getAnalyticVolumeMoments(tet, plane);
+      EXPECT_NEAR(simplex_moments.volume(), analytic_moments.volume(),
+                  1.0e-14);
+      for (UnsignedIndex_t d = 0; d < 3; ++d) {
+        EXPECT_NEAR(simplex_moments.centroid()[d],
+                    analytic_moments.centroid()[d], 1.0e-14);
+      }
+    }
+  }
+}
+
+// Many tets at once, with partial blocks, two-plane separators and
+// localizers.
+TEST(SimplexCutting, MultiTetKernelMatchesHalfEdgeCutting) {
+  std::mt19937_64 eng(19);
+  std::uniform_real_distribution<double> random_normal(-1.0, 1.0);
+  std::uniform_real_distribution<double> random_offset(-0.2, 0.2);
+  std::uniform_real_distribution<double> random_perturbation(-0.05, 0.05);
+  // Cube vertices followed by one point per face.
+  const std::array<Pt, 14> vertices{
+      {Pt(0.5, -0.5, -0.5), Pt(0.5, 0.5, -0.5), Pt(0.5, 0.5, 0.5),
+       Pt(0.5, -0.5, 0.5), Pt(-0.5, -0.5, -0.5), Pt(-0.5, 0.5, -0.5),
+       Pt(-0.5, 0.5, 0.5), Pt(-0.5, -0.5, 0.5), Pt(0.5, 0.0, 0.0),
+       Pt(0.0, 0.0, -0.5), Pt(0.0, 0.5, 0.0), Pt(0.0, 0.0, 0.5),
+       Pt(0.0, -0.5, 0.0), Pt(-0.5, 0.0, 0.0)}};
+  auto random_plane = [&]() {
+    const Normal normal = Normal::normalized(
+        random_normal(eng), random_normal(eng), random_normal(eng));
+    return Plane(normal, random_offset(eng));
+  };
+  PlanarLocalizer localizer;
+  localizer.setNumberOfPlanes(2);
+  localizer[0] = Plane(Normal(1.0, 0.0, 0.0), 0.3);
+  localizer[1] = Plane(Normal(0.0, -1.0, 0.0), 0.25);
+
+  for (UnsignedIndex_t n = 0; n < 200; ++n) {
+    Polyhedron24 polyhedron;
+    for (UnsignedIndex_t v = 0; v < 14; ++v) {
+      polyhedron[v] =
+          vertices[v] + Pt(random_perturbation(eng), random_perturbation(eng),
+                           random_perturbation(eng));
+    }
+    const PlanarSeparator separator =
+        n % 3 == 0 ? PlanarSeparator::fromTwoPlanes(
+                         random_plane(), random_plane(), n % 2 ? 1.0 : -1.0)
+                   : PlanarSeparator::fromOnePlane(random_plane());
+    const auto simplex_volume =
+        getVolumeMoments<Volume, SimplexCutting>(polyhedron, separator);
+    const auto half_edge_volume =
+        getVolumeMoments<Volume, HalfEdgeCutting>(polyhedron, separator);
+    EXPECT_NEAR(simplex_volume, half_edge_volume, 1.0e-13);
+
+    // Each truncation adds vertices, so keep the total number of planes
+    // within what a decomposed Polyhedron24 can store.
+    const PlanarSeparator one_plane_separator =
+        PlanarSeparator::fromOnePlane(separator[0]);
+    const LocalizedSeparator localized_separator(&localizer,
+                                                 &one_plane_separator);
+    const auto simplex_moments =
+        getVolumeMoments<VolumeMoments, SimplexCutting>(polyhedron,
+                                                        localized_separator);
+    const auto half_edge_moments =
+        getVolumeMoments<VolumeMoments, HalfEdgeCutting>(polyhedron,
+                                                         localized_separator);
+    EXPECT_NEAR(simplex_moments.volume(), half_edge_moments.volume(),
+                1.0e-13);
+    for (UnsignedIndex_t d = 0; d < 3; ++d) {
+      EXPECT_NEAR(simplex_moments.centroid()[d],
+                  half_edge_moments.centroid()[d], 1.0e-13);
+    }
+  }
+}
+
 }  // namespace
@@ -0,0 +1,132 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/helpers/telemetry.h"
+
+#include <sstream>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "irl/generic_cutting/generic_cutting.h"
+#include "irl/geometry/polyhedrons/hexahedron.h"
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/interface_reconstruction_methods/reconstruction_interface.h"
+#include "irl/interface_reconstruction_methods/volume_fraction_matching.h"
+#include "irl/moments/volume_moments.h"
+#include "irl/planar_reconstruction/localized_separator_link.h"
+
+namespace {
+
+using namespace IRL;
+
+const Hexahedron cube({Pt(0.5, -0.5, -0.5), Pt(0.5, 0.5, -0.5),
+                       Pt(0.5, 0.5, 0.5), Pt(0.5, -0.5, 0.5),
+                       Pt(-0.5, -0.5, -0.5), Pt(-0.5, 0.5, -0.5),
+                       Pt(-0.5, 0.5, 0.5), Pt(-0.5, -0.5, 0.5)});
+
+double cutCube(const double a_distance) {
+  const auto reconstruction = PlanarSeparator::fromOnePlane(
+      Plane(Normal::normalized(1.0, 0.3, -0.2), a_distance));
+  return getVolumeMoments<VolumeMoments, HalfEdgeCutting>(cube,
+                                                          reconstruction)
+      .volume();
+}
+
+TEST(Telemetry, CountsHotPaths) {
+  resetTelemetry();
+
+  EXPECT_GT(cutCube(0.1), 0.0);
+
+  const auto two_planes = PlanarSeparator::fromTwoPlanes(
+      Plane(Normal::normalized(1.0, 0.2, 0.0), 0.1),
+      Plane(Normal::normalized(-1.0, 0.1, 0.0), 0.1), 1.0);
+  EXPECT_GT((getVolumeMoments<VolumeMoments, SimplexCutting>(cube, two_planes)
+                 .volume()),
+            0.0);
+
+  PlanarLocalizer left_localizer = unit_cell.getLocalizer();
+  PlanarLocalizer right_localizer = unit_cell.getLocalizer();
+  left_localizer[0] = Plane(Normal(1.0, 0.0, 0.0), 0.5);
+  right_localizer[1] = Plane(Normal(-1.0, 0.0, 0.0), -0.5);
+  PlanarSeparator separator = PlanarSeparator::fromOnePlane(
+      Plane(Normal(0.0, 0.0, 1.0), 0.0));
+  LocalizedSeparatorLink left(&left_localizer, &separator);
+  LocalizedSeparatorLink right(&right_localizer, &separator);
+  left.setId(0);
+  right.setId(1);
+  left.setEdgeConnectivity(0, &right);
+  right.setEdgeConnectivity(1, &left);
+  const auto flux = RectangularCuboid::fromBoundingPts(Pt(0.0, -0.5, -0.5),
+                                                       Pt(1.0, 0.5, 0.5));
+  EXPECT_NEAR((getVolumeMoments<Volume, HalfEdgeCutting>(flux, left)), 0.5,
+              1.0e-14);
+
+  auto reconstruction = two_planes;
+  setDistanceToMatchVolumeFraction(unit_cell, 0.3, &reconstruction, 1.0e-12);
+
+  const auto correct_svm =
+      getNormalizedVolumeMoments<SeparatedMoments<VolumeMoments>>(
+          unit_cell, PlanarSeparator::fromOnePlane(
+                         Plane(Normal::normalized(0.3, 0.6, 0.2), 0.05)));
+  reconstructionWithMOF3D(unit_cell, correct_svm);
+
+  const auto report = getTelemetryReport();
+  if (!telemetry_enabled) {
+    for (UnsignedIndex_t n = 0; n < telemetry_counters; ++n) {
+      EXPECT_EQ(report.counters[n], 0u);
+    }
+    for (UnsignedIndex_t n = 0; n < telemetry_timers; ++n) {
+      EXPECT_EQ(report.timer_calls[n], 0u);
+      EXPECT_EQ(report.timer_ticks[n], 0u);
+    }
+    return;
+  }
+  EXPECT_GT(report.count(TelemetryCounter::HalfEdgePolytopeBuilds), 0u);
+  EXPECT_GT(report.count(TelemetryCounter::PlaneClips), 0u);
+  EXPECT_EQ(report.count(TelemetryCounter::LinkTraversals), 2u);
+  EXPECT_GT(report.count(TelemetryCounter::SimplexDecompositions), 0u);
+  EXPECT_GT(report.count(TelemetryCounter::DistanceSolverIterations), 0u);
+  EXPECT_GT(report.count(TelemetryCounter::LevenbergMarquardtIterations), 0u);
+  EXPECT_GT(report.calls(TelemetryTimer::Cutting), 3u);
+  EXPECT_GT(report.ticks(TelemetryTimer::Cutting), 0u);
+  EXPECT_GT(report.calls(TelemetryTimer::DistanceSolver), 0u);
+  EXPECT_EQ(report.calls(TelemetryTimer::LevenbergMarquardt), 1u);
+  EXPECT_EQ(report.calls(TelemetryTimer::BFGS), 0u);
+
+  std::ostringstream out;
+  out << report;
+  EXPECT_NE(out.str().find("PlaneClips"), std::string::npos);
+}
+
+TEST(Telemetry, KeepsCountsOfExitedThreads) {
+  resetTelemetry();
+  const auto before = getTelemetryReport();
+  EXPECT_GT(cutCube(0.1), 0.0);
+  // Different cuts, so that none of the calls can be merged.
+  double worker_volume = 0.0;
+  std::thread worker(
+      [&worker_volume]() { worker_volume = cutCube(0.0) + cutCube(0.2); });
+  worker.join();
+  EXPECT_GT(worker_volume, 0.0);
+  const auto after = getTelemetryReport();
+  if (!telemetry_enabled) {
+    EXPECT_EQ(after.calls(TelemetryTimer::Cutting), 0u);
+    return;
+  }
+  EXPECT_EQ(before.calls(TelemetryTimer::Cutting), 0u);
+  EXPECT_EQ(after.calls(TelemetryTimer::Cutting), 3u);
+  EXPECT_EQ(after.count(TelemetryCounter::HalfEdgePolytopeBuilds), 3u);
+  EXPECT_GT(after.number_of_threads, before.number_of_threads);
+
+  resetTelemetry();
+  EXPECT_EQ(getTelemetryReport().calls(TelemetryTimer::Cutting), 0u);
+}
+
+}  // namespace
@@ -0,0 +1,169 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/parameters/tolerance_context.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "irl/geometry/polyhedrons/rectangular_cuboid.h"
+#include "irl/helpers/work_stealing_thread_pool.h"
+#include "irl/interface_reconstruction_methods/volume_fraction_matching.h"
+#include "irl/planar_reconstruction/planar_separator.h"
+
+namespace {
+
+using namespace IRL;
+
+// Whether a plane was fit for a volume fraction of 1.0e-4, or the cell
+// was treated as empty.
+bool fitsSmallVolumeFraction(void) {
+  PlanarSeparator separator = PlanarSeparator::fromOnePlane(
+      Plane(Normal::normalized(0.2, 0.1, 1.0), 0.0));
+  setDistanceToMatchVolumeFraction(unit_cell, 1.0e-4, &separator);
+  return separator[0].normal().calculateMagnitude() > 0.5;
+}
+
+TEST(ToleranceContext, DefaultsToGlobalConstants) {
+  EXPECT_EQ(getInstalledToleranceContext(), nullptr);
+  EXPECT_EQ(getVolumeFractionLow(), global_constants::VF_LOW);
+  EXPECT_EQ(getVolumeFractionHigh(), global_constants::VF_HIGH);
+  EXPECT_EQ(getVolumeFractionTolerance(),
+            global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);
+  EXPECT_EQ(getMinimumVolumeToTrack(),
+            global_constants::MINIMUM_VOLUME_TO_TRACK);
+  EXPECT_EQ(getMinimumSurfaceAreaToTrack(),
+            global_constants::MINIMUM_SURFACE_AREA_TO_TRACK);
+
+  const ToleranceContext context;
+  EXPECT_EQ(context.volumeFractionLow(), global_constants::VF_LOW);
+  EXPECT_EQ(context.volumeFractionHigh(), global_constants::VF_HIGH);
+  EXPECT_EQ(context.volumeFractionTolerance(),
+            global_constants::TWO_PLANE_DISTANCE_VOLUME_FRACTION_TOLERANCE);
+}
+
+TEST(ToleranceContext, Setters) {
+  ToleranceContext context;
+  context.setVolumeFractionBounds(1.0e-3);
+  EXPECT_EQ(context.volumeFractionLow(), 1.0e-3);
+  EXPECT_EQ(context.volumeFractionHigh(), 1.0 - 1.0e-3);
+  context.setVolumeFractionTolerance(0.1);
+  EXPECT_EQ(context.volumeFractionTolerance(), 1.0e-3);
+  context.setVolumeFractionTolerance(1.0e-6);
+  EXPECT_EQ(context.volumeFractionTolerance(), 1.0e-6);
+  context.setMinimumVolumeToTrack(1.0e-10);
+  context.setMinimumSurfaceAreaToTrack(1.0e-7);
+  EXPECT_EQ(context.minimumVolumeToTrack(), 1.0e-10);
+  EXPECT_EQ(context.minimumSurfaceAreaToTrack(), 1.0e-7);
+  // The globals are untouched.
+  EXPECT_NE(global_constants::VF_LOW, 1.0e-3);
+}
+
+TEST(ToleranceContext, ScopesNest) {
+  ToleranceContext coarse;
+  coarse.setVolumeFractionBounds(1.0e-3);
+  ToleranceContext fine;
+  fine.setVolumeFractionBounds(1.0e-6);
+  EXPECT_TRUE(fitsSmallVolumeFraction());
+  {
+    ScopedToleranceContext coarse_scope(coarse);
+    EXPECT_EQ(getVolumeFractionLow(), 1.0e-3);
+    EXPECT_FALSE(fitsSmallVolumeFraction());
+    {
+      ScopedToleranceContext fine_scope(fine);
+      EXPECT_EQ(getInstalledToleranceContext(), &fine);
+      EXPECT_TRUE(fitsSmallVolumeFraction());
+    }
+    EXPECT_EQ(getInstalledToleranceContext(), &coarse);
+    EXPECT_FALSE(fitsSmallVolumeFraction());
+  }
+  EXPECT_EQ(getInstalledToleranceContext(), nullptr);
+}
+
+TEST(ToleranceContext, ExplicitContext) {
+  ToleranceContext coarse;
+  coarse.setVolumeFractionBounds(1.0e-3);
+  PlanarSeparator separator = PlanarSeparator::fromOnePlane(
+      Plane(Normal::normalized(0.2, 0.1, 1.0), 0.0));
+  setDistanceToMatchVolumeFraction(unit_cell, 1.0e-4, &separator, coarse);
+  EXPECT_EQ(separator[0].normal().calculateMagnitude(), 0.0);
+  EXPECT_EQ(getInstalledToleranceContext(), nullptr);
+
+  separator = PlanarSeparator::fromOnePlane(
+      Plane(Normal::normalized(0.2, 0.1, 1.0), 0.0));
+  cleanReconstruction(unit_cell, 0.5, &separator, coarse);
+  EXPECT_EQ(separator.getNumberOfPlanes(), 1u);
+  EXPECT_EQ(getInstalledToleranceContext(), nullptr);
+}
+
+TEST(ToleranceContext, ThreadsUseTheirOwnContext) {
+  ToleranceContext coarse;
+  coarse.setVolumeFractionBounds(1.0e-3);
+  ToleranceContext fine;
+  fine.setVolumeFractionBounds(1.0e-6);
+  bool coarse_fits = true;
+  bool fine_fits = false;
+  auto run = [](const ToleranceContext* a_context, bool* a_fits,
+                const bool a_expected) {
+    ScopedToleranceContext scope(*a_context);
+    for (UnsignedIndex_t n = 0; n < 1000; ++n) {
+      *a_fits = fitsSmallVolumeFraction();
+      if (*a_fits != a_expected) {
+        return;
+      }
+    }
+  };
+  std::thread coarse_thread(run, &coarse, &coarse_fits, false);
+  std::thread fine_thread(run, &fine, &fine_fits, true);
+  coarse_thread.join();
+  fine_thread.join();
+  EXPECT_FALSE(coarse_fits);
+  EXPECT_TRUE(fine_fits);
+  EXPECT_EQ(getInstalledToleranceContext(), nullptr);
+}
+
+TEST(ToleranceContext, ThreadPoolUsesCallersContext) {
+  ToleranceContext coarse;
+  coarse.setVolumeFractionBounds(1.0e-3);
+  WorkStealingThreadPool pool(4);
+  static constexpr UnsignedIndex_t size = 400;
+  std::vector<const ToleranceContext*> contexts(size);
+  std::vector<char> fits(size);
+  std::vector<UnsignedIndex_t> threads(size);
+  auto body = [&](const UnsignedIndex_t a_index,
+                  const UnsignedIndex_t a_thread) {
+    // Slow enough that every thread takes part.
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    threads[a_index] = a_thread;
+    contexts[a_index] = getInstalledToleranceContext();
+    fits[a_index] = fitsSmallVolumeFraction();
+  };
+  {
+    ScopedToleranceContext scope(coarse);
+    pool.parallelFor(size, 1, body);
+  }
+  EXPECT_GT(*std::max_element(threads.begin(), threads.end()), 0);
+  for (UnsignedIndex_t n = 0; n < size; ++n) {
+    EXPECT_EQ(contexts[n], &coarse);
+    EXPECT_FALSE(fits[n]);
+  }
+
+  // Workers do not keep the context once the caller no longer has it.
+  pool.parallelFor(size, 1, body);
+  for (UnsignedIndex_t n = 0; n < size; ++n) {
+    EXPECT_EQ(contexts[n], nullptr);
+    EXPECT_TRUE(fits[n]);
+  }
+}
+
+}  // namespace
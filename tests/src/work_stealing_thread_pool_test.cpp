@@ -0,0 +1,79 @@
+// This file is part of the Interface Reconstruction Library (IRL),
+// a library for interface reconstruction and computational geometry operations.
+//
+// Copyright (C) 2019 Robert Chiodi <robert.chiodi@gmail.com>
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "irl/helpers/work_stealing_thread_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace IRL;
+
+TEST(WorkStealingThreadPool, EveryIndexOnce) {
+  WorkStealingThreadPool pool(4);
+  EXPECT_EQ(pool.getNumberOfThreads(), 4);
+  for (const UnsignedIndex_t size : {0u, 1u, 3u, 1000u, 4097u}) {
+    std::vector<std::atomic<int>> visits(size);
+    for (auto& visit : visits) {
+      visit = 0;
+    }
+    pool.parallelFor(size, 7,
+                     [&visits](const UnsignedIndex_t a_index,
+                               const UnsignedIndex_t a_thread) {
+                       EXPECT_LT(a_thread, 4);
+                       visits[a_index].fetch_add(1);
+                     });
+    for (const auto& visit : visits) {
+      EXPECT_EQ(visit.load(), 1);
+    }
+  }
+}
+
+TEST(WorkStealingThreadPool, StealsUnevenWork) {
+  static constexpr UnsignedIndex_t number_of_threads = 4;
+  WorkStealingThreadPool pool(number_of_threads);
+  // All expensive work is initially given to the first thread.
+  static constexpr UnsignedIndex_t size = 400;
+  std::vector<UnsignedIndex_t> executed_by(size);
+  pool.parallelFor(size, 1,
+                   [&executed_by](const UnsignedIndex_t a_index,
+                                  const UnsignedIndex_t a_thread) {
+                     if (a_index < size / number_of_threads) {
+                       std::this_thread::sleep_for(
+                           std::chrono::microseconds(200));
+                     }
+                     executed_by[a_index] = a_thread;
+                   });
+  std::set<UnsignedIndex_t> threads_in_first_range(
+      executed_by.begin(), executed_by.begin() + size / number_of_threads);
+  EXPECT_GT(threads_in_first_range.size(), 1);
+}
+
+TEST(WorkStealingThreadPool, SingleThreadRunsInline) {
+  WorkStealingThreadPool pool(1);
+  const auto caller = std::this_thread::get_id();
+  UnsignedIndex_t count = 0;
+  pool.parallelFor(
+      10, 3, [&](const UnsignedIndex_t a_index, const UnsignedIndex_t a_thread) {
+        EXPECT_EQ(a_thread, 0);
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        // Indices are run in order on the calling thread.
+        EXPECT_EQ(a_index, count);
+        ++count;
+      });
+  EXPECT_EQ(count, 10);
+}
+
+}  // namespace